@@ -164,6 +164,7 @@
  *  - uint64_t
  *  - float32_t
  *  - float64_t
+ *  - one-byte sequential strings (passed as const FastOneByteString&)
  *
  * The 64-bit integer types currently have the IDL (unsigned) long long
  * semantics: https://heycam.github.io/webidl/#abstract-opdef-converttoint
@@ -258,6 +259,7 @@ class CTypeInfo {
                  // actual type. It's currently used by the arm64 simulator
                  // and can be added to the other simulators as well when fast
                  // calls having both GP and FP params need to be supported.
+    kSeqOneByteString,
   };
 
   // kCallbackOptionsType is not part of the Type enum
@@ -321,6 +323,14 @@ class CTypeInfo {
   Flags flags_;
 };
 
+// A view on the characters of a sequential one-byte string that is passed to
+// a fast API call without copying. The characters are not null-terminated and
+// are only valid for the duration of the call.
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
 struct FastApiTypedArrayBase {
  public:
   // Returns the length in number of elements.
@@ -435,6 +445,7 @@ struct AnyCType {
     const FastApiTypedArray<uint64_t>* uint64_ta_value;
     const FastApiTypedArray<float>* float_ta_value;
     const FastApiTypedArray<double>* double_ta_value;
+    const FastOneByteString* string_value;
     FastApiCallbackOptions* options_value;
   };
 };
@@ -713,6 +724,18 @@ struct TypeInfoHelper<v8::Local<v8::Uint32Array>> {
   }
 };
 
+template <>
+struct TypeInfoHelper<const FastOneByteString&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() {
+    return CTypeInfo::Type::kSeqOneByteString;
+  }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kScalar;
+  }
+};
+
 template <>
 struct TypeInfoHelper<FastApiCallbackOptions&> {
   static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
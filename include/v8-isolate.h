@@ -784,6 +784,22 @@ class V8_EXPORT Isolate {
   bool GetHeapObjectStatisticsAtLastGC(HeapObjectStatistics* object_statistics,
                                        size_t type_index);
 
+  /**
+   * Get statistics about objects in the heap that were estimated by sampling
+   * during concurrent marking of the previous full GC. Unlike
+   * GetHeapObjectStatisticsAtLastGC() this does not require the gc_stats
+   * tracing category and does not add a pause, but the counts are
+   * approximations. Sampling is enabled with
+   * --concurrent-marking-object-stats-sample-rate.
+   *
+   * \param object_statistics The HeapObjectStatistics object to fill in.
+   * \param type_index The index of the type of object to fill details about,
+   *   which ranges from 0 to NumberOfTrackedHeapObjectTypes() - 1.
+   * \returns true if statistics were sampled for the type.
+   */
+  bool GetSampledHeapObjectStatisticsAtLastGC(
+      HeapObjectStatistics* object_statistics, size_t type_index);
+
   /**
    * Get statistics about code and its metadata in the heap.
    *
@@ -1366,6 +1382,15 @@ class V8_EXPORT Isolate {
    */
   void SetRAILMode(RAILMode rail_mode);
 
+  /**
+   * Optional notification to tell V8 the maximum time in milliseconds that a
+   * single incremental marking step may spend on the isolate's thread. Smaller
+   * budgets bound GC pauses during incremental marking at the cost of marking
+   * making less progress per step, which may result in a larger heap. A budget
+   * of 0 restores the default heuristics.
+   */
+  void SetGCPauseBudget(double budget_in_ms);
+
   /**
    * Update load start time of the RAIL mode
    */
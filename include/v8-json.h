@@ -6,11 +6,13 @@
 #define INCLUDE_V8_JSON_H_
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class OutputStream;
 class Value;
 class String;
 
@@ -40,6 +42,22 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Like Stringify, but writes the result to |stream| as UTF-8, in chunks of
+   * stream->GetChunkSize() bytes, instead of creating a string. Only a
+   * bounded amount of the output is held in memory at any time.
+   * EndOfStream() is called once the whole result has been written.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream receiving the UTF-8 encoded output.
+   * \return Nothing if an exception was thrown, in which case part of the
+   *   output may already have been written, false if |json_object| does not
+   *   serialize to a JSON text or the stream aborted, true otherwise.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyTo(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
 };
 
 }  // namespace v8
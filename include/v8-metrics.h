@@ -85,6 +85,11 @@ struct GarbageCollectionYoungCycle {
   double collection_rate_in_percent = -1.0;
   double efficiency_in_bytes_per_us = -1.0;
   double main_thread_efficiency_in_bytes_per_us = -1.0;
+  // Young generation objects before and after the cycle. Promoted objects are
+  // not part of bytes_after; they are reported in promoted_bytes instead.
+  GarbageCollectionSizes objects;
+  // Bytes of surviving objects that were moved to the old generation.
+  int64_t promoted_bytes = -1;
 #if defined(CPPGC_YOUNG_GENERATION)
   GarbageCollectionPhases total_cpp;
   GarbageCollectionSizes objects_cpp;
@@ -688,6 +688,20 @@ class V8_EXPORT Object : public Value {
                            Local<Name>* names, Local<Value>* values,
                            size_t length);
 
+  /**
+   * Creates a JavaScript object with the initial Object.prototype and the
+   * given properties, like an object literal would. Unlike the overload
+   * above, which creates a dictionary-mode object, the properties are stored
+   * in fast in-object fields when there are not too many of them. Objects
+   * created with the same |names| in the same order share their hidden
+   * class, so this is meant for instantiating many objects of one shape,
+   * e.g. when converting rows of native data.
+   * All properties will be created as enumerable, configurable
+   * and writable properties.
+   */
+  static Local<Object> New(Isolate* isolate, Local<Name>* names,
+                           Local<Value>* values, size_t length);
+
   V8_INLINE static Object* Cast(Value* obj);
 
   /**
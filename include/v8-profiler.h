@@ -781,6 +781,13 @@ class V8_EXPORT AllocationProfile {
      * what samples were added or removed between two snapshots.
      */
     uint64_t sample_id;
+
+    /**
+     * The number of garbage collections that the sampled object has survived
+     * so far. Samples that keep surviving are the long-lived allocations,
+     * which makes them the first place to look for sources of memory growth.
+     */
+    uint32_t survived_gc_count;
   };
 
   /**
@@ -497,6 +497,16 @@ class V8_EXPORT ScriptCompiler {
 
     void Run();
 
+    /**
+     * Provides the source text and origin of the script to the task, which
+     * must be called on the main thread. If the script is already in the
+     * Isolate's compilation cache, the cached data does not need to be
+     * deserialized, and a Run() which has not started yet returns without
+     * doing so. The compile call consuming this task is unchanged.
+     */
+    void SourceTextAvailable(Isolate* isolate, Local<String> source_text,
+                             const ScriptOrigin& origin);
+
    private:
     friend class ScriptCompiler;
 
@@ -680,6 +690,20 @@ class V8_EXPORT ScriptCompiler {
   static CachedData* CreateCodeCache(
       Local<UnboundModuleScript> unbound_module_script);
 
+  /**
+   * Returns true if a code cache created now for the specified
+   * unbound_script would contain functions that are not compiled in
+   * cached_data, e.g. because they were compiled lazily after cached_data
+   * was produced, or if cached_data would be rejected for unbound_script.
+   * This is much cheaper than CreateCodeCache, so embedders can use it to
+   * avoid regenerating a code cache that would not change.
+   */
+  static bool CodeCacheNeedsUpdate(Local<UnboundScript> unbound_script,
+                                   const CachedData* cached_data);
+  static bool CodeCacheNeedsUpdate(
+      Local<UnboundModuleScript> unbound_module_script,
+      const CachedData* cached_data);
+
   /**
    * Creates and returns code cache for the specified function that was
    * previously produced by CompileFunction.
@@ -133,6 +133,17 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the number of bytes of reserved heap memory that V8 advised the
+   * OS to back with transparent huge pages. Whether the memory is actually
+   * backed by huge pages is up to the OS. This is only non-zero with
+   * --transparent-huge-pages on platforms that support it. Memory shared
+   * between isolates of the process is included in the value of each of them.
+   */
+  size_t total_huge_page_advised_size() {
+    return total_huge_page_advised_size_;
+  }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -154,6 +165,7 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_detached_contexts_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
+  size_t total_huge_page_advised_size_;
 
   friend class V8;
   friend class Isolate;
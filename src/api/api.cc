@@ -9,6 +9,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>  // For move
 #include <vector>
 
@@ -28,8 +29,10 @@
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
 #include "src/api/api-natives.h"
+#include "src/base/bits.h"
 #include "src/base/functional.h"
 #include "src/base/logging.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/safe_conversions.h"
@@ -122,6 +125,7 @@
 #include "src/snapshot/startup-serializer.h"  // For SerializedHandleChecker.
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/utils/detachable-vector.h"
@@ -364,30 +368,154 @@ namespace {
 #ifdef V8_SANDBOXED_POINTERS
 // ArrayBufferAllocator to use when sandboxed pointers are used in which case
 // all ArrayBuffer backing stores need to be allocated inside the sandbox.
-// Note, the current implementation is extremely inefficient as it uses the
-// BoundedPageAllocator. In the future, we'll need a proper allocator
-// implementation.
+// Large backing stores get their own pages from the BoundedPageAllocator.
+// Small ones are carved out of larger chunks and recycled through per size
+// class free lists, since giving each of them at least one page is both slow
+// and wasteful. Every chunk serves a single size class and goes back to the
+// page allocator once all of its blocks have been freed.
 class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
  public:
-  ArrayBufferAllocator() { CHECK(page_allocator_); }
+  ArrayBufferAllocator() {
+    CHECK(page_allocator_);
+    CHECK(base::bits::IsPowerOfTwo(chunk_size_));
+  }
+
+  ~ArrayBufferAllocator() override {
+    for (const auto& chunk : chunks_) {
+      page_allocator_->FreePages(reinterpret_cast<void*>(chunk.first),
+                                 chunk_size_);
+    }
+  }
 
   void* Allocate(size_t length) override {
-    return page_allocator_->AllocatePages(nullptr, RoundUp(length, page_size_),
-                                          page_size_,
-                                          PageAllocator::kReadWrite);
+    if (length > kMaxPooledSize) return AllocatePages(length, page_size_);
+    bool is_zeroed;
+    void* data = AllocatePooled(length, &is_zeroed);
+    if (data != nullptr && !is_zeroed) memset(data, 0, length);
+    return data;
   }
 
   void* AllocateUninitialized(size_t length) override {
-    return Allocate(length);
+    if (length > kMaxPooledSize) return AllocatePages(length, page_size_);
+    bool is_zeroed;
+    return AllocatePooled(length, &is_zeroed);
   }
 
   void Free(void* data, size_t length) override {
-    page_allocator_->FreePages(data, RoundUp(length, page_size_));
+    if (length > kMaxPooledSize) {
+      page_allocator_->FreePages(data, RoundUp(length, page_size_));
+      return;
+    }
+    base::MutexGuard guard(&mutex_);
+    const uintptr_t chunk_start = ChunkStart(data);
+    auto it = chunks_.find(chunk_start);
+    DCHECK(it != chunks_.end());
+    ChunkInfo& chunk = it->second;
+    DCHECK_EQ(chunk.size_class, SizeClassIndex(length));
+    DCHECK_LT(0, chunk.live_blocks);
+    SizeClass& size_class = size_classes_[chunk.size_class];
+    if (--chunk.live_blocks > 0 || IsCurrentChunk(size_class, chunk_start)) {
+      size_class.free_list.push_back(data);
+      return;
+    }
+    // The chunk is empty and no longer bump-allocated from, so drop its
+    // blocks from the free list and hand the pages back.
+    std::vector<void*>& free_list = size_class.free_list;
+    free_list.erase(std::remove_if(free_list.begin(), free_list.end(),
+                                   [=](void* block) {
+                                     return ChunkStart(block) == chunk_start;
+                                   }),
+                    free_list.end());
+    chunks_.erase(it);
+    page_allocator_->FreePages(reinterpret_cast<void*>(chunk_start),
+                               chunk_size_);
   }
 
  private:
+  static constexpr size_t kMinPooledSize = 16;
+  static constexpr size_t kMaxPooledSize = 16 * i::KB;
+  static constexpr size_t kNumSizeClasses = 11;
+  STATIC_ASSERT(kMinPooledSize << (kNumSizeClasses - 1) == kMaxPooledSize);
+  static constexpr size_t kChunkSize = 256 * i::KB;
+
+  struct SizeClass {
+    // The free list lives outside of the sandbox on purpose: links stored in
+    // the freed blocks themselves could be corrupted from inside the sandbox
+    // to make later allocations return arbitrary memory.
+    std::vector<void*> free_list;
+    // The chunk new blocks of this size class are bump-allocated from.
+    uint8_t* top = nullptr;
+    uint8_t* end = nullptr;
+  };
+
+  struct ChunkInfo {
+    size_t size_class;
+    size_t live_blocks;
+  };
+
+  static size_t SizeClassIndex(size_t length) {
+    if (length <= kMinPooledSize) return 0;
+    return base::bits::WhichPowerOfTwo(
+               base::bits::RoundUpToPowerOfTwo(length)) -
+           base::bits::WhichPowerOfTwo(kMinPooledSize);
+  }
+
+  uintptr_t ChunkStart(void* block) const {
+    return RoundDown(reinterpret_cast<uintptr_t>(block), chunk_size_);
+  }
+
+  bool IsCurrentChunk(const SizeClass& size_class,
+                      uintptr_t chunk_start) const {
+    return size_class.end != nullptr &&
+           reinterpret_cast<uintptr_t>(size_class.end) - chunk_size_ ==
+               chunk_start;
+  }
+
+  void* AllocatePages(size_t length, size_t alignment) {
+    return page_allocator_->AllocatePages(nullptr, RoundUp(length, page_size_),
+                                          alignment,
+                                          PageAllocator::kReadWrite);
+  }
+
+  // Returns a block for {length} bytes and sets {is_zeroed} if the block has
+  // never been handed out before, in which case it still holds the zeroes of
+  // the freshly mapped chunk.
+  void* AllocatePooled(size_t length, bool* is_zeroed) {
+    const size_t index = SizeClassIndex(length);
+    base::MutexGuard guard(&mutex_);
+    SizeClass& size_class = size_classes_[index];
+    void* data;
+    if (!size_class.free_list.empty()) {
+      data = size_class.free_list.back();
+      size_class.free_list.pop_back();
+      *is_zeroed = false;
+    } else {
+      const size_t block_size = kMinPooledSize << index;
+      if (static_cast<size_t>(size_class.end - size_class.top) < block_size) {
+        // Chunks are aligned to their size so that Free() can find the chunk
+        // of a block by masking its address.
+        void* chunk = AllocatePages(chunk_size_, chunk_size_);
+        if (chunk == nullptr) return nullptr;
+        chunks_.emplace(reinterpret_cast<uintptr_t>(chunk),
+                        ChunkInfo{index, 0});
+        size_class.top = reinterpret_cast<uint8_t*>(chunk);
+        size_class.end = size_class.top + chunk_size_;
+      }
+      data = size_class.top;
+      size_class.top += block_size;
+      *is_zeroed = true;
+    }
+    chunks_[ChunkStart(data)].live_blocks++;
+    return data;
+  }
+
   PageAllocator* page_allocator_ = internal::GetArrayBufferPageAllocator();
   const size_t page_size_ = page_allocator_->AllocatePageSize();
+  const size_t chunk_size_ = RoundUp(kChunkSize, page_size_);
+
+  base::Mutex mutex_;
+  SizeClass size_classes_[kNumSizeClasses];
+  std::unordered_map<uintptr_t, ChunkInfo> chunks_;
 };
 
 #else
@@ -2721,6 +2849,20 @@ ScriptCompiler::ConsumeCodeCacheTask::~ConsumeCodeCacheTask() = default;
 
 void ScriptCompiler::ConsumeCodeCacheTask::Run() { impl_->Run(); }
 
+void ScriptCompiler::ConsumeCodeCacheTask::SourceTextAvailable(
+    Isolate* v8_isolate, Local<String> source_text,
+    const ScriptOrigin& origin) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  i::HandleScope scope(isolate);
+  i::Handle<i::String> str = Utils::OpenHandle(*(source_text));
+  i::ScriptDetails script_details =
+      GetScriptDetails(isolate, origin.ResourceName(), origin.LineOffset(),
+                       origin.ColumnOffset(), origin.SourceMapUrl(),
+                       origin.GetHostDefinedOptions(), origin.Options());
+  impl_->SourceTextAvailable(isolate, str, script_details);
+}
+
 ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
     Isolate* v8_isolate, std::unique_ptr<CachedData> cached_data) {
   if (!i::FLAG_concurrent_cache_deserialization) return nullptr;
@@ -2813,6 +2955,37 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
   return i::CodeSerializer::Serialize(shared);
 }
 
+namespace {
+
+bool CodeCacheNeedsUpdateImpl(i::Handle<i::SharedFunctionInfo> shared,
+                              const ScriptCompiler::CachedData* cached_data) {
+  ASSERT_NO_SCRIPT_NO_EXCEPTION(shared->GetIsolate());
+  DCHECK(shared->is_toplevel());
+  i::AlignedCachedData aligned_data(cached_data->data, cached_data->length);
+  return i::CodeSerializer::HasNewCompiledFunctions(shared, &aligned_data);
+}
+
+}  // namespace
+
+// static
+bool ScriptCompiler::CodeCacheNeedsUpdate(Local<UnboundScript> unbound_script,
+                                          const CachedData* cached_data) {
+  return CodeCacheNeedsUpdateImpl(
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script)),
+      cached_data);
+}
+
+// static
+bool ScriptCompiler::CodeCacheNeedsUpdate(
+    Local<UnboundModuleScript> unbound_module_script,
+    const CachedData* cached_data) {
+  return CodeCacheNeedsUpdateImpl(
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_module_script)),
+      cached_data);
+}
+
 ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
     Local<Function> function) {
   auto js_function =
@@ -3299,6 +3472,23 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyTo(Local<Context> context, Local<Value> json_object,
+                              OutputStream* stream, Local<String> gap) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, JSON, StringifyTo, Nothing<bool>(),
+           i::HandleScope);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::Object> replacer = isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result = i::JsonStringifyToStream(isolate, object, replacer,
+                                                gap_string, stream);
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -5583,21 +5773,20 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
     }
     // Write the characters to the stream.
     if (sizeof(Char) == 1) {
-      // Simply memcpy if we only have ASCII characters.
-      uint8_t char_mask = 0;
-      for (int i = read_index; i < up_to; i++) char_mask |= read_start[i];
-      if ((char_mask & 0x80) == 0) {
-        int copy_length = up_to - read_index;
+      while (read_index < up_to) {
+        // Simply memcpy runs of ASCII characters, which are found a word at a
+        // time.
+        int copy_length = i::NonAsciiStart(
+            reinterpret_cast<const uint8_t*>(read_start + read_index),
+            up_to - read_index);
         memcpy(current_write, read_start + read_index, copy_length);
         current_write += copy_length;
-        read_index = up_to;
-      } else {
-        for (; read_index < up_to; read_index++) {
-          current_write += unibrow::Utf8::EncodeOneByte(
-              current_write, static_cast<uint8_t>(read_start[read_index]));
-          DCHECK(write_capacity == -1 ||
-                 (current_write - write_start) <= write_capacity);
-        }
+        read_index += copy_length;
+        if (read_index == up_to) break;
+        current_write += unibrow::Utf8::EncodeOneByte(
+            current_write, static_cast<uint8_t>(read_start[read_index++]));
+        DCHECK(write_capacity == -1 ||
+               (current_write - write_start) <= write_capacity);
       }
     } else {
       for (; read_index < up_to; read_index++) {
@@ -6146,7 +6335,8 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      total_huge_page_advised_size_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -7116,6 +7306,34 @@ Local<v8::Object> v8::Object::New(Isolate* isolate,
   }
 }
 
+Local<v8::Object> v8::Object::New(Isolate* isolate, Local<Name>* names,
+                                  Local<Value>* values, size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  LOG_API(i_isolate, Object, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  // Start from the same map as an object literal with {length} properties.
+  // Adding the properties then follows (and on first use, creates) the
+  // transition tree rooted at that map, so objects with the same names end
+  // up sharing their map.
+  int number_of_properties = static_cast<int>(
+      std::min(length, static_cast<size_t>(i::JSObject::kMapCacheSize)));
+  i::Handle<i::Map> map = i_isolate->factory()->ObjectLiteralMapFromCache(
+      i_isolate->native_context(), number_of_properties);
+  i::Handle<i::JSObject> obj =
+      map->is_dictionary_map()
+          ? i_isolate->factory()->NewSlowJSObjectFromMap(
+                map, static_cast<int>(length))
+          : i_isolate->factory()->NewJSObjectFromMap(map);
+  for (size_t i = 0; i < length; ++i) {
+    i::Handle<i::Name> name = Utils::OpenHandle(*names[i]);
+    i::Handle<i::Object> value = Utils::OpenHandle(*values[i]);
+    // Cannot throw, since {obj} is an ordinary extensible object.
+    i::JSObject::DefinePropertyOrElementIgnoreAttributes(obj, name, value)
+        .Check();
+  }
+  return Utils::ToLocal(obj);
+}
+
 Local<v8::Value> v8::NumberObject::New(Isolate* isolate, double value) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
   LOG_API(i_isolate, NumberObject, New);
@@ -7356,6 +7574,23 @@ Local<v8::Array> v8::Array::New(Isolate* isolate, Local<Value>* elements,
       factory->NewJSArrayWithElements(result, i::PACKED_ELEMENTS, len));
 }
 
+Local<v8::Array> v8::Array::New(Isolate* isolate, const double* elements,
+                                size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Factory* factory = i_isolate->factory();
+  LOG_API(i_isolate, Array, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  int len = static_cast<int>(length);
+  if (len == 0) return Utils::ToLocal(factory->NewJSArray(0));
+
+  i::Handle<i::FixedDoubleArray> result =
+      i::Handle<i::FixedDoubleArray>::cast(factory->NewFixedDoubleArray(len));
+  for (int i = 0; i < len; i++) result->set(i, elements[i]);
+
+  return Utils::ToLocal(
+      factory->NewJSArrayWithElements(result, i::PACKED_DOUBLE_ELEMENTS, len));
+}
+
 uint32_t v8::Array::Length() const {
   i::Handle<i::JSArray> obj = Utils::OpenHandle(this);
   i::Object length = obj->length();
@@ -7366,6 +7601,107 @@ uint32_t v8::Array::Length() const {
   }
 }
 
+namespace {
+
+enum class FastIterateResult {
+  kException = static_cast<int>(v8::Array::CallbackResult::kException),
+  kBreak = static_cast<int>(v8::Array::CallbackResult::kBreak),
+  kSlowPath,
+  kFinished,
+};
+
+FastIterateResult FastIterateArray(i::Handle<i::JSArray> array,
+                                   i::Isolate* i_isolate,
+                                   v8::Array::IterationCallback callback,
+                                   void* callback_data) {
+  // Instead of relying on callers to check conditions, this function returns
+  // {kSlowPath} for situations it can't handle. Holes would require a lookup
+  // on the prototype chain, so only packed elements are handled here.
+  i::ElementsKind kind = array->GetElementsKind();
+  if (i::IsHoleyElementsKindForRead(kind) || !array->length().IsSmi()) {
+    return FastIterateResult::kSlowPath;
+  }
+  uint32_t length = static_cast<uint32_t>(i::Smi::ToInt(array->length()));
+  if (length == 0) return FastIterateResult::kFinished;
+  // The callback must not allocate and continue iterating, which is not
+  // enforced with DisallowGarbageCollection to allow allocating an error
+  // object before terminating the iteration. The elements store is still
+  // reloaded for each element so that such a callback cannot observe a
+  // moved backing store.
+  switch (kind) {
+    case i::PACKED_SMI_ELEMENTS:
+    case i::PACKED_ELEMENTS:
+    case i::PACKED_FROZEN_ELEMENTS:
+    case i::PACKED_SEALED_ELEMENTS:
+    case i::PACKED_NONEXTENSIBLE_ELEMENTS: {
+      for (uint32_t i = 0; i < length; i++) {
+        i::Object element =
+            i::FixedArray::cast(array->elements()).get(static_cast<int>(i));
+        // Since {callback} must not allocate, a handle pointing to the stack
+        // slot of {element} stays valid for the duration of the call.
+        i::Handle<i::Object> fake_handle(
+            reinterpret_cast<i::Address*>(&element));
+        using Result = v8::Array::CallbackResult;
+        Result result = callback(i, Utils::ToLocal(fake_handle), callback_data);
+        if (result != Result::kContinue) {
+          return static_cast<FastIterateResult>(result);
+        }
+        DCHECK_EQ(kind, array->GetElementsKind());
+        DCHECK_EQ(length, i::Smi::ToInt(array->length()));
+      }
+      return FastIterateResult::kFinished;
+    }
+    case i::PACKED_DOUBLE_ELEMENTS: {
+      for (uint32_t i = 0; i < length; i++) {
+        // Boxing the value allocates, so this needs a real handle.
+        i::HandleScope handle_scope(i_isolate);
+        double value = i::FixedDoubleArray::cast(array->elements())
+                           .get_scalar(static_cast<int>(i));
+        i::Handle<i::Object> element = i_isolate->factory()->NewNumber(value);
+        using Result = v8::Array::CallbackResult;
+        Result result = callback(i, Utils::ToLocal(element), callback_data);
+        if (result != Result::kContinue) {
+          return static_cast<FastIterateResult>(result);
+        }
+        DCHECK_EQ(kind, array->GetElementsKind());
+        DCHECK_EQ(length, i::Smi::ToInt(array->length()));
+      }
+      return FastIterateResult::kFinished;
+    }
+    default:
+      return FastIterateResult::kSlowPath;
+  }
+}
+
+}  // namespace
+
+Maybe<void> v8::Array::Iterate(Local<Context> context,
+                               v8::Array::IterationCallback callback,
+                               void* callback_data) {
+  i::Handle<i::JSArray> array = Utils::OpenHandle(this);
+  i::Isolate* isolate = array->GetIsolate();
+  FastIterateResult fast_result =
+      FastIterateArray(array, isolate, callback, callback_data);
+  if (fast_result == FastIterateResult::kException) return Nothing<void>();
+  // Early breaks and completed iteration both return successfully.
+  if (fast_result != FastIterateResult::kSlowPath) return JustVoid();
+
+  // Slow path: retrieving elements could have side effects.
+  ENTER_V8(isolate, context, Array, Iterate, Nothing<void>(), i::HandleScope);
+  for (uint32_t i = 0; i < i::NumberToUint32(array->length()); ++i) {
+    i::HandleScope element_scope(isolate);
+    i::Handle<i::Object> element;
+    has_pending_exception =
+        !i::JSReceiver::GetElement(isolate, array, i).ToHandle(&element);
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(void);
+    using Result = v8::Array::CallbackResult;
+    Result result = callback(i, Utils::ToLocal(element), callback_data);
+    if (result == Result::kException) return Nothing<void>();
+    if (result == Result::kBreak) return JustVoid();
+  }
+  return JustVoid();
+}
+
 Local<v8::Map> v8::Map::New(Isolate* isolate) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
   LOG_API(i_isolate, Map, New);
@@ -8908,6 +9244,8 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
   heap_statistics->does_zap_garbage_ = heap->ShouldZapGarbage();
+  heap_statistics->total_huge_page_advised_size_ =
+      heap->HugePageAdvisedMemory();
 
 #if V8_ENABLE_WEBASSEMBLY
   heap_statistics->malloced_memory_ +=
@@ -8991,6 +9329,28 @@ bool Isolate::GetHeapObjectStatisticsAtLastGC(
   return true;
 }
 
+bool Isolate::GetSampledHeapObjectStatisticsAtLastGC(
+    HeapObjectStatistics* object_statistics, size_t type_index) {
+  if (!object_statistics) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Heap* heap = isolate->heap();
+  size_t object_count = heap->SampledObjectCountAtLastGC(type_index);
+  if (object_count == 0) return false;
+
+  const char* object_type;
+  const char* object_sub_type;
+  if (!heap->GetObjectTypeName(type_index, &object_type, &object_sub_type)) {
+    return false;
+  }
+
+  object_statistics->object_type_ = object_type;
+  object_statistics->object_sub_type_ = object_sub_type;
+  object_statistics->object_count_ = object_count;
+  object_statistics->object_size_ = heap->SampledObjectSizeAtLastGC(type_index);
+  return true;
+}
+
 bool Isolate::GetHeapCodeAndMetadataStatistics(
     HeapCodeStatistics* code_statistics) {
   if (!code_statistics) return false;
@@ -9275,6 +9635,14 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
   return isolate->SetRAILMode(rail_mode);
 }
 
+void Isolate::SetGCPauseBudget(double budget_in_ms) {
+  Utils::ApiCheck(budget_in_ms >= 0, "v8::Isolate::SetGCPauseBudget",
+                  "budget must not be negative");
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->incremental_marking()->set_step_duration_budget_ms(
+      budget_in_ms);
+}
+
 void Isolate::UpdateLoadStartTime() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->UpdateLoadStartTime();
@@ -27,6 +27,9 @@
 
 #include "src/ast/ast-value-factory.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "src/base/hashmap-entry.h"
 #include "src/base/logging.h"
 #include "src/base/platform/wrappers.h"
@@ -370,13 +373,43 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 template <typename IsolateT>
 void AstValueFactory::Internalize(IsolateT* isolate) {
   // Strings need to be internalized before values, because values refer to
-  // strings.
+  // strings. One- and two-byte strings are looked up as one batch each, so
+  // that the string table can insert all new strings at once.
+  std::vector<AstRawString*> one_byte_strings;
+  std::vector<OneByteStringKey> one_byte_keys;
+  std::vector<AstRawString*> two_byte_strings;
+  std::vector<TwoByteStringKey> two_byte_keys;
   for (AstRawString* current = strings_; current != nullptr;) {
     AstRawString* next = current->next();
-    current->Internalize(isolate);
+    if (current->IsEmpty()) {
+      current->set_string(isolate->factory()->empty_string());
+    } else if (current->is_one_byte()) {
+      one_byte_strings.push_back(current);
+      one_byte_keys.emplace_back(current->raw_hash_field(),
+                                 current->literal_bytes_);
+    } else {
+      two_byte_strings.push_back(current);
+      two_byte_keys.emplace_back(
+          current->raw_hash_field(),
+          base::Vector<const uint16_t>::cast(current->literal_bytes_));
+    }
     current = next;
   }
 
+  StringTable* string_table = isolate->string_table();
+  std::vector<Handle<String>> results(
+      std::max(one_byte_keys.size(), two_byte_keys.size()));
+  string_table->LookupKeys(isolate, base::VectorOf(one_byte_keys),
+                           results.data());
+  for (size_t i = 0; i < one_byte_strings.size(); i++) {
+    one_byte_strings[i]->set_string(results[i]);
+  }
+  string_table->LookupKeys(isolate, base::VectorOf(two_byte_keys),
+                           results.data());
+  for (size_t i = 0; i < two_byte_strings.size(); i++) {
+    two_byte_strings[i]->set_string(results[i]);
+  }
+
   ResetStrings();
 }
 template EXPORT_TEMPLATE_DEFINE(
@@ -9,6 +9,7 @@
 #include <cmath>
 #include <limits>
 
+#include "src/base/memory.h"
 #include "src/base/numbers/bignum.h"
 #include "src/base/numbers/cached-powers.h"
 #include "src/base/numbers/double.h"
@@ -104,6 +105,19 @@ static void TrimToMaxSignificantDigits(Vector<const char> buffer, int exponent,
       exponent + (buffer.length() - kMaxSignificantDecimalDigits);
 }
 
+// Converts the eight decimal digits starting at {chars} to their value, with
+// a few multiplications instead of one per digit (SWAR).
+static uint64_t ReadEightDigits(const char* chars) {
+  uint64_t value =
+      ReadLittleEndianValue<uint64_t>(reinterpret_cast<Address>(chars));
+  DCHECK_EQ(value & 0xF0F0'F0F0'F0F0'F0F0, 0x3030'3030'3030'3030);
+  // Combine adjacent digits into two-digit, then four-digit, then the final
+  // eight-digit value. The first character is in the lowest byte.
+  value = ((value & 0x0F0F'0F0F'0F0F'0F0F) * (10 << 8 | 1)) >> 8;
+  value = ((value & 0x00FF'00FF'00FF'00FF) * (100 << 16 | 1)) >> 16;
+  return ((value & 0x0000'FFFF'0000'FFFF) * (10000ull << 32 | 1)) >> 32;
+}
+
 // Reads digits from the buffer and converts them to a uint64.
 // Reads in as many digits as fit into a uint64.
 // When the string starts with "1844674407370955161" no further digit is read.
@@ -113,6 +127,10 @@ static uint64_t ReadUint64(Vector<const char> buffer,
                            int* number_of_read_digits) {
   uint64_t result = 0;
   int i = 0;
+  // Up to 16 digits always fit, so they can be read in bulk.
+  for (; i < 16 && i + 8 <= buffer.length(); i += 8) {
+    result = result * 100000000 + ReadEightDigits(buffer.begin() + i);
+  }
   while (i < buffer.length() && result <= (kMaxUint64 / 10 - 1)) {
     int digit = buffer[i++] - '0';
     DCHECK(0 <= digit && digit <= 9);
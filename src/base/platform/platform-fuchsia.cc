@@ -342,6 +342,22 @@ void OS::DestroySharedMemoryHandle(PlatformSharedMemoryHandle handle) {
   zx_handle_close(vmo);
 }
 
+// static
+size_t OS::AdviseTransparentHugePages(void* address, size_t size) {
+  return 0;
+}
+
+// static
+bool OS::AdvisePagesMergeable(void* address, size_t size) { return false; }
+
+// static
+int OS::GetCurrentNumaNode() { return -1; }
+
+// static
+bool OS::SetPreferredNumaNode(void* address, size_t size, int node) {
+  return false;
+}
+
 // static
 bool OS::HasLazyCommits() { return true; }
 
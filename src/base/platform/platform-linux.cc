@@ -155,6 +155,19 @@ void* OS::RemapShared(void* old_address, void* new_address, size_t size) {
   return result;
 }
 
+bool OS::MovePages(void* old_address, void* new_address, size_t size) {
+#ifndef MREMAP_DONTUNMAP
+  // Only available since Linux 5.7; older kernels fail with EINVAL.
+  constexpr int MREMAP_DONTUNMAP = 4;
+#endif
+  void* result =
+      mremap(old_address, size, size,
+             MREMAP_FIXED | MREMAP_MAYMOVE | MREMAP_DONTUNMAP, new_address);
+  if (result == MAP_FAILED) return false;
+  DCHECK_EQ(new_address, result);
+  return true;
+}
+
 std::vector<OS::MemoryRange> OS::GetFreeMemoryRangesWithin(
     OS::Address boundary_start, OS::Address boundary_end, size_t minimum_size,
     size_t alignment) {
@@ -531,6 +531,66 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ret == 0;
 }
 
+// static
+size_t OS::AdviseTransparentHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  // Transparent huge pages are 2MB on all architectures we care about.
+  constexpr uintptr_t kTransparentHugePageSize = uintptr_t{2} << 20;
+  const uintptr_t start = RoundUp(reinterpret_cast<uintptr_t>(address),
+                                  kTransparentHugePageSize);
+  const uintptr_t end = RoundDown(reinterpret_cast<uintptr_t>(address) + size,
+                                  kTransparentHugePageSize);
+  if (end <= start) return 0;
+  if (madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE) !=
+      0) {
+    return 0;
+  }
+  return end - start;
+#else
+  return 0;
+#endif
+}
+
+// static
+bool OS::AdvisePagesMergeable(void* address, size_t size) {
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
+  DCHECK_EQ(0, size % CommitPageSize());
+#if V8_OS_LINUX && defined(MADV_MERGEABLE)
+  return madvise(address, size, MADV_MERGEABLE) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+int OS::GetCurrentNumaNode() {
+#if V8_OS_LINUX && defined(__NR_getcpu)
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(__NR_getcpu, &cpu, &node, nullptr) != 0) return -1;
+  return static_cast<int>(node);
+#else
+  return -1;
+#endif
+}
+
+// static
+bool OS::SetPreferredNumaNode(void* address, size_t size, int node) {
+#if V8_OS_LINUX && defined(__NR_mbind)
+  // Avoid depending on libnuma for a single system call.
+  constexpr int kMpolPreferred = 1;
+  using NodeMask = unsigned long;  // NOLINT(runtime/int)
+  constexpr int kMaxNode = sizeof(NodeMask) * CHAR_BIT;
+  if (node < 0 || node >= kMaxNode) return false;
+  NodeMask node_mask = NodeMask{1} << node;
+  // The kernel expects the number of bits of the mask plus one.
+  return syscall(__NR_mbind, address, size, kMpolPreferred, &node_mask,
+                 kMaxNode + 1, 0) == 0;
+#else
+  return false;
+#endif
+}
+
 #if !defined(_AIX)
 // See AIX version for details.
 // static
@@ -1023,6 +1083,7 @@ class Thread::PlatformData {
 Thread::Thread(const Options& options)
     : data_(new PlatformData),
       stack_size_(options.stack_size()),
+      priority_(options.priority()),
       start_semaphore_(nullptr) {
   const int min_stack_size = static_cast<int>(PTHREAD_STACK_MIN);
   if (stack_size_ > 0) stack_size_ = std::max(stack_size_, min_stack_size);
@@ -1060,6 +1121,12 @@ static void SetThreadName(const char* name) {
 #endif
 }
 
+#if V8_OS_LINUX
+// Nice value of kBestEffort threads. High enough to keep them out of the way
+// of the embedder's threads, but not SCHED_IDLE, which could starve them
+// indefinitely on a busy machine.
+constexpr int kBestEffortThreadNiceValue = 10;
+#endif  // V8_OS_LINUX
 
 static void* ThreadEntry(void* arg) {
   Thread* thread = reinterpret_cast<Thread*>(arg);
@@ -1068,6 +1135,14 @@ static void* ThreadEntry(void* arg) {
   // one).
   { MutexGuard lock_guard(&thread->data()->thread_creation_mutex_); }
   SetThreadName(thread->name());
+#if V8_OS_LINUX
+  // On Linux, setpriority() applies to the calling thread only. Lowering the
+  // priority never needs privileges, raising it usually does, so only best
+  // effort threads are deprioritized and all others keep the default.
+  if (thread->priority() == Thread::Priority::kBestEffort) {
+    USE(setpriority(PRIO_PROCESS, 0, kBestEffortThreadNiceValue));
+  }
+#endif  // V8_OS_LINUX
   DCHECK_NE(thread->data()->thread_, kNoThread);
   thread->NotifyStartedAndRun();
   return nullptr;
@@ -1099,6 +1174,24 @@ bool Thread::Start() {
     result = pthread_attr_setstacksize(&attr, stack_size);
     if (result != 0) return pthread_attr_destroy(&attr), false;
   }
+#if V8_OS_DARWIN
+  switch (priority_) {
+    case Priority::kBestEffort:
+      result = pthread_attr_set_qos_class_np(&attr, QOS_CLASS_BACKGROUND, 0);
+      break;
+    case Priority::kUserVisible:
+      result = pthread_attr_set_qos_class_np(&attr, QOS_CLASS_USER_INITIATED,
+                                             -1);
+      break;
+    case Priority::kUserBlocking:
+      result = pthread_attr_set_qos_class_np(&attr, QOS_CLASS_USER_INITIATED,
+                                             0);
+      break;
+    case Priority::kDefault:
+      break;
+  }
+  if (result != 0) return pthread_attr_destroy(&attr), false;
+#endif  // V8_OS_DARWIN
   {
     MutexGuard lock_guard(&data_->thread_creation_mutex_);
     result = pthread_create(&data_->thread_, &attr, ThreadEntry, this);
@@ -224,6 +224,22 @@ bool OS::SetPermissions(void* address, size_t size, MemoryPermission access) {
   return SbMemoryProtect(address, size, new_protection);
 }
 
+// static
+size_t OS::AdviseTransparentHugePages(void* address, size_t size) {
+  return 0;
+}
+
+// static
+bool OS::AdvisePagesMergeable(void* address, size_t size) { return false; }
+
+// static
+int OS::GetCurrentNumaNode() { return -1; }
+
+// static
+bool OS::SetPreferredNumaNode(void* address, size_t size, int node) {
+  return false;
+}
+
 // static
 bool OS::HasLazyCommits() {
   SB_NOTIMPLEMENTED();
@@ -377,6 +393,7 @@ class Thread::PlatformData {
 Thread::Thread(const Options& options)
     : data_(new PlatformData),
       stack_size_(options.stack_size()),
+      priority_(options.priority()),
       start_semaphore_(nullptr) {
   set_name(options.name());
 }
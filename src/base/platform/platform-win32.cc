@@ -1089,6 +1089,22 @@ void OS::DestroySharedMemoryHandle(PlatformSharedMemoryHandle handle) {
   CHECK(CloseHandle(file_mapping));
 }
 
+// static
+size_t OS::AdviseTransparentHugePages(void* address, size_t size) {
+  return 0;
+}
+
+// static
+bool OS::AdvisePagesMergeable(void* address, size_t size) { return false; }
+
+// static
+int OS::GetCurrentNumaNode() { return -1; }
+
+// static
+bool OS::SetPreferredNumaNode(void* address, size_t size, int node) {
+  return false;
+}
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(alph): implement for the platform.
@@ -1598,7 +1614,9 @@ class Thread::PlatformData {
 // handle until it is started.
 
 Thread::Thread(const Options& options)
-    : stack_size_(options.stack_size()), start_semaphore_(nullptr) {
+    : stack_size_(options.stack_size()),
+      priority_(options.priority()),
+      start_semaphore_(nullptr) {
   data_ = new PlatformData(kNoThread);
   set_name(options.name());
 }
@@ -336,6 +336,26 @@ class V8_BASE_EXPORT OS {
                                                void* new_address,
                                                MemoryPermission access);
 
+  // Advises the OS to back the huge page aligned part of the given range with
+  // transparent huge pages. This is only a hint; the OS is free to ignore it.
+  // Returns the number of bytes that were advised, which is 0 if the platform
+  // does not support transparent huge pages.
+  static size_t AdviseTransparentHugePages(void* address, size_t size);
+
+  // Advises the OS that the given page-aligned range may be merged with
+  // identical pages of other processes (Linux KSM). This is only a hint.
+  // Returns false if the platform does not support it.
+  static bool AdvisePagesMergeable(void* address, size_t size);
+
+  // Returns the NUMA node of the CPU the calling thread currently runs on, or
+  // -1 if it cannot be determined.
+  static int GetCurrentNumaNode();
+
+  // Asks the OS to preferably place the pages of the given range on the given
+  // NUMA node. Pages that are already faulted in are not moved. Returns false
+  // if the platform does not support it.
+  static bool SetPreferredNumaNode(void* address, size_t size, int node);
+
  private:
   // These classes use the private memory management API below.
   friend class AddressSpaceReservation;
@@ -345,6 +365,9 @@ class V8_BASE_EXPORT OS {
   friend class v8::base::VirtualAddressSpace;
   friend class v8::base::VirtualAddressSubspace;
   FRIEND_TEST(OS, RemapPages);
+  FRIEND_TEST(OS, AdviseTransparentHugePages);
+  FRIEND_TEST(OS, AdvisePagesMergeable);
+  FRIEND_TEST(OS, SetPreferredNumaNode);
 
   static size_t AllocatePageSize();
 
@@ -365,6 +388,14 @@ class V8_BASE_EXPORT OS {
                                                  void* new_address,
                                                  size_t size);
 
+  // Moves the pages of the private anonymous mapping at |old_address| into
+  // the already-reserved range at |new_address| without copying them. The
+  // range at |old_address| stays mapped, but its contents are discarded.
+  // Only implemented on Linux; returns false if the kernel does not support
+  // it.
+  V8_WARN_UNUSED_RESULT static bool MovePages(void* old_address,
+                                              void* new_address, size_t size);
+
   static void Free(void* address, size_t size);
 
   V8_WARN_UNUSED_RESULT static void* AllocateShared(
@@ -507,17 +538,25 @@ class V8_BASE_EXPORT Thread {
   using LocalStorageKey = int32_t;
 #endif
 
+  // Scheduling priority of the thread. Mapped to the closest OS-level
+  // equivalent where one exists, and ignored otherwise.
+  enum class Priority { kBestEffort, kUserVisible, kUserBlocking, kDefault };
+
   class Options {
    public:
-    Options() : name_("v8:<unknown>"), stack_size_(0) {}
+    Options() : Options("v8:<unknown>") {}
     explicit Options(const char* name, int stack_size = 0)
-        : name_(name), stack_size_(stack_size) {}
+        : Options(name, Priority::kDefault, stack_size) {}
+    Options(const char* name, Priority priority, int stack_size = 0)
+        : name_(name), priority_(priority), stack_size_(stack_size) {}
 
     const char* name() const { return name_; }
+    Priority priority() const { return priority_; }
     int stack_size() const { return stack_size_; }
 
    private:
     const char* name_;
+    Priority priority_;
     int stack_size_;
   };
 
@@ -547,6 +586,8 @@ class V8_BASE_EXPORT Thread {
     return name_;
   }
 
+  Priority priority() const { return priority_; }
+
   // Abstract method for run handler.
   virtual void Run() = 0;
 
@@ -591,6 +632,7 @@ class V8_BASE_EXPORT Thread {
 
   char name_[kMaxThreadNameLength];
   int stack_size_;
+  Priority priority_;
   Semaphore* start_semaphore_;
 };
 
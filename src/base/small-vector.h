@@ -98,6 +98,15 @@ class SmallVector {
   bool empty() const { return end_ == begin_; }
   size_t capacity() const { return end_of_storage_ - begin_; }
 
+  T& front() {
+    DCHECK_NE(0, size());
+    return begin_[0];
+  }
+  const T& front() const {
+    DCHECK_NE(0, size());
+    return begin_[0];
+  }
+
   T& back() {
     DCHECK_NE(0, size());
     return end_[-1];
@@ -127,6 +136,8 @@ class SmallVector {
     end_ = end + 1;
   }
 
+  void push_back(T x) { emplace_back(std::move(x)); }
+
   void pop_back(size_t count = 1) {
     DCHECK_GE(size(), count);
     end_ -= count;
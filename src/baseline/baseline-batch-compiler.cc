@@ -158,14 +158,19 @@ class ConcurrentBaselineCompiler {
       // we only switch back the memory chunks to RX at the end.
       CodePageCollectionMemoryModificationScope batch_alloc(isolate_->heap());
 
+      bool has_finished_jobs = false;
       while (!incoming_queue_->IsEmpty() && !delegate->ShouldYield()) {
         std::unique_ptr<BaselineBatchCompilerJob> job;
         if (!incoming_queue_->Dequeue(&job)) break;
         DCHECK_NOT_NULL(job);
         job->Compile(&local_isolate);
         outgoing_queue_->Enqueue(std::move(job));
+        has_finished_jobs = true;
+      }
+      // Only interrupt the main thread if there is something to install.
+      if (has_finished_jobs) {
+        isolate_->stack_guard()->RequestInstallBaselineCode();
       }
-      isolate_->stack_guard()->RequestInstallBaselineCode();
     }
 
     size_t GetMaxConcurrency(size_t worker_count) const override {
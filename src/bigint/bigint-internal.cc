@@ -18,7 +18,12 @@ bool kAdvancedAlgorithmsEnabledInLibrary = false;
 
 ProcessorImpl::ProcessorImpl(Platform* platform) : platform_(platform) {}
 
-ProcessorImpl::~ProcessorImpl() { delete platform_; }
+ProcessorImpl::~ProcessorImpl() {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+  ClearToStringCache();
+#endif
+  delete platform_;
+}
 
 Status ProcessorImpl::get_and_clear_status() {
   Status result = status_;
@@ -16,14 +16,22 @@ constexpr int kKaratsubaThreshold = 34;
 constexpr int kToomThreshold = 193;
 constexpr int kFftThreshold = 1500;
 constexpr int kFftInnerThreshold = 200;
+// Above this length of the shorter operand, the pointwise multiplications of
+// an FFT are distributed over {Platform::RunInParallel}.
+constexpr int kFftParallelThreshold = 4000;
 
 constexpr int kBurnikelThreshold = 57;
 constexpr int kNewtonInversionThreshold = 50;
 // kBarrettThreshold is defined in bigint.h.
 
 constexpr int kToStringFastThreshold = 43;
+// Fast to-string conversions of inputs up to this length reuse the divisors
+// computed for earlier conversions in the same radix.
+constexpr int kToStringCacheMaxLength = 4096;
 constexpr int kFromStringLargeThreshold = 300;
 
+class RecursionLevel;
+
 class ProcessorImpl : public Processor {
  public:
   explicit ProcessorImpl(Platform* platform);
@@ -67,6 +75,13 @@ class ProcessorImpl : public Processor {
   void ToString(char* out, int* out_length, Digits X, int radix, bool sign);
   void ToStringImpl(char* out, int* out_length, Digits X, int radix, bool sign,
                     bool use_fast_algorithm);
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+  // Returns the top recursion level for a fast to-string conversion of a
+  // {target_bit_length}-bit number. The levels are owned by the processor.
+  RecursionLevel* ToStringLevels(int radix, digit_t base_divisor,
+                                 int base_char_count, int target_bit_length);
+  void ClearToStringCache();
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
 
   void FromString(RWDigits Z, FromStringAccumulator* accumulator);
   void FromStringClassic(RWDigits Z, FromStringAccumulator* accumulator);
@@ -75,6 +90,8 @@ class ProcessorImpl : public Processor {
 
   bool should_terminate() { return status_ == Status::kInterrupted; }
 
+  Platform* platform() { return platform_; }
+
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
   // Doesn't need to be accurate; we just want to make sure to check for
   // interrupt requests every now and then (roughly every 10-100 ms; often
@@ -96,6 +113,10 @@ class ProcessorImpl : public Processor {
   uintptr_t work_estimate_{0};
   Status status_{Status::kOk};
   Platform* platform_;
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+  RecursionLevel* tostring_levels_{nullptr};
+  int tostring_levels_radix_{0};
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
 };
 
 // These constants are primarily needed for Barrett division in div-barrett.cc,
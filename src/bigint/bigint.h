@@ -191,6 +191,23 @@ class Platform {
   // a Platform subclass that overrides this method. It will be queried
   // every now and then by long-running operations.
   virtual bool InterruptRequested() { return false; }
+
+  // A unit of work that long-running operations can split into independent
+  // pieces.
+  class ParallelTask {
+   public:
+    virtual ~ParallelTask() = default;
+    virtual void Run(int index) = 0;
+  };
+
+  // If you want long-running operations to use more than one thread,
+  // implement a Platform subclass that overrides this method. It must call
+  // {task->Run(i)} exactly once for every {i} in [0, num_tasks), possibly
+  // concurrently, and only return when all calls have returned. The tasks
+  // never call back into the Platform.
+  virtual void RunInParallel(ParallelTask* task, int num_tasks) {
+    for (int i = 0; i < num_tasks; i++) task->Run(i);
+  }
 };
 
 // These are the operations that this library supports.
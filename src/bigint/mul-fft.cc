@@ -462,9 +462,9 @@ class FFTContainer {
   void BackwardFFT(int start, int len, int omega);
   void BackwardFFT_Threadsafe(int start, int len, int omega, digit_t* temp);
 
-  void PointwiseMultiply(const FFTContainer& other);
+  void PointwiseMultiply(const FFTContainer& other, bool parallel = false);
   void DoPointwiseMultiplication(const FFTContainer& other, int start, int end,
-                                 digit_t* temp);
+                                 digit_t* temp, ProcessorImpl* processor);
 
   int length() const { return length_; }
 
@@ -722,8 +722,8 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 
 // Actual implementation of pointwise multiplications.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
-                                             int start, int end,
-                                             digit_t* temp) {
+                                             int start, int end, digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -734,11 +734,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -748,10 +748,50 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
   }
 }
 
+// The pointwise multiplications are independent of each other, so for large
+// inputs they are split into ranges that may run on other threads. Every
+// range has an even length (see the SumDiff step above) and uses its own
+// scratch space and Processor, since processors are not thread-safe.
+class PointwiseMultiplicationTask : public Platform::ParallelTask {
+ public:
+  PointwiseMultiplicationTask(FFTContainer* container,
+                              const FFTContainer& other, int parts_per_task)
+      : container_(container),
+        other_(other),
+        parts_per_task_(parts_per_task) {}
+
+  void Run(int index) override {
+    // Workers must not query the embedder for interrupts (which may only be
+    // safe on the main thread); the caller checks once all tasks are done.
+    // The processor takes ownership of the default (no-op) platform.
+    ProcessorImpl processor(new Platform());
+    Storage temp(2 * container_->length());
+    int start = index * parts_per_task_;
+    container_->DoPointwiseMultiplication(other_, start,
+                                          start + parts_per_task_, temp.get(),
+                                          &processor);
+  }
+
+ private:
+  FFTContainer* container_;
+  const FFTContainer& other_;
+  const int parts_per_task_;
+};
+
 // Convenient entry point for pointwise multiplications.
-void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
+void FFTContainer::PointwiseMultiply(const FFTContainer& other, bool parallel) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  // {n_} is a power of two, so this splits it into equal, even ranges.
+  constexpr int kMaxTasks = 16;
+  int num_tasks = parallel ? std::min(kMaxTasks, n_ / 2) : 1;
+  if (num_tasks <= 1) {
+    DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
+    return;
+  }
+  PointwiseMultiplicationTask task(this, other, n_ / num_tasks);
+  processor_->platform()->RunInParallel(&task, num_tasks);
+  // Force an interrupt check, which the tasks skipped.
+  processor_->AddWorkEstimate(ProcessorImpl::kWorkEstimateThreshold);
 }
 
 }  // namespace
@@ -770,15 +810,16 @@ void ProcessorImpl::MultiplyFFT(RWDigits Z, Digits X, Digits Y) {
   int m = GetParameters(X.len() + Y.len(), &params);
   int omega = params.r;  // really: 2^r
 
+  const bool parallel = Y.len() >= kFftParallelThreshold;
   FFTContainer a(params.n, params.K, this);
   a.Start(X, params.s, 0, omega);
   if (X == Y) {
     // Squaring.
-    a.PointwiseMultiply(a);
+    a.PointwiseMultiply(a, parallel);
   } else {
     FFTContainer b(params.n, params.K, this);
     b.Start(Y, params.s, 0, omega);
-    a.PointwiseMultiply(b);
+    a.PointwiseMultiply(b, parallel);
   }
   if (should_terminate()) return;
 
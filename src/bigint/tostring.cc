@@ -106,8 +106,6 @@ char* DivideByMagic(RWDigits rest, Digits input, char* output) {
   return output;
 }
 
-class RecursionLevel;
-
 // The classic algorithm must check for interrupt requests if no faster
 // algorithm is available.
 #if V8_ADVANCED_BIGINT_ALGORITHMS
@@ -270,6 +268,8 @@ void ToStringFormatter::BasePowerOfTwo() {
   }
 }
 
+}  // namespace
+
 #if V8_ADVANCED_BIGINT_ALGORITHMS
 
 // "Fast" divide-and-conquer conversion to string. The basic idea is to
@@ -313,7 +313,14 @@ void ToStringFormatter::BasePowerOfTwo() {
 // a leading "0" in its string representation, the other must not.
 //
 // In this example, {base_divisor} is 100 and {base_char_count} is 2.
+//
+// The levels only depend on the radix, so the processor keeps the most
+// recently used stack of levels around (see {ProcessorImpl::ToStringLevels}),
+// growing it on demand. Converting many similarly-sized BigInts, e.g. when
+// serializing them to JSON, then only pays for the divisions.
 
+// RecursionLevel is not in the anonymous namespace because the processor
+// holds on to the cached levels.
 // TODO(jkummerow): Investigate whether it is beneficial to build one or two
 // fewer RecursionLevels, and use the topmost level for more than one division.
 
@@ -322,13 +329,20 @@ class RecursionLevel {
   static RecursionLevel* CreateLevels(digit_t base_divisor, int base_char_count,
                                       int target_bit_length,
                                       ProcessorImpl* processor);
+  // Adds levels on top of {level}, whose divisor must not be left-shifted
+  // yet, until they cover {target_bit_length}. Returns the new top level, or
+  // nullptr (having deleted all levels) if the processor got interrupted.
+  static RecursionLevel* AddLevels(RecursionLevel* level,
+                                   int target_bit_length,
+                                   ProcessorImpl* processor);
   ~RecursionLevel() { delete next_; }
 
   void ComputeInverse(ProcessorImpl* proc, int dividend_length = 0);
   Digits GetInverse(int dividend_length);
 
  private:
-  friend class ToStringFormatter;
+  friend ToStringFormatter;
+  friend class ProcessorImpl;
   RecursionLevel(digit_t base_divisor, int base_char_count)
       : char_count_(base_char_count), divisor_(1) {
     divisor_[0] = base_divisor;
@@ -336,19 +350,27 @@ class RecursionLevel {
   explicit RecursionLevel(RecursionLevel* next)
       : char_count_(next->char_count_ * 2),
         next_(next),
-        divisor_(next->divisor_.len() * 2) {
-    next->is_toplevel_ = false;
-  }
+        divisor_(next->divisor_.len() * 2) {}
 
   void LeftShiftDivisor() {
     leading_zero_shift_ = CountLeadingZeros(divisor_.msd());
     LeftShift(divisor_, divisor_, leading_zero_shift_);
   }
+  void UndoLeftShiftDivisor() {
+    RightShift(divisor_, divisor_, leading_zero_shift_);
+    leading_zero_shift_ = 0;
+  }
+
+  // Whether this level, rather than the next one, has to be the top level
+  // when formatting a number of {target_bit_length} bits. See {AddLevels}.
+  bool Covers(int target_bit_length) {
+    int bit_length = BitLength(divisor_) - leading_zero_shift_;
+    return bit_length * 2 - 1 > target_bit_length;
+  }
 
   int leading_zero_shift_{0};
   // The number of characters generated by *each half* of this level.
   int char_count_;
-  bool is_toplevel_{true};
   RecursionLevel* next_{nullptr};
   ScratchDigits divisor_;
   std::unique_ptr<Storage> inverse_storage_;
@@ -361,6 +383,13 @@ RecursionLevel* RecursionLevel::CreateLevels(digit_t base_divisor,
                                              int target_bit_length,
                                              ProcessorImpl* processor) {
   RecursionLevel* level = new RecursionLevel(base_divisor, base_char_count);
+  return AddLevels(level, target_bit_length, processor);
+}
+
+// static
+RecursionLevel* RecursionLevel::AddLevels(RecursionLevel* level,
+                                          int target_bit_length,
+                                          ProcessorImpl* processor) {
   // We can stop creating levels when the next level's divisor, which is the
   // square of the current level's divisor, would be strictly bigger (in terms
   // of its numeric value) than the input we're formatting. Since computing that
@@ -371,7 +400,7 @@ RecursionLevel* RecursionLevel::CreateLevels(digit_t base_divisor,
   //   is bigger, we have to aim for a strictly bigger bit length.
   // - when squaring, the bit length sometimes doubles (e.g. 0b11² == 0b1001),
   //   but usually we "lose" a bit (e.g. 0b10² == 0b100).
-  while (BitLength(level->divisor_) * 2 - 1 <= target_bit_length) {
+  while (!level->Covers(target_bit_length)) {
     RecursionLevel* prev = level;
     level = new RecursionLevel(prev);
     processor->Multiply(level->divisor_, prev->divisor_, prev->divisor_);
@@ -418,11 +447,25 @@ Digits RecursionLevel::GetInverse(int dividend_length) {
   return inverse_ + (inverse_.len() - inverse_len);
 }
 
+namespace {
+
 void ToStringFormatter::Fast() {
-  std::unique_ptr<RecursionLevel> recursion_levels(RecursionLevel::CreateLevels(
-      chunk_divisor_, chunk_chars_, BitLength(digits_), processor_));
+  int target_bit_length = BitLength(digits_);
+  std::unique_ptr<RecursionLevel> uncached_levels;
+  RecursionLevel* recursion_levels;
+  if (digits_.len() <= kToStringCacheMaxLength) {
+    recursion_levels =
+        processor_->ToStringLevels(radix_, chunk_divisor_, chunk_chars_,
+                                   target_bit_length);
+  } else {
+    // Don't hold on to the levels of huge numbers, they take up about as
+    // much memory as the input.
+    uncached_levels.reset(RecursionLevel::CreateLevels(
+        chunk_divisor_, chunk_chars_, target_bit_length, processor_));
+    recursion_levels = uncached_levels.get();
+  }
   if (processor_->should_terminate()) return;
-  out_ = ProcessLevel(recursion_levels.get(), digits_, out_, true);
+  out_ = ProcessLevel(recursion_levels, digits_, out_, true);
 }
 
 // Writes '0' characters right-to-left, starting at {out}-1, until the distance
@@ -512,8 +555,9 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
   } else {
     ScratchDigits scratch(DivideBarrettScratchSpace(chunk.len()));
     // The top level only computes its inverse when {chunk.len()} is
-    // available. Other levels have precomputed theirs.
-    if (level->is_toplevel_) {
+    // available. Other levels have precomputed theirs. A cached top level
+    // may also have to grow an inverse it computed for a shorter input.
+    if (level->inverse_.len() < inverse_len) {
       level->ComputeInverse(processor_, chunk.len());
       if (processor_->should_terminate()) return out;
     }
@@ -542,10 +586,40 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
                       is_last_on_level);
 }
 
-#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
-
 }  // namespace
 
+RecursionLevel* ProcessorImpl::ToStringLevels(int radix, digit_t base_divisor,
+                                              int base_char_count,
+                                              int target_bit_length) {
+  if (tostring_levels_ != nullptr && tostring_levels_radix_ != radix) {
+    ClearToStringCache();
+  }
+  if (tostring_levels_ == nullptr) {
+    tostring_levels_ = RecursionLevel::CreateLevels(
+        base_divisor, base_char_count, target_bit_length, this);
+    tostring_levels_radix_ = radix;
+  } else if (!tostring_levels_->Covers(target_bit_length)) {
+    tostring_levels_->UndoLeftShiftDivisor();
+    tostring_levels_ =
+        RecursionLevel::AddLevels(tostring_levels_, target_bit_length, this);
+  }
+  if (tostring_levels_ == nullptr) return nullptr;
+  // Start at the same level that {CreateLevels} would have built last.
+  RecursionLevel* level = tostring_levels_;
+  while (level->next_ != nullptr && level->next_->Covers(target_bit_length)) {
+    level = level->next_;
+  }
+  return level;
+}
+
+void ProcessorImpl::ClearToStringCache() {
+  delete tostring_levels_;
+  tostring_levels_ = nullptr;
+  tostring_levels_radix_ = 0;
+}
+
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+
 void ProcessorImpl::ToString(char* out, int* out_length, Digits X, int radix,
                              bool sign) {
   const bool use_fast_algorithm = X.len() >= kToStringFastThreshold;
@@ -565,7 +639,11 @@ void ProcessorImpl::ToStringImpl(char* out, int* out_length, Digits X,
   } else if (fast) {
     formatter.Start();
     formatter.Fast();
-    if (should_terminate()) return;
+    if (should_terminate()) {
+      // An interrupted inversion may have left a cached level incomplete.
+      ClearToStringCache();
+      return;
+    }
 #else
     USE(fast);
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
@@ -471,6 +471,28 @@ TF_BUILTIN(ExtractFastJSArray, ArrayBuiltinsAssembler) {
   Return(ExtractFastJSArray(context, array, begin, count));
 }
 
+void ArrayBuiltinsAssembler::TryMakeElementsCopyOnWrite(TNode<JSArray> array,
+                                                        bool packed_only) {
+  Label done(this);
+  TNode<Int32T> elements_kind = LoadElementsKind(array);
+  GotoIfNot(IsFastSmiOrTaggedElementsKind(elements_kind), &done);
+  if (packed_only) GotoIf(IsHoleyFastElementsKind(elements_kind), &done);
+  TNode<Smi> length = CAST(LoadJSArrayLength(array));
+  GotoIf(SmiLessThan(length, SmiConstant(kMinLengthForCopyOnWriteClone)),
+         &done);
+  // Only a plain FixedArray is exclusively owned by {array}; COW arrays are
+  // shared already.
+  TNode<FixedArrayBase> elements = LoadElements(array);
+  GotoIfNot(TaggedEqual(LoadMap(elements), FixedArrayMapConstant()), &done);
+  // COW backing stores must not have slack: fast-path stores only check the
+  // capacity, so a push into the spare capacity of a shared store would be
+  // visible through every array sharing it.
+  GotoIfNot(SmiEqual(LoadFixedArrayBaseLength(elements), length), &done);
+  StoreMapNoWriteBarrier(elements, RootIndex::kFixedCOWArrayMap);
+  Goto(&done);
+  BIND(&done);
+}
+
 TF_BUILTIN(CloneFastJSArray, ArrayBuiltinsAssembler) {
   auto context = Parameter<Context>(Descriptor::kContext);
   auto array = Parameter<JSArray>(Descriptor::kSource);
@@ -480,6 +502,7 @@ TF_BUILTIN(CloneFastJSArray, ArrayBuiltinsAssembler) {
                           LoadElementsKind(array))),
                       Word32BinaryNot(IsNoElementsProtectorCellInvalid())));
 
+  TryMakeElementsCopyOnWrite(array, false);
   Return(CloneFastJSArray(context, array));
 }
 
@@ -499,6 +522,8 @@ TF_BUILTIN(CloneFastJSArrayFillingHoles, ArrayBuiltinsAssembler) {
                           LoadElementsKind(array))),
                       Word32BinaryNot(IsNoElementsProtectorCellInvalid())));
 
+  // Holes have to be converted, so only packed backing stores can be shared.
+  TryMakeElementsCopyOnWrite(array, true);
   Return(CloneFastJSArray(context, array, base::nullopt,
                           HoleConversionMode::kConvertToUndefined));
 }
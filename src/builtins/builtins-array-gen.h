@@ -56,6 +56,17 @@ class ArrayBuiltinsAssembler : public CodeStubAssembler {
 
   void ReturnFromBuiltin(TNode<Object> value);
 
+  // Whole-array copies of at least this many elements share the source's
+  // backing store copy-on-write instead of copying it.
+  static constexpr int kMinLengthForCopyOnWriteClone = 256;
+
+  // If {array} has a large enough, writable FixedArray backing store of a fast
+  // Smi or object elements kind, turns it into a COW array in place so that a
+  // subsequent CloneFastJSArray shares it. Both arrays copy it lazily on their
+  // first write (see JSObject::EnsureWritableFastElements). With
+  // {packed_only}, holey arrays are left alone.
+  void TryMakeElementsCopyOnWrite(TNode<JSArray> array, bool packed_only);
+
   void InitIteratingArrayBuiltinBody(TNode<Context> context,
                                      TNode<Object> receiver,
                                      TNode<Object> callbackfn,
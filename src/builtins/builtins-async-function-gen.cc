@@ -140,6 +140,12 @@ TF_BUILTIN(AsyncFunctionEnter, AsyncFunctionBuiltinsAssembler) {
       parameters_and_registers);
   StoreObjectFieldNoWriteBarrier(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset, promise);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                       RootIndex::kUndefinedValue);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                       RootIndex::kUndefinedValue);
 
   // While we are executing an async function, we need to have the implicit
   // promise on the stack to get the catch prediction right, even before we
@@ -238,14 +244,43 @@ void AsyncFunctionBuiltinsAssembler::AsyncFunctionAwait(
   auto value = Parameter<Object>(Descriptor::kValue);
   auto context = Parameter<Context>(Descriptor::kContext);
 
-  TNode<SharedFunctionInfo> on_resolve_sfi =
-      AsyncFunctionAwaitResolveSharedFunConstant();
-  TNode<SharedFunctionInfo> on_reject_sfi =
-      AsyncFunctionAwaitRejectSharedFunConstant();
   TNode<JSPromise> outer_promise = LoadObjectField<JSPromise>(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset);
-  Await(context, async_function_object, value, outer_promise, on_resolve_sfi,
-        on_reject_sfi, is_predicted_as_caught);
+
+  // The await closures only capture the {async_function_object}, so they are
+  // allocated on the first await and cached on the object for the others.
+  TVARIABLE(HeapObject, var_on_resolve,
+            LoadObjectField<HeapObject>(
+                async_function_object,
+                JSAsyncFunctionObject::kAwaitResolveClosureOffset));
+  TVARIABLE(HeapObject, var_on_reject,
+            LoadObjectField<HeapObject>(
+                async_function_object,
+                JSAsyncFunctionObject::kAwaitRejectClosureOffset));
+  Label if_closures_ready(this);
+  GotoIfNot(IsUndefined(var_on_resolve.value()), &if_closures_ready);
+  {
+    TNode<NativeContext> native_context = LoadNativeContext(context);
+    TNode<Context> closure_context =
+        AllocateAwaitClosureContext(native_context, async_function_object);
+    var_on_resolve = AllocateAwaitClosure(
+        native_context, closure_context,
+        AsyncFunctionAwaitResolveSharedFunConstant());
+    var_on_reject = AllocateAwaitClosure(
+        native_context, closure_context,
+        AsyncFunctionAwaitRejectSharedFunConstant());
+    StoreObjectField(async_function_object,
+                     JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                     var_on_resolve.value());
+    StoreObjectField(async_function_object,
+                     JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                     var_on_reject.value());
+    Goto(&if_closures_ready);
+  }
+  BIND(&if_closures_ready);
+  AwaitWithClosures(context, async_function_object, value, outer_promise,
+                    var_on_resolve.value(), var_on_reject.value(),
+                    BooleanConstant(is_predicted_as_caught));
 
   // Return outer promise to avoid adding an load of the outer promise before
   // suspending in BytecodeGenerator.
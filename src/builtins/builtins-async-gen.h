@@ -36,6 +36,26 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                  on_reject_sfi, BooleanConstant(is_predicted_as_caught));
   }
 
+  // Like Await, but with already allocated {on_resolve} and {on_reject}
+  // closures, e.g. ones cached on the generator by an earlier await.
+  TNode<Object> AwaitWithClosures(TNode<Context> context,
+                                  TNode<JSGeneratorObject> generator,
+                                  TNode<Object> value,
+                                  TNode<JSPromise> outer_promise,
+                                  TNode<HeapObject> on_resolve,
+                                  TNode<HeapObject> on_reject,
+                                  TNode<Oddball> is_predicted_as_caught);
+
+  // Allocate the context shared by the await closures of {generator}, which
+  // stores the {generator} as its extension.
+  TNode<Context> AllocateAwaitClosureContext(
+      TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator);
+
+  // Allocate a native await closure for {shared_info} in {closure_context}.
+  TNode<HeapObject> AllocateAwaitClosure(TNode<NativeContext> native_context,
+                                         TNode<Context> closure_context,
+                                         TNode<SharedFunctionInfo> shared_info);
+
   // Return a new built-in function object as defined in
   // Async Iterator Value Unwrap Functions
   TNode<JSFunction> CreateUnwrapClosure(TNode<NativeContext> native_context,
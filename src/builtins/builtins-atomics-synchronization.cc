@@ -0,0 +1,176 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/builtins/builtins-utils-inl.h"
+#include "src/objects/js-atomics-synchronization-inl.h"
+
+namespace v8 {
+namespace internal {
+
+BUILTIN(AtomicsMutexConstructor) {
+  DCHECK(FLAG_harmony_struct);
+  HandleScope scope(isolate);
+  return *JSAtomicsMutex::Create(isolate);
+}
+
+BUILTIN(AtomicsMutexLock) {
+  DCHECK(FLAG_harmony_struct);
+  constexpr char method_name[] = "Atomics.Mutex.lock";
+  HandleScope scope(isolate);
+
+  Handle<Object> js_mutex_obj = args.atOrUndefined(isolate, 1);
+  if (!js_mutex_obj->IsJSAtomicsMutex()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kMethodInvokedOnWrongType,
+                              isolate->factory()->NewStringFromAsciiChecked(
+                                  method_name)));
+  }
+  Handle<JSAtomicsMutex> js_mutex = Handle<JSAtomicsMutex>::cast(js_mutex_obj);
+  Handle<Object> run_under_lock = args.atOrUndefined(isolate, 2);
+  if (!run_under_lock->IsCallable()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kNotCallable, run_under_lock));
+  }
+
+  // Like Atomics.wait, blocking is not allowed on threads that must not
+  // block, e.g. the main thread of a browser.
+  if (!isolate->allow_atomics_wait()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kAtomicsOperationNotAllowed,
+                              isolate->factory()->NewStringFromAsciiChecked(
+                                  method_name)));
+  }
+
+  Handle<Object> result;
+  {
+    JSAtomicsMutex::LockGuard lock_guard(isolate, js_mutex);
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, result,
+        Execution::Call(isolate, run_under_lock,
+                        isolate->factory()->undefined_value(), 0, nullptr));
+  }
+
+  return *result;
+}
+
+BUILTIN(AtomicsMutexTryLock) {
+  DCHECK(FLAG_harmony_struct);
+  constexpr char method_name[] = "Atomics.Mutex.tryLock";
+  HandleScope scope(isolate);
+
+  Handle<Object> js_mutex_obj = args.atOrUndefined(isolate, 1);
+  if (!js_mutex_obj->IsJSAtomicsMutex()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kMethodInvokedOnWrongType,
+                              isolate->factory()->NewStringFromAsciiChecked(
+                                  method_name)));
+  }
+  Handle<JSAtomicsMutex> js_mutex = Handle<JSAtomicsMutex>::cast(js_mutex_obj);
+  Handle<Object> run_under_lock = args.atOrUndefined(isolate, 2);
+  if (!run_under_lock->IsCallable()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kNotCallable, run_under_lock));
+  }
+
+  if (!js_mutex->TryLock()) return ReadOnlyRoots(isolate).false_value();
+
+  MaybeHandle<Object> result =
+      Execution::Call(isolate, run_under_lock,
+                      isolate->factory()->undefined_value(), 0, nullptr);
+  js_mutex->Unlock(isolate);
+  RETURN_FAILURE_ON_EXCEPTION(isolate, result);
+  return ReadOnlyRoots(isolate).true_value();
+}
+
+BUILTIN(AtomicsConditionConstructor) {
+  DCHECK(FLAG_harmony_struct);
+  HandleScope scope(isolate);
+  return *JSAtomicsCondition::Create(isolate);
+}
+
+BUILTIN(AtomicsConditionWait) {
+  DCHECK(FLAG_harmony_struct);
+  constexpr char method_name[] = "Atomics.Condition.wait";
+  HandleScope scope(isolate);
+
+  Handle<Object> js_condition_obj = args.atOrUndefined(isolate, 1);
+  Handle<Object> js_mutex_obj = args.atOrUndefined(isolate, 2);
+  Handle<Object> timeout_obj = args.atOrUndefined(isolate, 3);
+  if (!js_condition_obj->IsJSAtomicsCondition() ||
+      !js_mutex_obj->IsJSAtomicsMutex()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kMethodInvokedOnWrongType,
+                              isolate->factory()->NewStringFromAsciiChecked(
+                                  method_name)));
+  }
+
+  base::Optional<base::TimeDelta> timeout;
+  if (!timeout_obj->IsUndefined(isolate)) {
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, timeout_obj,
+                                       Object::ToNumber(isolate, timeout_obj));
+    double ms = timeout_obj->Number();
+    // NaN and +Infinity wait forever, like in Atomics.wait.
+    if (!std::isnan(ms) && ms != V8_INFINITY) {
+      timeout = base::TimeDelta::FromMillisecondsD(std::max(ms, 0.0));
+    }
+  }
+
+  if (!isolate->allow_atomics_wait()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kAtomicsOperationNotAllowed,
+                              isolate->factory()->NewStringFromAsciiChecked(
+                                  method_name)));
+  }
+
+  Handle<JSAtomicsCondition> js_condition =
+      Handle<JSAtomicsCondition>::cast(js_condition_obj);
+  Handle<JSAtomicsMutex> js_mutex = Handle<JSAtomicsMutex>::cast(js_mutex_obj);
+  if (!js_mutex->IsHeld()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kAtomicsMutexNotLocked,
+                              isolate->factory()->NewStringFromAsciiChecked(
+                                  method_name)));
+  }
+
+  return isolate->heap()->ToBoolean(
+      JSAtomicsCondition::WaitFor(isolate, js_condition, js_mutex, timeout));
+}
+
+BUILTIN(AtomicsConditionNotify) {
+  DCHECK(FLAG_harmony_struct);
+  constexpr char method_name[] = "Atomics.Condition.notify";
+  HandleScope scope(isolate);
+
+  Handle<Object> js_condition_obj = args.atOrUndefined(isolate, 1);
+  Handle<Object> count_obj = args.atOrUndefined(isolate, 2);
+  if (!js_condition_obj->IsJSAtomicsCondition()) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kMethodInvokedOnWrongType,
+                              isolate->factory()->NewStringFromAsciiChecked(
+                                  method_name)));
+  }
+
+  uint32_t count;
+  if (count_obj->IsUndefined(isolate)) {
+    count = JSAtomicsCondition::kAllWaiters;
+  } else {
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, count_obj, Object::ToInteger(isolate, count_obj));
+    double count_double = count_obj->Number();
+    if (count_double < 0) {
+      count_double = 0;
+    } else if (count_double > JSAtomicsCondition::kAllWaiters) {
+      count_double = JSAtomicsCondition::kAllWaiters;
+    }
+    count = static_cast<uint32_t>(count_double);
+  }
+
+  Handle<JSAtomicsCondition> js_condition =
+      Handle<JSAtomicsCondition>::cast(js_condition_obj);
+  return *isolate->factory()->NewNumberFromUint(
+      js_condition->Notify(isolate, count));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -680,7 +680,10 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
                                              Label* entry_found,
                                              Label* not_found);
   TNode<IntPtrT> ComputeStringHash(TNode<String> string_key);
-  void SameValueZeroString(TNode<String> key_string,
+  // Compares {key_string}, whose hash is {key_hash}, against a table key.
+  // Candidates with a different cached hash are rejected without calling
+  // StringEqual.
+  void SameValueZeroString(TNode<String> key_string, TNode<IntPtrT> key_hash,
                            TNode<Object> candidate_key, Label* if_same,
                            Label* if_not_same);
 
@@ -1302,7 +1305,8 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntryForStringKey(
   FindOrderedHashTableEntry<CollectionType>(
       table, hash,
       [&](TNode<Object> other_key, Label* if_same, Label* if_not_same) {
-        SameValueZeroString(key_tagged, other_key, if_same, if_not_same);
+        SameValueZeroString(key_tagged, hash, other_key, if_same,
+                            if_not_same);
       },
       result, entry_found, not_found);
 }
@@ -1372,12 +1376,23 @@ TNode<IntPtrT> CollectionsBuiltinsAssembler::ComputeStringHash(
 }
 
 void CollectionsBuiltinsAssembler::SameValueZeroString(
-    TNode<String> key_string, TNode<Object> candidate_key, Label* if_same,
-    Label* if_not_same) {
+    TNode<String> key_string, TNode<IntPtrT> key_hash,
+    TNode<Object> candidate_key, Label* if_same, Label* if_not_same) {
+  GotoIf(TaggedEqual(key_string, candidate_key), if_same);
+
   // If the candidate is not a string, the keys are not equal.
   GotoIf(TaggedIsSmi(candidate_key), if_not_same);
   GotoIfNot(IsString(CAST(candidate_key)), if_not_same);
 
+  // Strings in the table had their hash computed on insertion, so unequal
+  // hashes rule out equality. Forwarded hashes take the slow comparison.
+  Label compare_strings(this);
+  const TNode<Uint32T> candidate_hash =
+      LoadNameHash(CAST(candidate_key), &compare_strings);
+  Branch(IntPtrEqual(ChangeInt32ToIntPtr(Signed(candidate_hash)), key_hash),
+         &compare_strings, if_not_same);
+
+  BIND(&compare_strings);
   Branch(TaggedEqual(CallBuiltin(Builtin::kStringEqual, NoContextConstant(),
                                  key_string, candidate_key),
                      TrueConstant()),
@@ -67,6 +67,17 @@ Object SetLocalDateValue(Isolate* isolate, Handle<JSDate> date,
   return *JSDate::SetValue(date, DateCache::TimeClip(time_val));
 }
 
+// Writes {value} as exactly {digits} zero-padded decimal digits.
+uint8_t* WriteDecimalDigits(uint8_t* out, int value, int digits) {
+  DCHECK_GE(value, 0);
+  for (int i = digits - 1; i >= 0; i--) {
+    out[i] = '0' + value % 10;
+    value /= 10;
+  }
+  DCHECK_EQ(0, value);
+  return out + digits;
+}
+
 }  // namespace
 
 // ES #sec-date-constructor
@@ -686,11 +697,33 @@ BUILTIN(DatePrototypeToISOString) {
   int year, month, day, weekday, hour, min, sec, ms;
   isolate->date_cache()->BreakDownTime(time_ms, &year, &month, &day, &weekday,
                                        &hour, &min, &sec, &ms);
-  char buffer[128];
   if (year >= 0 && year <= 9999) {
-    SNPrintF(base::ArrayVector(buffer), "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ",
-             year, month + 1, day, hour, min, sec, ms);
-  } else if (year < 0) {
+    // Fast path for the common fixed-width format YYYY-MM-DDTHH:mm:ss.sssZ,
+    // written straight into the result string.
+    static constexpr int kLength = 24;
+    Handle<SeqOneByteString> result =
+        isolate->factory()->NewRawOneByteString(kLength).ToHandleChecked();
+    DisallowGarbageCollection no_gc;
+    uint8_t* chars = result->GetChars(no_gc);
+    uint8_t* p = WriteDecimalDigits(chars, year, 4);
+    *p++ = '-';
+    p = WriteDecimalDigits(p, month + 1, 2);
+    *p++ = '-';
+    p = WriteDecimalDigits(p, day, 2);
+    *p++ = 'T';
+    p = WriteDecimalDigits(p, hour, 2);
+    *p++ = ':';
+    p = WriteDecimalDigits(p, min, 2);
+    *p++ = ':';
+    p = WriteDecimalDigits(p, sec, 2);
+    *p++ = '.';
+    p = WriteDecimalDigits(p, ms, 3);
+    *p++ = 'Z';
+    DCHECK_EQ(chars + kLength, p);
+    return *result;
+  }
+  char buffer[128];
+  if (year < 0) {
     SNPrintF(base::ArrayVector(buffer), "-%06d-%02d-%02dT%02d:%02d:%02d.%03dZ",
              -year, month + 1, day, hour, min, sec, ms);
   } else {
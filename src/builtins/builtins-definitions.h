@@ -986,6 +986,12 @@ namespace internal {
   /* JS Structs */                                                             \
   CPP(SharedStructTypeConstructor)                                             \
   CPP(SharedStructConstructor)                                                 \
+  CPP(AtomicsMutexConstructor)                                                 \
+  CPP(AtomicsMutexLock)                                                        \
+  CPP(AtomicsMutexTryLock)                                                     \
+  CPP(AtomicsConditionConstructor)                                             \
+  CPP(AtomicsConditionWait)                                                    \
+  CPP(AtomicsConditionNotify)                                                  \
                                                                                \
   /* AsyncGenerator */                                                         \
                                                                                \
@@ -1139,8 +1139,10 @@ BUILTIN(CollatorInternalCompare) {
   // 7. Return CompareStrings(collator, X, Y).
   icu::Collator* icu_collator = collator->icu_collator().raw();
   CHECK_NOT_NULL(icu_collator);
-  return Smi::FromInt(
-      Intl::CompareStrings(isolate, *icu_collator, string_x, string_y));
+  return Smi::FromInt(Intl::CompareStrings(
+      isolate, *icu_collator, string_x, string_y,
+      collator->try_fast_compare() ? Intl::CompareStringsOptions::kTryFastPath
+                                   : Intl::CompareStringsOptions::kNone));
 }
 
 // ecma402 #sec-%segmentiteratorprototype%.next
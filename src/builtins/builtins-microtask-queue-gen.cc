@@ -34,17 +34,31 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
                                            TNode<IntPtrT> start,
                                            TNode<IntPtrT> index);
 
-  void PrepareForContext(TNode<Context> microtask_context, Label* bailout);
-  void RunSingleMicrotask(TNode<Context> current_context,
+  // Enters {native_context} as microtask context unless it is still entered
+  // from the previous microtask, which is tracked in {var_entered_context}.
+  void PrepareForContext(TNode<RawPtrT> hsi, TNode<Context> native_context,
+                         TNode<IntPtrT> saved_entered_context_count,
+                         TVariable<Object>* var_entered_context,
+                         Label* bailout);
+  // Leaves the microtask context kept in {var_entered_context}, if any.
+  void LeaveMicrotaskContext(TNode<RawPtrT> hsi,
+                             TNode<IntPtrT> saved_entered_context_count,
+                             TVariable<Object>* var_entered_context);
+  void RunSingleMicrotask(TNode<RawPtrT> hsi, TNode<Context> current_context,
+                          TNode<IntPtrT> saved_entered_context_count,
+                          TVariable<Object>* var_entered_context,
                           TNode<Microtask> microtask);
   void IncrementFinishedMicrotaskCount(TNode<RawPtrT> microtask_queue);
 
   TNode<Context> GetCurrentContext();
   void SetCurrentContext(TNode<Context> context);
 
-  TNode<IntPtrT> GetEnteredContextCount();
-  void EnterMicrotaskContext(TNode<Context> native_context);
-  void RewindEnteredContext(TNode<IntPtrT> saved_entered_context_count);
+  TNode<RawPtrT> GetHandleScopeImplementer();
+  TNode<IntPtrT> GetEnteredContextCount(TNode<RawPtrT> hsi);
+  void EnterMicrotaskContext(TNode<RawPtrT> hsi,
+                             TNode<Context> native_context);
+  void RewindEnteredContext(TNode<RawPtrT> hsi,
+                            TNode<IntPtrT> saved_entered_context_count);
 
   void RunAllPromiseHooks(PromiseHookType type, TNode<Context> context,
                           TNode<HeapObject> promise_or_capability);
@@ -104,23 +118,56 @@ TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::CalculateRingBufferOffset(
 }
 
 void MicrotaskQueueBuiltinsAssembler::PrepareForContext(
-    TNode<Context> native_context, Label* bailout) {
+    TNode<RawPtrT> hsi, TNode<Context> native_context,
+    TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_entered_context, Label* bailout) {
   CSA_DCHECK(this, IsNativeContext(native_context));
 
   // Skip the microtask execution if the associated context is shutdown.
   GotoIf(WordEqual(GetMicrotaskQueue(native_context), IntPtrConstant(0)),
          bailout);
 
-  EnterMicrotaskContext(native_context);
+  // Consecutive microtasks of the same native context, e.g. the reaction jobs
+  // of a promise chain, keep the context entered instead of leaving and
+  // re-entering it for every microtask. That only holds as long as the
+  // previous microtask left the entered contexts balanced.
+  Label enter(this), done(this);
+  GotoIfNot(TaggedEqual(var_entered_context->value(), native_context), &enter);
+  Branch(IntPtrEqual(GetEnteredContextCount(hsi),
+                     IntPtrAdd(saved_entered_context_count, IntPtrConstant(1))),
+         &done, &enter);
+
+  BIND(&enter);
+  {
+    LeaveMicrotaskContext(hsi, saved_entered_context_count,
+                          var_entered_context);
+    EnterMicrotaskContext(hsi, native_context);
+    *var_entered_context = native_context;
+    Goto(&done);
+  }
+
+  BIND(&done);
   SetCurrentContext(native_context);
 }
 
+void MicrotaskQueueBuiltinsAssembler::LeaveMicrotaskContext(
+    TNode<RawPtrT> hsi, TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_entered_context) {
+  Label done(this);
+  GotoIf(IsUndefined(var_entered_context->value()), &done);
+  RewindEnteredContext(hsi, saved_entered_context_count);
+  *var_entered_context = UndefinedConstant();
+  Goto(&done);
+  BIND(&done);
+}
+
 void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
-    TNode<Context> current_context, TNode<Microtask> microtask) {
+    TNode<RawPtrT> hsi, TNode<Context> current_context,
+    TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_entered_context, TNode<Microtask> microtask) {
   CSA_DCHECK(this, TaggedIsNotSmi(microtask));
 
   StoreRoot(RootIndex::kCurrentMicrotask, microtask);
-  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
   TNode<Map> microtask_map = LoadMap(microtask);
   TNode<Uint16T> microtask_type = LoadMapInstanceType(microtask_map);
 
@@ -149,7 +196,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context =
         LoadObjectField<Context>(microtask, CallableTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(hsi, native_context, saved_entered_context_count,
+                      var_entered_context, &done);
 
     TNode<JSReceiver> callable =
         LoadObjectField<JSReceiver>(microtask, CallableTask::kCallableOffset);
@@ -157,13 +205,17 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
       ScopedExceptionHandler handler(this, &if_exception, &var_exception);
       Call(microtask_context, callable, UndefinedConstant());
     }
-    RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
 
   BIND(&is_callback);
   {
+    // Callbacks run in the {current_context} without an entered microtask
+    // context.
+    LeaveMicrotaskContext(hsi, saved_entered_context_count,
+                          var_entered_context);
+
     const TNode<Object> microtask_callback =
         LoadObjectField(microtask, CallbackTask::kCallbackOffset);
     const TNode<Object> microtask_data =
@@ -193,7 +245,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseResolveThenableJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(hsi, native_context, saved_entered_context_count,
+                      var_entered_context, &done);
 
     const TNode<Object> promise_to_resolve = LoadObjectField(
         microtask, PromiseResolveThenableJobTask::kPromiseToResolveOffset);
@@ -214,7 +267,6 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     RunAllPromiseHooks(PromiseHookType::kAfter, microtask_context,
                    CAST(promise_to_resolve));
 
-    RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -225,7 +277,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseReactionJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(hsi, native_context, saved_entered_context_count,
+                      var_entered_context, &done);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
@@ -267,7 +320,6 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     Goto(&preserved_data_reset_done);
     BIND(&preserved_data_reset_done);
 
-    RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -278,7 +330,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseReactionJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(hsi, native_context, saved_entered_context_count,
+                      var_entered_context, &done);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
@@ -320,7 +373,6 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     Goto(&preserved_data_reset_done);
     BIND(&preserved_data_reset_done);
 
-    RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -333,7 +385,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     // Report unhandled exceptions from microtasks.
     CallRuntime(Runtime::kReportMessageFromMicrotask, GetCurrentContext(),
                 var_exception.value());
-    RewindEnteredContext(saved_entered_context_count);
+    LeaveMicrotaskContext(hsi, saved_entered_context_count,
+                          var_entered_context);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -365,10 +418,13 @@ void MicrotaskQueueBuiltinsAssembler::SetCurrentContext(
   StoreFullTaggedNoWriteBarrier(ExternalConstant(ref), context);
 }
 
-TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::GetEnteredContextCount() {
+TNode<RawPtrT> MicrotaskQueueBuiltinsAssembler::GetHandleScopeImplementer() {
   auto ref = ExternalReference::handle_scope_implementer_address(isolate());
-  TNode<RawPtrT> hsi = Load<RawPtrT>(ExternalConstant(ref));
+  return Load<RawPtrT>(ExternalConstant(ref));
+}
 
+TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::GetEnteredContextCount(
+    TNode<RawPtrT> hsi) {
   using ContextStack = DetachableVector<Context>;
   TNode<IntPtrT> size_offset =
       IntPtrConstant(HandleScopeImplementer::kEnteredContextsOffset +
@@ -377,12 +433,9 @@ TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::GetEnteredContextCount() {
 }
 
 void MicrotaskQueueBuiltinsAssembler::EnterMicrotaskContext(
-    TNode<Context> native_context) {
+    TNode<RawPtrT> hsi, TNode<Context> native_context) {
   CSA_DCHECK(this, IsNativeContext(native_context));
 
-  auto ref = ExternalReference::handle_scope_implementer_address(isolate());
-  TNode<RawPtrT> hsi = Load<RawPtrT>(ExternalConstant(ref));
-
   using ContextStack = DetachableVector<Context>;
   TNode<IntPtrT> capacity_offset =
       IntPtrConstant(HandleScopeImplementer::kEnteredContextsOffset +
@@ -449,10 +502,7 @@ void MicrotaskQueueBuiltinsAssembler::EnterMicrotaskContext(
 }
 
 void MicrotaskQueueBuiltinsAssembler::RewindEnteredContext(
-    TNode<IntPtrT> saved_entered_context_count) {
-  auto ref = ExternalReference::handle_scope_implementer_address(isolate());
-  TNode<RawPtrT> hsi = Load<RawPtrT>(ExternalConstant(ref));
-
+    TNode<RawPtrT> hsi, TNode<IntPtrT> saved_entered_context_count) {
   using ContextStack = DetachableVector<Context>;
   TNode<IntPtrT> size_offset =
       IntPtrConstant(HandleScopeImplementer::kEnteredContextsOffset +
@@ -585,7 +635,13 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   auto microtask_queue =
       UncheckedParameter<RawPtrT>(Descriptor::kMicrotaskQueue);
 
-  Label loop(this), done(this);
+  // The HandleScopeImplementer and the entered context depth are the same at
+  // the start of every microtask, so look them up once per drain.
+  TNode<RawPtrT> hsi = GetHandleScopeImplementer();
+  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount(hsi);
+  TVARIABLE(Object, var_entered_context, UndefinedConstant());
+
+  Label loop(this, &var_entered_context), done(this);
   Goto(&loop);
   BIND(&loop);
 
@@ -612,12 +668,16 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   SetMicrotaskQueueSize(microtask_queue, new_size);
   SetMicrotaskQueueStart(microtask_queue, new_start);
 
-  RunSingleMicrotask(current_context, microtask);
+  RunSingleMicrotask(hsi, current_context, saved_entered_context_count,
+                     &var_entered_context, microtask);
   IncrementFinishedMicrotaskCount(microtask_queue);
   Goto(&loop);
 
   BIND(&done);
   {
+    LeaveMicrotaskContext(hsi, saved_entered_context_count,
+                          &var_entered_context);
+
     // Reset the "current microtask" on the isolate.
     StoreRoot(RootIndex::kCurrentMicrotask, UndefinedConstant());
     Return(UndefinedConstant());
@@ -11,6 +11,7 @@
 #include "src/ic/keyed-store-generic.h"
 #include "src/objects/js-generator.h"
 #include "src/objects/js-objects.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/property-descriptor-object.h"
 #include "src/objects/property-details.h"
 #include "src/objects/shared-function-info.h"
@@ -53,6 +54,12 @@ class ObjectBuiltinsAssembler : public CodeStubAssembler {
                                           TNode<BoolT> configurable);
   TNode<HeapObject> GetAccessorOrUndefined(TNode<HeapObject> accessor,
                                            Label* if_bailout);
+
+  // Performs Object.assign(to, source) for an empty object literal {to} by
+  // copying the fields of {source} and switching {to} to the map found in
+  // the ObjectAssignCache. Jumps to {if_slow} if that isn't possible.
+  void AssignToEmptyObject(TNode<Context> context, TNode<JSReceiver> to,
+                           TNode<Object> source, Label* if_slow);
 };
 
 class ObjectEntriesValuesBuiltinsAssembler : public ObjectBuiltinsAssembler {
@@ -446,11 +453,20 @@ TF_BUILTIN(ObjectAssign, ObjectBuiltinsAssembler) {
   // 3. Let sources be the List of argument values starting with the
   //    second argument.
   // 4. For each element nextSource of sources, in ascending index order,
+  // When {to} is an empty object literal, the first source can often be
+  // copied wholesale, e.g. for Object.assign({}, state, changes).
+  TVARIABLE(IntPtrT, var_first_source, IntPtrConstant(1));
+  Label remaining_sources(this);
+  AssignToEmptyObject(context, to, args.AtIndex(1), &remaining_sources);
+  var_first_source = IntPtrConstant(2);
+  Goto(&remaining_sources);
+
+  BIND(&remaining_sources);
   args.ForEach(
       [=](TNode<Object> next_source) {
         CallBuiltin(Builtin::kSetDataProperties, context, to, next_source);
       },
-      IntPtrConstant(1));
+      var_first_source.value());
   Goto(&done);
 
   // 5. Return to.
@@ -458,6 +474,135 @@ TF_BUILTIN(ObjectAssign, ObjectBuiltinsAssembler) {
   args.PopAndReturn(to);
 }
 
+void ObjectBuiltinsAssembler::AssignToEmptyObject(TNode<Context> context,
+                                                  TNode<JSReceiver> to,
+                                                  TNode<Object> source,
+                                                  Label* if_slow) {
+  GotoIf(TaggedIsSmi(source), if_slow);
+
+  // {to} must be a fresh empty object literal.
+  TNode<NativeContext> native_context = LoadNativeContext(context);
+  TNode<Map> to_map = LoadMap(to);
+  GotoIfNot(TaggedEqual(to_map, LoadObjectFunctionInitialMap(native_context)),
+            if_slow);
+  GotoIfNot(TaggedEqual(LoadObjectField(to, JSObject::kPropertiesOrHashOffset),
+                        EmptyFixedArrayConstant()),
+            if_slow);
+  GotoIfNot(TaggedEqual(LoadElements(CAST(to)), EmptyFixedArrayConstant()),
+            if_slow);
+
+  TNode<HeapObject> source_object = CAST(source);
+  TNode<Map> source_map = LoadMap(source_object);
+  GotoIfNot(IsJSObjectMap(source_map), if_slow);
+  GotoIf(IsDeprecatedMap(source_map), if_slow);
+  GotoIfNot(
+      TaggedEqual(LoadElements(CAST(source_object)), EmptyFixedArrayConstant()),
+      if_slow);
+
+  // Probe the ObjectAssignCache for (to_map, source_map), see
+  // ObjectAssignCache::Hash().
+  TVARIABLE(Map, var_result_map);
+  Label if_result_map(this), if_miss(this, Label::kDeferred);
+  {
+    TNode<WordT> to_map_word = BitcastTaggedToWord(to_map);
+    TNode<WordT> source_map_word = BitcastTaggedToWord(source_map);
+    TNode<IntPtrT> index = Signed(WordAnd(
+        WordShr(WordXor(to_map_word, source_map_word), kTaggedSizeLog2),
+        IntPtrConstant(ObjectAssignCache::kLength - 1)));
+    TNode<IntPtrT> entry =
+        IntPtrMul(index, IntPtrConstant(ObjectAssignCache::kEntrySize));
+    TNode<ExternalReference> entries = ExternalConstant(
+        ExternalReference::object_assign_cache_entries(isolate()));
+    auto load_entry_field = [&](int offset) {
+      return Load<UintPtrT>(entries, IntPtrAdd(entry, IntPtrConstant(offset)));
+    };
+
+    GotoIfNot(WordEqual(load_entry_field(ObjectAssignCache::kEntryTargetOffset),
+                        to_map_word),
+              &if_miss);
+    GotoIfNot(WordEqual(load_entry_field(ObjectAssignCache::kEntrySourceOffset),
+                        source_map_word),
+              &if_miss);
+    TNode<Cell> validity_cell = CAST(BitcastWordToTagged(
+        load_entry_field(ObjectAssignCache::kEntryValidityCellOffset)));
+    GotoIfNot(TaggedEqual(LoadCellValue(validity_cell),
+                          SmiConstant(Map::kPrototypeChainValid)),
+              &if_miss);
+    TNode<UintPtrT> result_map_word =
+        load_entry_field(ObjectAssignCache::kEntryResultOffset);
+    // A cleared result records that the assignment is not a plain copy.
+    GotoIf(WordEqual(result_map_word, UintPtrConstant(kNullAddress)),
+           if_slow);
+    TNode<Map> result_map = CAST(BitcastWordToTagged(result_map_word));
+    GotoIf(IsDeprecatedMap(result_map), &if_miss);
+    var_result_map = result_map;
+    Goto(&if_result_map);
+  }
+
+  BIND(&if_miss);
+  {
+    TNode<Object> maybe_result_map = CallRuntime(
+        Runtime::kObjectAssignCloneMap, context, to, source_object);
+    GotoIf(IsUndefined(maybe_result_map), if_slow);
+    var_result_map = CAST(maybe_result_map);
+    Goto(&if_result_map);
+  }
+
+  BIND(&if_result_map);
+  TNode<Map> result_map = var_result_map.value();
+  CSA_DCHECK(this, IntPtrEqual(LoadMapInstanceSizeInWords(to_map),
+                               LoadMapInstanceSizeInWords(result_map)));
+
+  // Copy the out-of-object properties. The source PropertyArray may carry
+  // the identity hash of {source}, so it is never shared.
+  TVARIABLE(HeapObject, var_properties, EmptyFixedArrayConstant());
+  {
+    Label done(this);
+    TNode<Object> source_properties =
+        LoadObjectField(source_object, JSObject::kPropertiesOrHashOffset);
+    GotoIf(TaggedIsSmi(source_properties), &done);
+    GotoIf(IsEmptyFixedArray(CAST(source_properties)), &done);
+    TNode<PropertyArray> source_property_array = CAST(source_properties);
+    TNode<IntPtrT> length = LoadPropertyArrayLength(source_property_array);
+    GotoIf(IntPtrEqual(length, IntPtrConstant(0)), &done);
+    TNode<PropertyArray> property_array = AllocatePropertyArray(length);
+    FillPropertyArrayWithUndefined(property_array, IntPtrConstant(0), length);
+    CopyPropertyArrayValues(source_property_array, property_array, length,
+                            SKIP_WRITE_BARRIER, DestroySource::kNo);
+    var_properties = property_array;
+    Goto(&done);
+    BIND(&done);
+  }
+
+  // Copy the in-object properties, which live at the same offsets in both
+  // objects. {to} is not necessarily in new space, so the stores need write
+  // barriers, and mutable HeapNumbers must not be shared with {source}.
+  BuildFastLoop<IntPtrT>(
+      LoadMapInobjectPropertiesStartInWords(source_map),
+      LoadMapInstanceSizeInWords(source_map),
+      [=](TNode<IntPtrT> field_index) {
+        TNode<IntPtrT> field_offset = TimesTaggedSize(field_index);
+        TNode<Object> field = LoadObjectField(source_object, field_offset);
+        Label store_field(this), copy_heap_number(this, Label::kDeferred);
+        TVARIABLE(Object, var_field, field);
+        GotoIf(TaggedIsSmi(field), &store_field);
+        Branch(IsHeapNumber(CAST(field)), &copy_heap_number, &store_field);
+        BIND(&copy_heap_number);
+        {
+          var_field = AllocateHeapNumberWithValue(
+              LoadHeapNumberValue(CAST(field)));
+          Goto(&store_field);
+        }
+        BIND(&store_field);
+        StoreObjectField(to, field_offset, var_field.value());
+      },
+      1, IndexAdvanceMode::kPost);
+
+  StoreObjectField(to, JSObject::kPropertiesOrHashOffset,
+                   var_properties.value());
+  StoreMap(to, result_map);
+}
+
 // ES #sec-object.keys
 TF_BUILTIN(ObjectKeys, ObjectBuiltinsAssembler) {
   auto object = Parameter<Object>(Descriptor::kObject);
@@ -960,15 +960,33 @@ TF_BUILTIN(RegExpExecAtom, RegExpBuiltinsAssembler) {
   CSA_DCHECK(this, IntPtrGreaterThan(LoadStringLengthAsWord(needle_string),
                                      IntPtrConstant(0)));
 
-  const TNode<Smi> match_from =
-      CAST(CallBuiltin(Builtin::kStringIndexOf, context, subject_string,
-                       needle_string, last_index));
+  Label if_failure(this), if_success(this), if_sticky(this), if_search(this);
+  TVARIABLE(Smi, var_match_from);
+  const TNode<Smi> flags =
+      CAST(UnsafeLoadFixedArrayElement(data, JSRegExp::kFlagsIndex));
+  Branch(IsSetSmi(flags, JSRegExp::kSticky), &if_sticky, &if_search);
+
+  BIND(&if_sticky);
+  {
+    // Sticky atoms don't search; they only compare at {last_index}.
+    var_match_from = last_index;
+    Branch(RegExpAtomMatchesAt(subject_string, needle_string,
+                               SmiUntag(last_index)),
+           &if_success, &if_failure);
+  }
 
-  Label if_failure(this), if_success(this);
-  Branch(SmiEqual(match_from, SmiConstant(-1)), &if_failure, &if_success);
+  BIND(&if_search);
+  {
+    var_match_from =
+        CAST(CallBuiltin(Builtin::kStringIndexOf, context, subject_string,
+                         needle_string, last_index));
+    Branch(SmiEqual(var_match_from.value(), SmiConstant(-1)), &if_failure,
+           &if_success);
+  }
 
   BIND(&if_success);
   {
+    const TNode<Smi> match_from = var_match_from.value();
     CSA_DCHECK(this, TaggedIsPositiveSmi(match_from));
     CSA_DCHECK(this, UintPtrLessThan(SmiUntag(match_from),
                                      LoadStringLengthAsWord(subject_string)));
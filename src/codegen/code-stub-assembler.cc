@@ -25,6 +25,7 @@
 #include "src/objects/heap-number.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/js-generator.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/oddball.h"
 #include "src/objects/ordered-hash-table-inl.h"
 #include "src/objects/property-cell.h"
@@ -1589,6 +1590,19 @@ TNode<Uint32T> CodeStubAssembler::ChangeExternalPointerToIndex(
   TNode<Uint32T> shifted_index = ReinterpretCast<Uint32T>(external_pointer);
   return Word32Shr(shifted_index, Uint32Constant(kExternalPointerIndexShift));
 }
+
+TNode<IntPtrT> CodeStubAssembler::ChangeExternalPointerToTableOffset(
+    TNode<ExternalPointerT> external_pointer) {
+  DCHECK_EQ(kExternalPointerSize, kUInt32Size);
+  // The index is stored shifted by more than the entry size, so a single
+  // right shift turns it into the entry's offset.
+  STATIC_ASSERT(kExternalPointerIndexShift > kSystemPointerSizeLog2);
+  TNode<Uint32T> shifted_index = ReinterpretCast<Uint32T>(external_pointer);
+  TNode<Uint32T> offset = Word32Shr(
+      shifted_index,
+      Uint32Constant(kExternalPointerIndexShift - kSystemPointerSizeLog2));
+  return Signed(ChangeUint32ToWord(offset));
+}
 #endif  // V8_SANDBOXED_EXTERNAL_POINTERS
 
 void CodeStubAssembler::InitializeExternalPointerField(TNode<HeapObject> object,
@@ -1629,11 +1643,7 @@ TNode<RawPtrT> CodeStubAssembler::LoadExternalPointerFromObject(
 
   TNode<ExternalPointerT> encoded =
       LoadObjectField<ExternalPointerT>(object, offset);
-  TNode<Uint32T> index = ChangeExternalPointerToIndex(encoded);
-  // TODO(v8:10391): consider updating ElementOffsetFromIndex to generate code
-  // that does one shift right instead of two shifts (right and then left).
-  TNode<IntPtrT> table_offset = ElementOffsetFromIndex(
-      ChangeUint32ToWord(index), SYSTEM_POINTER_ELEMENTS, 0);
+  TNode<IntPtrT> table_offset = ChangeExternalPointerToTableOffset(encoded);
 
   TNode<UintPtrT> entry = Load<UintPtrT>(table, table_offset);
   if (external_pointer_tag != 0) {
@@ -1658,11 +1668,7 @@ void CodeStubAssembler::StoreExternalPointerToObject(
 
   TNode<ExternalPointerT> encoded =
       LoadObjectField<ExternalPointerT>(object, offset);
-  TNode<Uint32T> index = ChangeExternalPointerToIndex(encoded);
-  // TODO(v8:10391): consider updating ElementOffsetFromIndex to generate code
-  // that does one shift right instead of two shifts (right and then left).
-  TNode<IntPtrT> table_offset = ElementOffsetFromIndex(
-      ChangeUint32ToWord(index), SYSTEM_POINTER_ELEMENTS, 0);
+  TNode<IntPtrT> table_offset = ChangeExternalPointerToTableOffset(encoded);
 
   TNode<UintPtrT> value = UncheckedCast<UintPtrT>(pointer);
   if (external_pointer_tag != 0) {
@@ -7296,12 +7302,16 @@ TNode<String> CodeStubAssembler::NumberToString(TNode<Number> input,
   TNode<FixedArray> number_string_cache = NumberStringCacheConstant();
 
   // Make the hash mask from the length of the number string cache. It
-  // contains two elements (number and string) for each cache entry.
+  // contains two elements (number and string) for each cache entry, and is
+  // 2-way set-associative, so the mask selects the first entry of a pair.
+  // Keep in sync with Factory::NumberToStringCacheHash.
   TNode<IntPtrT> number_string_cache_length =
       LoadAndUntagFixedArrayBaseLength(number_string_cache);
-  TNode<Int32T> one = Int32Constant(1);
   TNode<Word32T> mask = Int32Sub(
-      Word32Shr(TruncateWordToInt32(number_string_cache_length), one), one);
+      Word32Shr(TruncateWordToInt32(number_string_cache_length),
+                Int32Constant(1)),
+      Int32Constant(2));
+  const int kEntrySize = 2;
 
   GotoIfNot(TaggedIsSmi(input), &if_heap_number);
   smi_input = CAST(input);
@@ -7319,29 +7329,37 @@ TNode<String> CodeStubAssembler::NumberToString(TNode<Number> input,
         LoadObjectField<Int32T>(heap_number_input, HeapNumber::kValueOffset);
     TNode<Int32T> high = LoadObjectField<Int32T>(
         heap_number_input, HeapNumber::kValueOffset + kIntSize);
-    TNode<Word32T> hash = Word32And(Word32Xor(low, high), mask);
+    TNode<Word32T> hash = Word32Xor(low, high);
+    hash = Word32And(Word32Xor(hash, Word32Shr(hash, Int32Constant(16))), mask);
     TNode<IntPtrT> entry_index =
         Signed(ChangeUint32ToWord(Int32Add(hash, hash)));
 
-    // Cache entry's key must be a heap number
-    TNode<Object> number_key =
-        UnsafeLoadFixedArrayElement(number_string_cache, entry_index);
-    GotoIf(TaggedIsSmi(number_key), bailout);
-    TNode<HeapObject> number_key_heap_object = CAST(number_key);
-    GotoIfNot(IsHeapNumber(number_key_heap_object), bailout);
-
-    // Cache entry's key must match the heap number value we're looking for.
-    TNode<Int32T> low_compare = LoadObjectField<Int32T>(
-        number_key_heap_object, HeapNumber::kValueOffset);
-    TNode<Int32T> high_compare = LoadObjectField<Int32T>(
-        number_key_heap_object, HeapNumber::kValueOffset + kIntSize);
-    GotoIfNot(Word32Equal(low, low_compare), bailout);
-    GotoIfNot(Word32Equal(high, high_compare), bailout);
-
-    // Heap number match, return value from cache entry.
-    result = CAST(UnsafeLoadFixedArrayElement(number_string_cache, entry_index,
-                                              kTaggedSize));
-    Goto(&done);
+    // Look for a matching key in both entries of the set.
+    Label if_second_entry(this);
+    auto try_entry = [&](TNode<IntPtrT> index, Label* if_miss) {
+      // Cache entry's key must be a heap number
+      TNode<Object> number_key =
+          UnsafeLoadFixedArrayElement(number_string_cache, index);
+      GotoIf(TaggedIsSmi(number_key), if_miss);
+      TNode<HeapObject> number_key_heap_object = CAST(number_key);
+      GotoIfNot(IsHeapNumber(number_key_heap_object), if_miss);
+
+      // Cache entry's key must match the heap number value we're looking for.
+      TNode<Int32T> low_compare = LoadObjectField<Int32T>(
+          number_key_heap_object, HeapNumber::kValueOffset);
+      TNode<Int32T> high_compare = LoadObjectField<Int32T>(
+          number_key_heap_object, HeapNumber::kValueOffset + kIntSize);
+      GotoIfNot(Word32Equal(low, low_compare), if_miss);
+      GotoIfNot(Word32Equal(high, high_compare), if_miss);
+
+      // Heap number match, return value from cache entry.
+      result = CAST(
+          UnsafeLoadFixedArrayElement(number_string_cache, index, kTaggedSize));
+      Goto(&done);
+    };
+    try_entry(entry_index, &if_second_entry);
+    BIND(&if_second_entry);
+    try_entry(IntPtrAdd(entry_index, IntPtrConstant(kEntrySize)), bailout);
   }
 
   BIND(&if_smi);
@@ -7351,16 +7369,26 @@ TNode<String> CodeStubAssembler::NumberToString(TNode<Number> input,
     TNode<Word32T> hash = Word32And(SmiToInt32(smi_input.value()), mask);
     TNode<IntPtrT> entry_index =
         Signed(ChangeUint32ToWord(Int32Add(hash, hash)));
+    TNode<IntPtrT> second_entry_index =
+        IntPtrAdd(entry_index, IntPtrConstant(kEntrySize));
+    Label if_first_entry_missed(this), if_smi_cache_missed(this);
     TNode<Object> smi_key =
         UnsafeLoadFixedArrayElement(number_string_cache, entry_index);
-    Label if_smi_cache_missed(this);
-    GotoIf(TaggedNotEqual(smi_key, smi_input.value()), &if_smi_cache_missed);
+    GotoIf(TaggedNotEqual(smi_key, smi_input.value()), &if_first_entry_missed);
 
     // Smi match, return value from cache entry.
     result = CAST(UnsafeLoadFixedArrayElement(number_string_cache, entry_index,
                                               kTaggedSize));
     Goto(&done);
 
+    BIND(&if_first_entry_missed);
+    smi_key =
+        UnsafeLoadFixedArrayElement(number_string_cache, second_entry_index);
+    GotoIf(TaggedNotEqual(smi_key, smi_input.value()), &if_smi_cache_missed);
+    result = CAST(UnsafeLoadFixedArrayElement(
+        number_string_cache, second_entry_index, kTaggedSize));
+    Goto(&done);
+
     BIND(&if_smi_cache_missed);
     {
       Label store_to_cache(this);
@@ -7378,7 +7406,16 @@ TNode<String> CodeStubAssembler::NumberToString(TNode<Number> input,
         result = NumberToStringSmi(SmiToInt32(smi_input.value()),
                                    Int32Constant(10), bailout);
 
-        // Store string into cache.
+        // Store string into the first entry of the set, moving its previous
+        // occupant to the second one.
+        StoreFixedArrayElement(
+            number_string_cache, second_entry_index,
+            UnsafeLoadFixedArrayElement(number_string_cache, entry_index));
+        StoreFixedArrayElement(
+            number_string_cache,
+            IntPtrAdd(second_entry_index, IntPtrConstant(1)),
+            UnsafeLoadFixedArrayElement(number_string_cache, entry_index,
+                                        kTaggedSize));
         StoreFixedArrayElement(number_string_cache, entry_index,
                                smi_input.value());
         StoreFixedArrayElement(number_string_cache,
@@ -9364,6 +9401,87 @@ void CodeStubAssembler::DescriptorLookup(TNode<Name> unique_name,
                           var_name_index, if_not_found);
 }
 
+void CodeStubAssembler::DescriptorLookupWithCache(
+    TNode<Name> unique_name, TNode<Map> map, TNode<DescriptorArray> descriptors,
+    TNode<Uint32T> bitfield3, Label* if_found,
+    TVariable<IntPtrT>* var_name_index, Label* if_not_found) {
+  Comment("DescriptorLookupWithCache");
+  TNode<Uint32T> nof =
+      DecodeWord32<Map::Bits3::NumberOfOwnDescriptorsBits>(bitfield3);
+  Label use_cache(this), search(this);
+  const int kMinDescriptors = DescriptorLookupCache::kMinDescriptorsForCaching;
+  Branch(Uint32GreaterThan(nof, Int32Constant(kMinDescriptors)), &use_cache,
+         &search);
+
+  BIND(&search);
+  Lookup<DescriptorArray>(unique_name, descriptors, nof, if_found,
+                          var_name_index, if_not_found);
+
+  BIND(&use_cache);
+  // See DescriptorLookupCache::Hash().
+  STATIC_ASSERT(base::bits::IsPowerOfTwo(DescriptorLookupCache::kLength));
+  TNode<Word32T> map_hash = Word32Shr(
+      TruncateIntPtrToInt32(BitcastTaggedToWord(map)), kTaggedSizeLog2);
+  TNode<Word32T> hash =
+      Word32Xor(map_hash, LoadNameHashAssumeComputed(unique_name));
+  TNode<IntPtrT> index = Signed(ChangeUint32ToWord(
+      Word32And(hash, Int32Constant(DescriptorLookupCache::kLength - 1))));
+  TNode<IntPtrT> key_offset =
+      IntPtrMul(index, IntPtrConstant(DescriptorLookupCache::kKeySize));
+  TNode<IntPtrT> result_offset =
+      IntPtrMul(index, IntPtrConstant(DescriptorLookupCache::kResultSize));
+  TNode<ExternalReference> keys = ExternalConstant(
+      ExternalReference::descriptor_lookup_cache_keys(isolate()));
+  TNode<ExternalReference> results = ExternalConstant(
+      ExternalReference::descriptor_lookup_cache_results(isolate()));
+  TNode<IntPtrT> source_offset = IntPtrAdd(
+      key_offset, IntPtrConstant(DescriptorLookupCache::kKeySourceOffset));
+  TNode<IntPtrT> name_offset = IntPtrAdd(
+      key_offset, IntPtrConstant(DescriptorLookupCache::kKeyNameOffset));
+  TNode<UintPtrT> map_word = Unsigned(BitcastTaggedToWord(map));
+  TNode<UintPtrT> name_word = Unsigned(BitcastTaggedToWord(unique_name));
+
+  Label cache_miss(this);
+  GotoIfNot(WordEqual(Load<UintPtrT>(keys, source_offset), map_word),
+            &cache_miss);
+  GotoIfNot(WordEqual(Load<UintPtrT>(keys, name_offset), name_word),
+            &cache_miss);
+  {
+    TNode<Int32T> result = Load<Int32T>(results, result_offset);
+    GotoIf(Word32Equal(result, Int32Constant(DescriptorArray::kNotFound)),
+           if_not_found);
+    *var_name_index = ToKeyIndex<DescriptorArray>(Unsigned(result));
+    Goto(if_found);
+  }
+
+  BIND(&cache_miss);
+  {
+    auto update_cache = [&](TNode<Int32T> result) {
+      StoreNoWriteBarrier(MachineType::PointerRepresentation(), keys,
+                          source_offset, map_word);
+      StoreNoWriteBarrier(MachineType::PointerRepresentation(), keys,
+                          name_offset, name_word);
+      StoreNoWriteBarrier(MachineRepresentation::kWord32, results,
+                          result_offset, result);
+    };
+    Label found(this), not_found(this);
+    Lookup<DescriptorArray>(unique_name, descriptors, nof, &found,
+                            var_name_index, &not_found);
+
+    BIND(&found);
+    TNode<IntPtrT> descriptor_number = IntPtrDiv(
+        IntPtrSub(var_name_index->value(),
+                  IntPtrConstant(DescriptorArray::ToKeyIndex(0))),
+        IntPtrConstant(DescriptorArray::kEntrySize));
+    update_cache(TruncateIntPtrToInt32(descriptor_number));
+    Goto(if_found);
+
+    BIND(&not_found);
+    update_cache(Int32Constant(DescriptorArray::kNotFound));
+    Goto(if_not_found);
+  }
+}
+
 void CodeStubAssembler::TransitionLookup(TNode<Name> unique_name,
                                          TNode<TransitionArray> transitions,
                                          Label* if_found,
@@ -1097,6 +1097,10 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
 #ifdef V8_SANDBOXED_EXTERNAL_POINTERS
   TNode<ExternalPointerT> ChangeIndexToExternalPointer(TNode<Uint32T> index);
   TNode<Uint32T> ChangeExternalPointerToIndex(TNode<ExternalPointerT> pointer);
+  // Returns the byte offset of the entry for {pointer} in the external pointer
+  // table.
+  TNode<IntPtrT> ChangeExternalPointerToTableOffset(
+      TNode<ExternalPointerT> pointer);
 #endif  // V8_SANDBOXED_EXTERNAL_POINTERS
 
   // Initialize an external pointer field in an object.
@@ -3928,6 +3932,15 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
                         TVariable<IntPtrT>* var_name_index,
                         Label* if_not_found);
 
+  // Implements DescriptorArray::SearchWithCache(): like DescriptorLookup(), but
+  // consults and updates the isolate's DescriptorLookupCache for maps with
+  // many own descriptors.
+  void DescriptorLookupWithCache(TNode<Name> unique_name, TNode<Map> map,
+                                 TNode<DescriptorArray> descriptors,
+                                 TNode<Uint32T> bitfield3, Label* if_found,
+                                 TVariable<IntPtrT>* var_name_index,
+                                 Label* if_not_found);
+
   // Implements TransitionArray::SearchName() - searches for first transition
   // entry with given name (note that there could be multiple entries with
   // the same name).
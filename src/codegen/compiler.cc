@@ -918,8 +918,9 @@ class OptimizedCodeCache : public AllStatic {
       }
     }
 
-    DCHECK_IMPLIES(!code.is_null(), code.kind() <= code_kind);
-    if (code.is_null() || code.kind() != code_kind) return {};
+    // Cached code of a higher tier than requested (e.g. TurboFan code when
+    // Maglev is requested) is still a hit; lower-tier code is not.
+    if (code.is_null() || code.kind() < code_kind) return {};
 
     DCHECK(!code.marked_for_deoptimization());
     DCHECK(shared.is_compiled());
@@ -927,7 +928,7 @@ class OptimizedCodeCache : public AllStatic {
     DCHECK_IMPLIES(IsOSR(osr_offset), CodeKindCanOSR(code.kind()));
 
     CompilerTracer::TraceOptimizedCodeCacheHit(isolate, function, osr_offset,
-                                               code_kind);
+                                               code.kind());
     return handle(code, isolate);
   }
 
@@ -1147,7 +1148,18 @@ MaybeHandle<CodeT> CompileMaglev(Isolate* isolate, Handle<JSFunction> function,
 
   if (IsSynchronous(mode)) {
     function->reset_tiering_state();
-    return Maglev::Compile(isolate, function);
+    Handle<CodeT> code;
+    if (!Maglev::Compile(isolate, function).ToHandle(&code)) return {};
+    // Maglev doesn't specialize to the function context, so the code can be
+    // shared by all closures using the same feedback vector. Valid cached code
+    // is always of the same or a higher tier, so keep it.
+    FeedbackVector feedback_vector = function->feedback_vector();
+    feedback_vector.EvictOptimizedCodeMarkedForDeoptimization(
+        function->shared(), "CompileMaglev");
+    if (!feedback_vector.has_optimized_code()) {
+      feedback_vector.SetOptimizedCode(code);
+    }
+    return code;
   }
 
   DCHECK(IsConcurrent(mode));
@@ -1817,6 +1829,17 @@ BackgroundDeserializeTask::BackgroundDeserializeTask(
 }
 
 void BackgroundDeserializeTask::Run() {
+  {
+    base::MutexGuard guard(&mutex_);
+    run_started_ = true;
+    if (found_in_compilation_cache_) {
+      isolate_for_local_isolate_->counters()
+          ->deserialize_skipped()
+          ->Increment();
+      return;
+    }
+  }
+
   LocalIsolate isolate(isolate_for_local_isolate_, ThreadKind::kBackground);
   UnparkedScope unparked_scope(&isolate);
   LocalHandleScope handle_scope(&isolate);
@@ -1824,11 +1847,30 @@ void BackgroundDeserializeTask::Run() {
   Handle<SharedFunctionInfo> inner_result;
   off_thread_data_ =
       CodeSerializer::StartDeserializeOffThread(&isolate, &cached_data_);
+  deserialized_off_thread_ = true;
+}
+
+void BackgroundDeserializeTask::SourceTextAvailable(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details) {
+  DCHECK_EQ(isolate, isolate_for_local_isolate_);
+  bool found = !isolate->compilation_cache()
+                    ->LookupScript(source, script_details,
+                                   construct_language_mode(FLAG_use_strict))
+                    .is_null();
+  base::MutexGuard guard(&mutex_);
+  if (!run_started_) found_in_compilation_cache_ = found;
 }
 
 MaybeHandle<SharedFunctionInfo> BackgroundDeserializeTask::Finish(
     Isolate* isolate, Handle<String> source,
     ScriptOriginOptions origin_options) {
+  if (!deserialized_off_thread_) {
+    // Run() skipped deserialization because the script was in the isolate
+    // compilation cache, but the entry has been flushed since.
+    return CodeSerializer::Deserialize(isolate, &cached_data_, source,
+                                       origin_options);
+  }
   return CodeSerializer::FinishOffThreadDeserialize(
       isolate, std::move(off_thread_data_), &cached_data_, source,
       origin_options);
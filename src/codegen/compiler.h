@@ -10,6 +10,7 @@
 
 #include "src/ast/ast-value-factory.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/small-vector.h"
 #include "src/codegen/bailout-reason.h"
 #include "src/common/globals.h"
@@ -589,6 +590,12 @@ class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
 
   void Run();
 
+  // Called on the main thread once the source is known. If the isolate
+  // compilation cache already holds the script, a Run() that has not started
+  // yet skips deserialization, since Finish() would not be reached anyway.
+  void SourceTextAvailable(Isolate* isolate, Handle<String> source,
+                           const ScriptDetails& script_details);
+
   MaybeHandle<SharedFunctionInfo> Finish(Isolate* isolate,
                                          Handle<String> source,
                                          ScriptOriginOptions origin_options);
@@ -599,6 +606,11 @@ class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
   Isolate* isolate_for_local_isolate_;
   AlignedCachedData cached_data_;
   CodeSerializer::OffThreadDeserializeData off_thread_data_;
+
+  base::Mutex mutex_;
+  bool run_started_ = false;
+  bool found_in_compilation_cache_ = false;
+  bool deserialized_off_thread_ = false;
 };
 
 }  // namespace internal
@@ -26,6 +26,7 @@
 #include "src/numbers/hash-seed-inl.h"
 #include "src/numbers/math-random.h"
 #include "src/objects/elements.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/object-type.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/ordered-hash-table.h"
@@ -367,6 +368,22 @@ ExternalReference ExternalReference::stress_deopt_count(Isolate* isolate) {
   return ExternalReference(isolate->stress_deopt_count_address());
 }
 
+ExternalReference ExternalReference::descriptor_lookup_cache_keys(
+    Isolate* isolate) {
+  return ExternalReference(isolate->descriptor_lookup_cache()->keys_address());
+}
+
+ExternalReference ExternalReference::descriptor_lookup_cache_results(
+    Isolate* isolate) {
+  return ExternalReference(
+      isolate->descriptor_lookup_cache()->results_address());
+}
+
+ExternalReference ExternalReference::object_assign_cache_entries(
+    Isolate* isolate) {
+  return ExternalReference(isolate->object_assign_cache()->entries_address());
+}
+
 ExternalReference ExternalReference::force_slow_path(Isolate* isolate) {
   return ExternalReference(isolate->force_slow_path_address());
 }
@@ -1014,6 +1031,9 @@ FUNCTION_REFERENCE(mutable_big_int_absolute_compare_function,
 FUNCTION_REFERENCE(mutable_big_int_absolute_sub_and_canonicalize_function,
                    MutableBigInt_AbsoluteSubAndCanonicalize)
 
+FUNCTION_REFERENCE(mutable_big_int_absolute_mul_and_canonicalize_function,
+                   MutableBigInt_AbsoluteMulAndCanonicalize)
+
 FUNCTION_REFERENCE(check_object_type, CheckObjectType)
 
 #ifdef V8_INTL_SUPPORT
@@ -34,6 +34,10 @@ class StatsCounter;
   V(interpreter_dispatch_table_address, "Interpreter::dispatch_table_address") \
   V(date_cache_stamp, "date_cache_stamp")                                      \
   V(stress_deopt_count, "Isolate::stress_deopt_count_address()")               \
+  V(descriptor_lookup_cache_keys, "DescriptorLookupCache::keys_address()")     \
+  V(descriptor_lookup_cache_results,                                           \
+    "DescriptorLookupCache::results_address()")                                \
+  V(object_assign_cache_entries, "ObjectAssignCache::entries_address()")       \
   V(force_slow_path, "Isolate::force_slow_path_address()")                     \
   V(isolate_root, "Isolate::isolate_root()")                                   \
   V(allocation_sites_list_address, "Heap::allocation_sites_list_address()")    \
@@ -171,6 +175,8 @@ class StatsCounter;
     "MutableBigInt_AbsoluteCompare")                                           \
   V(mutable_big_int_absolute_sub_and_canonicalize_function,                    \
     "MutableBigInt_AbsoluteSubAndCanonicalize")                                \
+  V(mutable_big_int_absolute_mul_and_canonicalize_function,                    \
+    "MutableBigInt_AbsoluteMulAndCanonicalize")                                \
   V(new_deoptimizer_function, "Deoptimizer::New()")                            \
   V(orderedhashmap_gethash_raw, "orderedhashmap_gethash_raw")                  \
   V(printf_function, "printf")                                                 \
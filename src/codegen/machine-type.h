@@ -301,6 +301,8 @@ class MachineType {
       case CTypeInfo::Type::kV8Value:
       case CTypeInfo::Type::kApiObject:
         return MachineType::AnyTagged();
+      case CTypeInfo::Type::kSeqOneByteString:
+        return MachineType::Pointer();
     }
   }
 
@@ -41,6 +41,8 @@ namespace internal {
   T(AwaitNotInDebugEvaluate,                                                   \
     "await can not be used when evaluating code "                              \
     "while paused in the debugger")                                            \
+  T(AtomicsMutexNotLocked, "% requires the mutex to be locked")               \
+  T(AtomicsOperationNotAllowed, "% cannot be called in this context")          \
   T(AtomicsWaitNotAllowed, "Atomics.wait cannot be called in this context")    \
   T(BadSortComparisonFunction,                                                 \
     "The comparison function must be either a function or undefined")          \
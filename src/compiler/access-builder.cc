@@ -312,6 +312,26 @@ FieldAccess AccessBuilder::ForJSAsyncFunctionObjectPromise() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForJSAsyncFunctionObjectAwaitResolveClosure() {
+  FieldAccess access = {
+      kTaggedBase,    JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+      Handle<Name>(), MaybeHandle<Map>(),
+      Type::Any(),    MachineType::AnyTagged(),
+      kFullWriteBarrier};
+  return access;
+}
+
+// static
+FieldAccess AccessBuilder::ForJSAsyncFunctionObjectAwaitRejectClosure() {
+  FieldAccess access = {
+      kTaggedBase,    JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+      Handle<Name>(), MaybeHandle<Map>(),
+      Type::Any(),    MachineType::AnyTagged(),
+      kFullWriteBarrier};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForJSAsyncGeneratorObjectQueue() {
   FieldAccess access = {
@@ -7,8 +7,10 @@
 #include "src/base/small-vector.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/js-graph.h"
+#include "src/compiler/node-matchers.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/simplified-operator.h"
+#include "src/compiler/type-cache.h"
 
 namespace v8 {
 namespace internal {
@@ -36,6 +38,8 @@ Reduction BranchElimination::Reduce(Node* node) {
     case IrOpcode::kDeoptimizeIf:
     case IrOpcode::kDeoptimizeUnless:
       return ReduceDeoptimizeConditional(node);
+    case IrOpcode::kCheckBounds:
+      return ReduceCheckBounds(node);
     case IrOpcode::kMerge:
       return ReduceMerge(node);
     case IrOpcode::kLoop:
@@ -162,6 +166,132 @@ Reduction BranchElimination::ReduceBranch(Node* node) {
   return TakeConditionsFromFirstControl(node);
 }
 
+// Remove a bounds check that is implied by a dominating branch, as in
+//
+//   for (let i = 0; i < a.length; ++i) a[i];
+//
+// where the loop condition `i < a.length` guarantees that the CheckBounds
+// for `a[i]` in the loop body always succeeds (once LoadElimination has
+// made both uses of `a.length` refer to the same node). The check is
+// replaced by a TypeGuard, so that its users keep the narrowed index type.
+Reduction BranchElimination::ReduceCheckBounds(Node* node) {
+  DCHECK_EQ(IrOpcode::kCheckBounds, node->opcode());
+  Node* index = NodeProperties::GetValueInput(node, 0);
+  Node* length = NodeProperties::GetValueInput(node, 1);
+  Node* control_input = NodeProperties::GetControlInput(node);
+  if (!reduced_.Get(control_input)) return NoChange();
+  if (!NodeProperties::IsTyped(node) || !NodeProperties::IsTyped(index) ||
+      !NodeProperties::IsTyped(length)) {
+    return NoChange();
+  }
+  // The comparison below only implies {index} < {length} if both are plain
+  // numbers, and the lower bound has to be known from the {index} type.
+  if (!NodeProperties::GetType(index).Is(
+          TypeCache::Get()->kPositiveSafeInteger) ||
+      !NodeProperties::GetType(length).Is(Type::Number())) {
+    return NoChange();
+  }
+
+  ControlPathConditions from_input = node_conditions_.Get(control_input);
+  for (Node* use : index->uses()) {
+    if (use->opcode() != IrOpcode::kNumberLessThan &&
+        use->opcode() != IrOpcode::kSpeculativeNumberLessThan) {
+      continue;
+    }
+    if (use->InputAt(0) != index || use->InputAt(1) != length) continue;
+    Node* branch;
+    bool condition_value;
+    if (from_input.LookupCondition(use, &branch, &condition_value) &&
+        condition_value) {
+      node->RemoveInput(1);
+      NodeProperties::ChangeOp(
+          node, common()->TypeGuard(NodeProperties::GetType(node)));
+      return Changed(node);
+    }
+  }
+  return NoChange();
+}
+
+namespace {
+
+// Splits the {limit} of a memory bounds check into {mem_size - offset}. The
+// subtraction may already have been rewritten to {mem_size + -offset} by the
+// MachineOperatorReducer.
+template <typename Matcher>
+void MatchBoundsCheckLimit(Node* limit, IrOpcode::Value sub_opcode,
+                           IrOpcode::Value add_opcode, Node** mem_size,
+                           uint64_t* offset) {
+  using T = typename Matcher::RightMatcher::ValueType;
+  Matcher m(limit);
+  *mem_size = limit;
+  *offset = 0;
+  if (!m.right().HasResolvedValue()) return;
+  T value = m.right().ResolvedValue();
+  if (limit->opcode() == sub_opcode && value >= 0) {
+    *mem_size = m.left().node();
+    *offset = static_cast<uint64_t>(value);
+  } else if (limit->opcode() == add_opcode && value < 0 &&
+             value != std::numeric_limits<T>::min()) {
+    *mem_size = m.left().node();
+    *offset = static_cast<uint64_t>(-value);
+  }
+}
+
+// Matches the memory bounds check {index < mem_size - offset} (or
+// {index < mem_size}, i.e. {offset} == 0) as built by
+// {WasmGraphBuilder::BoundsCheckMem}.
+bool MatchBoundsCheck(Node* condition, Node** index, Node** mem_size,
+                      uint64_t* offset) {
+  if (condition->opcode() == IrOpcode::kUint32LessThan) {
+    MatchBoundsCheckLimit<Int32BinopMatcher>(
+        condition->InputAt(1), IrOpcode::kInt32Sub, IrOpcode::kInt32Add,
+        mem_size, offset);
+  } else if (condition->opcode() == IrOpcode::kUint64LessThan) {
+    MatchBoundsCheckLimit<Int64BinopMatcher>(
+        condition->InputAt(1), IrOpcode::kInt64Sub, IrOpcode::kInt64Add,
+        mem_size, offset);
+  } else {
+    return false;
+  }
+  *index = condition->InputAt(0);
+  return true;
+}
+
+}  // namespace
+
+// A bounds check {index < mem_size - offset} is implied by a dominating,
+// non-trapping check {index < mem_size - other_offset} with
+// {other_offset >= offset}, e.g. when a loop body accesses {a[i + 4]} after
+// {a[i]} or rechecks an index after loop peeling. This relies on
+// {BoundsCheckMem} guaranteeing {other_offset <= mem_size} on all paths that
+// passed the dominating check, which is why only conditions guarding another
+// {TrapUnless} are considered.
+bool BranchElimination::IsImpliedByDominatingBoundsCheck(
+    Node* condition, ControlPathConditions conditions) {
+  Node* index;
+  Node* mem_size;
+  uint64_t offset;
+  if (!MatchBoundsCheck(condition, &index, &mem_size, &offset)) return false;
+  for (Node* use : index->uses()) {
+    if (use == condition || use->opcode() != condition->opcode()) continue;
+    Node* other_index;
+    Node* other_mem_size;
+    uint64_t other_offset;
+    if (!MatchBoundsCheck(use, &other_index, &other_mem_size, &other_offset) ||
+        other_index != index || other_mem_size != mem_size ||
+        other_offset < offset) {
+      continue;
+    }
+    Node* branch;
+    bool condition_value;
+    if (conditions.LookupCondition(use, &branch, &condition_value) &&
+        condition_value && branch->opcode() == IrOpcode::kTrapUnless) {
+      return true;
+    }
+  }
+  return false;
+}
+
 // Simplify a trap following a merge.
 // Assuming condition is in control1's path conditions, and !condition is in
 // control2's path condtions, the following transformation takes place:
@@ -303,6 +433,11 @@ Reduction BranchElimination::ReduceTrapConditional(Node* node) {
       return Replace(control_input);
     }
   }
+  if (!trapping_condition &&
+      IsImpliedByDominatingBoundsCheck(condition, from_input)) {
+    // This will not trap either, remove it.
+    return Replace(control_input);
+  }
   return UpdateConditions(node, from_input, condition, node,
                           !trapping_condition, false);
 }
@@ -177,6 +177,7 @@ class EffectControlLinearizer {
   Node* LowerStringLessThanOrEqual(Node* node);
   Node* LowerBigIntAdd(Node* node, Node* frame_state);
   Node* LowerBigIntSubtract(Node* node, Node* frame_state);
+  Node* LowerBigIntMultiply(Node* node, Node* frame_state);
   Node* LowerBigIntNegate(Node* node);
   Node* LowerCheckFloat64Hole(Node* node, Node* frame_state);
   Node* LowerCheckNotTaggedHole(Node* node, Node* frame_state);
@@ -1239,6 +1240,9 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kBigIntSubtract:
       result = LowerBigIntSubtract(node, frame_state);
       break;
+    case IrOpcode::kBigIntMultiply:
+      result = LowerBigIntMultiply(node, frame_state);
+      break;
     case IrOpcode::kBigIntNegate:
       result = LowerBigIntNegate(node);
       break;
@@ -4396,6 +4400,28 @@ Node* EffectControlLinearizer::LowerBigIntSubtract(Node* node,
   return value;
 }
 
+Node* EffectControlLinearizer::LowerBigIntMultiply(Node* node,
+                                                   Node* frame_state) {
+  Node* lhs = node->InputAt(0);
+  Node* rhs = node->InputAt(1);
+
+  Callable const callable =
+      Builtins::CallableFor(isolate(), Builtin::kBigIntMultiplyNoThrow);
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(), CallDescriptor::kNoFlags,
+      Operator::kFoldable | Operator::kNoThrow);
+  Node* value = __ Call(call_descriptor, __ HeapConstant(callable.code()), lhs,
+                        rhs, __ NoContextConstant());
+
+  // Check for exception sentinel: Smi is returned to signal BigIntTooBig or a
+  // pending termination request; the generic path then handles either.
+  __ DeoptimizeIf(DeoptimizeReason::kBigIntTooBig, FeedbackSource{},
+                  ObjectIsSmi(value), frame_state);
+
+  return value;
+}
+
 Node* EffectControlLinearizer::LowerBigIntNegate(Node* node) {
   Callable const callable =
       Builtins::CallableFor(isolate(), Builtin::kBigIntUnaryMinus);
@@ -4962,6 +4988,51 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
         case CTypeInfo::Type::kFloat32: {
           return __ TruncateFloat64ToFloat32(node);
         }
+        case CTypeInfo::Type::kSeqOneByteString: {
+          // Check that the value is a HeapObject.
+          Node* value_is_smi = ObjectIsSmi(node);
+          __ GotoIf(value_is_smi, if_error);
+
+          // Check that the value is a sequential one-byte string. Its
+          // characters can then be passed without copying, since the fast
+          // call is not allowed to trigger a GC that could move the string.
+          Node* map = __ LoadField(AccessBuilder::ForMap(), node);
+          Node* instance_type =
+              __ LoadField(AccessBuilder::ForMapInstanceType(), map);
+          Node* encoding = __ Word32And(
+              instance_type,
+              __ Int32Constant(kStringRepresentationAndEncodingMask));
+          Node* is_seq_one_byte_string = __ Word32Equal(
+              encoding, __ Int32Constant(kSeqOneByteStringTag));
+          __ GotoIfNot(is_seq_one_byte_string, if_error);
+
+          Node* length_in_bytes =
+              __ LoadField(AccessBuilder::ForStringLength(), node);
+          Node* data_ptr = __ IntAdd(
+              __ BitcastTaggedToWord(node),
+              __ IntPtrConstant(SeqOneByteString::kHeaderSize -
+                                kHeapObjectTag));
+
+          constexpr int kStringAlign = alignof(FastOneByteString);
+          constexpr int kStringSize = sizeof(FastOneByteString);
+          static_assert(offsetof(FastOneByteString, data) == 0 &&
+                            sizeof(FastOneByteString::data) ==
+                                sizeof(uintptr_t),
+                        "FastOneByteString::data must be a pointer at offset "
+                        "0.");
+          static_assert(sizeof(FastOneByteString::length) == sizeof(uint32_t),
+                        "FastOneByteString::length must be a 32-bit value.");
+          constexpr int kDataOffset = offsetof(FastOneByteString, data);
+          constexpr int kLengthOffset = offsetof(FastOneByteString, length);
+          Node* stack_slot = __ StackSlot(kStringSize, kStringAlign);
+          __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                                       kNoWriteBarrier),
+                   stack_slot, kDataOffset, data_ptr);
+          __ Store(StoreRepresentation(MachineRepresentation::kWord32,
+                                       kNoWriteBarrier),
+                   stack_slot, kLengthOffset, length_in_bytes);
+          return stack_slot;
+        }
         default: {
           return node;
         }
@@ -5335,6 +5406,7 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
       break;
     case CTypeInfo::Type::kV8Value:
     case CTypeInfo::Type::kApiObject:
+    case CTypeInfo::Type::kSeqOneByteString:
       UNREACHABLE();
     case CTypeInfo::Type::kAny:
       fast_call_result =
@@ -224,6 +224,21 @@ class EscapeAnalysisTracker : public ZoneObject {
       return tracker_->ResolveReplacement(
           NodeProperties::GetContextInput(current_node()));
     }
+    // Returns the value input shared by all inputs of the current phi after
+    // resolving replacements, ignoring inputs that refer back to the phi
+    // itself along loop back-edges. Returns nullptr if the inputs differ.
+    Node* UniquePhiInput() {
+      DCHECK_EQ(IrOpcode::kPhi, current_node()->opcode());
+      Node* unique = nullptr;
+      int value_input_count = current_node()->op()->ValueInputCount();
+      for (int i = 0; i < value_input_count; ++i) {
+        Node* input = ValueInput(i);
+        if (input == current_node()) continue;
+        if (unique && unique != input) return nullptr;
+        unique = input;
+      }
+      return unique;
+    }
 
     void SetReplacement(Node* replacement) {
       replacement_ = replacement;
@@ -798,6 +813,25 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       }
       break;
     }
+    case IrOpcode::kPhi: {
+      // Loads from virtual objects are replaced by the stored values, which
+      // can make phis redundant that merge such loads, e.g., a loop-carried
+      // reference to an object kept in a field of another virtual object.
+      // Replacing the phi keeps the merged object virtual instead of letting
+      // it escape through the phi.
+      Node* input = current->UniquePhiInput();
+      const VirtualObject* vobject =
+          input ? current->GetVirtualObject(input) : nullptr;
+      if (vobject && !vobject->HasEscaped()) {
+        current->SetReplacement(input);
+        break;
+      }
+      int value_input_count = op->ValueInputCount();
+      for (int i = 0; i < value_input_count; ++i) {
+        current->SetEscaped(current->ValueInput(i));
+      }
+      break;
+    }
     case IrOpcode::kStateValues:
     case IrOpcode::kFrameState:
       // These uses are always safe.
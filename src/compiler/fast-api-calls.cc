@@ -30,6 +30,7 @@ ElementsKind GetTypedArrayElementsKind(CTypeInfo::Type type) {
     case CTypeInfo::Type::kV8Value:
     case CTypeInfo::Type::kApiObject:
     case CTypeInfo::Type::kAny:
+    case CTypeInfo::Type::kSeqOneByteString:
       UNREACHABLE();
   }
 }
@@ -436,6 +436,17 @@ Node* GraphAssembler::Load(MachineType type, Node* object, int offset) {
   return Load(type, object, Int32Constant(offset));
 }
 
+Node* GraphAssembler::LoadImmutable(LoadRepresentation rep, Node* object,
+                                    Node* offset) {
+  return AddNode(
+      graph()->NewNode(machine()->LoadImmutable(rep), object, offset));
+}
+
+Node* GraphAssembler::LoadImmutable(LoadRepresentation rep, Node* object,
+                                    int offset) {
+  return LoadImmutable(rep, object, IntPtrConstant(offset));
+}
+
 Node* GraphAssembler::StoreUnaligned(MachineRepresentation rep, Node* object,
                                      Node* offset, Node* value) {
   Operator const* const op =
@@ -311,6 +311,10 @@ class V8_EXPORT_PRIVATE GraphAssembler {
   Node* Store(StoreRepresentation rep, Node* object, int offset, Node* value);
   Node* Load(MachineType type, Node* object, Node* offset);
   Node* Load(MachineType type, Node* object, int offset);
+  // Loads from memory that doesn't change while the code runs. Such loads are
+  // pure, so they can be value-numbered and hoisted out of loops.
+  Node* LoadImmutable(LoadRepresentation rep, Node* object, Node* offset);
+  Node* LoadImmutable(LoadRepresentation rep, Node* object, int offset);
 
   Node* StoreUnaligned(MachineRepresentation rep, Node* object, Node* offset,
                        Node* value);
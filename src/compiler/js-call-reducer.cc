@@ -3545,6 +3545,9 @@ bool CanInlineJSToWasmCall(const wasm::FunctionSig* wasm_signature) {
 #if defined(V8_TARGET_ARCH_32_BIT)
     if (type == wasm::kWasmI64) return false;
 #endif
+    // Without wasm-gc, externref values are passed through unchanged, so they
+    // do not need any conversion in the inlined wrapper.
+    if (type == wasm::kWasmAnyRef && !FLAG_experimental_wasm_gc) continue;
     if (type != wasm::kWasmI32 && type != wasm::kWasmI64 &&
         type != wasm::kWasmF32 && type != wasm::kWasmF64) {
       return false;
@@ -35,6 +35,11 @@ namespace compiler {
 
 namespace {
 
+// Polymorphic accesses are limited to a handful of maps (see
+// --max-valid-polymorphic-map-count), so the per-branch states of the final
+// merge, plus the merge itself, usually fit inline.
+constexpr size_t kInlineMergeSize = 8;
+
 bool HasNumberMaps(JSHeapBroker* broker, ZoneVector<MapRef> const& maps) {
   for (MapRef map : maps) {
     if (map.IsHeapNumberMap()) return true;
@@ -1218,9 +1223,9 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
   } else {
     // The final states for every polymorphic branch. We join them with
     // Merge+Phi+EffectPhi at the bottom.
-    ZoneVector<Node*> values(zone());
-    ZoneVector<Node*> effects(zone());
-    ZoneVector<Node*> controls(zone());
+    ZoneSmallVector<Node*, kInlineMergeSize> values(zone());
+    ZoneSmallVector<Node*, kInlineMergeSize> effects(zone());
+    ZoneSmallVector<Node*, kInlineMergeSize> controls(zone());
 
     Node* receiverissmi_control = nullptr;
     Node* receiverissmi_effect = effect;
@@ -1758,9 +1763,9 @@ Reduction JSNativeContextSpecialization::ReduceElementAccess(
   } else {
     // The final states for every polymorphic branch. We join them with
     // Merge+Phi+EffectPhi at the bottom.
-    ZoneVector<Node*> values(zone());
-    ZoneVector<Node*> effects(zone());
-    ZoneVector<Node*> controls(zone());
+    ZoneSmallVector<Node*, kInlineMergeSize> values(zone());
+    ZoneSmallVector<Node*, kInlineMergeSize> effects(zone());
+    ZoneSmallVector<Node*, kInlineMergeSize> controls(zone());
 
     // Generate code for the various different element access patterns.
     Node* fallthrough_control = control;
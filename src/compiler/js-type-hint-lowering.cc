@@ -159,6 +159,8 @@ class JSSpeculativeBinopBuilder final {
         return simplified()->SpeculativeBigIntAdd(hint);
       case IrOpcode::kJSSubtract:
         return simplified()->SpeculativeBigIntSubtract(hint);
+      case IrOpcode::kJSMultiply:
+        return simplified()->SpeculativeBigIntMultiply(hint);
       default:
         break;
     }
@@ -406,7 +408,8 @@ JSTypeHintLowering::LoweringResult JSTypeHintLowering::ReduceBinaryOperation(
         return LoweringResult::SideEffectFree(node, node, control);
       }
       if (op->opcode() == IrOpcode::kJSAdd ||
-          op->opcode() == IrOpcode::kJSSubtract) {
+          op->opcode() == IrOpcode::kJSSubtract ||
+          op->opcode() == IrOpcode::kJSMultiply) {
         if (jsgraph()->machine()->Is64()) {
           if (Node* node = b.TryBuildBigIntBinop()) {
             return LoweringResult::SideEffectFree(node, node, control);
@@ -4,12 +4,14 @@
 
 #include "src/compiler/loop-analysis.h"
 
+#include "src/base/optional.h"
 #include "src/codegen/tick-counter.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/node-marker.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
 #include "src/zone/zone.h"
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -548,6 +550,47 @@ LoopTree* LoopFinder::BuildLoopTree(Graph* graph, TickCounter* tick_counter,
   return loop_tree;
 }
 
+// static
+bool LoopFinder::IsTypedArrayVectorizationCandidate(
+    LoopTree* loop_tree, const LoopTree::Loop* loop) {
+  if (!loop->children().empty()) return false;
+
+  base::Optional<ExternalArrayType> element_type;
+  size_t element_accesses = 0;
+  for (Node* node : loop_tree->LoopNodes(loop)) {
+    const IrOpcode::Value opcode = node->opcode();
+    if (IrOpcode::IsCommonOpcode(opcode)) {
+      if (opcode == IrOpcode::kCall || opcode == IrOpcode::kTailCall) {
+        return false;
+      }
+      continue;
+    }
+    switch (opcode) {
+      case IrOpcode::kLoadTypedElement:
+      case IrOpcode::kStoreTypedElement: {
+        const ExternalArrayType type = ExternalArrayTypeOf(node->op());
+        if (element_type.has_value() && *element_type != type) return false;
+        element_type = type;
+        element_accesses++;
+        break;
+      }
+#define CASE(Name) case IrOpcode::k##Name:
+        SIMPLIFIED_COMPARE_BINOP_LIST(CASE)
+        SIMPLIFIED_NUMBER_BINOP_LIST(CASE)
+        SIMPLIFIED_SPECULATIVE_NUMBER_BINOP_LIST(CASE)
+        SIMPLIFIED_NUMBER_UNOP_LIST(CASE)
+#undef CASE
+      case IrOpcode::kCheckBounds:
+      case IrOpcode::kLoadField:
+      case IrOpcode::kJSStackCheck:
+        break;
+      default:
+        return false;
+    }
+  }
+  return element_accesses > 0;
+}
+
 #if V8_ENABLE_WEBASSEMBLY
 // static
 ZoneUnorderedSet<Node*>* LoopFinder::FindSmallInnermostLoopFromHeader(
@@ -179,6 +179,13 @@ class V8_EXPORT_PRIVATE LoopFinder {
 
   static bool HasMarkedExits(LoopTree* loop_tree_, const LoopTree::Loop* loop);
 
+  // Returns true if {loop} is an innermost loop whose body only consists of
+  // control/effect plumbing, number arithmetic and comparisons, bounds checks
+  // and at least one typed array element access, all of the same element
+  // type. Such loops are candidates for SIMD vectorization.
+  static bool IsTypedArrayVectorizationCandidate(LoopTree* loop_tree,
+                                                 const LoopTree::Loop* loop);
+
 #if V8_ENABLE_WEBASSEMBLY
   // Find all nodes in the loop headed by {loop_header} if it contains no nested
   // loops.
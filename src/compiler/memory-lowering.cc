@@ -437,10 +437,13 @@ Node* MemoryLowering::DecodeExternalPointer(
   // the generated code is never executed under a different Isolate, as that
   // would allow access to external objects from different Isolates. It also
   // would break if the code is serialized/deserialized at some point.
+  // The buffer itself is never reallocated, so its address can be loaded
+  // with an immutable load that is shared by all decodes in the function.
   Node* table_address = __ ExternalConstant(
       ExternalReference::external_pointer_table_address(isolate()));
-  Node* table = __ Load(MachineType::Pointer(), table_address,
-                        Internals::kExternalPointerTableBufferOffset);
+  Node* table =
+      __ LoadImmutable(MachineType::Pointer(), table_address,
+                       Internals::kExternalPointerTableBufferOffset);
   Node* decoded_ptr =
       __ Load(MachineType::Pointer(), table, __ ChangeUint32ToUint64(offset));
   Node* tag = __ IntPtrConstant(~external_pointer_tag);
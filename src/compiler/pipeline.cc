@@ -4,6 +4,7 @@
 
 #include "src/compiler/pipeline.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -1606,6 +1607,16 @@ struct LoopPeelingPhase {
 
     LoopTree* loop_tree = LoopFinder::BuildLoopTree(
         data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+    if (FLAG_trace_turbo_vectorization_candidates) {
+      for (const LoopTree::Loop* loop : loop_tree->inner_loops()) {
+        if (!LoopFinder::IsTypedArrayVectorizationCandidate(loop_tree, loop)) {
+          continue;
+        }
+        PrintF("Vectorization candidate loop with header #%d in %s\n",
+               loop_tree->HeaderNode(loop)->id(),
+               data->info()->GetDebugName().get());
+      }
+    }
     // We call the typer inside of PeelInnerLoopsOfTree which inspects heap
     // objects, so we need to unpark the local heap.
     UnparkedScopeIfNeeded scope(data->broker());
@@ -3473,11 +3484,27 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
 
   // Allocate registers.
 
-  // This limit is chosen somewhat arbitrarily, by looking at a few bigger
-  // WebAssembly programs, and chosing the limit such that functions that take
-  // >100ms in register allocation are switched to mid-tier.
-  static int kTopTierVirtualRegistersLimit = 8192;
-
+  // The default limit is chosen somewhat arbitrarily, by looking at a few
+  // bigger WebAssembly programs, and chosing the limit such that functions
+  // that take >100ms in register allocation are switched to mid-tier. Embedders
+  // with large generated JS functions (e.g. parsers) may want to lower it to
+  // trade code quality for time-to-optimized-code.
+  //
+  // Code in optimized JS functions without loops runs at most once per
+  // invocation, so a better allocation pays off less than the additional
+  // compile time; such functions switch to mid-tier at a lower limit.
+  int top_tier_virtual_registers_limit =
+      FLAG_turbo_top_tier_regalloc_max_virtual_registers;
+  if (data->info()->code_kind() == CodeKind::TURBOFAN &&
+      std::none_of(data->sequence()->instruction_blocks().begin(),
+                   data->sequence()->instruction_blocks().end(),
+                   [](const InstructionBlock* block) {
+                     return block->IsLoopHeader();
+                   })) {
+    top_tier_virtual_registers_limit =
+        std::min(top_tier_virtual_registers_limit,
+                 FLAG_turbo_top_tier_regalloc_max_virtual_registers_loop_free);
+  }
   const RegisterConfiguration* config = RegisterConfiguration::Default();
   std::unique_ptr<const RegisterConfiguration> restricted_config;
   bool use_mid_tier_register_allocator =
@@ -3485,7 +3512,7 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
       (FLAG_turbo_force_mid_tier_regalloc ||
        (FLAG_turbo_use_mid_tier_regalloc_for_huge_functions &&
         data->sequence()->VirtualRegisterCount() >
-            kTopTierVirtualRegistersLimit));
+            top_tier_virtual_registers_limit));
 
   if (call_descriptor->HasRestrictedAllocatableRegisters()) {
     RegList registers = call_descriptor->AllocatableRegisters();
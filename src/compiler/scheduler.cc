@@ -310,6 +310,10 @@ class CFGBuilder : public ZoneObject {
   friend class ScheduleLateNodeVisitor;
   friend class Scheduler;
 
+  // A successor that never ran according to the profile is deferred once its
+  // branch or switch has run at least this often.
+  static constexpr double kMinimumCountForUnreached = 1000;
+
   void FixNode(BasicBlock* block, Node* node) {
     schedule_->AddNode(block, node);
     scheduler_->UpdatePlacement(node, Scheduler::kFixed);
@@ -467,13 +471,15 @@ class CFGBuilder : public ZoneObject {
                            arraysize(successor_blocks));
 
     BranchHint hint_from_profile = BranchHint::kNone;
+    bool hint_from_unreached = false;
     if (const ProfileDataFromFile* profile_data = scheduler_->profile_data()) {
       double block_zero_count =
           profile_data->GetCounter(successor_blocks[0]->id().ToSize());
       double block_one_count =
           profile_data->GetCounter(successor_blocks[1]->id().ToSize());
       // If a branch is visited a non-trivial number of times and substantially
-      // more often than its alternative, then mark it as likely.
+      // more often than its alternative, then mark it as likely. An
+      // alternative that never ran at all is moved out of line much earlier.
       constexpr double kMinimumCount = 100000;
       constexpr double kThresholdRatio = 4000;
       if (block_zero_count > kMinimumCount &&
@@ -482,6 +488,14 @@ class CFGBuilder : public ZoneObject {
       } else if (block_one_count > kMinimumCount &&
                  block_one_count / kThresholdRatio > block_zero_count) {
         hint_from_profile = BranchHint::kFalse;
+      } else if (block_zero_count > kMinimumCountForUnreached &&
+                 block_one_count == 0) {
+        hint_from_profile = BranchHint::kTrue;
+        hint_from_unreached = true;
+      } else if (block_one_count > kMinimumCountForUnreached &&
+                 block_zero_count == 0) {
+        hint_from_profile = BranchHint::kFalse;
+        hint_from_unreached = true;
       }
     }
 
@@ -507,7 +521,9 @@ class CFGBuilder : public ZoneObject {
         break;
     }
 
-    if (hint_from_profile != BranchHint::kNone &&
+    // The unreached rule applies to many moderately hot branches, so only
+    // warn when a strongly biased profile contradicts a manual hint.
+    if (hint_from_profile != BranchHint::kNone && !hint_from_unreached &&
         BranchHintOf(branch->op()) != BranchHint::kNone &&
         hint_from_profile != BranchHintOf(branch->op())) {
       PrintF("Warning: profiling data overrode manual branch hint.\n");
@@ -554,6 +570,24 @@ class CFGBuilder : public ZoneObject {
         successor_blocks[index]->set_deferred(true);
       }
     }
+
+    // Cases that never ran while the switch itself was hot are cold, like the
+    // unreached side of a profiled branch.
+    if (const ProfileDataFromFile* profile_data = scheduler_->profile_data()) {
+      double total_count = 0;
+      for (size_t index = 0; index < successor_count; ++index) {
+        total_count +=
+            profile_data->GetCounter(successor_blocks[index]->id().ToSize());
+      }
+      if (total_count > kMinimumCountForUnreached) {
+        for (size_t index = 0; index < successor_count; ++index) {
+          if (profile_data->GetCounter(
+                  successor_blocks[index]->id().ToSize()) == 0) {
+            successor_blocks[index]->set_deferred(true);
+          }
+        }
+      }
+    }
   }
 
   void ConnectMerge(Node* merge) {
@@ -585,11 +619,34 @@ class CFGBuilder : public ZoneObject {
     schedule_->AddReturn(return_block, ret);
   }
 
+  // Blocks that unconditionally end in a throw or a deoptimization are cold.
+  // If such a block is the unhinted successor of a branch, mark it deferred
+  // so that it is laid out out-of-line, as if the branch had been hinted.
+  void MarkColdSuccessorDeferred(Node* exit_control) {
+    if (!FLAG_turbo_defer_throw_and_deopt_paths) return;
+    // Profile data, if present, determines the layout instead.
+    if (scheduler_->profile_data() != nullptr) return;
+    Node* node = exit_control;
+    while (schedule_->block(node) == nullptr) {
+      node = NodeProperties::GetControlInput(node);
+    }
+    if (node->opcode() != IrOpcode::kIfTrue &&
+        node->opcode() != IrOpcode::kIfFalse) {
+      return;
+    }
+    Node* branch = NodeProperties::GetControlInput(node);
+    if (BranchHintOf(branch->op()) != BranchHint::kNone) return;
+    TRACE("Marking cold block id:%d deferred\n",
+          schedule_->block(node)->id().ToInt());
+    schedule_->block(node)->set_deferred(true);
+  }
+
   void ConnectDeoptimize(Node* deopt) {
     Node* deoptimize_control = NodeProperties::GetControlInput(deopt);
     BasicBlock* deoptimize_block = FindPredecessorBlock(deoptimize_control);
     TraceConnect(deopt, deoptimize_block, nullptr);
     schedule_->AddDeoptimize(deoptimize_block, deopt);
+    MarkColdSuccessorDeferred(deoptimize_control);
   }
 
   void ConnectThrow(Node* thr) {
@@ -597,6 +654,7 @@ class CFGBuilder : public ZoneObject {
     BasicBlock* throw_block = FindPredecessorBlock(throw_control);
     TraceConnect(thr, throw_block, nullptr);
     schedule_->AddThrow(throw_block, thr);
+    MarkColdSuccessorDeferred(throw_control);
   }
 
   void TraceConnect(Node* node, BasicBlock* block, BasicBlock* succ) {
@@ -1870,6 +1870,7 @@ class RepresentationSelector {
             return UseInfo::CheckedNumberAsFloat64(kDistinguishZeros, feedback);
           case CTypeInfo::Type::kV8Value:
           case CTypeInfo::Type::kApiObject:
+          case CTypeInfo::Type::kSeqOneByteString:
             return UseInfo::AnyTagged();
         }
       }
@@ -1954,6 +1955,7 @@ class RepresentationSelector {
       case wasm::kI32:
         return UseInfo::CheckedNumberOrOddballAsWord32(feedback);
       case wasm::kI64:
+      case wasm::kOptRef:
         return UseInfo::AnyTagged();
       case wasm::kF32:
       case wasm::kF64:
@@ -2012,6 +2014,9 @@ class RepresentationSelector {
         // Conversion between negative int64 and BigInt not supported yet.
         // Do not bypass the type conversion when the result type is i64.
         SetOutput<T>(node, MachineRepresentation::kTagged);
+      } else if (wasm_signature->GetReturn().is_reference()) {
+        // Externref results are returned to JS as they are.
+        SetOutput<T>(node, MachineRepresentation::kTagged);
       } else {
         MachineType return_type =
             MachineTypeForWasmReturnType(wasm_signature->GetReturn());
@@ -3170,6 +3175,26 @@ class RepresentationSelector {
         }
         return;
       }
+      case IrOpcode::kSpeculativeBigIntMultiply: {
+        // The low 64 bits of a product only depend on the low 64 bits of its
+        // factors, so truncated uses can be computed in a single register.
+        if (truncation.IsUsedAsWord64()) {
+          VisitBinop<T>(
+              node, UseInfo::CheckedBigIntTruncatingWord64(FeedbackSource{}),
+              MachineRepresentation::kWord64);
+          if (lower<T>()) {
+            ChangeToPureOp(node, lowering->machine()->Int64Mul());
+          }
+        } else {
+          VisitBinop<T>(node,
+                        UseInfo::CheckedBigIntAsTaggedPointer(FeedbackSource{}),
+                        MachineRepresentation::kTaggedPointer);
+          if (lower<T>()) {
+            ChangeOp(node, lowering->simplified()->BigIntMultiply());
+          }
+        }
+        return;
+      }
       case IrOpcode::kSpeculativeBigIntNegate: {
         if (truncation.IsUsedAsWord64()) {
           VisitUnop<T>(node,
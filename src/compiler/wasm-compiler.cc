@@ -275,15 +275,6 @@ class WasmGraphAssembler : public GraphAssembler {
     return LoadImmutableFromObject(type, base, IntPtrConstant(offset));
   }
 
-  Node* LoadImmutable(LoadRepresentation rep, Node* base, Node* offset) {
-    return AddNode(graph()->NewNode(mcgraph()->machine()->LoadImmutable(rep),
-                                    base, offset));
-  }
-
-  Node* LoadImmutable(LoadRepresentation rep, Node* base, int offset) {
-    return LoadImmutable(rep, base, IntPtrConstant(offset));
-  }
-
   Node* StoreToObject(ObjectAccess access, Node* base, Node* offset,
                       Node* value) {
     return AddNode(graph()->NewNode(simplified_.StoreToObject(access), base,
@@ -3268,9 +3259,9 @@ Node* WasmGraphBuilder::BuildLoadExternalPointerFromObject(
   Node* scaled_index = gasm_->Word32Shr(external_pointer, shift_amount);
   Node* isolate_root = BuildLoadIsolateRoot();
   Node* table =
-      gasm_->LoadFromObject(MachineType::Pointer(), isolate_root,
-                            IsolateData::external_pointer_table_offset() +
-                                Internals::kExternalPointerTableBufferOffset);
+      gasm_->LoadImmutable(MachineType::Pointer(), isolate_root,
+                           IsolateData::external_pointer_table_offset() +
+                               Internals::kExternalPointerTableBufferOffset);
   Node* decoded_ptr = gasm_->Load(MachineType::Pointer(), table, scaled_index);
   return gasm_->WordAnd(decoded_ptr, gasm_->IntPtrConstant(~tag));
 #else
@@ -3862,6 +3853,15 @@ WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
 
   if (env_->bounds_checks == wasm::kTrapHandler &&
       enforce_check == kCanOmitBoundsCheck) {
+    if (env_->module->is_memory64) {
+      // The guard regions cover 32-bit indexes plus 32-bit offsets. Larger
+      // indexes are always out of bounds, since memories are at most 4GB.
+      DCHECK_EQ(kSystemPointerSize, kInt64Size);
+      TrapIfFalse(wasm::kTrapMemOutOfBounds,
+                  gasm_->Uint64LessThan(
+                      index, gasm_->Int64Constant(int64_t{1} << 32)),
+                  position);
+    }
     return {index, kTrapHandler};
   }
 
@@ -5671,12 +5671,22 @@ Node* WasmGraphBuilder::ArrayNewWithRtt(uint32_t array_index,
 Node* WasmGraphBuilder::ArrayInit(const wasm::ArrayType* type, Node* rtt,
                                   base::Vector<Node*> elements) {
   wasm::ValueType element_type = type->element_type();
-  // TODO(7748): Consider using gasm_->Allocate().
-  Node* array =
-      gasm_->CallBuiltin(Builtin::kWasmAllocateArray_Uninitialized,
-                         Operator::kNoDeopt | Operator::kNoThrow, rtt,
-                         Int32Constant(static_cast<int32_t>(elements.size())),
-                         Int32Constant(element_type.element_size_bytes()));
+  // The length is static, so allocate inline like {StructNewWithRtt} does. The
+  // elements are initialized below, only the header is set up here, like the
+  // {WasmAllocateArray_Uninitialized} builtin does.
+  int length = static_cast<int>(elements.size());
+  int size = WasmArray::kHeaderSize +
+             RoundUp(element_type.element_size_bytes() * length, kTaggedSize);
+  Node* array = gasm_->Allocate(size);
+  gasm_->StoreMap(array, rtt);
+  gasm_->InitializeImmutableInObject(
+      ObjectAccess(MachineType::TaggedPointer(), kNoWriteBarrier), array,
+      wasm::ObjectAccess::ToTagged(JSReceiver::kPropertiesOrHashOffset),
+      LOAD_ROOT(EmptyFixedArray, empty_fixed_array));
+  gasm_->InitializeImmutableInObject(
+      ObjectAccess(MachineType::Uint32(), kNoWriteBarrier), array,
+      wasm::ObjectAccess::ToTagged(WasmArray::kLengthOffset),
+      Int32Constant(length));
   for (int i = 0; i < static_cast<int>(elements.size()); i++) {
     Node* offset =
         gasm_->WasmArrayElementOffset(Int32Constant(i), element_type);
@@ -7784,6 +7794,11 @@ static bool IsSupportedWasmFastApiFunction(
     // Arg 0 is the receiver, skip over it since wasm doesn't
     // have a concept of receivers.
     CTypeInfo arg = info->ArgumentInfo(i + 1);
+    // Wasm values can't be passed as strings.
+    if (arg.GetType() == CTypeInfo::Type::kSeqOneByteString) {
+      log_imported_function_mismatch();
+      return false;
+    }
     if (NormalizeFastApiRepresentation(arg) !=
         expected_sig->GetParam(i).machine_type().representation()) {
       log_imported_function_mismatch();
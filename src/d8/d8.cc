@@ -8,6 +8,7 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <cinttypes>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
@@ -34,6 +35,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/cpu.h"
 #include "src/base/logging.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/platform/wrappers.h"
@@ -86,6 +88,9 @@
 #endif
 
 #if !defined(_WIN32) && !defined(_WIN64)
+#if !V8_OS_FUCHSIA
+#include <sys/resource.h>  // For getrusage.
+#endif
 #include <unistd.h>
 #else
 #include <windows.h>
@@ -976,6 +981,19 @@ class ModuleEmbedderData {
   // JSONModuleEvaluationSteps
   std::unordered_map<Global<Module>, Global<Value>, ModuleGlobalHash>
       json_module_to_parsed_json_map;
+
+  // A JavaScript module whose compilation was started on a background thread
+  // (--streaming-compile), but which hasn't been finalized yet.
+  struct StreamedModule {
+    StreamedModule(Isolate* isolate, Local<String> source)
+        : source_text(isolate, source),
+          streamed_source(std::make_unique<DummySourceStream>(source),
+                          ScriptCompiler::StreamedSource::UTF8) {}
+    Global<String> source_text;
+    ScriptCompiler::StreamedSource streamed_source;
+  };
+  // Map from normalized module specifier to its pending streamed compile.
+  std::map<std::string, std::unique_ptr<StreamedModule>> streamed_modules;
 };
 
 enum { kModuleEmbedderDataIndex, kInspectorClientIndex };
@@ -1016,23 +1034,54 @@ MaybeLocal<Module> ResolveModuleCallback(Local<Context> context,
 
 }  // anonymous namespace
 
+namespace {
+
+// Reads the source of the module at |file_name|, also trying the ".js" and
+// ".mjs" extensions with --fuzzy-module-file-extensions. Only the last attempt
+// throws on failure, and only if |should_throw| is set.
+Local<String> ReadModuleSource(Isolate* isolate, const std::string& file_name,
+                               bool should_throw) {
+  if (!Shell::options.fuzzy_module_file_extensions) {
+    return Shell::ReadFile(isolate, file_name.c_str(), false);
+  }
+  Local<String> source_text =
+      Shell::ReadFile(isolate, file_name.c_str(), false);
+  if (source_text.IsEmpty()) {
+    std::string fallback_file_name = file_name + ".js";
+    source_text = Shell::ReadFile(isolate, fallback_file_name.c_str(), false);
+    if (source_text.IsEmpty()) {
+      fallback_file_name = file_name + ".mjs";
+      source_text =
+          Shell::ReadFile(isolate, fallback_file_name.c_str(), should_throw);
+    }
+  }
+  return source_text;
+}
+
+}  // namespace
+
 MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
                                           Local<Context> context,
                                           const std::string& file_name,
                                           ModuleType module_type) {
   DCHECK(IsAbsolutePath(file_name));
   Isolate* isolate = context->GetIsolate();
-  Local<String> source_text = ReadFile(isolate, file_name.c_str(), false);
-  if (source_text.IsEmpty() && options.fuzzy_module_file_extensions) {
-    std::string fallback_file_name = file_name + ".js";
-    source_text = ReadFile(isolate, fallback_file_name.c_str(), false);
-    if (source_text.IsEmpty()) {
-      fallback_file_name = file_name + ".mjs";
-      source_text = ReadFile(isolate, fallback_file_name.c_str());
+  ModuleEmbedderData* d = GetModuleDataFromContext(context);
+
+  // If compilation of this module was already started in the background, it
+  // only needs to be finalized here.
+  std::unique_ptr<ModuleEmbedderData::StreamedModule> streamed_module;
+  if (module_type == ModuleType::kJavaScript) {
+    auto streamed_it = d->streamed_modules.find(file_name);
+    if (streamed_it != d->streamed_modules.end()) {
+      streamed_module = std::move(streamed_it->second);
+      d->streamed_modules.erase(streamed_it);
     }
   }
 
-  ModuleEmbedderData* d = GetModuleDataFromContext(context);
+  Local<String> source_text =
+      streamed_module ? streamed_module->source_text.Get(isolate)
+                      : ReadModuleSource(isolate, file_name, true);
   if (source_text.IsEmpty()) {
     std::string msg = "d8: Error reading  module from " + file_name;
     if (!referrer.IsEmpty()) {
@@ -1052,7 +1101,13 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
       CreateScriptOrigin(isolate, resource_name, ScriptType::kModule);
 
   Local<Module> module;
-  if (module_type == ModuleType::kJavaScript) {
+  if (streamed_module) {
+    if (!CompileStreamed<Module>(context, &streamed_module->streamed_source,
+                                 source_text, origin)
+             .ToLocal(&module)) {
+      return MaybeLocal<Module>();
+    }
+  } else if (module_type == ModuleType::kJavaScript) {
     ScriptCompiler::Source source(source_text, origin);
     if (!CompileString<Module>(isolate, context, source_text, origin)
              .ToLocal(&module)) {
@@ -1090,6 +1145,7 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
 
   std::string dir_name = DirName(file_name);
 
+  std::vector<std::pair<std::string, ModuleType>> requests;
   Local<FixedArray> module_requests = module->GetModuleRequests();
   for (int i = 0, length = module_requests->Length(); i < length; ++i) {
     Local<ModuleRequest> module_request =
@@ -1107,12 +1163,39 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
       return MaybeLocal<Module>();
     }
 
-    if (d->module_map.count(
-            std::make_pair(absolute_path, request_module_type))) {
-      continue;
+    requests.emplace_back(absolute_path, request_module_type);
+  }
+
+  // With --streaming-compile, start compiling all not yet loaded JavaScript
+  // dependencies in parallel on background threads, and only finalize them
+  // one by one below. Sources that can't be read are left to the regular
+  // path, which reports the error.
+  if (options.streaming_compile) {
+    bool started_streaming = false;
+    for (const auto& request : requests) {
+      if (request.second != ModuleType::kJavaScript ||
+          d->module_map.count(request) ||
+          d->streamed_modules.count(request.first)) {
+        continue;
+      }
+      Local<String> request_source =
+          ReadModuleSource(isolate, request.first, false);
+      if (request_source.IsEmpty()) continue;
+      auto streamed = std::make_unique<ModuleEmbedderData::StreamedModule>(
+          isolate, request_source);
+      PostBlockingBackgroundTask(std::make_unique<StreamingCompileTask>(
+          isolate, &streamed->streamed_source, v8::ScriptType::kModule));
+      d->streamed_modules.emplace(request.first, std::move(streamed));
+      started_streaming = true;
     }
+    // Pump the loop until all streaming tasks complete.
+    if (started_streaming) CompleteMessageLoop(isolate);
+  }
 
-    if (FetchModuleTree(module, context, absolute_path, request_module_type)
+  for (const auto& request : requests) {
+    if (d->module_map.count(request)) continue;
+
+    if (FetchModuleTree(module, context, request.first, request.second)
             .IsEmpty()) {
       return MaybeLocal<Module>();
     }
@@ -4047,6 +4130,153 @@ void SourceGroup::JoinThread() {
   thread_->Join();
 }
 
+namespace {
+
+// Runs the main source group in a fresh context of its own isolate, first
+// --bench-warmup times and then --bench-iterations times while recording the
+// latency of each run. The measured runs of all threads start together.
+class BenchmarkThread : public base::Thread {
+ public:
+  BenchmarkThread(base::Semaphore* warmed_up, base::Semaphore* go)
+      : base::Thread(GetThreadOptions("BenchmarkThread")),
+        warmed_up_(warmed_up),
+        go_(go) {}
+
+  void Run() override {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    create_params.experimental_attach_to_shared_isolate = Shell::shared_isolate;
+    Isolate* isolate = Isolate::New(create_params);
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    Shell::SetWaitUntilDone(isolate, false);
+    {
+      D8Console console(isolate);
+      Shell::Initialize(isolate, &console, false);
+      Isolate::Scope iscope(isolate);
+      for (int i = 0; i < Shell::options.bench_warmup; ++i) RunOnce(isolate);
+      {
+        i::ParkedScope parked_scope(i_isolate->main_thread_local_isolate());
+        warmed_up_->Signal();
+        go_->Wait();
+      }
+      double gc_time_at_start_ms = i_isolate->heap()->total_gc_time_ms();
+      latencies_ms_.reserve(Shell::options.bench_iterations);
+      for (int i = 0; i < Shell::options.bench_iterations; ++i) {
+        latencies_ms_.push_back(RunOnce(isolate));
+      }
+      gc_time_ms_ = i_isolate->heap()->total_gc_time_ms() - gc_time_at_start_ms;
+    }
+    isolate->Dispose();
+  }
+
+  const std::vector<double>& latencies_ms() const { return latencies_ms_; }
+  double gc_time_ms() const { return gc_time_ms_; }
+  bool success() const { return success_; }
+
+ private:
+  // Returns the wall time of the run in milliseconds.
+  double RunOnce(Isolate* isolate) {
+    base::ElapsedTimer timer;
+    timer.Start();
+    PerIsolateData data(isolate);
+    {
+      HandleScope scope(isolate);
+      Local<Context> context = Shell::CreateEvaluationContext(isolate);
+      {
+        Context::Scope cscope(context);
+        PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
+        if (!Shell::options.isolate_sources[0].Execute(isolate)) {
+          success_ = false;
+        }
+        if (!Shell::CompleteMessageLoop(isolate)) success_ = false;
+      }
+      DisposeModuleEmbedderData(context);
+    }
+    return timer.Elapsed().InMillisecondsF();
+  }
+
+  base::Semaphore* warmed_up_;
+  base::Semaphore* go_;
+  std::vector<double> latencies_ms_;
+  double gc_time_ms_ = 0;
+  bool success_ = true;
+};
+
+// Returns the peak resident set size of the process in KB, or -1 if it is
+// not available.
+int64_t PeakResidentSetSizeKB() {
+#if V8_OS_DARWIN
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+  return usage.ru_maxrss / KB;  // In bytes on macOS.
+#elif V8_OS_POSIX && !V8_OS_FUCHSIA
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+  return usage.ru_maxrss;  // In KB everywhere else.
+#else
+  return -1;
+#endif
+}
+
+}  // namespace
+
+int Shell::RunBenchmark(Isolate* isolate) {
+  const int num_threads = options.bench_threads;
+  base::Semaphore warmed_up(0);
+  base::Semaphore go(0);
+  std::vector<std::unique_ptr<BenchmarkThread>> threads;
+  double wall_time_ms;
+  {
+    // Park the main thread in case the benchmark isolates perform shared GCs.
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    i::ParkedScope parked(i_isolate->main_thread_local_isolate());
+    for (int i = 0; i < num_threads; ++i) {
+      threads.push_back(std::make_unique<BenchmarkThread>(&warmed_up, &go));
+      CHECK(threads.back()->Start());
+    }
+    for (int i = 0; i < num_threads; ++i) warmed_up.Wait();
+    base::ElapsedTimer timer;
+    timer.Start();
+    for (int i = 0; i < num_threads; ++i) go.Signal();
+    for (auto& thread : threads) thread->Join();
+    wall_time_ms = timer.Elapsed().InMillisecondsF();
+  }
+
+  bool success = true;
+  double gc_time_ms = 0;
+  std::vector<double> latencies_ms;
+  for (const auto& thread : threads) {
+    success &= thread->success();
+    gc_time_ms += thread->gc_time_ms();
+    latencies_ms.insert(latencies_ms.end(), thread->latencies_ms().begin(),
+                        thread->latencies_ms().end());
+  }
+  std::sort(latencies_ms.begin(), latencies_ms.end());
+  auto percentile = [&latencies_ms](double p) {
+    size_t index = static_cast<size_t>(p * (latencies_ms.size() - 1) + 0.5);
+    return latencies_ms[index];
+  };
+
+  printf("Benchmark: %d thread(s), %d warmup and %d measured iteration(s)\n",
+         num_threads, options.bench_warmup.get(),
+         options.bench_iterations.get());
+  printf("  Wall time:    %.3f ms\n", wall_time_ms);
+  printf("  Throughput:   %.3f iterations/s\n",
+         latencies_ms.size() * 1000.0 / wall_time_ms);
+  printf("  Latency p50:  %.3f ms\n", percentile(0.5));
+  printf("  Latency p90:  %.3f ms\n", percentile(0.9));
+  printf("  Latency p99:  %.3f ms\n", percentile(0.99));
+  printf("  Latency max:  %.3f ms\n", latencies_ms.back());
+  printf("  GC time:      %.3f ms (all isolates)\n", gc_time_ms);
+  int64_t peak_rss_kb = PeakResidentSetSizeKB();
+  if (peak_rss_kb >= 0) {
+    printf("  Peak RSS:     %" PRId64 " KB\n", peak_rss_kb);
+  }
+
+  if (options.no_fail) return 0;
+  return (success == options.expected_to_throw ? 1 : 0);
+}
+
 void SerializationDataQueue::Enqueue(std::unique_ptr<SerializationData> data) {
   base::MutexGuard lock_guard(&mutex_);
   data_.push_back(std::move(data));
@@ -4057,8 +4287,8 @@ bool SerializationDataQueue::Dequeue(
   out_data->reset();
   base::MutexGuard lock_guard(&mutex_);
   if (data_.empty()) return false;
-  *out_data = std::move(data_[0]);
-  data_.erase(data_.begin());
+  *out_data = std::move(data_.front());
+  data_.pop_front();
   return true;
 }
 
@@ -4327,7 +4557,8 @@ void Worker::PostMessageOut(const v8::FunctionCallbackInfo<v8::Value>& args) {
   }
 
   Local<Value> message = args[0];
-  Local<Value> transfer = Undefined(isolate);
+  Local<Value> transfer =
+      args.Length() >= 2 ? args[1] : Undefined(isolate).As<Value>();
   std::unique_ptr<SerializationData> data =
       Shell::SerializeValue(isolate, message, transfer);
   if (data) {
@@ -4500,6 +4731,22 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--thread-pool-size=", 19) == 0) {
       options.thread_pool_size = atoi(argv[i] + 19);
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--bench") == 0) {
+      options.bench = true;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-threads=", 16) == 0) {
+      options.bench_threads = std::max(1, atoi(argv[i] + 16));
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-warmup=", 15) == 0) {
+      options.bench_warmup = std::max(0, atoi(argv[i] + 15));
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-iterations=", 19) == 0) {
+      options.bench_iterations = std::max(1, atoi(argv[i] + 19));
+      argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--apply-priority") == 0) {
+      // Run worker threads at OS thread priorities matching their tasks.
+      options.apply_priority = true;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--stress-delay-tasks") == 0) {
       // Delay execution of tasks by 0-100ms randomly (based on --random-seed).
       options.stress_delay_tasks = true;
@@ -5270,7 +5517,9 @@ int Shell::Main(int argc, char* argv[]) {
   platform::tracing::TracingController* tracing_controller = tracing.get();
   g_platform = v8::platform::NewDefaultPlatform(
       options.thread_pool_size, v8::platform::IdleTaskSupport::kEnabled,
-      in_process_stack_dumping, std::move(tracing));
+      in_process_stack_dumping, std::move(tracing),
+      options.apply_priority ? v8::platform::PriorityMode::kApply
+                             : v8::platform::PriorityMode::kDontApply);
   g_default_platform = g_platform.get();
   if (i::FLAG_predictable) {
     g_platform = MakePredictablePlatform(std::move(g_platform));
@@ -5411,7 +5660,9 @@ int Shell::Main(int argc, char* argv[]) {
         cpu_profiler->StartProfiling(String::Empty(isolate), profile_options);
       }
 
-      if (options.stress_opt) {
+      if (options.bench) {
+        result = RunBenchmark(isolate);
+      } else if (options.stress_opt) {
         options.stress_runs = D8Testing::GetStressRuns();
         for (int i = 0; i < options.stress_runs && result == 0; i++) {
           printf("============ Stress %d/%d ============\n", i + 1,
@@ -5,6 +5,7 @@
 #ifndef V8_D8_D8_H_
 #define V8_D8_D8_H_
 
+#include <deque>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -182,7 +183,7 @@ class SerializationDataQueue {
 
  private:
   base::Mutex mutex_;
-  std::vector<std::unique_ptr<SerializationData>> data_;
+  std::deque<std::unique_ptr<SerializationData>> data_;
 };
 
 class Worker : public std::enable_shared_from_this<Worker> {
@@ -452,6 +453,11 @@ class ShellOptions {
   DisallowReassignment<bool> enable_os_system = {"enable-os-system", false};
   DisallowReassignment<bool> quiet_load = {"quiet-load", false};
   DisallowReassignment<int> thread_pool_size = {"thread-pool-size", 0};
+  DisallowReassignment<bool> apply_priority = {"apply-priority", false};
+  DisallowReassignment<bool> bench = {"bench", false};
+  DisallowReassignment<int> bench_threads = {"bench-threads", 1};
+  DisallowReassignment<int> bench_warmup = {"bench-warmup", 1};
+  DisallowReassignment<int> bench_iterations = {"bench-iterations", 10};
   DisallowReassignment<bool> stress_delay_tasks = {"stress-delay-tasks", false};
   std::vector<const char*> arguments;
   DisallowReassignment<bool> include_arguments = {"arguments", true};
@@ -506,6 +512,9 @@ class Shell : public i::AllStatic {
                                                  const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, bool last_run);
+  // Runs the main source group repeatedly on --bench-threads isolates, each
+  // on its own thread, and prints throughput and latency statistics.
+  static int RunBenchmark(Isolate* isolate);
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate, bool dispose);
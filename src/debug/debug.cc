@@ -1401,15 +1401,21 @@ void Debug::ClearOneShot() {
 namespace {
 class DiscardBaselineCodeVisitor : public ThreadVisitor {
  public:
-  explicit DiscardBaselineCodeVisitor(SharedFunctionInfo shared)
-      : shared_(shared) {}
-  DiscardBaselineCodeVisitor() : shared_(SharedFunctionInfo()) {}
+  // Visits the frames of the functions whose shared function info addresses
+  // are in {shareds}, which must stay alive and unmoved during the visit.
+  explicit DiscardBaselineCodeVisitor(
+      const std::unordered_set<Address>* shareds)
+      : shareds_(shareds) {}
+  DiscardBaselineCodeVisitor() : shareds_(nullptr) {}
 
   void VisitThread(Isolate* isolate, ThreadLocalTop* top) override {
     DisallowGarbageCollection diallow_gc;
-    bool deopt_all = shared_ == SharedFunctionInfo();
+    bool deopt_all = shareds_ == nullptr;
     for (JavaScriptFrameIterator it(isolate, top); !it.done(); it.Advance()) {
-      if (!deopt_all && it.frame()->function().shared() != shared_) continue;
+      if (!deopt_all &&
+          shareds_->count(it.frame()->function().shared().ptr()) == 0) {
+        continue;
+      }
       if (it.frame()->type() == StackFrame::BASELINE) {
         BaselineFrame* frame = BaselineFrame::cast(it.frame());
         int bytecode_offset = frame->GetBytecodeOffset();
@@ -1444,26 +1450,57 @@ class DiscardBaselineCodeVisitor : public ThreadVisitor {
   }
 
  private:
-  SharedFunctionInfo shared_;
+  const std::unordered_set<Address>* shareds_;
 };
+
+// Returns whether {code} was compiled for or inlines any of the shared
+// function infos in {shareds}. See Code::Inlines.
+bool InlinesAnyOf(Code code, const std::unordered_set<Address>& shareds) {
+  DCHECK(code.is_optimized_code());
+  DisallowGarbageCollection no_gc;
+  DeoptimizationData const data =
+      DeoptimizationData::cast(code.deoptimization_data());
+  if (data.length() == 0) return false;
+  if (shareds.count(data.SharedFunctionInfo().ptr()) != 0) return true;
+  DeoptimizationLiteralArray const literals = data.LiteralArray();
+  int const inlined_count = data.InlinedFunctionCount().value();
+  for (int i = 0; i < inlined_count; ++i) {
+    if (shareds.count(literals.get(i).ptr()) != 0) return true;
+  }
+  return false;
+}
 }  // namespace
 
 void Debug::DiscardBaselineCode(SharedFunctionInfo shared) {
-  RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
   DCHECK(shared.HasBaselineCode());
-  Isolate* isolate = shared.GetIsolate();
-  DiscardBaselineCodeVisitor visitor(shared);
-  visitor.VisitThread(isolate, isolate->thread_local_top());
-  isolate->thread_manager()->IterateArchivedThreads(&visitor);
+  HandleScope scope(isolate_);
+  DiscardBaselineCode({handle(shared, isolate_)});
+}
+
+void Debug::DiscardBaselineCode(
+    const std::vector<Handle<SharedFunctionInfo>>& shareds) {
+  RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
+  DisallowGarbageCollection no_gc;
+  std::unordered_set<Address> shared_ptrs;
+  for (Handle<SharedFunctionInfo> shared : shareds) {
+    DCHECK(shared->HasBaselineCode());
+    shared_ptrs.insert(shared->ptr());
+  }
+  DiscardBaselineCodeVisitor visitor(&shared_ptrs);
+  visitor.VisitThread(isolate_, isolate_->thread_local_top());
+  isolate_->thread_manager()->IterateArchivedThreads(&visitor);
   // TODO(v8:11429): Avoid this heap walk somehow.
-  HeapObjectIterator iterator(isolate->heap());
-  auto trampoline = BUILTIN_CODE(isolate, InterpreterEntryTrampoline);
-  shared.FlushBaselineCode();
+  HeapObjectIterator iterator(isolate_->heap());
+  auto trampoline = BUILTIN_CODE(isolate_, InterpreterEntryTrampoline);
+  for (Handle<SharedFunctionInfo> shared : shareds) {
+    shared->FlushBaselineCode();
+  }
   for (HeapObject obj = iterator.Next(); !obj.is_null();
        obj = iterator.Next()) {
     if (obj.IsJSFunction()) {
       JSFunction fun = JSFunction::cast(obj);
-      if (fun.shared() == shared && fun.ActiveTierIsBaseline()) {
+      if (shared_ptrs.count(fun.shared().ptr()) != 0 &&
+          fun.ActiveTierIsBaseline()) {
         fun.set_code(*trampoline);
       }
     }
@@ -1520,6 +1557,64 @@ void Debug::DeoptimizeFunction(Handle<SharedFunctionInfo> shared) {
   }
 }
 
+void Debug::PrepareFunctionsForDebugExecution(
+    const std::vector<Handle<SharedFunctionInfo>>& shareds) {
+  RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
+  std::vector<Handle<SharedFunctionInfo>> pending;
+  for (Handle<SharedFunctionInfo> shared : shareds) {
+    DCHECK(shared->HasDebugInfo());
+    DebugInfo debug_info = shared->GetDebugInfo();
+    if (debug_info.flags(kRelaxedLoad) &
+        DebugInfo::kPreparedForDebugExecution) {
+      continue;
+    }
+    // Breaking at entry deoptimizes everything anyway.
+    if (debug_info.CanBreakAtEntry()) {
+      PrepareFunctionForDebugExecution(shared);
+      continue;
+    }
+    pending.push_back(shared);
+  }
+
+  if (pending.empty()) return;
+  if (pending.size() == 1) {
+    PrepareFunctionForDebugExecution(pending[0]);
+    return;
+  }
+
+  // Get rid of the baseline and optimized code of all pending functions up
+  // front. Doing this per function costs a heap walk and a pass over all
+  // optimized code each, which adds up for scripts with many functions.
+  isolate_->AbortConcurrentOptimization(BlockingBehavior::kBlock);
+  std::vector<Handle<SharedFunctionInfo>> with_baseline_code;
+  bool found_something = false;
+  {
+    DisallowGarbageCollection no_gc;
+    std::unordered_set<Address> shared_ptrs;
+    for (Handle<SharedFunctionInfo> shared : pending) {
+      if (shared->HasBaselineCode()) with_baseline_code.push_back(shared);
+      shared_ptrs.insert(shared->ptr());
+    }
+    Code::OptimizedCodeIterator iterator(isolate_);
+    for (Code code = iterator.Next(); !code.is_null(); code = iterator.Next()) {
+      if (InlinesAnyOf(code, shared_ptrs)) {
+        code.set_marked_for_deoptimization(true);
+        found_something = true;
+      }
+    }
+  }
+  if (found_something) Deoptimizer::DeoptimizeMarkedCode(isolate_);
+  if (!with_baseline_code.empty()) DiscardBaselineCode(with_baseline_code);
+
+  // The code of all pending functions is gone now, so skip the per-function
+  // DeoptimizeFunction and only install the debug bytecode.
+  for (Handle<SharedFunctionInfo> shared : pending) {
+    DCHECK(!shared->HasBaselineCode());
+    FinishPrepareFunctionForDebugExecution(
+        shared, handle(shared->GetDebugInfo(), isolate_));
+  }
+}
+
 void Debug::PrepareFunctionForDebugExecution(
     Handle<SharedFunctionInfo> shared) {
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
@@ -1543,6 +1638,11 @@ void Debug::PrepareFunctionForDebugExecution(
     DeoptimizeFunction(shared);
   }
 
+  FinishPrepareFunctionForDebugExecution(shared, debug_info);
+}
+
+void Debug::FinishPrepareFunctionForDebugExecution(
+    Handle<SharedFunctionInfo> shared, Handle<DebugInfo> debug_info) {
   if (shared->HasBytecodeArray()) {
     DCHECK(!shared->HasBaselineCode());
     SharedFunctionInfo::InstallDebugBytecode(shared, isolate_);
@@ -1862,8 +1962,8 @@ bool Debug::FindSharedFunctionInfosIntersectingRange(
       DCHECK(is_compiled_scope.is_compiled());
       compiled_scopes.push_back(is_compiled_scope);
       if (!EnsureBreakInfo(candidate)) return false;
-      PrepareFunctionForDebugExecution(candidate);
     }
+    PrepareFunctionsForDebugExecution(candidates);
     if (was_compiled) continue;
     *intersecting_shared = std::move(candidates);
     return true;
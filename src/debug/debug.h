@@ -279,10 +279,16 @@ class V8_EXPORT_PRIVATE Debug {
   void ClearBreakOnNextFunctionCall();
 
   void DiscardBaselineCode(SharedFunctionInfo shared);
+  void DiscardBaselineCode(
+      const std::vector<Handle<SharedFunctionInfo>>& shareds);
   void DiscardAllBaselineCode();
 
   void DeoptimizeFunction(Handle<SharedFunctionInfo> shared);
   void PrepareFunctionForDebugExecution(Handle<SharedFunctionInfo> shared);
+  // Same as calling PrepareFunctionForDebugExecution on each of {shareds},
+  // but shares the code discarding passes between them.
+  void PrepareFunctionsForDebugExecution(
+      const std::vector<Handle<SharedFunctionInfo>>& shareds);
   void InstallDebugBreakTrampoline();
   bool GetPossibleBreakpoints(Handle<Script> script, int start_position,
                               int end_position, bool restrict_to_function,
@@ -417,6 +423,11 @@ class V8_EXPORT_PRIVATE Debug {
   void UpdateHookOnFunctionCall();
   void Unload();
 
+  // Installs the debug bytecode and redirects active frames once the code
+  // compiled from {shared} has been discarded.
+  void FinishPrepareFunctionForDebugExecution(
+      Handle<SharedFunctionInfo> shared, Handle<DebugInfo> debug_info);
+
   // Return the number of virtual frames below debugger entry.
   int CurrentFrameCount();
 
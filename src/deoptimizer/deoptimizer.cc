@@ -22,6 +22,7 @@
 #include "src/objects/js-function-inl.h"
 #include "src/objects/oddball.h"
 #include "src/snapshot/embedded/embedded-data.h"
+#include "src/tracing/traced-value.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/wasm/wasm-linkage.h"
@@ -686,6 +687,37 @@ void Deoptimizer::TraceDeoptBegin(int optimization_id,
   }
 }
 
+void Deoptimizer::EmitDeoptTraceEvent(int optimization_id,
+                                      BytecodeOffset bytecode_offset) {
+  bool enabled;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACE_DISABLED_BY_DEFAULT("v8.deopt"),
+                                     &enabled);
+  if (!enabled) return;
+
+  Deoptimizer::DeoptInfo info =
+      Deoptimizer::GetDeoptInfo(compiled_code_, from_);
+  auto value = v8::tracing::TracedValue::Create();
+  value->SetString("reason", DeoptimizeReasonToString(info.deopt_reason));
+  value->SetString("kind", MessageFor(deopt_kind_));
+  value->SetString("codeKind", CodeKindToString(compiled_code_.kind()));
+  value->SetInteger("optimizationId", optimization_id);
+  value->SetInteger("bytecodeOffset", bytecode_offset.ToInt());
+  if (function_.IsJSFunction()) {
+    SharedFunctionInfo shared = function_.shared();
+    value->SetString("functionName", shared.DebugNameCStr().get());
+    value->SetInteger("functionPosition", shared.StartPosition());
+    Object script = shared.script();
+    if (script.IsScript()) {
+      value->SetInteger("scriptId", Script::cast(script).id());
+    }
+  }
+  if (info.position.IsKnown()) {
+    value->SetInteger("position", info.position.ScriptOffset());
+  }
+  TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.deopt"), "V8.Deoptimize",
+                       TRACE_EVENT_SCOPE_THREAD, "data", std::move(value));
+}
+
 void Deoptimizer::TraceDeoptEnd(double deopt_duration) {
   DCHECK(verbose_tracing_enabled());
   PrintF(trace_scope()->file(), "[bailout end. took %0.3f ms]\n",
@@ -815,6 +847,7 @@ void Deoptimizer::DoComputeOutputFrames() {
     timer.Start();
     TraceDeoptBegin(input_data.OptimizationId().value(), bytecode_offset);
   }
+  EmitDeoptTraceEvent(input_data.OptimizationId().value(), bytecode_offset);
 
   FILE* trace_file =
       verbose_tracing_enabled() ? trace_scope()->file() : nullptr;
@@ -1544,6 +1577,11 @@ TranslatedValue Deoptimizer::TranslatedValueForWasmReturnKind(
         return TranslatedValue::NewDouble(
             &translated_state_,
             input_->GetDoubleRegister(wasm::kFpReturnRegisters[0].code()));
+      case wasm::kOptRef:
+        // Reference values are returned as full (uncompressed) tagged values.
+        return TranslatedValue::NewTagged(
+            &translated_state_,
+            Object(input_->GetRegister(kReturnRegister0.code())));
       default:
         UNREACHABLE();
     }
@@ -181,6 +181,10 @@ class Deoptimizer : public Malloced {
     return FLAG_trace_deopt_verbose ? trace_scope() : nullptr;
   }
   void TraceDeoptBegin(int optimization_id, BytecodeOffset bytecode_offset);
+  // Emits a structured trace event for this deopt, if the v8.deopt tracing
+  // category is enabled. Unlike --trace-deopt, this does not print anything.
+  void EmitDeoptTraceEvent(int optimization_id,
+                           BytecodeOffset bytecode_offset);
   void TraceDeoptEnd(double deopt_duration);
 #ifdef DEBUG
   static void TraceFoundActivation(Isolate* isolate, JSFunction function);
@@ -7,6 +7,7 @@
 #include <iomanip>
 
 #include "src/base/memory.h"
+#include "src/base/small-vector.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/deoptimizer/translation-opcode.h"
@@ -1325,7 +1326,9 @@ void TranslatedState::Init(Isolate* isolate, Address input_frame_pointer,
     ReadUpdateFeedback(iterator, literal_array, trace_file);
   }
 
-  std::stack<int> nested_counts;
+  // Captured objects rarely nest deeply, so keep the pending counts of the
+  // enclosing objects inline rather than in a heap-allocated std::stack.
+  base::SmallVector<int, 8> nested_counts;
 
   // Read the frames
   for (int frame_index = 0; frame_index < count; frame_index++) {
@@ -1362,12 +1365,12 @@ void TranslatedState::Init(Isolate* isolate, Address input_frame_pointer,
       // Update the value count and resolve the nesting.
       values_to_process--;
       if (nested_count > 0) {
-        nested_counts.push(values_to_process);
+        nested_counts.emplace_back(values_to_process);
         values_to_process = nested_count;
       } else {
         while (values_to_process == 0 && !nested_counts.empty()) {
-          values_to_process = nested_counts.top();
-          nested_counts.pop();
+          values_to_process = nested_counts.back();
+          nested_counts.pop_back();
         }
       }
     }
@@ -56,6 +56,22 @@ int32_t TranslationArrayIterator::Next() {
   }
 }
 
+void TranslationArrayIterator::Skip(int n) {
+  if (V8_UNLIKELY(FLAG_turbo_compress_translation_arrays)) {
+    index_ += n;
+    DCHECK_LE(index_, static_cast<int>(uncompressed_contents_.size()));
+  } else {
+    // Only the number of encoded values matters here, so just look for the
+    // bytes without a continuation bit instead of reassembling each value.
+    const byte* data = buffer_.GetDataStartAddress();
+    for (int i = 0; i < n; i++) {
+      while (data[index_++] & base::kContinueBit) {
+      }
+    }
+    DCHECK_LE(index_, buffer_.length());
+  }
+}
+
 bool TranslationArrayIterator::HasNext() const {
   if (V8_UNLIKELY(FLAG_turbo_compress_translation_arrays)) {
     return index_ < static_cast<int>(uncompressed_contents_.size());
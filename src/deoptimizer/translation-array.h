@@ -34,9 +34,8 @@ class TranslationArrayIterator {
 
   bool HasNext() const;
 
-  void Skip(int n) {
-    for (int i = 0; i < n; i++) Next();
-  }
+  // Advances past the next {n} values without decoding them.
+  void Skip(int n);
 
  private:
   std::vector<int32_t> uncompressed_contents_;
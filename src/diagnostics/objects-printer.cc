@@ -1447,6 +1447,20 @@ void JSSharedStruct::JSSharedStructPrint(std::ostream& os) {
   JSObjectPrintBody(os, *this);
 }
 
+void JSAtomicsMutex::JSAtomicsMutexPrint(std::ostream& os) {
+  JSObjectPrintHeader(os, *this, "JSAtomicsMutex");
+  os << "\n - state: " << state().value();
+  os << "\n - waiter_queue_id: " << waiter_queue_id().value();
+  JSObjectPrintBody(os, *this);
+}
+
+void JSAtomicsCondition::JSAtomicsConditionPrint(std::ostream& os) {
+  JSObjectPrintHeader(os, *this, "JSAtomicsCondition");
+  os << "\n - state: " << state().value();
+  os << "\n - waiter_queue_id: " << waiter_queue_id().value();
+  JSObjectPrintBody(os, *this);
+}
+
 void JSWeakMap::JSWeakMapPrint(std::ostream& os) {
   JSObjectPrintHeader(os, *this, "JSWeakMap");
   os << "\n - table: " << Brief(table());
@@ -2288,6 +2302,7 @@ void JSCollator::JSCollatorPrint(std::ostream& os) {
   JSObjectPrintHeader(os, *this, "JSCollator");
   os << "\n - icu collator: " << Brief(icu_collator());
   os << "\n - bound compare: " << Brief(bound_compare());
+  os << "\n - try fast compare: " << try_fast_compare();
   JSObjectPrintBody(os, *this);
 }
 
@@ -42,6 +42,7 @@
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
 #include "src/diagnostics/eh-frame.h"
+#include "src/heap/mark-compact-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/snapshot/embedded/embedded-data.h"
@@ -91,6 +92,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -246,6 +257,10 @@ void PerfJitLogger::LogRecordedBuffer(
   // Unwinding info comes right after debug info.
   if (FLAG_perf_prof_unwinding_info) LogWriteUnwindingInfo(*code);
 
+  // Only the instructions of on-heap code are moved by the GC.
+  if (!code->is_off_heap_trampoline()) {
+    code_indices_[code->address()] = code_index_;
+  }
   WriteJitCodeLoadEntry(code_pointer, code->InstructionSize(), code_name,
                         length);
 }
@@ -512,10 +527,54 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
   LogWriteBytes(padding_bytes, static_cast<int>(padding_size));
 }
 
+void PerfJitLogger::WriteJitCodeMoveEntry(Address from, Address to,
+                                          uint32_t code_size,
+                                          uint64_t code_index) {
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeMove::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ = static_cast<uint32_t>(process_id_);
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = static_cast<uint64_t>(to);
+  code_move.old_code_address_ = static_cast<uint64_t>(from);
+  code_move.new_code_address_ = static_cast<uint64_t>(to);
+  code_move.code_size_ = code_size;
+  code_move.code_id_ = code_index;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
 void PerfJitLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
-  // We may receive a CodeMove event if a BytecodeArray object moves. Otherwise
-  // code relocation is not supported.
-  CHECK(from.IsBytecodeArray());
+  // Bytecode arrays are never logged, only the code that runs them.
+  if (!from.IsCode()) return;
+
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+  if (perf_output_handle_ == nullptr) return;
+  auto it = code_indices_.find(from.address());
+  // Code that was never logged, e.g. because it was created before the
+  // logger was enabled, has nothing to move.
+  if (it == code_indices_.end()) return;
+  uint64_t code_index = it->second;
+  code_indices_.erase(it);
+  code_indices_[to.address()] = code_index;
+  WriteJitCodeMoveEntry(from.InstructionStart(), to.InstructionStart(),
+                        from.InstructionSize(), code_index);
+}
+
+void PerfJitLogger::WeakCodeClearEvent() {
+  // Called by the mark-compactor after marking. Code that was not marked is
+  // about to be freed, and its address may be reused by new code.
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+  MarkCompactCollector::NonAtomicMarkingState* marking_state =
+      isolate_->heap()->mark_compact_collector()->non_atomic_marking_state();
+  for (auto it = code_indices_.begin(); it != code_indices_.end();) {
+    if (marking_state->IsWhite(HeapObject::FromAddress(it->first))) {
+      it = code_indices_.erase(it);
+    } else {
+      ++it;
+    }
+  }
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
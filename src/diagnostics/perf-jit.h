@@ -33,6 +33,8 @@
 // {PerfJitLogger} is only implemented on Linux.
 #if V8_OS_LINUX
 
+#include <unordered_map>
+
 #include "src/logging/log.h"
 
 namespace v8 {
@@ -47,6 +49,7 @@ class PerfJitLogger : public CodeEventLogger {
   void CodeMoveEvent(AbstractCode from, AbstractCode to) override;
   void CodeDisableOptEvent(Handle<AbstractCode> code,
                            Handle<SharedFunctionInfo> shared) override {}
+  void WeakCodeClearEvent() override;
 
  private:
   void OpenJitDumpFile();
@@ -73,6 +76,8 @@ class PerfJitLogger : public CodeEventLogger {
 
   void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
                              const char* name, int name_length);
+  void WriteJitCodeMoveEntry(Address from, Address to, uint32_t code_size,
+                             uint64_t code_index);
 
   void LogWriteBytes(const char* bytes, int size);
   void LogWriteHeader();
@@ -138,6 +143,12 @@ class PerfJitLogger : public CodeEventLogger {
   static void* marker_address_;
   static uint64_t code_index_;
   static int process_id_;
+
+  // Maps the address of logged on-heap code of this isolate to the index of
+  // its load record. A move record has to name that index, so that perf can
+  // map the already written code image at the new address. Entries of dead
+  // code are removed by WeakCodeClearEvent. Guarded by {file_mutex_}.
+  std::unordered_map<Address, uint64_t> code_indices_;
 };
 
 }  // namespace internal
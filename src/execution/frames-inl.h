@@ -30,17 +30,25 @@ class InnerPointerToCodeCache {
   InnerPointerToCodeCache(const InnerPointerToCodeCache&) = delete;
   InnerPointerToCodeCache& operator=(const InnerPointerToCodeCache&) = delete;
 
-  void Flush() { memset(static_cast<void*>(&cache_[0]), 0, sizeof(cache_)); }
+  void Flush() {
+    memset(static_cast<void*>(&cache_[0]), 0, sizeof(cache_));
+    memset(&lru_way_[0], 0, sizeof(lru_way_));
+  }
 
   InnerPointerToCodeCacheEntry* GetCacheEntry(Address inner_pointer);
 
  private:
-  InnerPointerToCodeCacheEntry* cache(int index) { return &cache_[index]; }
-
   Isolate* isolate_;
 
-  static const int kInnerPointerToCodeCacheSize = 1024;
-  InnerPointerToCodeCacheEntry cache_[kInnerPointerToCodeCacheSize];
+  // The cache is two-way set associative, so that hot return addresses whose
+  // hashes collide, e.g. in deep recursive or async stacks, do not keep
+  // evicting each other.
+  static const int kInnerPointerToCodeCacheSets = 1024;
+  static const int kInnerPointerToCodeCacheWays = 2;
+  InnerPointerToCodeCacheEntry cache_[kInnerPointerToCodeCacheSets]
+                                     [kInnerPointerToCodeCacheWays];
+  // The least recently used way of each set, which is replaced on a miss.
+  uint8_t lru_way_[kInnerPointerToCodeCacheSets];
 };
 
 inline Address StackHandler::address() const {
@@ -2450,25 +2450,35 @@ uint32_t PcAddressForHashing(Isolate* isolate, Address address) {
 InnerPointerToCodeCache::InnerPointerToCodeCacheEntry*
 InnerPointerToCodeCache::GetCacheEntry(Address inner_pointer) {
   isolate_->counters()->pc_to_code()->Increment();
-  DCHECK(base::bits::IsPowerOfTwo(kInnerPointerToCodeCacheSize));
+  DCHECK(base::bits::IsPowerOfTwo(kInnerPointerToCodeCacheSets));
+  STATIC_ASSERT(kInnerPointerToCodeCacheWays == 2);
   uint32_t hash =
       ComputeUnseededHash(PcAddressForHashing(isolate_, inner_pointer));
-  uint32_t index = hash & (kInnerPointerToCodeCacheSize - 1);
-  InnerPointerToCodeCacheEntry* entry = cache(index);
-  if (entry->inner_pointer == inner_pointer) {
-    isolate_->counters()->pc_to_code_cached()->Increment();
-    DCHECK(entry->code ==
-           isolate_->heap()->GcSafeFindCodeForInnerPointer(inner_pointer));
-  } else {
-    // Because this code may be interrupted by a profiling signal that
-    // also queries the cache, we cannot update inner_pointer before the code
-    // has been set. Otherwise, we risk trying to use a cache entry before
-    // the code has been computed.
-    entry->code =
-        isolate_->heap()->GcSafeFindCodeForInnerPointer(inner_pointer);
-    entry->safepoint_entry.Reset();
-    entry->inner_pointer = inner_pointer;
+  uint32_t index = hash & (kInnerPointerToCodeCacheSets - 1);
+  InnerPointerToCodeCacheEntry* set = cache_[index];
+  for (int way = 0; way < kInnerPointerToCodeCacheWays; way++) {
+    InnerPointerToCodeCacheEntry* entry = &set[way];
+    if (entry->inner_pointer == inner_pointer) {
+      isolate_->counters()->pc_to_code_cached()->Increment();
+      DCHECK(entry->code ==
+             isolate_->heap()->GcSafeFindCodeForInnerPointer(inner_pointer));
+      lru_way_[index] = 1 - way;
+      return entry;
+    }
   }
+
+  // Entries are only ever replaced in place, never moved between ways, so an
+  // entry handed out earlier stays valid until it is replaced itself.
+  const int way = lru_way_[index];
+  InnerPointerToCodeCacheEntry* entry = &set[way];
+  // Because this code may be interrupted by a profiling signal that
+  // also queries the cache, we cannot update inner_pointer before the code
+  // has been set. Otherwise, we risk trying to use a cache entry before
+  // the code has been computed.
+  entry->code = isolate_->heap()->GcSafeFindCodeForInnerPointer(inner_pointer);
+  entry->safepoint_entry.Reset();
+  entry->inner_pointer = inner_pointer;
+  lru_way_[index] = 1 - way;
   return entry;
 }
 
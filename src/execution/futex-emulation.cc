@@ -4,7 +4,9 @@
 
 #include "src/execution/futex-emulation.h"
 
+#include <atomic>
 #include <limits>
+#include <unordered_map>
 
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
@@ -38,6 +40,17 @@ class FutexWaitList {
     return static_cast<int8_t*>(backing_store->buffer_start()) + addr;
   }
 
+  // Returns the waiter count of the bucket that {location} hashes to. It
+  // counts the non-empty wait lists of all locations in the bucket plus the
+  // waiters that are about to add themselves to one. It may be read without
+  // holding g_mutex, see FutexEmulation::Wake.
+  std::atomic<int>& WaiterCount(int8_t* location) {
+    // Wait locations are at least 4-byte aligned.
+    size_t bucket = (reinterpret_cast<uintptr_t>(location) >> 2) %
+                    kNumWaiterCountBuckets;
+    return waiter_counts_[bucket];
+  }
+
   // Deletes "node" and returns the next node of its list.
   static FutexWaitListNode* DeleteAsyncWaiterNode(FutexWaitListNode* node) {
     DCHECK_NOT_NULL(node->isolate_for_async_waiters_);
@@ -92,7 +105,10 @@ class FutexWaitList {
   };
   // Location inside a shared buffer -> linked list of Nodes waiting on that
   // location.
-  std::map<int8_t*, HeadAndTail> location_lists_;
+  std::unordered_map<int8_t*, HeadAndTail> location_lists_;
+
+  static constexpr size_t kNumWaiterCountBuckets = 256;
+  std::atomic<int> waiter_counts_[kNumWaiterCountBuckets] = {};
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
@@ -107,6 +123,24 @@ namespace {
 // condition variable of such nodes.
 base::LazyMutex g_mutex = LAZY_MUTEX_INITIALIZER;
 base::LazyInstance<FutexWaitList>::type g_wait_list = LAZY_INSTANCE_INITIALIZER;
+
+// Counts a waiter in the waiter count of its location from before it loads
+// the value it waits on until it has added itself to the wait list, so that a
+// concurrent Wake cannot take the lock-free fast path and miss it.
+class V8_NODISCARD AnnounceWaiterScope {
+ public:
+  explicit AnnounceWaiterScope(int8_t* wait_location)
+      : count_(g_wait_list.Pointer()->WaiterCount(wait_location)) {
+    count_.fetch_add(1, std::memory_order_seq_cst);
+    // Pairs with the fence in FutexEmulation::Wake: either the waiter's load
+    // of the value sees the notifier's store, or the notifier sees the count.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+  ~AnnounceWaiterScope() { count_.fetch_sub(1, std::memory_order_seq_cst); }
+
+ private:
+  std::atomic<int>& count_;
+};
 }  // namespace
 
 FutexWaitListNode::~FutexWaitListNode() {
@@ -203,6 +237,7 @@ void FutexWaitList::AddNode(FutexWaitListNode* node) {
   if (it == location_lists_.end()) {
     location_lists_.insert(
         std::make_pair(node->wait_location_, HeadAndTail{node, node}));
+    WaiterCount(node->wait_location_).fetch_add(1, std::memory_order_relaxed);
   } else {
     it->second.tail->next_ = node;
     node->prev_ = it->second.tail;
@@ -234,6 +269,7 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
   // If the node was the last one on its list, delete the whole list.
   if (node->prev_ == nullptr && node->next_ == nullptr) {
     location_lists_.erase(it);
+    WaiterCount(node->wait_location_).fetch_sub(1, std::memory_order_relaxed);
   }
 
   node->prev_ = node->next_ = nullptr;
@@ -393,6 +429,7 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
         FutexWaitList::ToWaitLocation(backing_store.get(), addr);
     node->wait_location_ = wait_location;
     node->waiting_ = true;
+    AnnounceWaiterScope announce_waiter(wait_location);
 
     // Reset node->waiting_ = false when leaving this scope (but while
     // still holding the lock).
@@ -549,9 +586,12 @@ Object FutexEmulation::WaitAsync(Isolate* isolate,
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
 
+    int8_t* wait_location =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+    AnnounceWaiterScope announce_waiter(wait_location);
+
     // 17. Let w be ! AtomicLoad(typedArray, i).
-    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(
-        static_cast<int8_t*>(backing_store->buffer_start()) + addr);
+    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
     T loaded_value = p->load();
 #if defined(V8_TARGET_BIG_ENDIAN)
     // If loading a Wasm value, it needs to be reversed on Big Endian platforms.
@@ -656,8 +696,23 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   DCHECK_LT(addr, array_buffer->byte_length());
 
   int waiters_woken = 0;
+  int8_t* wait_location =
+      static_cast<int8_t*>(array_buffer->backing_store()) + addr;
+
+  // Fast path: nobody waits on a location in the same bucket. Waiters are
+  // counted before they load the value they wait on, so a waiter that is
+  // not counted yet will observe any store that preceded this notification,
+  // and does not need to be woken. The store may have been a plain one, so
+  // fence it against the load of the count; see AnnounceWaiterScope.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (g_wait_list.Pointer()->WaiterCount(wait_location).load(
+          std::memory_order_seq_cst) == 0) {
+    return Smi::zero();
+  }
+
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
-  auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+  DCHECK_EQ(wait_location,
+            FutexWaitList::ToWaitLocation(backing_store.get(), addr));
 
   NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
 
@@ -669,13 +724,14 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   FutexWaitListNode* node = it->second.head;
   while (node && num_waiters_to_wake > 0) {
     bool delete_this_node = false;
-    std::shared_ptr<BackingStore> node_backing_store =
-        node->backing_store_.lock();
 
     if (!node->waiting_) {
       node = node->next_;
       continue;
     }
+
+    std::shared_ptr<BackingStore> node_backing_store =
+        node->backing_store_.lock();
     // Relying on wait_location_ here is not enough, since we need to guard
     // against the case where the BackingStore of the node has been deleted and
     // a new BackingStore recreated in the same memory area.
@@ -890,6 +946,8 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
       // head and tail are either both nullptr or both non-nullptr.
       DCHECK_EQ(head == nullptr, tail == nullptr);
       if (head == nullptr) {
+        g_wait_list.Pointer()->WaiterCount(it->first).fetch_sub(
+            1, std::memory_order_relaxed);
         location_lists.erase(it++);
       } else {
         ++it;
@@ -1118,6 +1118,8 @@ template <typename Visitor>
 void VisitStack(Isolate* isolate, Visitor* visitor,
                 StackTrace::StackTraceOptions options = StackTrace::kDetailed) {
   DisallowJavascriptExecution no_js(isolate);
+  // Reused across frames to avoid a vector allocation per frame.
+  std::vector<FrameSummary> summaries;
   for (StackFrameIterator it(isolate); !it.done(); it.Advance()) {
     StackFrame* frame = it.frame();
     switch (frame->type()) {
@@ -1134,7 +1136,7 @@ void VisitStack(Isolate* isolate, Visitor* visitor,
       {
         // A standard frame may include many summarized frames (due to
         // inlining).
-        std::vector<FrameSummary> summaries;
+        summaries.clear();
         CommonFrame::cast(frame)->Summarize(&summaries);
         for (auto rit = summaries.rbegin(); rit != summaries.rend(); ++rit) {
           FrameSummary& summary = *rit;
@@ -3517,6 +3519,9 @@ Isolate::~Isolate() {
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
 
+  delete object_assign_cache_;
+  object_assign_cache_ = nullptr;
+
   delete load_stub_cache_;
   load_stub_cache_ = nullptr;
   delete store_stub_cache_;
@@ -3857,7 +3862,48 @@ class BigIntPlatform : public bigint::Platform {
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  void RunInParallel(ParallelTask* task, int num_tasks) override {
+    if (!FLAG_parallel_bigint_multiplication) {
+      return bigint::Platform::RunInParallel(task, num_tasks);
+    }
+    ParallelJob job(task, num_tasks);
+    // The main thread joins in, so this makes progress even without workers.
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserBlocking,
+                  std::make_unique<JobTaskAdapter>(&job))
+        ->Join();
+  }
+
  private:
+  struct ParallelJob {
+    ParallelJob(ParallelTask* task, int num_tasks)
+        : task(task), num_tasks(num_tasks) {}
+    ParallelTask* const task;
+    const int num_tasks;
+    std::atomic<int> next_index{0};
+  };
+
+  class JobTaskAdapter final : public JobTask {
+   public:
+    explicit JobTaskAdapter(ParallelJob* job) : job_(job) {}
+
+    void Run(JobDelegate* delegate) override {
+      while (!delegate->ShouldYield()) {
+        int index = job_->next_index.fetch_add(1, std::memory_order_relaxed);
+        if (index >= job_->num_tasks) return;
+        job_->task->Run(index);
+      }
+    }
+
+    size_t GetMaxConcurrency(size_t worker_count) const override {
+      int next = job_->next_index.load(std::memory_order_relaxed);
+      return next >= job_->num_tasks ? 0 : job_->num_tasks - next;
+    }
+
+   private:
+    ParallelJob* const job_;
+  };
+
   Isolate* isolate_;
 };
 }  // namespace
@@ -3900,6 +3946,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   compilation_cache_ = new CompilationCache(this);
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  object_assign_cache_ = new ObjectAssignCache();
   inner_pointer_to_code_cache_ = new InnerPointerToCodeCache(this);
   global_handles_ = new GlobalHandles(this);
   eternal_handles_ = new EternalHandles();
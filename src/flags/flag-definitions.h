@@ -522,6 +522,10 @@ DEFINE_BOOL(maglev_break_on_entry, false, "insert an int3 on maglev entries")
 DEFINE_BOOL(print_maglev_graph, false, "print maglev graph")
 DEFINE_BOOL(print_maglev_code, false, "print maglev code")
 DEFINE_BOOL(trace_maglev_regalloc, false, "trace maglev register allocation")
+DEFINE_BOOL(trace_maglev_inlining, false,
+            "trace calls that maglev could inline based on call feedback")
+DEFINE_INT(max_maglev_inlined_bytecode_size, 100,
+           "maximum size of bytecode for a single maglev inlining candidate")
 
 #if ENABLE_SPARKPLUG
 DEFINE_WEAK_IMPLICATION(future, sparkplug)
@@ -591,6 +595,9 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(allocation_site_eager_tenuring, false,
+            "tenure allocation sites whose objects survive two scavenges in a "
+            "row, even if new space is not at its maximum capacity")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation")
@@ -599,6 +606,9 @@ DEFINE_BOOL(trace_pretenuring, false,
 DEFINE_BOOL(trace_pretenuring_statistics, false,
             "trace allocation site pretenuring statistics")
 DEFINE_BOOL(track_field_types, true, "track field types")
+DEFINE_BOOL(generalize_reinitialized_fields_to_tagged, false,
+            "generalize mutable fields that already hold values straight to "
+            "tagged when a double representation would deprecate their map")
 DEFINE_BOOL(trace_block_coverage, false,
             "trace collected block coverage information")
 DEFINE_BOOL(trace_protector_invalidation, false,
@@ -618,6 +628,9 @@ DEFINE_BOOL_READONLY(enable_sealed_frozen_elements_kind, true,
 // Flags for data representation optimizations
 DEFINE_BOOL(unbox_double_arrays, true, "automatically unbox arrays of doubles")
 DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
+DEFINE_BOOL(lazy_cons_string_flattening, false,
+            "read characters of large cons strings by walking the tree "
+            "instead of flattening, if the character is few levels deep")
 
 // Tiering: Sparkplug / feedback vector allocation.
 DEFINE_INT(interrupt_budget_for_feedback_allocation, 940,
@@ -646,6 +659,31 @@ DEFINE_INT(
     max_bytecode_size_for_early_opt, 81,
     "Maximum bytecode length for a function to be optimized on the first tick")
 
+// Tiering profiles. These only adjust the knobs above, so individual knobs
+// passed explicitly on the command line still take precedence.
+DEFINE_BOOL(tiering_for_throughput, false,
+            "tier up earlier and more eagerly, for long-running workloads")
+DEFINE_WEAK_VALUE_IMPLICATION(tiering_for_throughput,
+                              ticks_before_optimization, 2)
+DEFINE_WEAK_VALUE_IMPLICATION(tiering_for_throughput,
+                              bytecode_size_allowance_per_tick, 2200)
+DEFINE_WEAK_VALUE_IMPLICATION(tiering_for_throughput,
+                              max_bytecode_size_for_early_opt, 120)
+DEFINE_WEAK_VALUE_IMPLICATION(tiering_for_throughput,
+                              interrupt_budget_for_maglev, 20 * KB)
+DEFINE_BOOL(tiering_for_startup, false,
+            "tier up later and avoid speculative early optimization, for "
+            "short-running workloads")
+DEFINE_NEG_IMPLICATION(tiering_for_startup, tiering_for_throughput)
+DEFINE_WEAK_VALUE_IMPLICATION(tiering_for_startup, ticks_before_optimization,
+                              6)
+DEFINE_WEAK_VALUE_IMPLICATION(tiering_for_startup,
+                              bytecode_size_allowance_per_tick, 550)
+DEFINE_WEAK_VALUE_IMPLICATION(tiering_for_startup,
+                              max_bytecode_size_for_early_opt, 0)
+DEFINE_WEAK_VALUE_IMPLICATION(tiering_for_startup, interrupt_budget_for_maglev,
+                              80 * KB)
+
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
 DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
@@ -654,6 +692,8 @@ DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_reo_across_jumps, false,
+            "keep register equivalences on the fall-through path of jumps")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
@@ -713,9 +753,8 @@ DEFINE_BOOL(baseline_batch_compilation, true, "batch compile Sparkplug code")
 DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
 #else
-DEFINE_BOOL(concurrent_sparkplug, false,
+DEFINE_BOOL(concurrent_sparkplug, true,
             "compile Sparkplug code in a background thread")
-DEFINE_WEAK_IMPLICATION(future, concurrent_sparkplug)
 DEFINE_NEG_IMPLICATION(predictable, concurrent_sparkplug)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_sparkplug)
 DEFINE_NEG_IMPLICATION(jitless, concurrent_sparkplug)
@@ -819,6 +858,9 @@ DEFINE_BOOL(trace_turbo_trimming, false, "trace TurboFan's graph trimmer")
 DEFINE_BOOL(trace_turbo_jt, false, "trace TurboFan's jump threading")
 DEFINE_BOOL(trace_turbo_ceq, false, "trace TurboFan's control equivalence")
 DEFINE_BOOL(trace_turbo_loop, false, "trace TurboFan's loop optimizations")
+DEFINE_BOOL(trace_turbo_vectorization_candidates, false,
+            "trace innermost loops that only perform element-wise typed array "
+            "accesses and arithmetic (candidates for SIMD vectorization)")
 DEFINE_BOOL(trace_turbo_alloc, false, "trace TurboFan's register allocator")
 DEFINE_BOOL(trace_all_uses, false, "trace all use positions")
 DEFINE_BOOL(trace_representation, false, "trace representation types")
@@ -881,6 +923,9 @@ DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(concurrent_osr, false, "enable concurrent OSR")
+DEFINE_INT(concurrent_osr_max_cached_entries, 2,
+           "number of cached OSR entries at other loops a function may have "
+           "before concurrent OSR falls back to synchronous compilation")
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
@@ -918,6 +963,9 @@ DEFINE_BOOL(turbo_store_elimination, true,
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
 DEFINE_BOOL(turbo_rewrite_far_jumps, true,
             "rewrite far to near jumps (ia32,x64)")
+DEFINE_BOOL(turbo_defer_throw_and_deopt_paths, true,
+            "lay out unhinted branch successors that end in a throw or an "
+            "unconditional deoptimization as deferred code")
 DEFINE_BOOL(
     stress_gc_during_compilation, false,
     "simulate GC/compiler thread race related to https://crbug.com/v8/8520")
@@ -928,6 +976,12 @@ DEFINE_WEAK_IMPLICATION(future, turbo_inline_js_wasm_calls)
 DEFINE_BOOL(turbo_inline_js_wasm_calls, false, "inline JS->Wasm calls")
 DEFINE_BOOL(turbo_use_mid_tier_regalloc_for_huge_functions, true,
             "fall back to the mid-tier register allocator for huge functions")
+DEFINE_INT(turbo_top_tier_regalloc_max_virtual_registers, 8192,
+           "number of virtual registers above which a function is considered "
+           "huge for --turbo-use-mid-tier-regalloc-for-huge-functions")
+DEFINE_INT(turbo_top_tier_regalloc_max_virtual_registers_loop_free, 2048,
+           "same as --turbo-top-tier-regalloc-max-virtual-registers, but for "
+           "optimized JS functions without loops")
 DEFINE_BOOL(turbo_force_mid_tier_regalloc, false,
             "always use the mid-tier register allocator (for testing)")
 
@@ -974,6 +1028,10 @@ DEFINE_BOOL(wasm_async_compilation, true,
 DEFINE_NEG_IMPLICATION(single_threaded, wasm_async_compilation)
 DEFINE_BOOL(wasm_test_streaming, false,
             "use streaming compilation instead of async compilation for tests")
+DEFINE_UINT(wasm_streaming_commit_bytes, 16 * KB,
+            "during streaming compilation, hand function bodies to background "
+            "compilation once this many bytes are pending instead of waiting "
+            "for the end of the received chunk (0 to commit per chunk only)")
 DEFINE_UINT(wasm_max_mem_pages, v8::internal::wasm::kV8MaxWasmMemoryPages,
             "maximum number of 64KiB memory pages per wasm memory")
 DEFINE_UINT(wasm_max_table_size, v8::internal::wasm::kV8MaxWasmTableSize,
@@ -988,6 +1046,15 @@ DEFINE_BOOL(wasm_dynamic_tiering, true,
 DEFINE_NEG_NEG_IMPLICATION(liftoff, wasm_dynamic_tiering)
 DEFINE_INT(wasm_tiering_budget, 1800000,
            "budget for dynamic tiering (rough approximation of bytes executed")
+DEFINE_BOOL(wasm_pgo_to_file, false,
+            "write the functions that tiered up and their call_ref feedback "
+            "to a profile file in the current directory when an isolate is "
+            "torn down")
+DEFINE_BOOL(wasm_pgo_from_file, false,
+            "compile functions that tiered up in a previous run (see "
+            "--wasm-pgo-to-file) with TurboFan right away, using the recorded "
+            "call_ref feedback for inlining")
+DEFINE_BOOL(trace_wasm_pgo, false, "trace reading and writing wasm profiles")
 DEFINE_INT(
     wasm_caching_threshold, 1000000,
     "the amount of wasm top tier code that triggers the next caching event")
@@ -1010,6 +1077,9 @@ DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_dynamic_tiering)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_BOOL(liftoff_loop_locals_in_registers, false,
+            "keep locals in registers across back edges of short Liftoff "
+            "loops without calls")
 DEFINE_DEBUG_BOOL(
     enable_testing_opcode_in_wasm, false,
     "enables a testing opcode in wasm that is only implemented in TurboFan")
@@ -1129,6 +1199,9 @@ DEFINE_BOOL(wasm_lazy_validation, false,
 DEFINE_BOOL(wasm_simd_ssse3_codegen, false, "allow wasm SIMD SSSE3 codegen")
 
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
+DEFINE_BOOL(wasm_separate_hot_code, false,
+            "allocate TurboFan code from the end of the code space, such that "
+            "freed Liftoff code leaves whole pages to decommit")
 DEFINE_BOOL(trace_wasm_code_gc, false, "trace garbage collection of wasm code")
 DEFINE_BOOL(stress_wasm_code_gc, false,
             "stress test garbage collection of wasm code")
@@ -1173,6 +1246,12 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_BOOL(adaptive_young_generation_size, false,
+            "size the new space from the allocation throughput, scavenge speed "
+            "and survival ratio instead of growing it by a fixed factor")
+DEFINE_FLOAT(young_generation_pause_target_ms, 1.0,
+             "target scavenge pause time in ms used by "
+             "--adaptive-young-generation-size")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -1254,6 +1333,9 @@ DEFINE_INT(incremental_marking_hard_trigger, 0,
            "of available space: limit - size")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
+DEFINE_BOOL(scavenger_split_pages, true,
+            "split the remembered set of large pages into several work items "
+            "during parallel scavenge")
 DEFINE_BOOL(scavenge_task, true, "schedule scavenge tasks")
 DEFINE_INT(scavenge_task_trigger, 80,
            "scavenge task trigger in percent of the current heap limit")
@@ -1275,14 +1357,26 @@ DEFINE_BOOL(concurrent_marking, V8_CONCURRENT_MARKING_BOOL,
             "use concurrent marking")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_BOOL(concurrent_array_buffer_freeing, true,
+            "free dead array buffer backing stores in batches on a background "
+            "thread")
+DEFINE_BOOL(concurrent_allocator_free_list_shards, false,
+            "let background allocators take several free-list nodes per "
+            "space lock acquisition")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_BOOL(parallel_marking, V8_CONCURRENT_MARKING_BOOL,
             "use parallel marking in atomic pause")
+DEFINE_BOOL(parallel_client_heap_marking, false,
+            "scan client heaps for references into the shared heap in "
+            "parallel during a shared GC")
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
+DEFINE_INT(concurrent_marking_object_stats_sample_rate, 0,
+           "record the instance type of every n-th object visited by "
+           "concurrent marking (0 disables sampling)")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
@@ -1305,6 +1399,8 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_SIZE_T(
     zone_stats_tolerance, 1 * MB,
     "report a tick only when allocated zone memory changes by this amount")
+DEFINE_SIZE_T(zone_segment_pool_size, 1 * MB,
+              "maximum amount of memory kept in the zone segment pool")
 DEFINE_BOOL(trace_zone_type_stats, false, "trace per-type zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
@@ -1340,9 +1436,24 @@ DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
 DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
+DEFINE_BOOL(graded_memory_pressure_response, false,
+            "on memory pressure, release pooled pages, discard free-list "
+            "memory and shrink new space at the next GC before resorting to "
+            "a full GC")
+DEFINE_BOOL(trace_memory_pressure, false,
+            "print the memory reclaimed by each memory pressure stage")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(transparent_huge_pages, false,
+            "advise the OS to back the code range, the pointer compression "
+            "cage and wasm code spaces with transparent huge pages")
+DEFINE_BOOL(mergeable_read_only_heap, false,
+            "advise the OS that read-only heap pages may be merged with "
+            "identical pages of other processes (Linux KSM)")
+DEFINE_BOOL(numa_aware_page_allocation, false,
+            "prefer placing heap pages on the NUMA node of the thread that "
+            "created the isolate")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -1350,6 +1461,14 @@ DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
 DEFINE_BOOL(compact_maps, false,
             "Perform compaction on maps on full collections.")
+DEFINE_BOOL(compaction_cost_model, false,
+            "select evacuation candidates by weighing the fragmented free "
+            "memory of a page against the cost of evacuating it")
+DEFINE_INT(compaction_payback_gcs, 4,
+           "maximum number of full GCs over which the fragmented memory "
+           "reclaimed by evacuating a page is credited")
+DEFINE_BOOL(trace_compaction_cost_model, false,
+            "trace the decisions of --compaction-cost-model")
 DEFINE_BOOL(use_map_space, true, "Use separate space for maps.")
 // Without a map space we have to compact maps.
 DEFINE_NEG_VALUE_IMPLICATION(use_map_space, compact_maps, true)
@@ -1370,6 +1489,12 @@ DEFINE_BOOL(flush_baseline_code, false,
             "flush of baseline code when it has not been executed recently")
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
+DEFINE_BOOL(flush_recompiled_bytecode, false,
+            "keep flushing the bytecode of functions that were repeatedly "
+            "recompiled after earlier flushes")
+DEFINE_BOOL(flush_cold_feedback, false,
+            "drop the feedback vectors of interpreted functions whose "
+            "bytecode has not been executed recently")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -1582,6 +1707,9 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_INT(compilation_cache_max_entries, 1024,
+           "maximum number of entries per script or eval compilation cache "
+           "table (0 for no limit)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -1599,6 +1727,9 @@ DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_toplevel,
 DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
             "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_INT(parallel_compile_tasks_for_lazy_min_size, 0,
+           "minimum source size of lazily compiled functions for which "
+           "parallel compile tasks are spawned")
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
@@ -1742,7 +1873,8 @@ DEFINE_BOOL(rehash_snapshot, true,
             "rehash strings from the snapshot to override the baked-in seed")
 DEFINE_UINT64(hash_seed, 0,
               "Fixed seed to use to hash property keys (0 means random)"
-              "(with snapshots this option cannot override the baked-in seed)")
+              "(with snapshots, rehashing is skipped if this matches the seed "
+              "the snapshot was created with)")
 DEFINE_INT(random_seed, 0,
            "Default seed for initializing random generator "
            "(0, the default, means to use system random).")
@@ -1771,6 +1903,11 @@ DEFINE_BOOL(short_builtin_calls, V8_SHORT_BUILTIN_CALLS_BOOL,
             "Put embedded builtins code into the code range for shorter "
             "builtin calls/jumps if system has >=4GB memory")
 
+DEFINE_BOOL(retain_process_wide_heap_state, false,
+            "keep the process-wide code range, including the re-embedded "
+            "builtins, and the shared read-only heap alive after the last "
+            "isolate is disposed, so that isolates created later reuse them")
+
 // runtime.cc
 DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
 DEFINE_GENERIC_IMPLICATION(
@@ -1790,8 +1927,25 @@ DEFINE_BOOL(verify_snapshot_checksum, true,
             "checksum creation and verification for code caches.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_BOOL(concurrent_snapshot_decompression, true,
+            "Decompress the read-only snapshot on a background thread while "
+            "decompressing the startup snapshot (only with snapshot "
+            "compression).")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+
+// json-parser.cc
+DEFINE_BOOL(json_parse_parallel_string_scan, true,
+            "locate the strings of large JSON.parse inputs on background "
+            "threads before parsing")
+DEFINE_INT(json_parse_parallel_string_scan_threshold_kb, 8 * KB,
+           "minimum input size in kBytes for "
+           "--json-parse-parallel-string-scan")
+
+// bigint.cc
+DEFINE_BOOL(parallel_bigint_multiplication, true,
+            "distribute the work of very large BigInt multiplications over "
+            "background threads")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
@@ -1809,6 +1963,8 @@ DEFINE_INT(regexp_tier_up_ticks, 1,
            "tiering-up to the compiler")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
+DEFINE_BOOL(regexp_shared_bytecode_cache, false,
+            "share regexp bytecode between all isolates of the process")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
@@ -1830,6 +1986,13 @@ DEFINE_BOOL(trace_experimental_regexp_engine, false,
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
             "backtracking")
+DEFINE_BOOL(experimental_regexp_engine_after_fallback, true,
+            "keep running regexps on the breadth-first engine once they fell "
+            "back to it because of excessive backtracking")
+DEFINE_SIZE_T(regexp_stack_size_limit, 64 * MB / KB,
+              "maximum size of the regexp backtracking stack in kBytes; "
+              "regexp executions exceeding it throw a stack overflow error "
+              "(capped at 64 MB)")
 DEFINE_UINT(regexp_backtracks_before_fallback, 50000,
             "number of backtracks during regexp execution before fall back "
             "to experimental engine if "
@@ -1874,6 +2037,9 @@ DEFINE_BOOL(target_is_simulator, false,
 DEFINE_STRING(turbo_profiling_log_file, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins. (mksnapshot only)")
+DEFINE_BOOL(reorder_builtins, false,
+            "Lay out embedded builtins hot-first, ordered by the entry block "
+            "counters in --turbo-profiling-log-file. (mksnapshot only)")
 
 // On some platforms, the .text section only has execute permissions.
 DEFINE_BOOL(text_is_readable, true,
@@ -1888,6 +2054,9 @@ DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
 DEFINE_BOOL(minor_mc_sweeping, false,
             "perform sweeping in young generation mark compact GCs")
+DEFINE_BOOL(minor_mc_concurrent_root_marking, true,
+            "process the old-to-new remembered set in the background while "
+            "the main thread scans roots in young generation mark compact GCs")
 
 //
 // Dev shell flags
@@ -2071,7 +2240,6 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 // TODO(v8:8462) Remove implication once perf supports remapping.
 #if !MUST_WRITE_PROTECT_CODE_MEMORY
 DEFINE_NEG_IMPLICATION(perf_prof, write_protect_code_memory)
@@ -2212,6 +2380,9 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, concurrent_snapshot_decompression)
+DEFINE_NEG_IMPLICATION(single_threaded, json_parse_parallel_string_scan)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_bigint_multiplication)
 
 //
 // Parallel and concurrent GC (Orinoco) related flags.
@@ -2224,6 +2395,7 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_freeing)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
 
 // Web snapshots
@@ -2232,6 +2404,10 @@ DEFINE_BOOL(
     experimental_web_snapshots, false,
     "interpret scripts as web snapshots if they start with a magic number")
 DEFINE_NEG_IMPLICATION(experimental_web_snapshots, script_streaming)
+DEFINE_BOOL(concurrent_web_snapshot_strings, true,
+            "decode large web snapshot string tables partly on a background "
+            "thread")
+DEFINE_NEG_IMPLICATION(single_threaded, concurrent_web_snapshot_strings)
 
 #undef FLAG
 
@@ -35,6 +35,10 @@ namespace {
 
 constexpr size_t kBlockSize = 256;
 
+// The young node lists are only shrunk when their capacity exceeds their size
+// by this factor.
+constexpr size_t kYoungNodeListShrinkFactor = 4;
+
 }  // namespace
 
 template <class _NodeType>
@@ -1081,8 +1085,11 @@ GlobalHandles* GlobalHandles::From(const TracedNode* node) {
 
 void GlobalHandles::MarkTraced(Address* location) {
   TracedNode* node = TracedNode::FromLocation(location);
-  node->set_markbit();
   DCHECK(node->IsInUse());
+  // Nodes are black allocated and commonly reached through many embedder
+  // objects, so avoid dirtying the node's cache line when nothing changes.
+  if (node->markbit()) return;
+  node->set_markbit();
 }
 
 void GlobalHandles::Destroy(Address* location) {
@@ -1413,7 +1420,13 @@ void GlobalHandles::UpdateAndCompactListOfYoungNode(
   }
   DCHECK_LE(last, node_list->size());
   node_list->resize(last);
-  node_list->shrink_to_fit();
+  // Embedders with many young handles would otherwise reallocate and regrow
+  // the list on every scavenge. Only give memory back when the list shrank
+  // substantially.
+  if (node_list->capacity() >
+      kYoungNodeListShrinkFactor * (last + kBlockSize)) {
+    node_list->shrink_to_fit();
+  }
 }
 
 void GlobalHandles::UpdateListOfYoungNodes() {
@@ -1427,6 +1440,8 @@ size_t GlobalHandles::InvokeFirstPassWeakCallbacks(
   size_t freed_nodes = 0;
   std::vector<std::pair<T*, PendingPhantomCallback>> pending_phantom_callbacks;
   pending_phantom_callbacks.swap(*pending);
+  second_pass_callbacks_.reserve(second_pass_callbacks_.size() +
+                                 pending_phantom_callbacks.size());
   {
     // The initial pass callbacks must simply clear the nodes.
     for (auto& pair : pending_phantom_callbacks) {
@@ -1445,6 +1460,12 @@ size_t GlobalHandles::InvokeFirstPassWeakCallbacks(
       freed_nodes++;
     }
   }
+  // Hand the storage back so that the next GC does not have to regrow it, as
+  // long as no callback queued new phantom callbacks in the meantime.
+  if (pending->empty()) {
+    pending_phantom_callbacks.clear();
+    pending->swap(pending_phantom_callbacks);
+  }
   return freed_nodes;
 }
 
@@ -80,16 +80,23 @@ struct ArrayBufferSweeper::SweepingJob final {
         old_(std::move(old)),
         type_(type) {}
 
-  void Sweep();
+  // If |dead| is non-null, the dead extensions are moved there before the job
+  // is marked as done. Otherwise they are freed on finalization.
+  void Sweep(ArrayBufferList* dead = nullptr);
   void SweepYoung();
   void SweepFull();
   ArrayBufferList SweepListFull(ArrayBufferList* list);
 
+  // Dead extensions are not deleted while sweeping but collected here, so
+  // that their backing stores can be released in one batch.
+  void Free(ArrayBufferExtension* extension);
+
  private:
   CancelableTaskManager::Id id_ = CancelableTaskManager::kInvalidTaskId;
   std::atomic<SweepingState> state_;
   ArrayBufferList young_;
   ArrayBufferList old_;
+  ArrayBufferList dead_;
   const SweepingType type_;
   std::atomic<size_t> freed_bytes_{0};
 
@@ -100,6 +107,8 @@ ArrayBufferSweeper::ArrayBufferSweeper(Heap* heap) : heap_(heap) {}
 
 ArrayBufferSweeper::~ArrayBufferSweeper() {
   EnsureFinished();
+  // A free task may have been cancelled during tear down.
+  FreePending();
   ReleaseAll(&old_);
   ReleaseAll(&young_);
 }
@@ -160,9 +169,15 @@ void ArrayBufferSweeper::RequestSweep(SweepingType type) {
               ? GCTracer::Scope::BACKGROUND_YOUNG_ARRAY_BUFFER_SWEEP
               : GCTracer::Scope::BACKGROUND_FULL_ARRAY_BUFFER_SWEEP;
       TRACE_GC_EPOCH(heap_->tracer(), scope_id, ThreadKind::kBackground);
-      base::MutexGuard guard(&sweeping_mutex_);
-      job_->Sweep();
-      job_finished_.NotifyAll();
+      ArrayBufferList dead;
+      {
+        base::MutexGuard guard(&sweeping_mutex_);
+        job_->Sweep(&dead);
+        job_finished_.NotifyAll();
+      }
+      // Already on a background thread, so free right away but without
+      // holding the lock the main thread may be waiting for.
+      ReleaseAll(&dead);
     });
     job_->id_ = task->id();
     V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
@@ -195,6 +210,8 @@ void ArrayBufferSweeper::Finalize() {
   CHECK_EQ(job_->state_, SweepingState::kDone);
   young_.Append(&job_->young_);
   old_.Append(&job_->old_);
+  // Only non-empty if the job was swept on the main thread.
+  ScheduleFree(&job_->dead_);
   const size_t freed_bytes =
       job_->freed_bytes_.exchange(0, std::memory_order_relaxed);
   DecrementExternalMemoryCounters(freed_bytes);
@@ -202,6 +219,37 @@ void ArrayBufferSweeper::Finalize() {
   DCHECK(!sweeping_in_progress());
 }
 
+void ArrayBufferSweeper::ScheduleFree(ArrayBufferList* dead) {
+  if (dead->IsEmpty()) return;
+  if (heap_->IsTearingDown() || !FLAG_concurrent_array_buffer_sweeping ||
+      !FLAG_concurrent_array_buffer_freeing) {
+    ReleaseAll(dead);
+    return;
+  }
+  {
+    base::MutexGuard guard(&free_mutex_);
+    pending_free_.Append(dead);
+    // A posted task that has not yet run also picks up the new extensions.
+    if (free_task_posted_) return;
+    free_task_posted_ = true;
+  }
+  auto task = MakeCancelableTask(heap_->isolate(), [this] { FreePending(); });
+  V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+}
+
+void ArrayBufferSweeper::FreePending() {
+  ArrayBufferList list;
+  {
+    base::MutexGuard guard(&free_mutex_);
+    list = pending_free_;
+    pending_free_ = ArrayBufferList();
+    free_task_posted_ = false;
+  }
+  // Free outside of the lock so that the main thread never waits for
+  // backing stores to be released.
+  ReleaseAll(&list);
+}
+
 void ArrayBufferSweeper::ReleaseAll(ArrayBufferList* list) {
   ArrayBufferExtension* current = list->head_;
   while (current) {
@@ -269,7 +317,7 @@ void ArrayBufferSweeper::DecrementExternalMemoryCounters(size_t bytes) {
   heap_->update_external_memory(-static_cast<int64_t>(bytes));
 }
 
-void ArrayBufferSweeper::SweepingJob::Sweep() {
+void ArrayBufferSweeper::SweepingJob::Sweep(ArrayBufferList* dead) {
   CHECK_EQ(state_, SweepingState::kInProgress);
   switch (type_) {
     case SweepingType::kYoung:
@@ -279,9 +327,20 @@ void ArrayBufferSweeper::SweepingJob::Sweep() {
       SweepFull();
       break;
   }
+  if (dead) {
+    *dead = dead_;
+    dead_ = ArrayBufferList();
+  }
+  // The main thread may finalize the job as soon as it observes this state.
   state_ = SweepingState::kDone;
 }
 
+void ArrayBufferSweeper::SweepingJob::Free(ArrayBufferExtension* extension) {
+  const size_t bytes = extension->accounting_length();
+  dead_.Append(extension);
+  if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
 void ArrayBufferSweeper::SweepingJob::SweepFull() {
   DCHECK_EQ(SweepingType::kFull, type_);
   ArrayBufferList promoted = SweepListFull(&young_);
@@ -300,9 +359,7 @@ ArrayBufferList ArrayBufferSweeper::SweepingJob::SweepListFull(
     ArrayBufferExtension* next = current->next();
 
     if (!current->IsMarked()) {
-      const size_t bytes = current->accounting_length();
-      delete current;
-      if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+      Free(current);
     } else {
       current->Unmark();
       survivor_list.Append(current);
@@ -326,9 +383,7 @@ void ArrayBufferSweeper::SweepingJob::SweepYoung() {
     ArrayBufferExtension* next = current->next();
 
     if (!current->IsYoungMarked()) {
-      size_t bytes = current->accounting_length();
-      delete current;
-      if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+      Free(current);
     } else if (current->IsYoungPromoted()) {
       current->YoungUnmark();
       new_old.Append(current);
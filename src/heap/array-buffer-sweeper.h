@@ -87,12 +87,24 @@ class ArrayBufferSweeper final {
 
   void ReleaseAll(ArrayBufferList* extension);
 
+  // Hands dead extensions off to a background task that deletes them, and
+  // thereby releases their backing stores, in one batch. Frees the list
+  // synchronously when that is not possible.
+  void ScheduleFree(ArrayBufferList* dead);
+  // Deletes all extensions that are waiting to be freed.
+  void FreePending();
+
   Heap* const heap_;
   std::unique_ptr<SweepingJob> job_;
   base::Mutex sweeping_mutex_;
   base::ConditionVariable job_finished_;
   ArrayBufferList young_;
   ArrayBufferList old_;
+
+  // Dead extensions waiting for the free task. Guarded by free_mutex_.
+  base::Mutex free_mutex_;
+  ArrayBufferList pending_free_;
+  bool free_task_posted_ = false;
 };
 
 }  // namespace internal
@@ -26,6 +26,12 @@ base::LazyMutex process_wide_code_range_creation_mutex_ =
 base::LazyInstance<std::weak_ptr<CodeRange>>::type process_wide_code_range_ =
     LAZY_INSTANCE_INITIALIZER;
 
+// Strong reference to the process-wide CodeRange that keeps it, and the
+// builtins re-embedded into it, alive while no Heaps remain. Only set with
+// --retain-process-wide-heap-state.
+base::LazyInstance<std::shared_ptr<CodeRange>>::type
+    retained_process_wide_code_range_ = LAZY_INSTANCE_INITIALIZER;
+
 DEFINE_LAZY_LEAKY_OBJECT_GETTER(CodeRangeAddressHint, GetCodeRangeAddressHint)
 
 void FunctionInStaticBinaryForAddressHint() {}
@@ -156,6 +162,8 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
     }
   }
 
+  if (FLAG_transparent_huge_pages) AdviseTransparentHugePages();
+
   return true;
 }
 
@@ -264,6 +272,9 @@ std::shared_ptr<CodeRange> CodeRange::EnsureProcessWideCodeRange(
           nullptr, "Failed to reserve virtual memory for CodeRange");
     }
     *process_wide_code_range_.Pointer() = code_range;
+    if (FLAG_retain_process_wide_heap_state) {
+      *retained_process_wide_code_range_.Pointer() = code_range;
+    }
   }
   return code_range;
 }
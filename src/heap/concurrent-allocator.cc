@@ -88,6 +88,14 @@ void ConcurrentAllocator::FreeLinearAllocationArea() {
     optional_scope.emplace(MemoryChunk::FromAddress(lab_.top()));
   }
   lab_.CloseAndMakeIterable();
+  ReleaseFreeListShard();
+}
+
+void ConcurrentAllocator::ReleaseFreeListShard() {
+  if (free_list_shard_count_ == 0) return;
+  space_->ReturnFreeListNodesBackground(free_list_shard_,
+                                        free_list_shard_count_);
+  free_list_shard_count_ = 0;
 }
 
 void ConcurrentAllocator::MakeLinearAllocationAreaIterable() {
@@ -132,25 +140,70 @@ AllocationResult ConcurrentAllocator::AllocateInLabSlow(
 }
 
 bool ConcurrentAllocator::EnsureLab(AllocationOrigin origin) {
+  if (FLAG_concurrent_allocator_free_list_shards &&
+      space_->identity() != CODE_SPACE &&
+      TryRefillLabFromFreeListShard(origin)) {
+    return true;
+  }
+
   auto result = space_->RawRefillLabBackground(
       local_heap_, kLabSize, kMaxLabSize, kTaggedAligned, origin);
   if (!result) return false;
 
+  SetLab(result->first, result->second);
+  return true;
+}
+
+bool ConcurrentAllocator::TryRefillLabFromFreeListShard(
+    AllocationOrigin origin) {
+  if (free_list_shard_count_ == 0) {
+    free_list_shard_count_ = space_->TakeFreeListNodesBackground(
+        kLabSize, kMaxFreeListShardSize, free_list_shard_,
+        kMaxFreeListShardNodes, origin);
+  }
+  while (free_list_shard_count_ > 0) {
+    std::pair<Address, size_t>& node =
+        free_list_shard_[free_list_shard_count_ - 1];
+    // The page may have become an evacuation candidate since the node was
+    // taken. Its free memory is reclaimed when the page is released.
+    if (Page::FromAddress(node.first)->IsEvacuationCandidate()) {
+      free_list_shard_count_--;
+      continue;
+    }
+    const Address start = node.first;
+    size_t size = node.second;
+    if (size >= static_cast<size_t>(kMaxLabSize + kLabSize)) {
+      // Split off a LAB and keep the rest of the node iterable in the shard.
+      size = kMaxLabSize;
+      node.first += size;
+      node.second -= size;
+      owning_heap()->CreateFillerObjectAtBackground(
+          node.first, static_cast<int>(node.second),
+          ClearFreedMemoryMode::kDontClearFreedMemory);
+    } else {
+      free_list_shard_count_--;
+    }
+    SetLab(start, size);
+    return true;
+  }
+  return false;
+}
+
+void ConcurrentAllocator::SetLab(Address start, size_t size) {
   if (IsBlackAllocationEnabled()) {
-    Address top = result->first;
-    Address limit = top + result->second;
-    Page::FromAllocationAreaAddress(top)->CreateBlackAreaBackground(top, limit);
+    Address limit = start + size;
+    Page::FromAllocationAreaAddress(start)->CreateBlackAreaBackground(start,
+                                                                      limit);
   }
 
-  HeapObject object = HeapObject::FromAddress(result->first);
+  HeapObject object = HeapObject::FromAddress(start);
   LocalAllocationBuffer saved_lab = std::move(lab_);
   lab_ = LocalAllocationBuffer::FromResult(
-      space_->heap(), AllocationResult::FromObject(object), result->second);
+      space_->heap(), AllocationResult::FromObject(object), size);
   DCHECK(lab_.IsValid());
   if (!lab_.TryMerge(&saved_lab)) {
     saved_lab.CloseAndMakeIterable();
   }
-  return true;
 }
 
 AllocationResult ConcurrentAllocator::AllocateOutsideLab(
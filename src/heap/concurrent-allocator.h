@@ -36,6 +36,10 @@ class ConcurrentAllocator {
   static const int kLabSize = 4 * KB;
   static const int kMaxLabSize = 32 * KB;
   static const int kMaxLabObjectSize = 2 * KB;
+  // Limits for the free-list nodes that are taken at once with
+  // --concurrent-allocator-free-list-shards.
+  static const int kMaxFreeListShardNodes = 8;
+  static const int kMaxFreeListShardSize = 4 * kMaxLabSize;
 
   explicit ConcurrentAllocator(LocalHeap* local_heap, PagedSpace* space)
       : local_heap_(local_heap),
@@ -55,6 +59,12 @@ class ConcurrentAllocator {
   V8_EXPORT_PRIVATE AllocationResult AllocateInLabSlow(
       int object_size, AllocationAlignment alignment, AllocationOrigin origin);
   bool EnsureLab(AllocationOrigin origin);
+  // Installs [start, start + size) as the new LAB.
+  void SetLab(Address start, size_t size);
+  // Tries to refill the LAB from free_list_shard_, refilling the shard from
+  // the space first if it is empty.
+  bool TryRefillLabFromFreeListShard(AllocationOrigin origin);
+  void ReleaseFreeListShard();
 
   inline AllocationResult AllocateInLab(int object_size,
                                         AllocationAlignment alignment,
@@ -72,6 +82,11 @@ class ConcurrentAllocator {
   LocalHeap* const local_heap_;
   PagedSpace* const space_;
   LocalAllocationBuffer lab_;
+
+  // Free-list nodes owned by this allocator. They are accounted as allocated
+  // in the space and kept iterable as fillers.
+  std::pair<Address, size_t> free_list_shard_[kMaxFreeListShardNodes];
+  int free_list_shard_count_ = 0;
 };
 
 }  // namespace internal
@@ -471,6 +471,14 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
   NativeContextInferrer& native_context_inferrer =
       task_state->native_context_inferrer;
   NativeContextStats& native_context_stats = task_state->native_context_stats;
+  const int object_stats_sample_rate =
+      FLAG_concurrent_marking_object_stats_sample_rate;
+  int objects_until_sample = object_stats_sample_rate;
+  // The table is only allocated once sampling is enabled, as it is large.
+  if (object_stats_sample_rate > 0 && !task_state->object_stats) {
+    task_state->object_stats = std::make_unique<SampledObjectStats>();
+  }
+  SampledObjectStats* object_stats = task_state->object_stats.get();
   double time_ms;
   size_t marked_bytes = 0;
   Isolate* isolate = heap_->isolate();
@@ -537,6 +545,12 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
             native_context_stats.IncrementSize(
                 local_marking_worklists.Context(), map, object, visited_size);
           }
+          if (V8_UNLIKELY(object_stats_sample_rate > 0) &&
+              --objects_until_sample == 0) {
+            objects_until_sample = object_stats_sample_rate;
+            object_stats->Record(map.instance_type(), visited_size,
+                                 object_stats_sample_rate);
+          }
           current_marked_bytes += visited_size;
         }
       }
@@ -647,6 +661,16 @@ void ConcurrentMarking::FlushNativeContexts(NativeContextStats* main_stats) {
   }
 }
 
+void ConcurrentMarking::FlushObjectStats(SampledObjectStats* main_stats) {
+  DCHECK(!job_handle_ || !job_handle_->IsValid());
+  for (int i = 1; i <= kMaxTasks; i++) {
+    SampledObjectStats* task_stats = task_state_[i].object_stats.get();
+    if (!task_stats) continue;
+    main_stats->Merge(*task_stats);
+    task_stats->Clear();
+  }
+}
+
 void ConcurrentMarking::FlushMemoryChunkData(
     MajorNonAtomicMarkingState* marking_state) {
   DCHECK(!job_handle_ || !job_handle_->IsValid());
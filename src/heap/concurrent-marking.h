@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_CONCURRENT_MARKING_H_
 #define V8_HEAP_CONCURRENT_MARKING_H_
 
+#include <array>
 #include <memory>
 
 #include "include/v8-platform.h"
@@ -17,6 +18,7 @@
 #include "src/heap/slot-set.h"
 #include "src/heap/spaces.h"
 #include "src/init/v8.h"
+#include "src/objects/instance-type.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/utils/allocation.h"
 #include "src/utils/utils.h"
@@ -38,6 +40,33 @@ struct MemoryChunkData {
 using MemoryChunkDataMap =
     std::unordered_map<MemoryChunk*, MemoryChunkData, MemoryChunk::Hasher>;
 
+// Object counts and sizes per instance type, extrapolated from a sample of the
+// objects visited by concurrent marking. See
+// --concurrent-marking-object-stats-sample-rate.
+struct SampledObjectStats {
+  static constexpr size_t kNumberOfTypes = LAST_TYPE + 1;
+
+  void Record(InstanceType type, size_t object_size, size_t weight) {
+    count[type] += weight;
+    size[type] += object_size * weight;
+  }
+
+  void Merge(const SampledObjectStats& other) {
+    for (size_t i = 0; i < kNumberOfTypes; i++) {
+      count[i] += other.count[i];
+      size[i] += other.size[i];
+    }
+  }
+
+  void Clear() {
+    count.fill(0);
+    size.fill(0);
+  }
+
+  std::array<size_t, kNumberOfTypes> count{};
+  std::array<size_t, kNumberOfTypes> size{};
+};
+
 class V8_EXPORT_PRIVATE ConcurrentMarking {
  public:
   // When the scope is entered, the concurrent marking tasks
@@ -79,6 +108,8 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
       TaskPriority priority = TaskPriority::kUserVisible);
   // Flushes native context sizes to the given table of the main thread.
   void FlushNativeContexts(NativeContextStats* main_stats);
+  // Flushes sampled object statistics to the given table of the main thread.
+  void FlushObjectStats(SampledObjectStats* main_stats);
   // Flushes memory chunk data using the given marking state.
   void FlushMemoryChunkData(MajorNonAtomicMarkingState* marking_state);
   // This function is called for a new space page that was cleared after
@@ -103,6 +134,7 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
     MemoryChunkDataMap memory_chunk_data;
     NativeContextInferrer native_context_inferrer;
     NativeContextStats native_context_stats;
+    std::unique_ptr<SampledObjectStats> object_stats;
     char cache_line_padding[64];
   };
   class JobTask;
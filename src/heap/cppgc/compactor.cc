@@ -70,6 +70,11 @@ class MovableReferences final {
   // - Upon moving an object this value is adjusted accordingly.
   std::map<MovableReference*, Address> interior_movable_references_;
 
+  // Pages that contain at least one interior slot. Most compacted pages do not
+  // host any interior slots, which allows skipping the ordered lookup in
+  // |interior_movable_references_| for objects moved off those pages.
+  std::unordered_set<const BasePage*> pages_with_interior_slots_;
+
 #if DEBUG
   // The following two collections are used to allow refer back from a slot to
   // an already moved object.
@@ -129,6 +134,7 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   CHECK_EQ(interior_movable_references_.end(),
            interior_movable_references_.find(slot));
   interior_movable_references_.emplace(slot, nullptr);
+  pages_with_interior_slots_.insert(slot_page);
 #if DEBUG
   interior_slot_to_object_.emplace(slot, slot_header.ObjectStart());
 #endif  // DEBUG
@@ -143,8 +149,10 @@ void MovableReferences::Relocate(Address from, Address to) {
   // Consider an object A with slot A.x pointing to value B where A is
   // allocated on a movable page itself. When B is finally moved, it needs to
   // find the corresponding slot A.x. Object A may be moved already and the
-  // memory may have been freed, which would result in a crash.
-  if (!interior_movable_references_.empty()) {
+  // memory may have been freed, which would result in a crash. Interior slots
+  // of |from| can only reside on the page |from| is located on.
+  if (!interior_movable_references_.empty() &&
+      pages_with_interior_slots_.count(BasePage::FromPayload(from))) {
     const HeapObjectHeader& header = HeapObjectHeader::FromObject(to);
     const size_t size = header.ObjectSize();
     RelocateInteriorReferences(from, to, size);
@@ -26,6 +26,10 @@ namespace internal {
 
 namespace {
 
+// Upper bound for lazily sweeping a space on the allocation slow path before
+// the space is expanded instead.
+constexpr double kSweepOnAllocationBudgetInSeconds = 0.0005;
+
 void MarkRangeAsYoung(BasePage* page, Address begin, Address end) {
 #if defined(CPPGC_YOUNG_GENERATION)
   DCHECK_LT(begin, end);
@@ -175,13 +179,12 @@ void ObjectAllocator::RefillLinearAllocationBuffer(NormalPageSpace& space,
   // Try to allocate from the freelist.
   if (RefillLinearAllocationBufferFromFreeList(space, size)) return;
 
-  // Lazily sweep pages of this heap until we find a freed area for this
-  // allocation or we finish sweeping all pages of this heap.
+  // Lazily sweep pages of this space until we find a freed area for this
+  // allocation, we finish sweeping all pages of this space, or the sweeping
+  // budget is exhausted.
   Sweeper& sweeper = raw_heap_.heap()->sweeper();
-  // TODO(chromium:1056170): Investigate whether this should be a loop which
-  // would result in more agressive re-use of memory at the expense of
-  // potentially larger allocation time.
-  if (sweeper.SweepForAllocationIfRunning(&space, size)) {
+  if (sweeper.SweepForAllocationIfRunning(&space, size,
+                                          kSweepOnAllocationBudgetInSeconds)) {
     // Sweeper found a block of at least `size` bytes. Allocation from the
     // free list may still fail as actual  buckets are not exhaustively
     // searched for a suitable block. Instead, buckets are tested from larger
@@ -192,8 +195,11 @@ void ObjectAllocator::RefillLinearAllocationBuffer(NormalPageSpace& space,
     if (RefillLinearAllocationBufferFromFreeList(space, size)) return;
   }
 
-  sweeper.FinishIfRunning();
-  // TODO(chromium:1056170): Make use of the synchronously freed memory.
+  // Sweeping did not yield memory for this allocation within its budget.
+  // Expanding the space is cheaper than finishing sweeping of the whole heap,
+  // which would only release memory of unrelated size classes. Sweeping is
+  // only finished when the concurrent sweeper has already run out of work.
+  sweeper.FinishIfOutOfWork();
 
   auto* new_page = NormalPage::Create(page_backend_, space);
   space.AddPage(new_page);
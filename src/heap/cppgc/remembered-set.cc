@@ -19,10 +19,26 @@ namespace {
 // Visit remembered set that was recorded in the generational barrier.
 void VisitRememberedSlots(const std::set<void*>& slots, const HeapBase& heap,
                           MutatorMarkingState& mutator_marking_state) {
+  // Slots are visited in address order, so consecutive slots frequently live
+  // in the same object. Cache the last resolved object range to avoid the
+  // page and object-start bitmap lookups for each of them.
+  ConstAddress cached_object_begin = nullptr;
+  ConstAddress cached_object_end = nullptr;
+  HeapObjectHeader* cached_header = nullptr;
   for (void* slot : slots) {
-    // Slot must always point to a valid, not freed object.
-    auto& slot_header = BasePage::FromInnerAddress(&heap, slot)
-                            ->ObjectHeaderFromInnerAddress(slot);
+    const ConstAddress slot_address = static_cast<ConstAddress>(slot);
+    if (slot_address < cached_object_begin ||
+        slot_address >= cached_object_end) {
+      // Slot must always point to a valid, not freed object.
+      BasePage* page = BasePage::FromInnerAddress(&heap, slot);
+      cached_header = &page->ObjectHeaderFromInnerAddress(slot);
+      cached_object_begin = reinterpret_cast<ConstAddress>(cached_header);
+      cached_object_end =
+          page->is_large()
+              ? LargePage::From(page)->PayloadEnd()
+              : cached_header->ObjectEnd<AccessMode::kNonAtomic>();
+    }
+    auto& slot_header = *cached_header;
     // The age checking in the generational barrier is imprecise, since a card
     // may have mixed young/old objects. Check here precisely if the object is
     // old.
@@ -771,7 +771,8 @@ class Sweeper::SweeperImpl final {
     }
   }
 
-  bool SweepForAllocationIfRunning(NormalPageSpace* space, size_t size) {
+  bool SweepForAllocationIfRunning(NormalPageSpace* space, size_t size,
+                                   double max_duration_in_seconds) {
     if (!is_in_progress_) return false;
 
     // Bail out for recursive sweeping calls. This can happen when finalizers
@@ -793,6 +794,12 @@ class Sweeper::SweeperImpl final {
         stats_collector_, StatsCollector::kSweepOnAllocation);
     MutatorThreadSweepingScope sweeping_in_progresss(*this);
 
+    // Sweeping only ever processes pages of the space (i.e., the size class)
+    // that the allocation is requested for and is bounded by
+    // |max_duration_in_seconds|, so that allocations keep amortizing sweeping
+    // work page by page instead of stalling on a large space.
+    const double deadline_in_seconds =
+        platform_->MonotonicallyIncreasingTime() + max_duration_in_seconds;
     {
       // First, process unfinalized pages as finalizing a page is faster than
       // sweeping.
@@ -800,6 +807,8 @@ class Sweeper::SweeperImpl final {
       while (auto page = space_state.swept_unfinalized_pages.Pop()) {
         finalizer.FinalizePage(&*page);
         if (size <= finalizer.largest_new_free_list_entry()) return true;
+        if (deadline_in_seconds <= platform_->MonotonicallyIncreasingTime())
+          return false;
       }
     }
     {
@@ -810,6 +819,8 @@ class Sweeper::SweeperImpl final {
       while (auto page = space_state.unswept_pages.Pop()) {
         sweeper.SweepPage(**page);
         if (size <= sweeper.largest_new_free_list_entry()) return true;
+        if (deadline_in_seconds <= platform_->MonotonicallyIncreasingTime())
+          return false;
       }
     }
 
@@ -1050,8 +1061,10 @@ void Sweeper::WaitForConcurrentSweepingForTesting() {
   impl_->WaitForConcurrentSweepingForTesting();
 }
 void Sweeper::NotifyDoneIfNeeded() { impl_->NotifyDoneIfNeeded(); }
-bool Sweeper::SweepForAllocationIfRunning(NormalPageSpace* space, size_t size) {
-  return impl_->SweepForAllocationIfRunning(space, size);
+bool Sweeper::SweepForAllocationIfRunning(NormalPageSpace* space, size_t size,
+                                          double max_duration_in_seconds) {
+  return impl_->SweepForAllocationIfRunning(space, size,
+                                            max_duration_in_seconds);
 }
 bool Sweeper::IsSweepingOnMutatorThread() const {
   return impl_->IsSweepingOnMutatorThread();
@@ -51,9 +51,10 @@ class V8_EXPORT_PRIVATE Sweeper final {
   void FinishIfOutOfWork();
   void NotifyDoneIfNeeded();
   // SweepForAllocationIfRunning sweeps the given |space| until a slot that can
-  // fit an allocation of size |size| is found. Returns true if a slot was
-  // found.
-  bool SweepForAllocationIfRunning(NormalPageSpace* space, size_t size);
+  // fit an allocation of size |size| is found or |max_duration_in_seconds| is
+  // exceeded. Returns true if a slot was found.
+  bool SweepForAllocationIfRunning(NormalPageSpace* space, size_t size,
+                                   double max_duration_in_seconds);
 
   bool IsSweepingOnMutatorThread() const;
   bool IsSweepingInProgress() const;
@@ -3210,15 +3210,23 @@ Handle<SharedFunctionInfo> Factory::NewSharedFunctionInfoForWebSnapshot() {
 }
 
 namespace {
+// The number-string cache is 2-way set-associative: a number hashes to a pair
+// of adjacent entries, the first of which holds the most recently added
+// number. The hashes below are the index of that first entry.
 V8_INLINE int NumberToStringCacheHash(Handle<FixedArray> cache, Smi number) {
-  int mask = (cache->length() >> 1) - 1;
+  int mask = (cache->length() >> 1) - 2;
   return number.value() & mask;
 }
 
 V8_INLINE int NumberToStringCacheHash(Handle<FixedArray> cache, double number) {
-  int mask = (cache->length() >> 1) - 1;
+  int mask = (cache->length() >> 1) - 2;
   int64_t bits = bit_cast<int64_t>(number);
-  return (static_cast<int>(bits) ^ static_cast<int>(bits >> 32)) & mask;
+  uint32_t hash =
+      static_cast<uint32_t>(bits) ^ static_cast<uint32_t>(bits >> 32);
+  // Doubles with short mantissas, like 0.5 or 12.25, only differ in the upper
+  // bits of {hash}; fold those into the bits used for indexing.
+  hash ^= hash >> 16;
+  return static_cast<int>(hash) & mask;
 }
 
 V8_INLINE Handle<String> CharToString(Factory* factory, const char* string,
@@ -3235,7 +3243,9 @@ V8_INLINE Handle<String> CharToString(Factory* factory, const char* string,
 
 void Factory::NumberToStringCacheSet(Handle<Object> number, int hash,
                                      Handle<String> js_string) {
-  if (!number_string_cache()->get(hash * 2).IsUndefined(isolate()) &&
+  // The second entry of a set is only used once the first one is, so the set
+  // is full iff the second entry is.
+  if (!number_string_cache()->get((hash + 1) * 2).IsUndefined(isolate()) &&
       !FLAG_optimize_for_size) {
     int full_size = isolate()->heap()->MaxNumberToStringCacheSize();
     if (number_string_cache()->length() != full_size) {
@@ -3247,6 +3257,9 @@ void Factory::NumberToStringCacheSet(Handle<Object> number, int hash,
   }
   DisallowGarbageCollection no_gc;
   FixedArray cache = *number_string_cache();
+  // Move the previous first entry to the second way, evicting its occupant.
+  cache.set((hash + 1) * 2, cache.get(hash * 2));
+  cache.set((hash + 1) * 2 + 1, cache.get(hash * 2 + 1));
   cache.set(hash * 2, *number);
   cache.set(hash * 2 + 1, *js_string);
 }
@@ -3254,10 +3267,12 @@ void Factory::NumberToStringCacheSet(Handle<Object> number, int hash,
 Handle<Object> Factory::NumberToStringCacheGet(Object number, int hash) {
   DisallowGarbageCollection no_gc;
   FixedArray cache = *number_string_cache();
-  Object key = cache.get(hash * 2);
-  if (key == number || (key.IsHeapNumber() && number.IsHeapNumber() &&
-                        key.Number() == number.Number())) {
-    return Handle<String>(String::cast(cache.get(hash * 2 + 1)), isolate());
+  for (int entry = hash; entry < hash + 2; entry++) {
+    Object key = cache.get(entry * 2);
+    if (key == number || (key.IsHeapNumber() && number.IsHeapNumber() &&
+                          key.Number() == number.Number())) {
+      return Handle<String>(String::cast(cache.get(entry * 2 + 1)), isolate());
+    }
   }
   return undefined_value();
 }
@@ -8,6 +8,7 @@
 #include "src/common/globals.h"
 #include "src/heap/free-list-inl.h"
 #include "src/heap/heap.h"
+#include "src/heap/memory-allocator.h"
 #include "src/heap/memory-chunk-inl.h"
 #include "src/objects/free-space-inl.h"
 
@@ -516,6 +517,20 @@ size_t FreeListCategory::SumFreeList() {
   }
   return sum;
 }
+size_t FreeListCategory::DiscardUnusedMemory(Page* page) {
+  size_t discarded = 0;
+  for (FreeSpace cur = top(); !cur.is_null(); cur = cur.next()) {
+    const Address start = cur.address() + FreeSpace::kSize;
+    const size_t size = cur.size(kRelaxedLoad) - FreeSpace::kSize;
+    const base::AddressRegion area =
+        MemoryAllocator::ComputeDiscardMemoryArea(start, size);
+    if (area.size() == 0) continue;
+    page->DiscardUnusedMemory(area.begin(), area.size());
+    discarded += area.size();
+  }
+  return discarded;
+}
+
 int FreeListCategory::FreeListLength() {
   int length = 0;
   FreeSpace cur = top();
@@ -77,6 +77,10 @@ class FreeListCategory {
   size_t SumFreeList();
   int FreeListLength();
 
+  // Returns the memory of the nodes in this category, apart from their
+  // headers, to the OS. Returns the number of bytes discarded.
+  size_t DiscardUnusedMemory(Page* page);
+
  private:
   // For debug builds we accurately compute free lists lengths up until
   // {kVeryLongFreeList} by manually walking the list.
@@ -4,6 +4,7 @@
 
 #include "src/heap/gc-tracer.h"
 
+#include <algorithm>
 #include <cstdarg>
 
 #include "include/v8-metrics.h"
@@ -1781,6 +1782,19 @@ void GCTracer::ReportYoungCycleToRecorder() {
       freed_bytes / total_wall_clock_duration_in_us;
   event.main_thread_efficiency_in_bytes_per_us =
       freed_bytes / main_thread_wall_clock_duration_in_us;
+  // Sizes:
+  // Survivors are either copied within the young generation or promoted.
+  // Promoted objects are no longer young, so they only count towards
+  // {promoted_bytes}, i.e. bytes_before == bytes_after + bytes_freed +
+  // promoted_bytes.
+  const size_t promoted_bytes = std::min(heap_->promoted_objects_size(),
+                                         current_.survived_young_object_size);
+  event.objects.bytes_before =
+      static_cast<int64_t>(current_.young_object_size);
+  event.objects.bytes_after = static_cast<int64_t>(
+      current_.survived_young_object_size - promoted_bytes);
+  event.objects.bytes_freed = static_cast<int64_t>(freed_bytes);
+  event.promoted_bytes = static_cast<int64_t>(promoted_bytes);
 
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
 }
@@ -171,5 +171,33 @@ template class V8_EXPORT_PRIVATE MemoryController<GlobalMemoryTrait>;
 const char* V8HeapTrait::kName = "HeapController";
 const char* GlobalMemoryTrait::kName = "GlobalMemoryController";
 
+// static
+size_t YoungGenerationSizeController::DesiredCapacity(
+    size_t current_capacity, size_t min_capacity, size_t max_capacity,
+    double allocation_throughput, double scavenge_speed, double survival_ratio,
+    double pause_target_ms) {
+  DCHECK_LE(min_capacity, max_capacity);
+  DCHECK(IsAligned(min_capacity, Page::kPageSize));
+  DCHECK(IsAligned(max_capacity, Page::kPageSize));
+  const size_t current =
+      std::min(std::max(current_capacity, min_capacity), max_capacity);
+  // Without measurements there is nothing to adapt to.
+  if (allocation_throughput <= 0 || scavenge_speed <= 0) return current;
+
+  // The expected scavenge pause is capacity * survival_ratio / scavenge_speed.
+  const double pause_bound = pause_target_ms * scavenge_speed /
+                             std::max(survival_ratio, kMinSurvivalRatio);
+  const double throughput_bound =
+      allocation_throughput * kTargetScavengeIntervalMs;
+  double desired = std::min(pause_bound, throughput_bound);
+  desired = std::min(desired, current * kMaxGrowingFactor);
+  desired = std::max(desired, current / kMaxShrinkingFactor);
+
+  if (desired >= static_cast<double>(max_capacity)) return max_capacity;
+  const size_t result =
+      ::RoundUp(static_cast<size_t>(desired), Page::kPageSize);
+  return std::min(std::max(result, min_capacity), max_capacity);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -56,6 +56,30 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
+// Sizes the young generation (the capacity of a semi-space) from the new space
+// allocation throughput, the scavenge speed and the survival ratio. The
+// capacity is chosen as large as needed to scavenge at most once per
+// kTargetScavengeIntervalMs, but small enough that the expected scavenge pause
+// stays within the pause target.
+class V8_EXPORT_PRIVATE YoungGenerationSizeController : public AllStatic {
+ public:
+  static constexpr double kTargetScavengeIntervalMs = 1000.0;
+  // Survival ratios below this value are treated as this value to avoid
+  // unbounded growth when (almost) nothing survives.
+  static constexpr double kMinSurvivalRatio = 0.01;
+  // Bounds on the change of the capacity in a single step.
+  static constexpr double kMaxGrowingFactor = 2.0;
+  static constexpr double kMaxShrinkingFactor = 2.0;
+
+  // |survival_ratio| is in the range [0, 1]. Returns a page-aligned capacity in
+  // the range [min_capacity, max_capacity].
+  static size_t DesiredCapacity(size_t current_capacity, size_t min_capacity,
+                                size_t max_capacity,
+                                double allocation_throughput,
+                                double scavenge_speed, double survival_ratio,
+                                double pause_target_ms);
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -10,6 +10,7 @@
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 #include "include/v8-locker.h"
 #include "src/api/api-inl.h"
@@ -91,6 +92,7 @@
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots-inl.h"
+#include "src/regexp/regexp-stack.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/serializer-deserializer.h"
@@ -101,6 +103,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -397,6 +400,19 @@ size_t Heap::CommittedMemoryExecutable() {
   return static_cast<size_t>(memory_allocator()->SizeExecutable());
 }
 
+size_t Heap::HugePageAdvisedMemory() {
+  size_t total = 0;
+#ifdef V8_COMPRESS_POINTERS
+  // The cage is advised once when it is reserved (see IsolateAllocator). All
+  // data pages are allocated from it without address hints, and its allocator
+  // reuses the smallest fitting free region first, which keeps pages packed
+  // so that they fill whole huge pages.
+  total += isolate_->GetPtrComprCage()->huge_page_advised_size();
+#endif  // V8_COMPRESS_POINTERS
+  if (code_range_) total += code_range_->huge_page_advised_size();
+  return total;
+}
+
 void Heap::UpdateMaximumCommitted() {
   if (!HasBeenSetUp()) return;
 
@@ -1175,8 +1191,12 @@ inline bool MakePretenureDecision(
        current_decision == AllocationSite::kMaybeTenure)) {
     if (ratio >= AllocationSite::kPretenureRatio) {
       // We just transition into tenure state when the semi-space was at
-      // maximum capacity.
-      if (maximum_size_scavenge) {
+      // maximum capacity. With eager tenuring, a site that already survived
+      // at a high rate in the previous GC is tenured right away so that its
+      // objects are not copied within new space once more before promotion.
+      if (maximum_size_scavenge ||
+          (FLAG_allocation_site_eager_tenuring &&
+           current_decision == AllocationSite::kMaybeTenure)) {
         site.set_deopt_dependent_code(true);
         site.set_pretenure_decision(AllocationSite::kTenure);
         // Currently we just need to deopt when we make a state transition to
@@ -2082,6 +2102,75 @@ void Heap::StartIdleIncrementalMarking(
                           gc_callback_flags);
 }
 
+namespace {
+
+// Moves |count| tagged values between possibly overlapping ranges using relaxed
+// atomic accesses, so that concurrent markers never observe torn values. When
+// tagged values are smaller than a word and both ranges are equally aligned,
+// pairs of values are moved with a single word-sized access.
+void RelaxedMoveTagged(Address dst, Address src, size_t count) {
+  constexpr Address kWordMask = kSystemPointerSize - 1;
+  constexpr size_t kTaggedPerWord = kSystemPointerSize / kTaggedSize;
+  const bool use_words =
+      kTaggedPerWord > 1 && ((dst ^ src) & kWordMask) == 0;
+  auto move_tagged = [](Address to, Address from) {
+    AsAtomicTagged::Relaxed_Store(
+        reinterpret_cast<AtomicTagged_t*>(to),
+        AsAtomicTagged::Relaxed_Load(reinterpret_cast<AtomicTagged_t*>(from)));
+  };
+  auto move_word = [](Address to, Address from) {
+    base::AsAtomicWord::Relaxed_Store(
+        reinterpret_cast<base::AtomicWord*>(to),
+        base::AsAtomicWord::Relaxed_Load(
+            reinterpret_cast<base::AtomicWord*>(from)));
+  };
+
+  // Copying forwards is safe if the ranges do not overlap or |dst| lies
+  // before |src|.
+  if (dst - src >= count * kTaggedSize) {
+    if (use_words) {
+      for (; count > 0 && (dst & kWordMask) != 0; count--) {
+        move_tagged(dst, src);
+        dst += kTaggedSize;
+        src += kTaggedSize;
+      }
+      for (; count >= kTaggedPerWord; count -= kTaggedPerWord) {
+        move_word(dst, src);
+        dst += kSystemPointerSize;
+        src += kSystemPointerSize;
+      }
+    }
+    for (; count > 0; count--) {
+      move_tagged(dst, src);
+      dst += kTaggedSize;
+      src += kTaggedSize;
+    }
+    return;
+  }
+
+  dst += count * kTaggedSize;
+  src += count * kTaggedSize;
+  if (use_words) {
+    for (; count > 0 && (dst & kWordMask) != 0; count--) {
+      dst -= kTaggedSize;
+      src -= kTaggedSize;
+      move_tagged(dst, src);
+    }
+    for (; count >= kTaggedPerWord; count -= kTaggedPerWord) {
+      dst -= kSystemPointerSize;
+      src -= kSystemPointerSize;
+      move_word(dst, src);
+    }
+  }
+  for (; count > 0; count--) {
+    dst -= kTaggedSize;
+    src -= kTaggedSize;
+    move_tagged(dst, src);
+  }
+}
+
+}  // namespace
+
 void Heap::MoveRange(HeapObject dst_object, const ObjectSlot dst_slot,
                      const ObjectSlot src_slot, int len,
                      WriteBarrierMode mode) {
@@ -2093,29 +2182,9 @@ void Heap::MoveRange(HeapObject dst_object, const ObjectSlot dst_slot,
   DCHECK(src_slot < src_slot + len);
 
   if (FLAG_concurrent_marking && incremental_marking()->IsMarking()) {
-    if (dst_slot < src_slot) {
-      // Copy tagged values forward using relaxed load/stores that do not
-      // involve value decompression.
-      const AtomicSlot atomic_dst_end(dst_end);
-      AtomicSlot dst(dst_slot);
-      AtomicSlot src(src_slot);
-      while (dst < atomic_dst_end) {
-        *dst = *src;
-        ++dst;
-        ++src;
-      }
-    } else {
-      // Copy tagged values backwards using relaxed load/stores that do not
-      // involve value decompression.
-      const AtomicSlot atomic_dst_begin(dst_slot);
-      AtomicSlot dst(dst_slot + len - 1);
-      AtomicSlot src(src_slot + len - 1);
-      while (dst >= atomic_dst_begin) {
-        *dst = *src;
-        --dst;
-        --src;
-      }
-    }
+    // Move tagged values using relaxed load/stores that do not involve value
+    // decompression.
+    RelaxedMoveTagged(dst_slot.address(), src_slot.address(), len);
   } else {
     MemMove(dst_slot.ToVoidPtr(), src_slot.ToVoidPtr(), len * kTaggedSize);
   }
@@ -2146,14 +2215,7 @@ void Heap::CopyRange(HeapObject dst_object, const TSlot dst_slot,
   if (FLAG_concurrent_marking && incremental_marking()->IsMarking()) {
     // Copy tagged values using relaxed load/stores that do not involve value
     // decompression.
-    const AtomicSlot atomic_dst_end(dst_end);
-    AtomicSlot dst(dst_slot);
-    AtomicSlot src(src_slot);
-    while (dst < atomic_dst_end) {
-      *dst = *src;
-      ++dst;
-      ++src;
-    }
+    RelaxedMoveTagged(dst_slot.address(), src_slot.address(), len);
   } else {
     MemCopy(dst_slot.ToVoidPtr(), src_slot.ToVoidPtr(), len * kTaggedSize);
   }
@@ -2639,6 +2701,10 @@ void Heap::MarkCompactEpilogue() {
 
   incremental_marking()->Epilogue();
 
+  // Don't hold on to retained regexp backtracking stacks when the embedder
+  // or the memory reducer asked to reduce the footprint.
+  if (ShouldReduceMemory()) isolate_->regexp_stack()->ReleaseCachedMemory();
+
   DCHECK(incremental_marking()->IsStopped());
 }
 
@@ -2653,8 +2719,31 @@ void Heap::MarkCompactPrologue() {
   FlushNumberStringCache();
 }
 
+size_t Heap::DesiredNewSpaceCapacity() {
+  const size_t desired = YoungGenerationSizeController::DesiredCapacity(
+      new_space_->TotalCapacity(), new_space_->InitialTotalCapacity(),
+      new_space_->MaximumCapacity(),
+      tracer()->NewSpaceAllocationThroughputInBytesPerMillisecond(
+          GCTracer::kThroughputTimeFrameMs),
+      tracer()->ScavengeSpeedInBytesPerMillisecond(kForSurvivedObjects),
+      tracer()->AverageSurvivalRatio() / 100.0,
+      FLAG_young_generation_pause_target_ms);
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "[YoungGenerationSizeController] capacity: %zu KB, desired: %zu KB\n",
+        new_space_->TotalCapacity() / KB, desired / KB);
+  }
+  return desired;
+}
+
 void Heap::CheckNewSpaceExpansionCriteria() {
-  if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
+  if (FLAG_adaptive_young_generation_size) {
+    // Shrinking is only possible after a GC, see ReduceNewSpaceSize().
+    const size_t desired = DesiredNewSpaceCapacity();
+    if (desired > new_space_->TotalCapacity()) {
+      new_space_->GrowTo(desired);
+    }
+  } else if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
       survived_since_last_expansion_ > new_space_->TotalCapacity()) {
     // Grow the size of new space if there is room to grow, and enough data
     // has survived scavenge since the last expansion.
@@ -3825,9 +3914,37 @@ void Heap::ReduceNewSpaceSize() {
   static const size_t kLowAllocationThroughput = 1000;
   const double allocation_throughput =
       tracer()->CurrentAllocationThroughputInBytesPerMillisecond();
+  const bool shrink_requested =
+      std::exchange(shrink_new_space_on_next_gc_, false);
 
   if (FLAG_predictable) return;
 
+  if (shrink_requested) {
+    const size_t committed_before = new_space_->CommittedMemory();
+    new_space_->Shrink();
+    new_lo_space_->SetCapacity(new_space_->Capacity());
+    UncommitFromSpace();
+    if (FLAG_trace_memory_pressure) {
+      const size_t committed_after = new_space_->CommittedMemory();
+      isolate()->PrintWithTimestamp(
+          "Memory pressure: new space reclaimed %zuKB\n",
+          committed_before > committed_after
+              ? (committed_before - committed_after) / KB
+              : 0);
+    }
+    return;
+  }
+
+  if (FLAG_adaptive_young_generation_size && !ShouldReduceMemory()) {
+    const size_t desired = DesiredNewSpaceCapacity();
+    if (desired < new_space_->TotalCapacity()) {
+      new_space_->ShrinkTo(desired);
+      new_lo_space_->SetCapacity(new_space_->Capacity());
+      UncommitFromSpace();
+    }
+    return;
+  }
+
   if (ShouldReduceMemory() ||
       ((allocation_throughput != 0) &&
        (allocation_throughput < kLowAllocationThroughput))) {
@@ -4180,13 +4297,18 @@ void Heap::CheckMemoryPressure() {
   if (HighMemoryPressure()) {
     // The optimizing compiler may be unnecessarily holding on to memory.
     isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
+    isolate()->allocator()->ReleasePooledSegments();
   }
   // Reset the memory pressure level to avoid recursive GCs triggered by
   // CheckMemoryPressure from AdjustAmountOfExternalMemory called by
   // the finalizers.
   MemoryPressureLevel memory_pressure_level = memory_pressure_level_.exchange(
       MemoryPressureLevel::kNone, std::memory_order_relaxed);
-  if (memory_pressure_level == MemoryPressureLevel::kCritical) {
+  if (FLAG_graded_memory_pressure_response &&
+      memory_pressure_level != MemoryPressureLevel::kNone) {
+    TRACE_EVENT0("devtools.timeline,v8", "V8.CheckMemoryPressure");
+    ReclaimMemoryOnPressure(memory_pressure_level);
+  } else if (memory_pressure_level == MemoryPressureLevel::kCritical) {
     TRACE_EVENT0("devtools.timeline,v8", "V8.CheckMemoryPressure");
     CollectGarbageOnMemoryPressure();
   } else if (memory_pressure_level == MemoryPressureLevel::kModerate) {
@@ -4234,6 +4356,53 @@ void Heap::CollectGarbageOnMemoryPressure() {
   }
 }
 
+void Heap::ReclaimMemoryOnPressure(MemoryPressureLevel level) {
+  DCHECK_NE(MemoryPressureLevel::kNone, level);
+  auto trace_stage = [this, level](const char* stage, size_t bytes) {
+    if (!FLAG_trace_memory_pressure) return;
+    isolate()->PrintWithTimestamp(
+        "Memory pressure (%s): %s reclaimed %zuKB\n",
+        level == MemoryPressureLevel::kCritical ? "critical" : "moderate",
+        stage, bytes / KB);
+  };
+
+  // Stage 1: Pages kept in the unmapper pool for reuse.
+  MemoryAllocator::Unmapper* unmapper = memory_allocator()->unmapper();
+  const size_t pooled_before = unmapper->CommittedBufferedMemory();
+  unmapper->EnsureUnmappingCompleted();
+  const size_t pooled_after = unmapper->CommittedBufferedMemory();
+  trace_stage("unmapper pool",
+              pooled_before > pooled_after ? pooled_before - pooled_after : 0);
+
+  // Stage 2: Free-list memory of the paged spaces. The pages stay committed
+  // but the OS may reclaim the discarded ranges.
+  size_t discarded = 0;
+  PagedSpaceIterator spaces(this);
+  for (PagedSpace* space = spaces.Next(); space != nullptr;
+       space = spaces.Next()) {
+    discarded += space->DiscardFreeListMemory();
+  }
+  trace_stage("free lists", discarded);
+
+  // Stage 3: Unused capacity of the young generation. New space can only be
+  // shrunk after a GC, so this is left to the epilogue of the next one (see
+  // ReduceNewSpaceSize()). For critical pressure that is the GC below.
+  if (new_space_) shrink_new_space_on_next_gc_ = true;
+
+  // Stage 4: Reclaim fragmentation and garbage through compaction.
+  const size_t committed_before = CommittedMemory();
+  if (level == MemoryPressureLevel::kCritical) {
+    CollectGarbageOnMemoryPressure();
+  } else if (FLAG_incremental_marking && incremental_marking()->IsStopped()) {
+    StartIncrementalMarking(kReduceMemoryFootprintMask,
+                            GarbageCollectionReason::kMemoryPressure);
+  }
+  const size_t committed_after = CommittedMemory();
+  trace_stage("garbage collection", committed_before > committed_after
+                                        ? committed_before - committed_after
+                                        : 0);
+}
+
 void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                                       bool is_isolate_locked) {
   TRACE_EVENT1("devtools.timeline,v8", "V8.MemoryPressureNotification", "level",
@@ -4843,6 +5012,13 @@ void Heap::IterateWeakRoots(RootVisitor* v, base::EnumSet<SkipRoot> options) {
     external_string_table_.IterateAll(v);
   }
   v->Synchronize(VisitorSynchronization::kExternalStringsTable);
+  if (!options.contains(SkipRoot::kOldGeneration) &&
+      !options.contains(SkipRoot::kUnserializable)) {
+    // All maps and cells in the cache are in old space. It is not serialized;
+    // a deserialized isolate starts with an empty cache.
+    isolate()->object_assign_cache()->Iterate(v);
+  }
+  v->Synchronize(VisitorSynchronization::kObjectAssignCache);
 }
 
 void Heap::IterateSmiRoots(RootVisitor* v) {
@@ -6649,11 +6825,7 @@ HeapObject HeapObjectIterator::NextObject() {
   return HeapObject();
 }
 
-void Heap::UpdateTotalGCTime(double duration) {
-  if (FLAG_trace_gc_verbose) {
-    total_gc_time_ms_ += duration;
-  }
-}
+void Heap::UpdateTotalGCTime(double duration) { total_gc_time_ms_ += duration; }
 
 void Heap::ExternalStringTable::CleanUpYoung() {
   int last = 0;
@@ -6914,6 +7086,20 @@ size_t Heap::ObjectSizeAtLastGC(size_t index) {
   return live_object_stats_->object_size_last_gc(index);
 }
 
+size_t Heap::SampledObjectCountAtLastGC(size_t index) {
+  const SampledObjectStats* stats =
+      mark_compact_collector()->sampled_object_stats_at_last_gc();
+  if (!stats || index >= SampledObjectStats::kNumberOfTypes) return 0;
+  return stats->count[index];
+}
+
+size_t Heap::SampledObjectSizeAtLastGC(size_t index) {
+  const SampledObjectStats* stats =
+      mark_compact_collector()->sampled_object_stats_at_last_gc();
+  if (!stats || index >= SampledObjectStats::kNumberOfTypes) return 0;
+  return stats->size[index];
+}
+
 bool Heap::GetObjectTypeName(size_t index, const char** object_type,
                              const char** object_sub_type) {
   if (index >= ObjectStats::OBJECT_STATS_COUNT) return false;
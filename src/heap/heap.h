@@ -697,6 +697,9 @@ class Heap {
 
   V8_EXPORT_PRIVATE double MonotonicallyIncreasingTimeInMs() const;
 
+  // Returns the total time spent in atomic GC pauses on the main thread.
+  double total_gc_time_ms() const { return total_gc_time_ms_; }
+
   void VerifyNewSpaceTop();
 
   void RecordStats(HeapStats* stats, bool take_snapshot = false);
@@ -1258,6 +1261,11 @@ class Heap {
   size_t ObjectCountAtLastGC(size_t index);
   size_t ObjectSizeAtLastGC(size_t index);
 
+  // Returns the object count and size estimated by sampling during concurrent
+  // marking of the last major GC. Only instance type buckets are populated.
+  size_t SampledObjectCountAtLastGC(size_t index);
+  size_t SampledObjectSizeAtLastGC(size_t index);
+
   // Retrieves names of buckets used by object statistics tracking.
   bool GetObjectTypeName(size_t index, const char** object_type,
                          const char** object_sub_type);
@@ -1326,6 +1334,12 @@ class Heap {
   // Returns the amount of phyical memory currently committed for the heap.
   size_t CommittedPhysicalMemory();
 
+  // Returns the amount of reserved memory that was advised to be backed by
+  // transparent huge pages (see --transparent-huge-pages). Memory shared with
+  // other isolates, like a shared pointer compression cage or code range, is
+  // advised and counted once per reservation, but reported by every isolate.
+  size_t HugePageAdvisedMemory();
+
   // Returns the maximum amount of memory ever committed for the heap.
   size_t MaximumCommittedMemory() { return maximum_committed_; }
 
@@ -1833,6 +1847,10 @@ class Heap {
 
   void ReduceNewSpaceSize();
 
+  // Returns the semi-space capacity suggested by the
+  // YoungGenerationSizeController for --adaptive-young-generation-size.
+  size_t DesiredNewSpaceCapacity();
+
   GCIdleTimeHeapState ComputeHeapState();
 
   bool PerformIdleTimeAction(GCIdleTimeAction action,
@@ -1855,6 +1873,11 @@ class Heap {
 
   void CollectGarbageOnMemoryPressure();
 
+  // Reclaims memory in stages of increasing cost, from releasing pooled
+  // pages up to a full compacting GC for critical pressure. Used with
+  // --graded-memory-pressure-response.
+  void ReclaimMemoryOnPressure(MemoryPressureLevel level);
+
   void EagerlyFreeExternalMemory();
 
   bool InvokeNearHeapLimitCallback();
@@ -2158,6 +2181,10 @@ class Heap {
   // and reset by a mark-compact garbage collection.
   std::atomic<MemoryPressureLevel> memory_pressure_level_;
 
+  // Set by a graded memory pressure response to have the next GC shrink new
+  // space in its epilogue.
+  bool shrink_new_space_on_next_gc_ = false;
+
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
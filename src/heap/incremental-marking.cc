@@ -881,6 +881,11 @@ StepResult IncrementalMarking::Step(double max_step_size_in_ms,
                                     CompletionAction action,
                                     StepOrigin step_origin) {
   double start = heap_->MonotonicallyIncreasingTimeInMs();
+  const bool has_step_duration_budget = step_duration_budget_ms_ > 0.0;
+  if (has_step_duration_budget) {
+    max_step_size_in_ms =
+        std::min(max_step_size_in_ms, step_duration_budget_ms_);
+  }
 
   StepResult combined_result = StepResult::kMoreWorkRemaining;
   size_t bytes_to_process = 0;
@@ -915,7 +920,12 @@ StepResult IncrementalMarking::Step(double max_step_size_in_ms,
         max_step_size_in_ms, marking_speed);
     bytes_to_process =
         std::min(ComputeStepSizeInBytes(step_origin), max_step_size);
-    bytes_to_process = std::max({bytes_to_process, kMinStepSizeInBytes});
+    // With an embedder-provided budget the minimum step size must not exceed
+    // what can be marked within the budget.
+    const size_t min_step_size =
+        has_step_duration_budget ? std::min(kMinStepSizeInBytes, max_step_size)
+                                 : kMinStepSizeInBytes;
+    bytes_to_process = std::max({bytes_to_process, min_step_size});
 
     // Perform a single V8 and a single embedder step. In case both have been
     // observed as empty back to back, we can finalize.
@@ -191,6 +191,15 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
 
   bool black_allocation() { return black_allocation_; }
 
+  // Upper bound on the duration of a single marking step on the main thread,
+  // set through v8::Isolate::SetGCPauseBudget(). 0 means that the default step
+  // sizes are used.
+  void set_step_duration_budget_ms(double budget_ms) {
+    DCHECK_LE(0, budget_ms);
+    step_duration_budget_ms_ = budget_ms;
+  }
+  double step_duration_budget_ms() const { return step_duration_budget_ms_; }
+
   void StartBlackAllocationForTesting() {
     if (!black_allocation_) {
       StartBlackAllocation();
@@ -285,6 +294,7 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   size_t bytes_marked_ = 0;
   size_t scheduled_bytes_to_mark_ = 0;
   double schedule_update_time_ms_ = 0.0;
+  double step_duration_budget_ms_ = 0.0;
   // A sample of concurrent_marking()->TotalMarkedBytes() at the last
   // incremental marking step. It is used for updating
   // bytes_marked_ahead_of_schedule_ with contribution of concurrent marking.
@@ -41,8 +41,9 @@ void MarkCompactCollector::MarkRootObject(Root root, HeapObject obj) {
 }
 
 void MinorMarkCompactCollector::MarkRootObject(HeapObject obj) {
-  if (Heap::InYoungGeneration(obj) &&
-      non_atomic_marking_state_.WhiteToGrey(obj)) {
+  // Background markers may already be running while roots are visited, so the
+  // atomic marking state is required here.
+  if (Heap::InYoungGeneration(obj) && marking_state_.WhiteToGrey(obj)) {
     main_thread_worklist_local_.Push(obj);
   }
 }
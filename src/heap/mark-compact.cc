@@ -55,6 +55,7 @@
 #include "src/objects/instance-type.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-objects-inl.h"
+#include "src/objects/lookup-cache-inl.h"
 #include "src/objects/maybe-object.h"
 #include "src/objects/objects.h"
 #include "src/objects/slots-inl.h"
@@ -620,6 +621,7 @@ void MarkCompactCollector::CollectGarbage() {
   VerifyMarking();
   heap()->memory_measurement()->FinishProcessing(native_context_stats_);
   RecordObjectStats();
+  PublishSampledObjectStats();
 
   StartSweepSpaces();
   Evacuate();
@@ -851,6 +853,9 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
       // considered for evacuation.
       if (area_size - p->allocated_bytes() >= free_bytes_threshold) {
         pages.push_back(std::make_pair(p->allocated_bytes(), p));
+        p->set_fragmented_full_gcs(p->fragmented_full_gcs() + 1);
+      } else {
+        p->set_fragmented_full_gcs(0);
       }
     } else {
       pages.push_back(std::make_pair(p->allocated_bytes(), p));
@@ -903,17 +908,29 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     // - the total size of evacuated objects does not exceed the specified
     // limit.
     // - fragmentation of (n+1)-th page does not exceed the specified limit.
-    std::sort(pages.begin(), pages.end(),
-              [](const LiveBytesPagePair& a, const LiveBytesPagePair& b) {
-                return a.first < b.first;
-              });
+    // With --compaction-cost-model only pages whose evacuation pays off are
+    // kept, ordered by how well they pay off, instead.
+    if (!FLAG_compaction_cost_model ||
+        !SelectEvacuationCandidatesByCost(space, &pages)) {
+      std::sort(pages.begin(), pages.end(),
+                [](const LiveBytesPagePair& a, const LiveBytesPagePair& b) {
+                  return a.first < b.first;
+                });
+    }
+    // Candidates are a prefix of |pages|. That order is not by live bytes
+    // with the cost model, so stop at the first page that exceeds the quota
+    // rather than skipping it and taking a later, smaller one.
+    bool quota_exceeded = false;
     for (size_t i = 0; i < pages.size(); i++) {
       size_t live_bytes = pages[i].first;
       DCHECK_GE(area_size, live_bytes);
-      if (FLAG_compact_on_every_full_gc ||
-          ((total_live_bytes + live_bytes) <= max_evacuated_bytes)) {
+      if (!quota_exceeded &&
+          (FLAG_compact_on_every_full_gc ||
+           ((total_live_bytes + live_bytes) <= max_evacuated_bytes))) {
         candidate_count++;
         total_live_bytes += live_bytes;
+      } else {
+        quota_exceeded = true;
       }
       if (FLAG_trace_fragmentation_verbose) {
         PrintIsolate(isolate(),
@@ -936,6 +953,8 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     if ((estimated_released_pages == 0) && !FLAG_compact_on_every_full_gc) {
       candidate_count = 0;
     }
+    DCHECK(FLAG_compact_on_every_full_gc ||
+           total_live_bytes <= max_evacuated_bytes);
     for (int i = 0; i < candidate_count; i++) {
       AddEvacuationCandidate(pages[i].second);
     }
@@ -950,6 +969,68 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   }
 }
 
+bool MarkCompactCollector::SelectEvacuationCandidatesByCost(
+    PagedSpace* space, std::vector<std::pair<size_t, Page*>>* pages) {
+  const double compaction_speed =
+      heap()->tracer()->CompactionSpeedInBytesPerMillisecond();
+  const double allocation_throughput =
+      heap()->tracer()
+          ->OldGenerationAllocationThroughputInBytesPerMillisecond();
+  // Fall back to the default heuristics until there are enough samples.
+  if (compaction_speed == 0 || allocation_throughput == 0) return false;
+
+  // Evacuating a page with |live| bytes pauses the mutator for
+  // |live / compaction_speed| ms, during which it could have allocated
+  // |live * allocation_throughput / compaction_speed| bytes. The page pays for
+  // itself if the fragmented memory that evacuation returns is at least that
+  // much. Fragmented memory consists of free blocks that are too small to
+  // serve a linear allocation area and of wasted memory. It is credited once
+  // for every full GC the page has stayed fragmented, up to
+  // --compaction-payback-gcs, since long-lived fragmentation is unlikely to go
+  // away by itself.
+  struct Candidate {
+    size_t live_bytes;
+    Page* page;
+    double score;
+  };
+  std::vector<Candidate> candidates;
+  candidates.reserve(pages->size());
+  const size_t max_credited_gcs =
+      static_cast<size_t>(std::max(FLAG_compaction_payback_gcs, 1));
+  for (const auto& pair : *pages) {
+    const size_t live_bytes = pair.first;
+    Page* p = pair.second;
+    const size_t fragmented_bytes =
+        p->free_block_bytes(0) + p->free_block_bytes(1) + p->wasted_memory();
+    const double benefit =
+        static_cast<double>(fragmented_bytes) *
+        std::min(p->fragmented_full_gcs(), max_credited_gcs);
+    const double cost = live_bytes * allocation_throughput / compaction_speed;
+    const bool pays_off = benefit >= cost;
+    if (FLAG_trace_compaction_cost_model) {
+      PrintIsolate(isolate(),
+                   "compaction-cost-model: space=%s page=%p live_kb=%zu "
+                   "fragmented_kb=%zu fragmented_gcs=%zu cost_ms=%.2f "
+                   "benefit_kb=%.1f cost_kb=%.1f pays_off=%d\n",
+                   space->name(), reinterpret_cast<void*>(p), live_bytes / KB,
+                   fragmented_bytes / KB, p->fragmented_full_gcs(),
+                   live_bytes / compaction_speed, benefit / KB, cost / KB,
+                   pays_off);
+    }
+    if (!pays_off) continue;
+    candidates.push_back({live_bytes, p, benefit / (cost + 1)});
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const Candidate& a, const Candidate& b) {
+              return a.score > b.score;
+            });
+  pages->clear();
+  for (const Candidate& candidate : candidates) {
+    pages->emplace_back(candidate.live_bytes, candidate.page);
+  }
+  return true;
+}
+
 void MarkCompactCollector::AbortCompaction() {
   if (compacting_) {
     RememberedSet<OLD_TO_OLD>::ClearAll(heap());
@@ -1013,6 +1094,13 @@ void MarkCompactCollector::FinishConcurrentMarking() {
     heap()->concurrent_marking()->FlushMemoryChunkData(
         non_atomic_marking_state());
     heap()->concurrent_marking()->FlushNativeContexts(&native_context_stats_);
+    if (FLAG_concurrent_marking_object_stats_sample_rate > 0) {
+      if (!sampled_object_stats_) {
+        sampled_object_stats_ = std::make_unique<SampledObjectStats>();
+      }
+      heap()->concurrent_marking()->FlushObjectStats(
+          sampled_object_stats_.get());
+    }
   }
 }
 
@@ -1219,12 +1307,18 @@ class MarkCompactCollector::CustomRootBodyMarkingVisitor final
   MarkCompactCollector* const collector_;
 };
 
+// Marks objects in the shared heap that are referenced from client heaps.
+// Marked objects are pushed onto |marking_worklists|, which may differ from
+// the collector's main thread worklists when client heaps are scanned in
+// parallel.
 class MarkCompactCollector::SharedHeapObjectVisitor final
     : public ObjectVisitorWithCageBases {
  public:
-  explicit SharedHeapObjectVisitor(MarkCompactCollector* collector)
+  SharedHeapObjectVisitor(MarkCompactCollector* collector,
+                          MarkingWorklists::Local* marking_worklists)
       : ObjectVisitorWithCageBases(collector->isolate()),
-        collector_(collector) {}
+        collector_(collector),
+        marking_worklists_(marking_worklists) {}
 
   void VisitPointer(HeapObject host, ObjectSlot p) final {
     MarkObject(host, p, p.load(cage_base()));
@@ -1282,7 +1376,11 @@ class MarkCompactCollector::SharedHeapObjectVisitor final
     if (!heap_object.InSharedHeap()) return;
     RememberedSet<OLD_TO_SHARED>::Insert<AccessMode::NON_ATOMIC>(
         MemoryChunk::FromHeapObject(host), slot.address());
-    collector_->MarkRootObject(Root::kClientHeap, heap_object);
+    if (marking_worklists_ == collector_->local_marking_worklists()) {
+      collector_->MarkRootObject(Root::kClientHeap, heap_object);
+    } else if (collector_->marking_state()->WhiteToGrey(heap_object)) {
+      marking_worklists_->Push(heap_object);
+    }
   }
 
   V8_INLINE void RecordRelocSlot(Code host, RelocInfo* rinfo,
@@ -1300,6 +1398,67 @@ class MarkCompactCollector::SharedHeapObjectVisitor final
   }
 
   MarkCompactCollector* const collector_;
+  MarkingWorklists::Local* const marking_worklists_;
+};
+
+// Scans the objects of client heap spaces for references into the shared
+// heap. Every work item is a single space of a client heap, so remembered set
+// insertions into a client chunk are never performed concurrently.
+class MarkCompactCollector::ClientHeapMarkingJob final : public v8::JobTask {
+ public:
+  struct WorkItem {
+    Isolate* client;
+    std::unique_ptr<ObjectIterator> iterator;
+  };
+
+  ClientHeapMarkingJob(MarkCompactCollector* collector,
+                       std::vector<WorkItem> items)
+      : collector_(collector),
+        items_(std::move(items)),
+        remaining_items_(items_.size()) {}
+
+  ClientHeapMarkingJob(const ClientHeapMarkingJob&) = delete;
+  ClientHeapMarkingJob& operator=(const ClientHeapMarkingJob&) = delete;
+
+  void Run(JobDelegate* delegate) override {
+    if (delegate->IsJoiningThread()) {
+      ProcessItems();
+    } else {
+      TRACE_GC_EPOCH(collector_->heap()->tracer(),
+                     GCTracer::Scope::MC_BACKGROUND_MARKING,
+                     ThreadKind::kBackground);
+      ProcessItems();
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return std::min<size_t>(remaining_items_.load(std::memory_order_relaxed),
+                            ConcurrentMarking::kMaxTasks + 1);
+  }
+
+ private:
+  void ProcessItems() {
+    MarkingWorklists::Local local_marking_worklists(
+        collector_->marking_worklists());
+    SharedHeapObjectVisitor visitor(collector_, &local_marking_worklists);
+    while (true) {
+      const size_t index = next_item_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= items_.size()) break;
+      WorkItem& item = items_[index];
+      PtrComprCageBase cage_base(item.client);
+      for (HeapObject obj = item.iterator->Next(); !obj.is_null();
+           obj = item.iterator->Next()) {
+        obj.IterateFast(cage_base, &visitor);
+      }
+      remaining_items_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    local_marking_worklists.Publish();
+  }
+
+  MarkCompactCollector* const collector_;
+  std::vector<WorkItem> items_;
+  std::atomic<size_t> next_item_{0};
+  std::atomic<size_t> remaining_items_;
 };
 
 class InternalizedStringTableCleaner : public RootVisitor {
@@ -1572,6 +1731,12 @@ class EvacuateVisitorBase : public HeapObjectVisitor {
     observers_.push_back(observer);
   }
 
+  // Code pages that received migrated code objects. Their instruction caches
+  // have not been flushed yet.
+  const std::vector<MemoryChunk*>& code_pages_with_migrated_objects() const {
+    return code_pages_with_migrated_objects_;
+  }
+
  protected:
   enum MigrationMode { kFast, kObserved };
 
@@ -1619,7 +1784,10 @@ class EvacuateVisitorBase : public HeapObjectVisitor {
       DCHECK_CODEOBJECT_SIZE(size, base->heap_->code_space());
       base->heap_->CopyBlock(dst_addr, src_addr, size);
       Code code = Code::cast(dst);
-      code.Relocate(dst_addr - src_addr);
+      // The instruction cache is flushed for all pages that received code
+      // objects at once after evacuation.
+      code.RelocateNoFlush(dst_addr - src_addr);
+      base->RecordCodePageWithMigratedObjects(MemoryChunk::FromHeapObject(dst));
       if (mode != MigrationMode::kFast)
         base->ExecuteMigrationObservers(dest, src, dst, size);
       // In case the object's map gets relocated during GC we load the old map
@@ -1696,6 +1864,15 @@ class EvacuateVisitorBase : public HeapObjectVisitor {
     migration_function_(this, dst, src, size, dest);
   }
 
+  inline void RecordCodePageWithMigratedObjects(MemoryChunk* chunk) {
+    // Code objects are allocated linearly, so consecutive migrations mostly
+    // target the same page.
+    if (code_pages_with_migrated_objects_.empty() ||
+        code_pages_with_migrated_objects_.back() != chunk) {
+      code_pages_with_migrated_objects_.push_back(chunk);
+    }
+  }
+
 #ifdef DEBUG
   bool AbortCompactionForTesting(HeapObject object) {
     if (FLAG_stress_compaction) {
@@ -1722,6 +1899,7 @@ class EvacuateVisitorBase : public HeapObjectVisitor {
   std::vector<MigrationObserver*> observers_;
   MigrateFunction migration_function_;
   bool shared_string_table_ = false;
+  std::vector<MemoryChunk*> code_pages_with_migrated_objects_;
 };
 
 class EvacuateNewSpaceVisitor final : public EvacuateVisitorBase {
@@ -1972,7 +2150,13 @@ void MarkCompactCollector::MarkRoots(RootVisitor* root_visitor,
 void MarkCompactCollector::MarkObjectsFromClientHeaps() {
   if (!isolate()->is_shared()) return;
 
-  SharedHeapObjectVisitor visitor(this);
+  // Retaining paths are recorded in a main thread only data structure.
+  if (FLAG_parallel_client_heap_marking && !FLAG_track_retaining_path) {
+    MarkObjectsFromClientHeapsInParallel();
+    return;
+  }
+
+  SharedHeapObjectVisitor visitor(this, local_marking_worklists());
 
   isolate()->global_safepoint()->IterateClientIsolates(
       [&visitor](Isolate* client) {
@@ -1986,6 +2170,27 @@ void MarkCompactCollector::MarkObjectsFromClientHeaps() {
       });
 }
 
+void MarkCompactCollector::MarkObjectsFromClientHeapsInParallel() {
+  // The iterators are created on the main thread as creating them makes the
+  // client heap iterable, which requires the client's safepoint. Advancing
+  // them only walks pages.
+  std::vector<ClientHeapMarkingJob::WorkItem> items;
+  isolate()->global_safepoint()->IterateClientIsolates(
+      [&items](Isolate* client) {
+        Heap* heap = client->heap();
+        SpaceIterator spaces(heap);
+        while (spaces.HasNext()) {
+          items.push_back({client, spaces.Next()->GetObjectIterator(heap)});
+        }
+      });
+  if (items.empty()) return;
+
+  V8::GetCurrentPlatform()
+      ->PostJob(v8::TaskPriority::kUserBlocking,
+                std::make_unique<ClientHeapMarkingJob>(this, std::move(items)))
+      ->Join();
+}
+
 void MarkCompactCollector::VisitObject(HeapObject obj) {
   marking_visitor_->Visit(obj.map(), obj);
 }
@@ -2323,6 +2528,37 @@ void MarkCompactCollector::ProcessTopOptimizedFrame(ObjectVisitor* visitor,
   }
 }
 
+void MarkCompactCollector::PublishSampledObjectStats() {
+  if (V8_LIKELY(!sampled_object_stats_)) return;
+  // Reuse the previous table for the next GC instead of reallocating it.
+  std::swap(sampled_object_stats_at_last_gc_, sampled_object_stats_);
+  if (sampled_object_stats_) sampled_object_stats_->Clear();
+  const SampledObjectStats& stats = *sampled_object_stats_at_last_gc_;
+
+  bool tracing_enabled;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACE_DISABLED_BY_DEFAULT("v8.gc_stats"),
+                                     &tracing_enabled);
+  if (!tracing_enabled) return;
+  std::stringstream stream;
+  stream << "{";
+  bool first = true;
+  for (size_t i = 0; i < SampledObjectStats::kNumberOfTypes; i++) {
+    if (stats.count[i] == 0) continue;
+    const char* object_type;
+    const char* object_sub_type;
+    if (!heap()->GetObjectTypeName(i, &object_type, &object_sub_type)) {
+      continue;
+    }
+    stream << (first ? "" : ",") << "\"" << object_type << "\":["
+           << stats.count[i] << "," << stats.size[i] << "]";
+    first = false;
+  }
+  stream << "}";
+  TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.gc_stats"),
+                       "V8.GC_Sampled_Objects_Stats", TRACE_EVENT_SCOPE_THREAD,
+                       "sampled", TRACE_STR_COPY(stream.str().c_str()));
+}
+
 void MarkCompactCollector::RecordObjectStats() {
   if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled())) return;
   // Cannot run during bootstrapping due to incomplete objects.
@@ -2503,6 +2739,15 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   heap()->external_string_table_.IterateAll(&external_visitor);
   heap()->external_string_table_.CleanUpAll();
 
+  // Entries of the Object.assign cache are weak; drop those that refer to
+  // dead maps or cells.
+  isolate()->object_assign_cache()->ClearDeadEntries(
+      [this](HeapObject object) {
+        return (!is_shared_heap_ && object.InSharedHeap()) ||
+               BasicMemoryChunk::FromHeapObject(object)->InReadOnlySpace() ||
+               non_atomic_marking_state()->IsBlackOrGrey(object);
+      });
+
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_FLUSHABLE_BYTECODE);
     // ProcessFlusheBaselineCandidates should be called after clearing bytecode
@@ -2670,6 +2915,7 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   // Use the raw function data setter to avoid validity checks, since we're
   // performing the unusual task of decompiling.
   shared_info.set_function_data(uncompiled_data, kReleaseStore);
+  shared_info.IncrementFlushCount();
   DCHECK(!shared_info.is_compiled());
 }
 
@@ -2726,7 +2972,8 @@ void MarkCompactCollector::ProcessOldCodeCandidates() {
 }
 
 void MarkCompactCollector::ClearFlushedJsFunctions() {
-  DCHECK(FLAG_flush_bytecode || weak_objects_.flushed_js_functions.IsEmpty());
+  DCHECK(FLAG_flush_bytecode || FLAG_flush_cold_feedback ||
+         weak_objects_.flushed_js_functions.IsEmpty());
   JSFunction flushed_js_function;
   while (local_weak_objects()->flushed_js_functions_local.Pop(
       &flushed_js_function)) {
@@ -2734,7 +2981,13 @@ void MarkCompactCollector::ClearFlushedJsFunctions() {
                                      Object target) {
       RecordSlot(object, slot, HeapObject::cast(target));
     };
-    flushed_js_function.ResetIfCodeFlushed(gc_notify_updated_slot);
+    if (flushed_js_function.NeedsResetDueToFlushedBytecode()) {
+      flushed_js_function.ResetIfCodeFlushed(gc_notify_updated_slot);
+    } else {
+      // The closure was pushed because its feedback vector went cold.
+      flushed_js_function.ResetIfFeedbackCold(code_flush_mode(),
+                                              gc_notify_updated_slot);
+    }
   }
 }
 
@@ -3687,6 +3940,9 @@ void Evacuator::Finalize() {
       new_to_old_page_visitor_.moved_bytes() +
       new_to_new_page_visitor_.moved_bytes());
   heap()->MergeAllocationSitePretenuringFeedback(local_pretenuring_feedback_);
+  // Only the old space visitor migrates code objects.
+  heap()->mark_compact_collector()->RecordCodePagesForICacheFlush(
+      old_space_visitor_.code_pages_with_migrated_objects());
 }
 
 class FullEvacuator : public Evacuator {
@@ -4117,6 +4373,8 @@ void MarkCompactCollector::Evacuate() {
 
   UpdatePointersAfterEvacuation();
 
+  FlushInstructionCacheForMigratedCode();
+
   if (heap()->new_space()) {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_EVACUATE_REBALANCE);
     if (!heap()->new_space()->Rebalance()) {
@@ -4171,6 +4429,26 @@ void MarkCompactCollector::Evacuate() {
 #endif
 }
 
+void MarkCompactCollector::RecordCodePagesForICacheFlush(
+    const std::vector<MemoryChunk*>& pages) {
+  code_pages_to_flush_.insert(code_pages_to_flush_.end(), pages.begin(),
+                              pages.end());
+}
+
+void MarkCompactCollector::FlushInstructionCacheForMigratedCode() {
+  if (code_pages_to_flush_.empty()) return;
+  // Several evacuators may have migrated code objects to the same page.
+  std::sort(code_pages_to_flush_.begin(), code_pages_to_flush_.end());
+  code_pages_to_flush_.erase(
+      std::unique(code_pages_to_flush_.begin(), code_pages_to_flush_.end()),
+      code_pages_to_flush_.end());
+  for (MemoryChunk* chunk : code_pages_to_flush_) {
+    DCHECK(chunk->IsFlagSet(MemoryChunk::IS_EXECUTABLE));
+    FlushInstructionCache(chunk->area_start(), chunk->area_size());
+  }
+  code_pages_to_flush_.clear();
+}
+
 class UpdatingItem : public ParallelWorkItem {
  public:
   virtual ~UpdatingItem() = default;
@@ -5707,10 +5985,24 @@ void MinorMarkCompactCollector::MarkRootSetInParallel(
     RootMarkingVisitor* root_visitor) {
   {
     std::vector<PageMarkingItem> marking_items;
+    std::unique_ptr<JobHandle> job_handle;
 
     // Seed the root set (roots + old->new set).
     {
       TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_MARK_SEED);
+      // Create items for each page.
+      RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
+          heap(), [&marking_items](MemoryChunk* chunk) {
+            marking_items.emplace_back(chunk);
+          });
+      if (FLAG_minor_mc_concurrent_root_marking) {
+        // Remembered set items do not depend on the roots, so background
+        // markers can start on them while the main thread scans the roots.
+        job_handle = V8::GetCurrentPlatform()->PostJob(
+            v8::TaskPriority::kUserBlocking,
+            std::make_unique<YoungGenerationMarkingJob>(
+                isolate(), this, worklist(), std::move(marking_items)));
+      }
       isolate()->global_handles()->IdentifyWeakUnmodifiedObjects(
           &JSObject::IsUnmodifiedApiObject);
       // MinorMC treats all weak roots except for global handles as strong.
@@ -5722,11 +6014,6 @@ void MinorMarkCompactCollector::MarkRootSetInParallel(
                                                 SkipRoot::kOldGeneration});
       isolate()->global_handles()->IterateYoungStrongAndDependentRoots(
           root_visitor);
-      // Create items for each page.
-      RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
-          heap(), [&marking_items](MemoryChunk* chunk) {
-            marking_items.emplace_back(chunk);
-          });
     }
 
     // Add tasks and run in parallel.
@@ -5736,11 +6023,15 @@ void MinorMarkCompactCollector::MarkRootSetInParallel(
       // job.
       main_thread_worklist_local_.Publish();
       TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_MARK_ROOTS);
-      V8::GetCurrentPlatform()
-          ->PostJob(v8::TaskPriority::kUserBlocking,
-                    std::make_unique<YoungGenerationMarkingJob>(
-                        isolate(), this, worklist(), std::move(marking_items)))
-          ->Join();
+      if (job_handle) {
+        job_handle->NotifyConcurrencyIncrease();
+      } else {
+        job_handle = V8::GetCurrentPlatform()->PostJob(
+            v8::TaskPriority::kUserBlocking,
+            std::make_unique<YoungGenerationMarkingJob>(
+                isolate(), this, worklist(), std::move(marking_items)));
+      }
+      job_handle->Join();
 
       DCHECK(worklist()->IsEmpty());
       DCHECK(main_thread_worklist_local_.IsLocalEmpty());
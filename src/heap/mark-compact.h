@@ -453,6 +453,7 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   class RootMarkingVisitor;
   class CustomRootBodyMarkingVisitor;
   class SharedHeapObjectVisitor;
+  class ClientHeapMarkingJob;
 
   enum IterationMode {
     kKeepMarking,
@@ -605,6 +606,15 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   explicit MarkCompactCollector(Heap* heap);
   ~MarkCompactCollector() override;
 
+  // Called on the main thread when finalizing evacuators.
+  void RecordCodePagesForICacheFlush(const std::vector<MemoryChunk*>& pages);
+
+  // Object statistics sampled by concurrent marking during the last full GC,
+  // or nullptr if nothing was sampled yet.
+  const SampledObjectStats* sampled_object_stats_at_last_gc() const {
+    return sampled_object_stats_at_last_gc_.get();
+  }
+
   // Used by wrapper tracing.
   V8_INLINE void MarkExternallyReferencedObject(HeapObject obj);
   // Used by incremental marking for object that change their layout.
@@ -624,7 +634,16 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
                                    int* target_fragmentation_percent,
                                    size_t* max_evacuated_bytes);
 
+  // Filters and orders the given (live bytes, page) pairs according to
+  // --compaction-cost-model. Returns false, leaving |pages| untouched, if the
+  // GC tracer has no samples to base the cost model on yet.
+  bool SelectEvacuationCandidatesByCost(
+      PagedSpace* space, std::vector<std::pair<size_t, Page*>>* pages);
+
   void RecordObjectStats();
+  // Makes the object statistics sampled during this GC available through
+  // sampled_object_stats_at_last_gc() and the v8.gc_stats trace category.
+  void PublishSampledObjectStats();
 
   // Finishes GC, performs heap verification if enabled.
   void Finish();
@@ -652,6 +671,9 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // Mark all objects that are directly referenced from one of the clients
   // heaps.
   void MarkObjectsFromClientHeaps();
+  // Same as above but distributes the spaces of all client heaps over
+  // parallel tasks. Used with --parallel-client-heap-marking.
+  void MarkObjectsFromClientHeapsInParallel();
 
   // Updates pointers to shared objects from client heaps.
   void UpdatePointersInClientHeaps();
@@ -753,6 +775,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   std::unique_ptr<UpdatingItem> CreateRememberedSetUpdatingItem(
       MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode) override;
 
+  // Instruction caches for migrated code objects are flushed per page after
+  // evacuation instead of per object.
+  void FlushInstructionCacheForMigratedCode();
+
   void ReleaseEvacuationCandidates();
   // Returns number of aborted pages.
   size_t PostProcessEvacuationCandidates();
@@ -802,6 +828,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   std::unique_ptr<WeakObjects::Local> local_weak_objects_;
   NativeContextInferrer native_context_inferrer_;
   NativeContextStats native_context_stats_;
+  // Allocated on first use, only with
+  // --concurrent-marking-object-stats-sample-rate.
+  std::unique_ptr<SampledObjectStats> sampled_object_stats_;
+  std::unique_ptr<SampledObjectStats> sampled_object_stats_at_last_gc_;
 
   // Candidates for pages that should be evacuated.
   std::vector<Page*> evacuation_candidates_;
@@ -813,6 +843,7 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   std::vector<std::pair<Address, Page*>>
       aborted_evacuation_candidates_due_to_flags_;
   std::vector<LargePage*> promoted_large_pages_;
+  std::vector<MemoryChunk*> code_pages_to_flush_;
 
   MarkingState marking_state_;
   NonAtomicMarkingState non_atomic_marking_state_;
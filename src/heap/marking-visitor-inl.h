@@ -168,8 +168,9 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitJSFunction(
     // TODO(mythria): Consider updating the check for ShouldFlushBaselineCode to
     // also include cases where there is old bytecode even when there is no
     // baseline code and remove this check here.
-    if (IsByteCodeFlushingEnabled(code_flush_mode_) &&
-        js_function.NeedsResetDueToFlushedBytecode()) {
+    if ((IsByteCodeFlushingEnabled(code_flush_mode_) &&
+         js_function.NeedsResetDueToFlushedBytecode()) ||
+        js_function.NeedsResetDueToColdFeedback(code_flush_mode_)) {
       local_weak_objects_->flushed_js_functions_local.Push(js_function);
     }
   }
@@ -190,9 +191,12 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitSharedFunctionInfo(
     // data strongly.
     VisitPointer(shared_info,
                  shared_info.RawField(SharedFunctionInfo::kFunctionDataOffset));
-  } else if (!IsByteCodeFlushingEnabled(code_flush_mode_)) {
-    // If bytecode flushing is disabled but baseline code flushing is enabled
-    // then we have to visit the bytecode but not the baseline code.
+  } else if (!IsByteCodeFlushingEnabled(code_flush_mode_) ||
+             (!IsStressFlushingEnabled(code_flush_mode_) &&
+              shared_info.IsBytecodeRetainedAfterFlushes())) {
+    // If bytecode flushing is disabled, or the bytecode of this function is
+    // retained, but baseline code flushing is enabled then we have to visit
+    // the bytecode but not the baseline code.
     DCHECK(IsBaselineCodeFlushingEnabled(code_flush_mode_));
     CodeT baseline_codet = CodeT::cast(shared_info.function_data(kAcquireLoad));
     // Safe to do a relaxed load here since the CodeT was acquire-loaded.
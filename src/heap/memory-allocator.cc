@@ -39,7 +39,11 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate,
       size_executable_(0),
       lowest_ever_allocated_(static_cast<Address>(-1ll)),
       highest_ever_allocated_(kNullAddress),
-      unmapper_(isolate->heap(), this) {
+      unmapper_(isolate->heap(), this),
+      // The heap is set up on the isolate's main thread.
+      numa_node_(FLAG_numa_aware_page_allocation
+                     ? base::OS::GetCurrentNumaNode()
+                     : -1) {
   DCHECK_NOT_NULL(code_page_allocator);
 }
 
@@ -202,14 +206,18 @@ size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
   base::MutexGuard guard(&mutex_);
 
   size_t sum = 0;
-  // kPooled chunks are already uncommited. We only have to account for
-  // kRegular and kNonRegular chunks.
+  // kPooled chunks are already uncommited unless transparent huge pages are
+  // used. Otherwise we only have to account for kRegular and kNonRegular
+  // chunks.
   for (auto& chunk : chunks_[ChunkQueueType::kRegular]) {
     sum += chunk->size();
   }
   for (auto& chunk : chunks_[ChunkQueueType::kNonRegular]) {
     sum += chunk->size();
   }
+  if (FLAG_transparent_huge_pages) {
+    sum += chunks_[ChunkQueueType::kPooled].size() * MemoryChunk::kPageSize;
+  }
   return sum;
 }
 
@@ -261,6 +269,13 @@ Address MemoryAllocator::AllocateAlignedMemory(
 
   Address base = reservation.address();
 
+  if (numa_node_ >= 0) {
+    // The policy sticks to the range, i.e., it also applies when the chunk is
+    // pooled and later recommitted. This is a hint, so errors are ignored.
+    USE(base::OS::SetPreferredNumaNode(reinterpret_cast<void*>(base),
+                                       chunk_size, numa_node_));
+  }
+
   if (executable == EXECUTABLE) {
     const size_t aligned_area_size = ::RoundUp(area_size, GetCommitPageSize());
     if (!SetPermissionsOnExecutableMemoryChunk(&reservation, base,
@@ -494,7 +509,9 @@ void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
 
   VirtualMemory* reservation = chunk->reserved_memory();
   if (chunk->IsFlagSet(MemoryChunk::POOLED)) {
-    UncommitMemory(reservation);
+    // Uncommitting a pooled page would split the huge page backing it. Keep
+    // the page committed instead; it is released once the pool is freed.
+    if (!FLAG_transparent_huge_pages) UncommitMemory(reservation);
   } else {
     DCHECK(reservation->IsReserved());
     reservation->Free();
@@ -521,8 +538,8 @@ void MemoryAllocator::Free(MemoryAllocator::FreeMode mode, MemoryChunk* chunk) {
 }
 
 void MemoryAllocator::FreePooledChunk(MemoryChunk* chunk) {
-  // Pooled pages cannot be touched anymore as their memory is uncommitted.
-  // Pooled pages are not-executable.
+  // Pooled pages cannot be touched anymore as their memory is uncommitted
+  // (unless --transparent-huge-pages is on). Pooled pages are not-executable.
   FreeMemoryRegion(data_page_allocator(), chunk->address(),
                    static_cast<size_t>(MemoryChunk::kPageSize));
 }
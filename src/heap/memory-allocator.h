@@ -401,6 +401,10 @@ class MemoryAllocator {
   base::Optional<VirtualMemory> reserved_chunk_at_virtual_memory_limit_;
   Unmapper unmapper_;
 
+  // NUMA node that new chunks are preferably placed on, or -1 if there is no
+  // preference (see --numa-aware-page-allocation).
+  const int numa_node_;
+
 #ifdef DEBUG
   // Data structure to remember allocated executable memory chunks.
   // This data structure is used only in DCHECKs.
@@ -39,6 +39,7 @@ class V8_EXPORT_PRIVATE MemoryChunkLayout {
  public:
   static const int kNumSets = NUMBER_OF_REMEMBERED_SET_TYPES;
   static const int kNumTypes = ExternalBackingStoreType::kNumTypes;
+  static const int kNumFreeBlockSizeClasses = 4;
 #define FIELD(Type, Name) \
   k##Name##Offset, k##Name##End = k##Name##Offset + sizeof(Type) - 1
   enum Header {
@@ -71,6 +72,8 @@ class V8_EXPORT_PRIVATE MemoryChunkLayout {
     FIELD(CodeObjectRegistry*, CodeObjectRegistry),
     FIELD(PossiblyEmptyBuckets, PossiblyEmptyBuckets),
     FIELD(ActiveSystemPages, ActiveSystemPages),
+    FIELD(size_t[kNumFreeBlockSizeClasses], FreeBlockBytes),
+    FIELD(size_t, FragmentedFullGCs),
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
     FIELD(ObjectStartBitmap, ObjectStartBitmap),
 #endif
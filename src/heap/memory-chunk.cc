@@ -177,6 +177,9 @@ MemoryChunk::MemoryChunk(Heap* heap, BaseSpace* space, size_t chunk_size,
 
   possibly_empty_buckets_.Initialize();
 
+  ResetFreeBlockHistogram();
+  fragmented_full_gcs_ = 0;
+
   if (page_size == PageSize::kRegular) {
     active_system_pages_.Init(MemoryChunkLayout::kMemoryChunkHeaderSize,
                               MemoryAllocator::GetCommitPageSizeBits(), size());
@@ -468,6 +471,12 @@ void MemoryChunk::ValidateOffsets(MemoryChunk* chunk) {
   DCHECK_EQ(reinterpret_cast<Address>(&chunk->possibly_empty_buckets_) -
                 chunk->address(),
             MemoryChunkLayout::kPossiblyEmptyBucketsOffset);
+  DCHECK_EQ(reinterpret_cast<Address>(&chunk->free_block_bytes_) -
+                chunk->address(),
+            MemoryChunkLayout::kFreeBlockBytesOffset);
+  DCHECK_EQ(reinterpret_cast<Address>(&chunk->fragmented_full_gcs_) -
+                chunk->address(),
+            MemoryChunkLayout::kFragmentedFullGCsOffset);
 }
 #endif
 
@@ -211,6 +211,34 @@ class MemoryChunk : public BasicMemoryChunk {
   // read-only space chunks.
   void ReleaseAllocatedMemoryNeededForWritableChunk();
 
+  // Histogram of the free blocks found by the last sweep of this chunk. Blocks
+  // are bucketed by size class; each bucket holds the total bytes of its
+  // blocks. Only accessed by the sweeper and on the main thread while no
+  // sweeping is in progress.
+  static constexpr int kNumFreeBlockSizeClasses =
+      MemoryChunkLayout::kNumFreeBlockSizeClasses;
+  static int FreeBlockSizeClass(size_t size) {
+    if (size < 256) return 0;
+    if (size < 2 * KB) return 1;
+    if (size < 16 * KB) return 2;
+    return 3;
+  }
+  void ResetFreeBlockHistogram() {
+    for (size_t& bytes : free_block_bytes_) bytes = 0;
+  }
+  void RecordFreeBlock(size_t size) {
+    free_block_bytes_[FreeBlockSizeClass(size)] += size;
+  }
+  size_t free_block_bytes(int size_class) const {
+    DCHECK_LT(size_class, kNumFreeBlockSizeClasses);
+    return free_block_bytes_[size_class];
+  }
+
+  // Number of consecutive full GCs in which this page was fragmented enough
+  // to be considered for evacuation but was not evacuated.
+  size_t fragmented_full_gcs() const { return fragmented_full_gcs_; }
+  void set_fragmented_full_gcs(size_t value) { fragmented_full_gcs_ = value; }
+
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
   ObjectStartBitmap* object_start_bitmap() { return &object_start_bitmap_; }
 #endif
@@ -287,6 +315,10 @@ class MemoryChunk : public BasicMemoryChunk {
 
   ActiveSystemPages active_system_pages_;
 
+  size_t free_block_bytes_[kNumFreeBlockSizeClasses];
+
+  size_t fragmented_full_gcs_;
+
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
   ObjectStartBitmap object_start_bitmap_;
 #endif
@@ -264,9 +264,18 @@ class V8_EXPORT_PRIVATE NewSpace final
   // their maximum capacity.
   void Grow();
 
+  // Grow the capacity of the semispaces to |new_capacity|, which must be
+  // page-aligned and larger than the current capacity.
+  void GrowTo(size_t new_capacity);
+
   // Shrink the capacity of the semispaces.
   void Shrink();
 
+  // Shrink the capacity of the semispaces towards |new_capacity|. The
+  // resulting capacity never drops below the initial capacity or twice the
+  // currently allocated size.
+  void ShrinkTo(size_t new_capacity);
+
   // Return the allocated bytes in the active semispace.
   size_t Size() const final {
     DCHECK_GE(top(), to_space_.page_low());
@@ -672,6 +672,68 @@ base::Optional<std::pair<Address, size_t>> PagedSpace::RawRefillLabBackground(
   return {};
 }
 
+size_t PagedSpace::DiscardFreeListMemory() {
+  // Background threads may allocate from the free list concurrently.
+  base::MutexGuard guard(mutex());
+  size_t discarded = 0;
+  for (Page* page : *this) {
+    // Pages that are still being swept may have their categories rebuilt.
+    if (!page->SweepingDone()) continue;
+    page->ForAllFreeListCategories([&discarded, page](FreeListCategory* c) {
+      discarded += c->DiscardUnusedMemory(page);
+    });
+  }
+  return discarded;
+}
+
+int PagedSpace::TakeFreeListNodesBackground(size_t min_size_in_bytes,
+                                            size_t max_total_size_in_bytes,
+                                            std::pair<Address, size_t>* nodes,
+                                            int max_nodes,
+                                            AllocationOrigin origin) {
+  // Code pages would need to be unprotected for every node.
+  DCHECK(identity() == OLD_SPACE || identity() == MAP_SPACE);
+  base::MutexGuard lock(&space_mutex_);
+  int count = 0;
+  size_t total = 0;
+  while (count < max_nodes && total < max_total_size_in_bytes) {
+    size_t node_size = 0;
+    FreeSpace node =
+        free_list_->Allocate(min_size_in_bytes, &node_size, origin);
+    if (node.is_null()) break;
+    DCHECK(!MarkCompactCollector::IsOnEvacuationCandidate(node));
+    Page* page = Page::FromHeapObject(node);
+    IncreaseAllocatedBytes(node_size, page);
+    Address start = node.address();
+    size_t used_size =
+        std::max(min_size_in_bytes,
+                 std::min(node_size, max_total_size_in_bytes - total));
+    if (used_size != node_size) {
+      Free(start + used_size, node_size - used_size,
+           SpaceAccountingMode::kSpaceAccounted);
+      // Keep the trimmed node iterable while it sits in the caller's shard.
+      heap()->CreateFillerObjectAtBackground(
+          start, static_cast<int>(used_size),
+          ClearFreedMemoryMode::kDontClearFreedMemory);
+    }
+    AddRangeToActiveSystemPages(page, start, start + used_size);
+    nodes[count++] = std::make_pair(start, used_size);
+    total += used_size;
+  }
+  if (count > 0) {
+    heap()->StartIncrementalMarkingIfAllocationLimitIsReachedBackground();
+  }
+  return count;
+}
+
+void PagedSpace::ReturnFreeListNodesBackground(
+    const std::pair<Address, size_t>* nodes, int count) {
+  base::MutexGuard lock(&space_mutex_);
+  for (int i = 0; i < count; i++) {
+    Free(nodes[i].first, nodes[i].second, SpaceAccountingMode::kSpaceAccounted);
+  }
+}
+
 base::Optional<std::pair<Address, size_t>>
 PagedSpace::TryAllocationFromFreeListBackground(size_t min_size_in_bytes,
                                                 size_t max_size_in_bytes,
@@ -168,6 +168,20 @@ class V8_EXPORT_PRIVATE PagedSpace
                          AllocationAlignment alignment,
                          AllocationOrigin origin);
 
+  // Takes up to |max_nodes| nodes of at least |min_size_in_bytes| bytes from
+  // the free list under a single acquisition of the space mutex, such that the
+  // total does not exceed |max_total_size_in_bytes|. The nodes are accounted as
+  // allocated and stored in |nodes| as (start, size) pairs. Returns the number
+  // of nodes taken.
+  int TakeFreeListNodesBackground(size_t min_size_in_bytes,
+                                  size_t max_total_size_in_bytes,
+                                  std::pair<Address, size_t>* nodes,
+                                  int max_nodes, AllocationOrigin origin);
+
+  // Returns nodes taken by TakeFreeListNodesBackground() to the free list.
+  void ReturnFreeListNodesBackground(const std::pair<Address, size_t>* nodes,
+                                     int count);
+
   size_t Free(Address start, size_t size_in_bytes, SpaceAccountingMode mode) {
     if (size_in_bytes == 0) return 0;
     heap()->CreateFillerObjectAtBackground(
@@ -319,6 +333,10 @@ class V8_EXPORT_PRIVATE PagedSpace
 
   size_t ShrinkPageToHighWaterMark(Page* page);
 
+  // Discards the memory of all free-list nodes on swept pages. Returns the
+  // number of bytes discarded.
+  size_t DiscardFreeListMemory();
+
   std::unique_ptr<ObjectIterator> GetObjectIterator(Heap* heap) override;
 
   void SetLinearAllocationArea(Address top, Address limit);
@@ -10,6 +10,7 @@
 #include "src/base/lazy-instance.h"
 #include "src/base/platform/mutex.h"
 #include "src/common/ptr-compr-inl.h"
+#include "src/flags/flags.h"
 #include "src/heap/basic-memory-chunk.h"
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/heap/memory-chunk.h"
@@ -35,6 +36,12 @@ base::LazyMutex read_only_heap_creation_mutex_ = LAZY_MUTEX_INITIALIZER;
 base::LazyInstance<std::weak_ptr<ReadOnlyArtifacts>>::type
     read_only_artifacts_ = LAZY_INSTANCE_INITIALIZER;
 
+// Strong reference that keeps the ReadOnlyArtifacts alive while no Isolates
+// remain, so that the read-only snapshot is not deserialized again for the
+// next Isolate. Only set with --retain-process-wide-heap-state.
+base::LazyInstance<std::shared_ptr<ReadOnlyArtifacts>>::type
+    retained_read_only_artifacts_ = LAZY_INSTANCE_INITIALIZER;
+
 std::shared_ptr<ReadOnlyArtifacts> InitializeSharedReadOnlyArtifacts() {
   std::shared_ptr<ReadOnlyArtifacts> artifacts;
   if (COMPRESS_POINTERS_IN_ISOLATE_CAGE_BOOL) {
@@ -79,6 +86,9 @@ void ReadOnlyHeap::SetUp(Isolate* isolate,
         ro_heap->DeseralizeIntoIsolate(isolate, read_only_snapshot_data,
                                        can_rehash);
         read_only_heap_created = true;
+        if (FLAG_retain_process_wide_heap_state) {
+          *retained_read_only_artifacts_.Pointer() = artifacts;
+        }
       } else {
         // With pointer compression, there is one ReadOnlyHeap per Isolate.
         // Without PC, there is only one shared between all Isolates.
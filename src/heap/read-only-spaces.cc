@@ -9,6 +9,7 @@
 #include "include/v8-internal.h"
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate.h"
@@ -419,6 +420,19 @@ void ReadOnlySpace::Seal(SealMode ro_mode) {
   }
 
   SetPermissionsForPages(memory_allocator, PageAllocator::kRead);
+
+  if (FLAG_mergeable_read_only_heap) {
+    // Read-only pages created from the same snapshot have (mostly) identical
+    // contents in every process, so many worker processes on a host can share
+    // their physical memory. Only private anonymous mappings are eligible,
+    // which excludes the shared-memory copies used for multiple pointer
+    // compression cages.
+    for (ReadOnlyPage* p : pages_) {
+      size_t size = RoundUp(p->size(), MemoryAllocator::GetCommitPageSize());
+      USE(base::OS::AdvisePagesMergeable(reinterpret_cast<void*>(p->address()),
+                                         size));
+    }
+  }
 }
 
 void ReadOnlySpace::Unseal() {
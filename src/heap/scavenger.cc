@@ -188,17 +188,49 @@ class ScavengeWeakObjectRetainer : public WeakObjectRetainer {
 ScavengerCollector::JobTask::JobTask(
     ScavengerCollector* outer,
     std::vector<std::unique_ptr<Scavenger>>* scavengers,
-    std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks,
+    std::vector<MemoryChunk*> memory_chunks,
     Scavenger::CopiedList* copied_list,
     Scavenger::PromotionList* promotion_list)
     : outer_(outer),
       scavengers_(scavengers),
-      memory_chunks_(std::move(memory_chunks)),
-      remaining_memory_chunks_(memory_chunks_.size()),
-      generator_(memory_chunks_.size()),
+      work_items_(CreateWorkItems(memory_chunks, &split_page_states_)),
+      remaining_work_items_(work_items_.size()),
+      generator_(work_items_.size()),
       copied_list_(copied_list),
       promotion_list_(promotion_list) {}
 
+// static
+std::vector<std::pair<ParallelWorkItem,
+                      ScavengerCollector::JobTask::PageWorkItem>>
+ScavengerCollector::JobTask::CreateWorkItems(
+    const std::vector<MemoryChunk*>& memory_chunks,
+    std::vector<std::unique_ptr<SplitPageState>>* split_page_states) {
+  std::vector<std::pair<ParallelWorkItem, PageWorkItem>> work_items;
+  work_items.reserve(memory_chunks.size());
+  for (MemoryChunk* chunk : memory_chunks) {
+    const size_t buckets = chunk->buckets();
+    // Code pages are never split as their write permissions are managed by a
+    // CodePageMemoryModificationScope that must not be shared across tasks.
+    if (!FLAG_scavenger_split_pages || buckets <= kBucketsPerPageSlice ||
+        chunk->IsFlagSet(MemoryChunk::IS_EXECUTABLE) ||
+        chunk->slot_set<OLD_TO_NEW, AccessMode::ATOMIC>() == nullptr) {
+      work_items.emplace_back(ParallelWorkItem{},
+                              PageWorkItem{chunk, 0, buckets, nullptr});
+      continue;
+    }
+    const size_t slices =
+        (buckets + kBucketsPerPageSlice - 1) / kBucketsPerPageSlice;
+    split_page_states->push_back(std::make_unique<SplitPageState>(slices));
+    SplitPageState* split_state = split_page_states->back().get();
+    for (size_t start = 0; start < buckets; start += kBucketsPerPageSlice) {
+      const size_t end = std::min(start + kBucketsPerPageSlice, buckets);
+      work_items.emplace_back(ParallelWorkItem{},
+                              PageWorkItem{chunk, start, end, split_state});
+    }
+  }
+  return work_items;
+}
+
 void ScavengerCollector::JobTask::Run(JobDelegate* delegate) {
   DCHECK_LT(delegate->GetTaskId(), scavengers_->size());
   Scavenger* scavenger = (*scavengers_)[delegate->GetTaskId()].get();
@@ -221,7 +253,7 @@ size_t ScavengerCollector::JobTask::GetMaxConcurrency(
   return std::min<size_t>(
       scavengers_->size(),
       std::max<size_t>(
-          remaining_memory_chunks_.load(std::memory_order_relaxed),
+          remaining_work_items_.load(std::memory_order_relaxed),
           worker_count + copied_list_->Size() + promotion_list_->Size()));
 }
 
@@ -243,21 +275,48 @@ void ScavengerCollector::JobTask::ProcessItems(JobDelegate* delegate,
 
 void ScavengerCollector::JobTask::ConcurrentScavengePages(
     Scavenger* scavenger) {
-  while (remaining_memory_chunks_.load(std::memory_order_relaxed) > 0) {
+  while (remaining_work_items_.load(std::memory_order_relaxed) > 0) {
     base::Optional<size_t> index = generator_.GetNext();
     if (!index) return;
-    for (size_t i = *index; i < memory_chunks_.size(); ++i) {
-      auto& work_item = memory_chunks_[i];
+    for (size_t i = *index; i < work_items_.size(); ++i) {
+      auto& work_item = work_items_[i];
       if (!work_item.first.TryAcquire()) break;
-      scavenger->ScavengePage(work_item.second);
-      if (remaining_memory_chunks_.fetch_sub(1, std::memory_order_relaxed) <=
-          1) {
+      ScavengeWorkItem(scavenger, work_item.second);
+      if (remaining_work_items_.fetch_sub(1, std::memory_order_relaxed) <= 1) {
         return;
       }
     }
   }
 }
 
+void ScavengerCollector::JobTask::ScavengeWorkItem(Scavenger* scavenger,
+                                                   const PageWorkItem& item) {
+  SplitPageState* split_state = item.split_state;
+  if (split_state == nullptr) {
+    scavenger->ScavengePage(item.chunk);
+    return;
+  }
+  std::vector<size_t> empty_buckets;
+  scavenger->ScavengePageSlice(item.chunk, item.start_bucket, item.end_bucket,
+                               &empty_buckets);
+  if (!empty_buckets.empty()) {
+    base::MutexGuard guard(&split_state->mutex);
+    PossiblyEmptyBuckets* possibly_empty_buckets =
+        item.chunk->possibly_empty_buckets();
+    const size_t buckets = item.chunk->buckets();
+    for (size_t bucket_index : empty_buckets) {
+      possibly_empty_buckets->Insert(bucket_index, buckets);
+    }
+  }
+  // The task finishing the last slice of a page is responsible for the
+  // remaining per-page work. The acquire-release ordering makes the empty
+  // buckets recorded by other slices visible to it.
+  if (split_state->remaining_slices.fetch_sub(1, std::memory_order_acq_rel) ==
+      1) {
+    scavenger->FinalizeSplitPage(item.chunk);
+  }
+}
+
 ScavengerCollector::ScavengerCollector(Heap* heap)
     : isolate_(heap->isolate()), heap_(heap) {}
 
@@ -307,10 +366,10 @@ void ScavengerCollector::CollectGarbage() {
                         &promotion_list, &ephemeron_table_list, i));
     }
 
-    std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks;
+    std::vector<MemoryChunk*> memory_chunks;
     RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
         heap_, [&memory_chunks](MemoryChunk* chunk) {
-          memory_chunks.emplace_back(ParallelWorkItem{}, chunk);
+          memory_chunks.push_back(chunk);
         });
 
     RootScavengeVisitor root_scavenge_visitor(scavengers[kMainThreadId].get());
@@ -650,6 +709,49 @@ void Scavenger::ScavengePage(MemoryChunk* page) {
   AddPageToSweeperIfNecessary(page);
 }
 
+void Scavenger::ScavengePageSlice(MemoryChunk* page, size_t start_bucket,
+                                  size_t end_bucket,
+                                  std::vector<size_t>* empty_buckets) {
+  DCHECK(!page->IsFlagSet(MemoryChunk::IS_EXECUTABLE));
+  DCHECK_LT(start_bucket, end_bucket);
+  DCHECK_LE(end_bucket, page->buckets());
+  SlotSet* slot_set = page->slot_set<OLD_TO_NEW, AccessMode::ATOMIC>();
+  DCHECK_NOT_NULL(slot_set);
+  // Invalidated slots are only released in FinalizeSplitPage(), so every
+  // slice observes the same filter.
+  InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToNew(page);
+  slot_set->IterateAndReportEmptyBuckets(
+      page->address(), start_bucket, end_bucket,
+      [this, &filter](MaybeObjectSlot slot) {
+        if (!filter.IsValid(slot.address())) return REMOVE_SLOT;
+        return CheckAndScavengeObject(heap_, slot);
+      },
+      [empty_buckets](size_t bucket_index) {
+        empty_buckets->push_back(bucket_index);
+      });
+}
+
+void Scavenger::FinalizeSplitPage(MemoryChunk* page) {
+  DCHECK(!page->IsFlagSet(MemoryChunk::IS_EXECUTABLE));
+  if (!page->possibly_empty_buckets()->IsEmpty()) {
+    empty_chunks_local_.Push(page);
+  }
+
+  if (page->invalidated_slots<OLD_TO_NEW>() != nullptr) {
+    page->ReleaseInvalidatedSlots<OLD_TO_NEW>();
+  }
+
+  RememberedSet<OLD_TO_NEW>::IterateTyped(
+      page, [=](SlotType type, Address addr) {
+        return UpdateTypedSlotHelper::UpdateTypedSlot(
+            heap_, type, addr, [this](FullMaybeObjectSlot slot) {
+              return CheckAndScavengeObject(heap(), slot);
+            });
+      });
+
+  AddPageToSweeperIfNecessary(page);
+}
+
 void Scavenger::Process(JobDelegate* delegate) {
   ScavengeVisitor scavenge_visitor(this);
 
@@ -6,6 +6,7 @@
 #define V8_HEAP_SCAVENGER_H_
 
 #include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/heap/base/worklist.h"
 #include "src/heap/evacuation-allocator.h"
 #include "src/heap/index-generator.h"
@@ -96,6 +97,17 @@ class Scavenger {
   // objects see RootScavengingVisitor and ScavengeVisitor below.
   void ScavengePage(MemoryChunk* page);
 
+  // Scavenges the untyped old-to-new slots in buckets [start_bucket,
+  // end_bucket) of |page|. Used for pages that are split into several work
+  // items so that multiple tasks can process a single page. Buckets that
+  // became possibly empty are appended to |empty_buckets|.
+  void ScavengePageSlice(MemoryChunk* page, size_t start_bucket,
+                         size_t end_bucket, std::vector<size_t>* empty_buckets);
+
+  // Finishes processing of a split page after all of its slices have been
+  // scavenged. Must be called exactly once per split page.
+  void FinalizeSplitPage(MemoryChunk* page);
+
   // Processes remaining work (=objects) after single objects have been
   // manually scavenged using ScavengeObject or CheckAndScavengeObject.
   void Process(JobDelegate* delegate = nullptr);
@@ -267,25 +279,53 @@ class ScavengerCollector {
  private:
   class JobTask : public v8::JobTask {
    public:
-    explicit JobTask(
-        ScavengerCollector* outer,
-        std::vector<std::unique_ptr<Scavenger>>* scavengers,
-        std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks,
-        Scavenger::CopiedList* copied_list,
-        Scavenger::PromotionList* promotion_list);
+    // Number of slot set buckets processed by a single work item when a page
+    // is split into several items.
+    static constexpr size_t kBucketsPerPageSlice = 16;
+
+    explicit JobTask(ScavengerCollector* outer,
+                     std::vector<std::unique_ptr<Scavenger>>* scavengers,
+                     std::vector<MemoryChunk*> memory_chunks,
+                     Scavenger::CopiedList* copied_list,
+                     Scavenger::PromotionList* promotion_list);
 
     void Run(JobDelegate* delegate) override;
     size_t GetMaxConcurrency(size_t worker_count) const override;
 
    private:
+    // State shared between all slices of a page that was split into several
+    // work items.
+    struct SplitPageState {
+      explicit SplitPageState(size_t slices) : remaining_slices(slices) {}
+
+      std::atomic<size_t> remaining_slices;
+      // Protects the possibly empty buckets of the page.
+      base::Mutex mutex;
+    };
+
+    struct PageWorkItem {
+      MemoryChunk* chunk;
+      size_t start_bucket;
+      size_t end_bucket;
+      // nullptr if the page is processed as a whole.
+      SplitPageState* split_state;
+    };
+
     void ProcessItems(JobDelegate* delegate, Scavenger* scavenger);
     void ConcurrentScavengePages(Scavenger* scavenger);
+    void ScavengeWorkItem(Scavenger* scavenger, const PageWorkItem& item);
+
+    static std::vector<std::pair<ParallelWorkItem, PageWorkItem>>
+    CreateWorkItems(
+        const std::vector<MemoryChunk*>& memory_chunks,
+        std::vector<std::unique_ptr<SplitPageState>>* split_page_states);
 
     ScavengerCollector* outer_;
 
     std::vector<std::unique_ptr<Scavenger>>* scavengers_;
-    std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks_;
-    std::atomic<size_t> remaining_memory_chunks_{0};
+    std::vector<std::unique_ptr<SplitPageState>> split_page_states_;
+    std::vector<std::pair<ParallelWorkItem, PageWorkItem>> work_items_;
+    std::atomic<size_t> remaining_work_items_{0};
     IndexGenerator generator_;
 
     Scavenger::CopiedList* copied_list_;
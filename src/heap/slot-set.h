@@ -366,6 +366,17 @@ class SlotSet {
                    });
   }
 
+  // Similar to IterateAndTrackEmptyBuckets but reports possibly empty buckets
+  // through |empty_bucket_callback| instead of recording them. This allows
+  // several threads to iterate disjoint bucket ranges of the same slot set.
+  template <typename Callback, typename EmptyBucketCallback>
+  size_t IterateAndReportEmptyBuckets(
+      Address chunk_start, size_t start_bucket, size_t end_bucket,
+      Callback callback, EmptyBucketCallback empty_bucket_callback) {
+    return Iterate(chunk_start, start_bucket, end_bucket, callback,
+                   empty_bucket_callback);
+  }
+
   bool FreeEmptyBuckets(size_t buckets) {
     bool empty = true;
     for (size_t bucket_index = 0; bucket_index < buckets; bucket_index++) {
@@ -476,27 +487,36 @@ class SlotSet {
       Bucket* bucket = LoadBucket(bucket_index);
       if (bucket != nullptr) {
         size_t in_bucket_count = 0;
-        size_t cell_offset = bucket_index << kBitsPerBucketLog2;
-        for (int i = 0; i < kCellsPerBucket; i++, cell_offset += kBitsPerCell) {
-          uint32_t cell = bucket->LoadCell(i);
-          if (cell) {
-            uint32_t old_cell = cell;
-            uint32_t mask = 0;
-            while (cell) {
-              int bit_offset = base::bits::CountTrailingZeros(cell);
-              uint32_t bit_mask = 1u << bit_offset;
-              Address slot = (cell_offset + bit_offset) << kTaggedSizeLog2;
-              if (callback(MaybeObjectSlot(chunk_start + slot)) == KEEP_SLOT) {
-                ++in_bucket_count;
-              } else {
-                mask |= bit_mask;
-              }
-              cell ^= bit_mask;
-            }
-            uint32_t new_cell = old_cell & ~mask;
-            if (old_cell != new_cell) {
-              bucket->ClearCellBits(i, mask);
+        // Snapshot the cells and summarize the non-empty ones in a mask first,
+        // so that empty cells are skipped with a find-first-set on the mask
+        // instead of a branch per cell.
+        STATIC_ASSERT(kCellsPerBucket <= kBitsPerCell);
+        uint32_t cells[kCellsPerBucket];
+        uint32_t non_empty_cells = 0;
+        for (int i = 0; i < kCellsPerBucket; i++) {
+          cells[i] = bucket->LoadCell(i);
+          non_empty_cells |= static_cast<uint32_t>(cells[i] != 0) << i;
+        }
+        const size_t bucket_offset = bucket_index << kBitsPerBucketLog2;
+        while (non_empty_cells) {
+          const int i = base::bits::CountTrailingZeros(non_empty_cells);
+          non_empty_cells &= non_empty_cells - 1;
+          const size_t cell_offset = bucket_offset + i * kBitsPerCell;
+          uint32_t cell = cells[i];
+          uint32_t mask = 0;
+          while (cell) {
+            int bit_offset = base::bits::CountTrailingZeros(cell);
+            uint32_t bit_mask = 1u << bit_offset;
+            Address slot = (cell_offset + bit_offset) << kTaggedSizeLog2;
+            if (callback(MaybeObjectSlot(chunk_start + slot)) == KEEP_SLOT) {
+              ++in_bucket_count;
+            } else {
+              mask |= bit_mask;
             }
+            cell ^= bit_mask;
+          }
+          if (mask) {
+            bucket->ClearCellBits(i, mask);
           }
         }
         if (in_bucket_count == 0) {
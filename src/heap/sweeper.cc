@@ -232,6 +232,7 @@ V8_INLINE size_t Sweeper::FreeAndProcessFreedMemory(
   CHECK_GT(free_end, free_start);
   size_t freed_bytes = 0;
   size_t size = static_cast<size_t>(free_end - free_start);
+  page->RecordFreeBlock(size);
   if (free_space_mode == ZAP_FREE_SPACE) {
     ZapCode(free_start, size);
   }
@@ -334,6 +335,7 @@ int Sweeper::RawSweep(Page* p, FreeListRebuildingMode free_list_mode,
   // counter. The free operations below will decrease allocated_bytes_ to actual
   // live bytes and keep track of wasted_memory_.
   p->ResetAllocationStatistics();
+  p->ResetFreeBlockHistogram();
 
   CodeObjectRegistry* code_object_registry = p->GetCodeObjectRegistry();
   if (code_object_registry) code_object_registry->Clear();
@@ -2717,8 +2717,9 @@ void AccessorAssembler::GenericPropertyLoad(
     TVARIABLE(IntPtrT, var_name_index);
     Label* notfound = use_stub_cache == kUseStubCache ? &try_stub_cache
                                                       : &lookup_prototype_chain;
-    DescriptorLookup(name, descriptors, bitfield3, &if_descriptor_found,
-                     &var_name_index, notfound);
+    DescriptorLookupWithCache(name, lookup_start_object_map, descriptors,
+                              bitfield3, &if_descriptor_found, &var_name_index,
+                              notfound);
 
     BIND(&if_descriptor_found);
     {
@@ -2908,7 +2909,8 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
   TNode<Word32T> hash_a = Int32Add(map32, name32);
   TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kSecondaryKeyShift);
   TNode<Word32T> hash = Int32Add(hash_a, hash_b);
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
+  int32_t mask = ((StubCache::kSecondaryTableSize - 1) &
+                  ~(StubCache::kSecondaryTableWays - 1))
                  << StubCache::kCacheIndexShift;
   TNode<UintPtrT> result =
       ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
@@ -2975,12 +2977,25 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
 
   BIND(&try_secondary);
   {
-    // Probe the secondary table.
+    // Probe all ways of the secondary table set.
     TNode<IntPtrT> secondary_offset =
         StubCacheSecondaryOffset(name, lookup_start_object_map);
-    TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
-                           lookup_start_object_map, if_handler, var_handler,
-                           &miss);
+    for (int way = 0; way < StubCache::kSecondaryTableWays - 1; way++) {
+      Label try_next_way(this);
+      TryProbeStubCacheTable(
+          stub_cache, kSecondary,
+          IntPtrAdd(secondary_offset,
+                    IntPtrConstant(way << StubCache::kCacheIndexShift)),
+          name, lookup_start_object_map, if_handler, var_handler,
+          &try_next_way);
+      BIND(&try_next_way);
+    }
+    TryProbeStubCacheTable(
+        stub_cache, kSecondary,
+        IntPtrAdd(secondary_offset,
+                  IntPtrConstant((StubCache::kSecondaryTableWays - 1)
+                                 << StubCache::kCacheIndexShift)),
+        name, lookup_start_object_map, if_handler, var_handler, &miss);
   }
 
   BIND(&miss);
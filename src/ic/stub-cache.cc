@@ -23,6 +23,7 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
 void StubCache::Initialize() {
   DCHECK(base::bits::IsPowerOfTwo(kPrimaryTableSize));
   DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableWays));
   Clear();
 }
 
@@ -46,13 +47,15 @@ int StubCache::PrimaryOffset(Name name, Map map) {
 // Hash algorithm for the secondary table.  This algorithm is replicated in
 // assembler. This hash should be sufficiently different from the primary one
 // in order to avoid collisions for minified code with short names.
-// Returns an index into the table that is scaled by 1 << kCacheIndexShift.
+// Returns the index of the first entry of a set into the table that is scaled
+// by 1 << kCacheIndexShift.
 int StubCache::SecondaryOffset(Name name, Map old_map) {
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
   key = key + (key >> kSecondaryKeyShift);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & (((kSecondaryTableSize - 1) & ~(kSecondaryTableWays - 1))
+                << kCacheIndexShift);
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -99,6 +102,9 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key));
     int secondary_offset = SecondaryOffset(old_name, old_map);
     Entry* secondary = entry(secondary_, secondary_offset);
+    for (int way = kSecondaryTableWays - 1; way > 0; way--) {
+      secondary[way] = secondary[way - 1];
+    }
     *secondary = *primary;
   }
 
@@ -118,8 +124,10 @@ MaybeObject StubCache::Get(Name name, Map map) {
   }
   int secondary_offset = SecondaryOffset(name, map);
   Entry* secondary = entry(secondary_, secondary_offset);
-  if (secondary->key == name && secondary->map == map) {
-    return TaggedValue::ToMaybeObject(isolate(), secondary->value);
+  for (int way = 0; way < kSecondaryTableWays; way++) {
+    if (secondary[way].key == name && secondary[way].map == map) {
+      return TaggedValue::ToMaybeObject(isolate(), secondary[way].value);
+    }
   }
   return MaybeObject();
 }
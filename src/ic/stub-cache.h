@@ -89,6 +89,9 @@ class V8_EXPORT_PRIVATE StubCache {
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // The secondary table is split into sets of kSecondaryTableWays adjacent
+  // entries. SecondaryOffset() returns the offset of the first entry of a set.
+  static const int kSecondaryTableWays = 2;
 
   // Used to introduce more entropy from the higher bits of the Map address.
   // This should fill in the masked out kCacheIndexShift-bits.
@@ -108,8 +111,9 @@ class V8_EXPORT_PRIVATE StubCache {
   // different hashing algorithms in order to avoid simultaneous collisions
   // in both caches.  Unlike a probing strategy (quadratic or otherwise) the
   // update strategy on updates is fairly clear and simple:  Any existing entry
-  // in the primary cache is moved to the secondary cache, and secondary cache
-  // entries are overwritten.
+  // in the primary cache is moved to the first way of its secondary cache set,
+  // the entries of that set shift down by one way, and the last one is
+  // dropped. Lookups therefore find the most recently retired entry first.
 
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
@@ -40,6 +40,7 @@
 #endif  // V8_INTL_SUPPORT
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-inl.h"
+#include "src/objects/js-atomics-synchronization.h"
 #ifdef V8_INTL_SUPPORT
 #include "src/objects/js-break-iterator.h"
 #include "src/objects/js-collator.h"
@@ -398,6 +399,32 @@ V8_NOINLINE Handle<JSFunction> CreateFunctionForBuiltin(Isolate* isolate,
       .Build();
 }
 
+// Creates a constructor for objects that live in the shared heap. Such objects
+// have a shared map, no prototype, and a fixed layout.
+V8_NOINLINE Handle<JSFunction> CreateSharedObjectConstructor(
+    Isolate* isolate, Handle<String> name, InstanceType type, int instance_size,
+    Builtin builtin) {
+  Factory* factory = isolate->factory();
+  Handle<SharedFunctionInfo> info =
+      factory->NewSharedFunctionInfoForBuiltin(name, builtin);
+  info->set_language_mode(LanguageMode::kStrict);
+  Handle<JSFunction> constructor =
+      Factory::JSFunctionBuilder{isolate, info, isolate->native_context()}
+          .set_map(isolate->strict_function_map())
+          .Build();
+  Handle<Map> instance_map =
+      factory->NewMap(type, instance_size, TERMINAL_FAST_ELEMENTS_KIND, 0,
+                      AllocationType::kSharedMap);
+  instance_map->SetInObjectUnusedPropertyFields(0);
+  instance_map->set_is_extensible(false);
+  JSFunction::SetInitialMap(isolate, constructor, instance_map,
+                            factory->null_value());
+  // The constructor is not a shared object, so the shared map should not point
+  // to it.
+  instance_map->set_constructor_or_back_pointer(*factory->null_value());
+  return constructor;
+}
+
 V8_NOINLINE Handle<JSFunction> CreateFunctionForBuiltinWithPrototype(
     Isolate* isolate, Handle<String> name, Builtin builtin,
     Handle<HeapObject> prototype, InstanceType type, int instance_size,
@@ -4532,6 +4559,49 @@ void Genesis::InitializeGlobal_harmony_struct() {
   shared_struct_type_fun->shared().set_length(1);
   JSObject::AddProperty(isolate(), global, "SharedStructType",
                         shared_struct_type_fun, DONT_ENUM);
+
+  Handle<JSObject> atomics_object(native_context()->atomics_object(),
+                                  isolate());
+
+  {  // Atomics.Mutex
+    Handle<String> mutex_str =
+        isolate()->factory()->InternalizeUtf8String("Mutex");
+    Handle<JSFunction> mutex_fun = CreateSharedObjectConstructor(
+        isolate(), mutex_str, JS_ATOMICS_MUTEX_TYPE,
+        JSAtomicsMutex::kHeaderSize, Builtin::kAtomicsMutexConstructor);
+    native_context()->set_js_atomics_mutex_map(mutex_fun->initial_map());
+    mutex_fun->shared().set_internal_formal_parameter_count(
+        JSParameterCount(0));
+    mutex_fun->shared().set_length(0);
+    JSObject::AddProperty(isolate(), atomics_object, mutex_str, mutex_fun,
+                          DONT_ENUM);
+
+    SimpleInstallFunction(isolate(), mutex_fun, "lock",
+                          Builtin::kAtomicsMutexLock, 2, true);
+    SimpleInstallFunction(isolate(), mutex_fun, "tryLock",
+                          Builtin::kAtomicsMutexTryLock, 2, true);
+  }
+
+  {  // Atomics.Condition
+    Handle<String> condition_str =
+        isolate()->factory()->InternalizeUtf8String("Condition");
+    Handle<JSFunction> condition_fun = CreateSharedObjectConstructor(
+        isolate(), condition_str, JS_ATOMICS_CONDITION_TYPE,
+        JSAtomicsCondition::kHeaderSize,
+        Builtin::kAtomicsConditionConstructor);
+    native_context()->set_js_atomics_condition_map(
+        condition_fun->initial_map());
+    condition_fun->shared().set_internal_formal_parameter_count(
+        JSParameterCount(0));
+    condition_fun->shared().set_length(0);
+    JSObject::AddProperty(isolate(), atomics_object, condition_str,
+                          condition_fun, DONT_ENUM);
+
+    SimpleInstallFunction(isolate(), condition_fun, "wait",
+                          Builtin::kAtomicsConditionWait, 2, true);
+    SimpleInstallFunction(isolate(), condition_fun, "notify",
+                          Builtin::kAtomicsConditionNotify, 2, true);
+  }
 }
 
 void Genesis::InitializeGlobal_harmony_array_find_last() {
@@ -107,6 +107,9 @@ void IsolateAllocator::InitializeOncePerProcess() {
         "Failed to reserve virtual memory for process-wide V8 "
         "pointer compression cage");
   }
+  if (FLAG_transparent_huge_pages) {
+    GetProcessWidePtrComprCage()->AdviseTransparentHugePages();
+  }
 #endif
 }
 
@@ -118,6 +121,9 @@ IsolateAllocator::IsolateAllocator() {
         nullptr,
         "Failed to reserve memory for Isolate V8 pointer compression cage");
   }
+  if (FLAG_transparent_huge_pages) {
+    isolate_ptr_compr_cage_.AdviseTransparentHugePages();
+  }
   page_allocator_ = isolate_ptr_compr_cage_.page_allocator();
   CommitPagesForIsolate();
 #elif defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
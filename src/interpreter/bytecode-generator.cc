@@ -2548,6 +2548,15 @@ void BytecodeGenerator::AddToEagerLiteralsIfEager(FunctionLiteral* literal) {
           Compiler::GetSharedFunctionInfo(literal, script_, local_isolate_);
       info()->dispatcher()->Enqueue(local_isolate_, shared_info,
                                     info()->character_stream()->Clone());
+    } else if (shared_info->flush_count() > 0 && !shared_info->is_compiled() &&
+               local_isolate_->is_main_thread() &&
+               !info()->dispatcher()->IsEnqueued(shared_info)) {
+      // We are recompiling a function after a flush, and this inner function
+      // got flushed as well. Code paths that run periodically tend to need
+      // their inner functions again too, so compile them in the background
+      // instead of on the main thread when they are called.
+      info()->dispatcher()->Enqueue(local_isolate_, shared_info,
+                                    info()->character_stream()->Clone());
     }
   } else if (eager_inner_literals_ && literal->ShouldEagerCompile()) {
     DCHECK(!IsInEagerLiterals(literal, *eager_inner_literals_));
@@ -4,6 +4,8 @@
 
 #include "src/interpreter/bytecode-register-optimizer.h"
 
+#include "src/flags/flags.h"
+
 namespace v8 {
 namespace internal {
 namespace interpreter {
@@ -226,6 +228,7 @@ BytecodeRegisterOptimizer::BytecodeRegisterOptimizer(
       equivalence_id_(0),
       bytecode_writer_(bytecode_writer),
       flush_required_(false),
+      keep_equivalences_across_jumps_(FLAG_ignition_reo_across_jumps),
       zone_(zone) {
   register_allocator->set_observer(this);
 
@@ -310,6 +313,31 @@ void BytecodeRegisterOptimizer::Flush() {
   flush_required_ = false;
 }
 
+void BytecodeRegisterOptimizer::MaterializeAllRegisters() {
+  if (!flush_required_) {
+    return;
+  }
+
+  // Materialize every allocated member of each equivalence set, but leave the
+  // sets (and |registers_needing_flushed_|) in place so that a later Flush()
+  // still breaks them up.
+  for (RegisterInfo* reg_info : registers_needing_flushed_) {
+    if (!reg_info->needs_flush()) continue;
+    RegisterInfo* materialized = GetMaterializedEquivalent(reg_info);
+    if (materialized == nullptr) {
+      // Equivalence class containing only unallocated registers.
+      DCHECK_NULL(reg_info->GetAllocatedEquivalent());
+      continue;
+    }
+    for (RegisterInfo* equivalent = materialized->GetEquivalent();
+         equivalent != materialized; equivalent = equivalent->GetEquivalent()) {
+      if (equivalent->allocated() && !equivalent->materialized()) {
+        OutputRegisterTransfer(materialized, equivalent);
+      }
+    }
+  }
+}
+
 void BytecodeRegisterOptimizer::OutputRegisterTransfer(
     RegisterInfo* input_info, RegisterInfo* output_info) {
   Register input = input_info->register_value();
@@ -62,20 +62,34 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
 
   // Materialize all live registers and flush equivalence sets.
   void Flush();
+  // Materialize all live registers, but keep equivalence sets intact. This is
+  // sufficient before a jump, since the straight-line successor still sees
+  // the same register values.
+  void MaterializeAllRegisters();
   bool EnsureAllRegistersAreFlushed() const;
 
   // Prepares for |bytecode|.
   template <Bytecode bytecode, ImplicitRegisterUse implicit_register_use>
   V8_INLINE void PrepareForBytecode() {
-    if (Bytecodes::IsJump(bytecode) || Bytecodes::IsSwitch(bytecode) ||
-        bytecode == Bytecode::kDebugger ||
-        bytecode == Bytecode::kSuspendGenerator ||
-        bytecode == Bytecode::kResumeGenerator) {
-      // All state must be flushed before emitting
+    if (Bytecodes::IsJump(bytecode) || Bytecodes::IsSwitch(bytecode)) {
+      // All registers must be materialized before emitting
       // - a jump bytecode (as the register equivalents at the jump target
       //   aren't known)
       // - a switch bytecode (as the register equivalents at the switch targets
       //   aren't known)
+      // The equivalences still hold on the fall-through path of conditional
+      // jumps and switches, so optionally keep them there; the target label
+      // flushes them when it is bound.
+      if (keep_equivalences_across_jumps_ &&
+          !Bytecodes::IsUnconditionalJump(bytecode)) {
+        MaterializeAllRegisters();
+      } else {
+        Flush();
+      }
+    } else if (bytecode == Bytecode::kDebugger ||
+               bytecode == Bytecode::kSuspendGenerator ||
+               bytecode == Bytecode::kResumeGenerator) {
+      // All state must be flushed before emitting
       // - a call to the debugger (as it can manipulate locals and parameters),
       // - a generator suspend (as this involves saving all registers).
       // - a generator register restore.
@@ -202,6 +216,7 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
 
   BytecodeWriter* bytecode_writer_;
   bool flush_required_;
+  const bool keep_equivalences_across_jumps_;
   Zone* zone_;
 };
 
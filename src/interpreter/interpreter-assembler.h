@@ -403,6 +403,16 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue/JumpIfFalse and inline it in a branch, including
+  // subsequent dispatch. Anything after this point can assume that the
+  // following instruction was not a JumpIfTrue or JumpIfFalse.
+  void JumpIfBooleanDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode| (JumpIfTrue or JumpIfFalse, jumping if the
+  // accumulator is |value|) at the current BytecodeOffset(), including the
+  // subsequent dispatch.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode, TNode<Oddball> value);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -4,6 +4,10 @@
 
 #include "src/json/json-parser.h"
 
+#include <atomic>
+
+#include "include/v8-platform.h"
+#include "src/base/memory.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
@@ -119,6 +123,270 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Skips word-sized chunks of one-byte string characters that contain no '"',
+// '\\' or control character, i.e. nothing that may terminate a JSON string.
+// Returns a pointer to the first chunk that needs per-character scanning.
+const uint8_t* SkipPlainJsonStringChunks(const uint8_t* cursor,
+                                         const uint8_t* end) {
+  constexpr uintptr_t kOneInEveryByte = kUintptrAllBitsSet / 0xFF;
+  constexpr uintptr_t kHighBitInEveryByte = kOneInEveryByte * 0x80;
+  while (static_cast<size_t>(end - cursor) >= sizeof(uintptr_t)) {
+    uintptr_t chunk =
+        base::ReadUnalignedValue<uintptr_t>(reinterpret_cast<Address>(cursor));
+    uintptr_t quotes = chunk ^ (kOneInEveryByte * '"');
+    uintptr_t backslashes = chunk ^ (kOneInEveryByte * '\\');
+    // (x - n) & ~x has the high bit set in some byte iff some byte of x is
+    // below n (for n <= 0x80).
+    uintptr_t terminators = ((chunk - kOneInEveryByte * 0x20) & ~chunk) |
+                            ((quotes - kOneInEveryByte) & ~quotes) |
+                            ((backslashes - kOneInEveryByte) & ~backslashes);
+    if (terminators & kHighBitInEveryByte) break;
+    cursor += sizeof(uintptr_t);
+  }
+  return cursor;
+}
+
+// Computes the value of the already validated JSON number {chars} without
+// going through StringToDouble, if its significand has at most 15 digits and
+// the power of ten it is scaled by is exactly representable. A single IEEE
+// multiplication or division then yields the correctly rounded result.
+template <typename Char>
+bool TryFastJsonNumberToDouble(base::Vector<const Char> chars,
+                               double* result) {
+#if (V8_TARGET_ARCH_IA32 || defined(USE_SIMULATOR)) && !defined(_MSC_VER)
+  // x87 double rounding makes the result inaccurate, see DoubleStrtod.
+  return false;
+#else
+  static constexpr double kExactPowersOfTen[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  static constexpr int kMaxExactPowerOfTen =
+      static_cast<int>(arraysize(kExactPowersOfTen)) - 1;
+  static constexpr int kMaxSignificandDigits = 15;
+
+  const Char* cursor = chars.begin();
+  const Char* end = chars.end();
+  bool negative = *cursor == '-';
+  if (negative) cursor++;
+
+  uint64_t significand = 0;
+  int significand_digits = 0;
+  int exponent = 0;
+  bool in_fraction = false;
+  for (; cursor != end; cursor++) {
+    Char c = *cursor;
+    if (c == '.') {
+      in_fraction = true;
+      continue;
+    }
+    if (!IsDecimalDigit(c)) break;
+    if (in_fraction) exponent--;
+    // Leading zeros don't count towards the significand digits.
+    if (significand == 0 && c == '0') continue;
+    if (++significand_digits > kMaxSignificandDigits) return false;
+    significand = significand * 10 + (c - '0');
+  }
+
+  if (cursor != end) {
+    DCHECK_EQ('e', AsciiAlphaToLower(*cursor));
+    cursor++;
+    bool negative_exponent = *cursor == '-';
+    if (*cursor == '-' || *cursor == '+') cursor++;
+    int explicit_exponent = 0;
+    for (; cursor != end; cursor++) {
+      DCHECK(IsDecimalDigit(*cursor));
+      if (explicit_exponent > kMaxExactPowerOfTen * 10) return false;
+      explicit_exponent = explicit_exponent * 10 + (*cursor - '0');
+    }
+    exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+  }
+
+  double value = static_cast<double>(significand);
+  if (significand != 0) {
+    if (exponent < -kMaxExactPowerOfTen || exponent > kMaxExactPowerOfTen) {
+      return false;
+    }
+    if (exponent < 0) {
+      value /= kExactPowersOfTen[-exponent];
+    } else {
+      value *= kExactPowersOfTen[exponent];
+    }
+  }
+  *result = negative ? -value : value;
+  return true;
+#endif
+}
+
+// Whether the character at {pos} is escaped, i.e. preceded by an odd number
+// of backslashes not before {begin}.
+template <typename Char>
+bool IsEscapedAt(const Char* chars, size_t begin, size_t pos) {
+  size_t backslashes = 0;
+  while (pos - backslashes > begin && chars[pos - backslashes - 1] == '\\') {
+    backslashes++;
+  }
+  return backslashes % 2 == 1;
+}
+
+// Locates the strings without escapes or control characters in a JSON source
+// in parallel chunks. The first pass counts the unescaped quotes of each
+// chunk, which determines whether a chunk starts within a string. The second
+// pass then scans each chunk for the strings starting in it. For valid JSON
+// this finds exactly the parser's strings. For invalid JSON it may find bogus
+// ones, which the parser never looks up, since any entry that starts where
+// the parser starts a string is accurate.
+template <typename Char>
+class JsonStringIndexer final {
+ public:
+  static constexpr size_t kChunkSize = 256 * KB;
+
+  JsonStringIndexer(const Char* chars, size_t begin, size_t end)
+      : chars_(chars),
+        begin_(begin),
+        end_(end),
+        num_chunks_((end - begin + kChunkSize - 1) / kChunkSize),
+        odd_quotes_(num_chunks_),
+        starts_in_string_(num_chunks_),
+        chunk_strings_(num_chunks_) {}
+
+  // Runs both passes and returns the strings sorted by position.
+  std::vector<JsonIndexedString> Run() {
+    RunPass(kCountQuotes);
+    bool in_string = false;
+    for (size_t i = 0; i < num_chunks_; i++) {
+      starts_in_string_[i] = in_string;
+      if (odd_quotes_[i]) in_string = !in_string;
+    }
+    RunPass(kFindStrings);
+
+    std::vector<JsonIndexedString> result;
+    size_t count = 0;
+    for (const auto& strings : chunk_strings_) count += strings.size();
+    result.reserve(count);
+    for (const auto& strings : chunk_strings_) {
+      result.insert(result.end(), strings.begin(), strings.end());
+    }
+    return result;
+  }
+
+ private:
+  enum Pass { kCountQuotes, kFindStrings };
+
+  class ChunkTask final : public JobTask {
+   public:
+    explicit ChunkTask(JsonStringIndexer* indexer) : indexer_(indexer) {}
+
+    void Run(JobDelegate* delegate) override {
+      while (!delegate->ShouldYield()) {
+        size_t chunk =
+            indexer_->next_chunk_.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= indexer_->num_chunks_) return;
+        indexer_->ProcessChunk(chunk);
+      }
+    }
+
+    size_t GetMaxConcurrency(size_t worker_count) const override {
+      size_t next = indexer_->next_chunk_.load(std::memory_order_relaxed);
+      return next >= indexer_->num_chunks_ ? 0 : indexer_->num_chunks_ - next;
+    }
+
+   private:
+    JsonStringIndexer* const indexer_;
+  };
+
+  void RunPass(Pass pass) {
+    pass_ = pass;
+    next_chunk_.store(0, std::memory_order_relaxed);
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserBlocking,
+                  std::make_unique<ChunkTask>(this))
+        ->Join();
+  }
+
+  void ProcessChunk(size_t chunk) {
+    size_t chunk_begin = begin_ + chunk * kChunkSize;
+    size_t chunk_end = std::min(end_, chunk_begin + kChunkSize);
+    if (pass_ == kCountQuotes) {
+      odd_quotes_[chunk] = HasOddQuotes(chunk_begin, chunk_end);
+    } else {
+      FindStrings(chunk_begin, chunk_end, starts_in_string_[chunk],
+                  &chunk_strings_[chunk]);
+    }
+  }
+
+  bool HasOddQuotes(size_t chunk_begin, size_t chunk_end) const {
+    bool odd = false;
+    bool escaped = IsEscapedAt(chars_, begin_, chunk_begin);
+    for (size_t i = chunk_begin; i < chunk_end; i++) {
+      Char c = chars_[i];
+      if (escaped) {
+        escaped = false;
+      } else if (c == '\\') {
+        escaped = true;
+      } else if (c == '"') {
+        odd = !odd;
+      }
+    }
+    return odd;
+  }
+
+  void FindStrings(size_t chunk_begin, size_t chunk_end, bool in_string,
+                   std::vector<JsonIndexedString>* strings) const {
+    size_t i = chunk_begin;
+    if (in_string) {
+      // Skip the rest of the string started in a previous chunk.
+      bool escaped = IsEscapedAt(chars_, begin_, chunk_begin);
+      for (; i < chunk_end; i++) {
+        Char c = chars_[i];
+        if (escaped) {
+          escaped = false;
+        } else if (c == '\\') {
+          escaped = true;
+        } else if (c == '"') {
+          i++;
+          break;
+        }
+      }
+    }
+    while (i < chunk_end) {
+      if (chars_[i++] != '"') continue;
+      // Scan the string, also beyond the end of the chunk.
+      size_t start = i;
+      bool simple = true;
+      uint16_t bits = 0;
+      for (; i < end_; i++) {
+        Char c = chars_[i];
+        if (c == '"') break;
+        if (c == '\\') {
+          simple = false;
+          i++;
+        } else if (c < 0x20) {
+          simple = false;
+        } else if (sizeof(Char) == 2 && c > unibrow::Latin1::kMaxChar) {
+          bits |= c;
+        }
+      }
+      if (i >= end_) return;
+      if (simple) {
+        strings->push_back({static_cast<uint32_t>(start),
+                            static_cast<uint32_t>(i), bits});
+      }
+      i++;
+    }
+  }
+
+  const Char* const chars_;
+  const size_t begin_;
+  const size_t end_;
+  const size_t num_chunks_;
+  Pass pass_ = kCountQuotes;
+  std::atomic<size_t> next_chunk_{0};
+  // One element per chunk, each written by a single task.
+  std::vector<uint8_t> odd_quotes_;
+  std::vector<uint8_t> starts_in_string_;
+  std::vector<std::vector<JsonIndexedString>> chunk_strings_;
+};
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -324,12 +592,39 @@ JsonParser<Char>::~JsonParser() {
 
 template <typename Char>
 MaybeHandle<Object> JsonParser<Char>::ParseJson() {
+  if (FLAG_json_parse_parallel_string_scan &&
+      end_ - cursor_ >=
+          static_cast<ptrdiff_t>(
+              FLAG_json_parse_parallel_string_scan_threshold_kb) *
+              KB) {
+    BuildStringIndex();
+  }
   MaybeHandle<Object> result = ParseJsonValue();
   if (!Check(JsonToken::EOS)) ReportUnexpectedToken(peek());
   if (isolate_->has_pending_exception()) return MaybeHandle<Object>();
   return result;
 }
 
+template <typename Char>
+void JsonParser<Char>::BuildStringIndex() {
+  // The source can't move while the main thread waits for the index.
+  DisallowGarbageCollection no_gc;
+  JsonStringIndexer<Char> indexer(chars_, cursor_ - chars_, end_ - chars_);
+  string_index_ = indexer.Run();
+}
+
+template <typename Char>
+const JsonIndexedString* JsonParser<Char>::FindIndexedString() {
+  uint32_t current = static_cast<uint32_t>(position());
+  while (string_index_cursor_ < string_index_.size() &&
+         string_index_[string_index_cursor_].start < current) {
+    string_index_cursor_++;
+  }
+  if (string_index_cursor_ == string_index_.size()) return nullptr;
+  const JsonIndexedString* string = &string_index_[string_index_cursor_];
+  return string->start == current ? string : nullptr;
+}
+
 MaybeHandle<Object> InternalizeJsonProperty(Handle<JSObject> holder,
                                             Handle<String> key);
 
@@ -838,12 +1133,25 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
             break;
           }
 
+          // Use the map of the previous sibling as feedback, both for array
+          // elements and for property values of the enclosing object (as in
+          // {"id1": {...}, "id2": {...}}).
+          Handle<Object> sibling;
+          if (cont_stack.size() > 0) {
+            const JsonContinuation& parent = cont_stack.back();
+            if (parent.type() == JsonContinuation::kArrayElement &&
+                parent.index < element_stack.size()) {
+              sibling = element_stack.back();
+            } else if (parent.type() == JsonContinuation::kObjectProperty &&
+                       parent.index + 1 < cont.index) {
+              // The enclosing object's property holding this object is at
+              // cont.index - 1, the previous one right below it.
+              sibling = property_stack[cont.index - 2].value;
+            }
+          }
           Handle<Map> feedback;
-          if (cont_stack.size() > 0 &&
-              cont_stack.back().type() == JsonContinuation::kArrayElement &&
-              cont_stack.back().index < element_stack.size() &&
-              element_stack.back()->IsJSObject()) {
-            Map maybe_feedback = JSObject::cast(*element_stack.back()).map();
+          if (!sibling.is_null() && sibling->IsJSObject()) {
+            Map maybe_feedback = JSObject::cast(*sibling).map();
             // Don't consume feedback from objects with a map that's detached
             // from the transition tree.
             if (!maybe_feedback.IsDetached(isolate_)) {
@@ -977,10 +1285,12 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
     }
 
     base::Vector<const Char> chars(start, cursor_ - start);
-    number =
-        StringToDouble(chars,
-                       NO_CONVERSION_FLAGS,  // Hex, octal or trailing junk.
-                       std::numeric_limits<double>::quiet_NaN());
+    if (!TryFastJsonNumberToDouble(chars, &number)) {
+      number =
+          StringToDouble(chars,
+                         NO_CONVERSION_FLAGS,  // Hex, octal or trailing junk.
+                         std::numeric_limits<double>::quiet_NaN());
+    }
 
     DCHECK(!std::isnan(number));
   }
@@ -1126,7 +1436,20 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   bool has_escape = false;
   base::uc32 bits = 0;
 
+  if (!string_index_.empty()) {
+    if (const JsonIndexedString* string = FindIndexedString()) {
+      cursor_ = chars_ + string->end + 1;
+      int length = static_cast<int>(string->end) - start;
+      bool convert =
+          sizeof(Char) == 2 && string->bits <= unibrow::Latin1::kMaxChar;
+      return JsonString(start, length, convert, needs_internalization, false);
+    }
+  }
+
   while (true) {
+    if constexpr (sizeof(Char) == 1) {
+      cursor_ = SkipPlainJsonStringChunks(cursor_, end_);
+    }
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -5,6 +5,8 @@
 #ifndef V8_JSON_JSON_PARSER_H_
 #define V8_JSON_JSON_PARSER_H_
 
+#include <vector>
+
 #include "include/v8-callbacks.h"
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
@@ -19,6 +21,16 @@ namespace internal {
 
 enum ParseElementResult { kElementFound, kElementNotFound };
 
+// A string of the JSON source without escapes or control characters, located
+// by the parallel pre-pass over large inputs. Positions are character offsets
+// of the first character and of the closing quote.
+struct JsonIndexedString {
+  uint32_t start;
+  uint32_t end;
+  // All characters above Latin1 or'ed together.
+  uint16_t bits;
+};
+
 class JsonString final {
  public:
   JsonString()
@@ -294,6 +306,13 @@ class JsonParser final {
   // one of "true", "false", or "null", or an object or array literal.
   MaybeHandle<Object> ParseJsonValue();
 
+  // Locates the strings of large inputs on background threads, so that
+  // ScanJsonString doesn't need to look at their characters
+  // (--json-parse-parallel-string-scan).
+  void BuildStringIndex();
+  // Returns the indexed string starting at the current position, if any.
+  const JsonIndexedString* FindIndexedString();
+
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const SmallVector<JsonProperty>& property_stack, Handle<Map> feedback);
@@ -355,6 +374,11 @@ class JsonParser final {
   const Char* cursor_;
   const Char* end_;
   const Char* chars_;
+
+  // Strings without escapes sorted by position, and the first one that may
+  // still be ahead of the cursor.
+  std::vector<JsonIndexedString> string_index_;
+  size_t string_index_cursor_ = 0;
 };
 
 // Explicit instantiation declarations.
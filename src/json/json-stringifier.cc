@@ -30,6 +30,9 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  void StreamTo(v8::OutputStream* stream) { builder_.StreamTo(stream); }
+  bool HasAbortedStream() const { return builder_.HasAbortedStream(); }
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION };
 
@@ -83,6 +86,17 @@ class JsonStringifier {
   V8_INLINE Result SerializeJSObject(Handle<JSObject> object,
                                      Handle<Object> key);
 
+  // The enumerable string-keyed own properties of objects with a given map,
+  // each with its key already quoted and escaped for output.
+  struct PlannedProperty {
+    InternalIndex descriptor;
+    std::string escaped_key;  // Empty if the key is not a one-byte string.
+  };
+  using SerializationPlan = std::vector<PlannedProperty>;
+  std::shared_ptr<const SerializationPlan> GetSerializationPlan(
+      Handle<Map> map);
+  std::string EscapeKey(String key);
+
   Result SerializeJSProxy(Handle<JSProxy> object, Handle<Object> key);
   Result SerializeJSReceiverSlow(Handle<JSReceiver> object);
   Result SerializeArrayLikeSlow(Handle<JSReceiver> object, uint32_t start,
@@ -135,6 +149,19 @@ class JsonStringifier {
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
 
+  // Plans for the most recently serialized maps, so that objects of the same
+  // shape (like the elements of an array of records) don't need to re-walk
+  // the descriptors and re-escape the keys.
+  struct PlanCacheEntry {
+    Handle<Object> map;
+    std::shared_ptr<const SerializationPlan> plan;
+  };
+  static const int kPlanCacheSize = 8;
+  PlanCacheEntry plan_cache_[kPlanCacheSize];
+  int next_plan_cache_entry_ = 0;
+  // The escaped form of the next deferred key, if taken from a plan.
+  const std::string* planned_key_ = nullptr;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
@@ -145,6 +172,18 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<Object> object,
+                                  Handle<Object> replacer, Handle<Object> gap,
+                                  v8::OutputStream* stream) {
+  JsonStringifier stringifier(isolate);
+  stringifier.StreamTo(stream);
+  Handle<Object> result;
+  if (!stringifier.Stringify(object, replacer, gap).ToHandle(&result)) {
+    return Nothing<bool>();
+  }
+  return Just(!result->IsUndefined(isolate) && !stringifier.HasAbortedStream());
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -220,6 +259,11 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       indent_(0),
       stack_() {
   tojson_string_ = factory()->toJSON_string();
+  // Every entry needs a handle of its own, since the entries are updated by
+  // patching the handle's location.
+  for (PlanCacheEntry& entry : plan_cache_) {
+    entry.map = handle(ReadOnlyRoots(isolate).undefined_value(), isolate);
+  }
 }
 
 MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
@@ -827,19 +871,17 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
   builder_.AppendCharacter('{');
   Indent();
   bool comma = false;
-  for (InternalIndex i : map->IterateOwnDescriptors()) {
+  std::shared_ptr<const SerializationPlan> plan = GetSerializationPlan(map);
+  for (const PlannedProperty& planned : *plan) {
+    InternalIndex i = planned.descriptor;
     Handle<String> key_name;
     PropertyDetails details = PropertyDetails::Empty();
     {
       DisallowGarbageCollection no_gc;
       DescriptorArray descriptors = map->instance_descriptors(cage_base);
-      Name name = descriptors.GetKey(i);
-      // TODO(rossberg): Should this throw?
-      if (!name.IsString(cage_base)) continue;
-      key_name = handle(String::cast(name), isolate_);
+      key_name = handle(String::cast(descriptors.GetKey(i)), isolate_);
       details = descriptors.GetDetails(i);
     }
-    if (details.IsDontEnum()) continue;
     Handle<Object> property;
     if (details.location() == PropertyLocation::kField &&
         *map == object->map(cage_base)) {
@@ -852,7 +894,9 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
           isolate_, property,
           Object::GetPropertyOrElement(isolate_, object, key_name), EXCEPTION);
     }
+    if (!planned.escaped_key.empty()) planned_key_ = &planned.escaped_key;
     Result result = SerializeProperty(property, comma, key_name);
+    planned_key_ = nullptr;
     if (!comma && result == SUCCESS) comma = true;
     if (result == EXCEPTION) return result;
   }
@@ -1089,11 +1133,61 @@ void JsonStringifier::Separator(bool first) {
 void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
                                            Handle<Object> deferred_key) {
   Separator(!deferred_comma);
+  if (planned_key_ != nullptr) {
+    builder_.AppendCString(planned_key_->c_str());
+    planned_key_ = nullptr;
+    return;
+  }
   SerializeString(Handle<String>::cast(deferred_key));
   builder_.AppendCharacter(':');
   if (gap_ != nullptr) builder_.AppendCharacter(' ');
 }
 
+std::shared_ptr<const JsonStringifier::SerializationPlan>
+JsonStringifier::GetSerializationPlan(Handle<Map> map) {
+  for (const PlanCacheEntry& entry : plan_cache_) {
+    if (*entry.map == *map) return entry.plan;
+  }
+
+  // The enumerability of a map's own descriptors never changes, only their
+  // field representations, which are looked up while serializing anyway.
+  auto plan = std::make_shared<SerializationPlan>();
+  {
+    DisallowGarbageCollection no_gc;
+    DescriptorArray descriptors = map->instance_descriptors(isolate_);
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      Name name = descriptors.GetKey(i);
+      // TODO(rossberg): Should this throw?
+      if (!name.IsString()) continue;
+      if (descriptors.GetDetails(i).IsDontEnum()) continue;
+      plan->push_back({i, EscapeKey(String::cast(name))});
+    }
+  }
+
+  PlanCacheEntry& entry = plan_cache_[next_plan_cache_entry_];
+  next_plan_cache_entry_ = (next_plan_cache_entry_ + 1) % kPlanCacheSize;
+  entry.map.PatchValue(*map);
+  entry.plan = plan;
+  return plan;
+}
+
+std::string JsonStringifier::EscapeKey(String key) {
+  std::string result;
+  DisallowGarbageCollection no_gc;
+  String::FlatContent flat = key.GetFlatContent(no_gc);
+  if (!flat.IsOneByte()) return result;
+  result.push_back('"');
+  for (uint8_t c : flat.ToOneByteVector()) {
+    if (DoNotEscape(c)) {
+      result.push_back(static_cast<char>(c));
+    } else {
+      result.append(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
+    }
+  }
+  result.append(gap_ != nullptr ? "\": " : "\":");
+  return result;
+}
+
 void JsonStringifier::SerializeString(Handle<String> object) {
   object = String::Flatten(isolate_, object);
   if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
@@ -94,6 +94,7 @@ void DefaultJobState::ReleaseTaskId(uint8_t task_id) {
 
 void DefaultJobState::Join() {
   bool can_run = false;
+  size_t num_tasks_to_post = 0;
   {
     base::MutexGuard guard(&mutex_);
     priority_ = TaskPriority::kUserBlocking;
@@ -102,6 +103,21 @@ void DefaultJobState::Join() {
     // workers to return if necessary so we don't exceed GetMaxConcurrency().
     num_worker_threads_ = platform_->NumberOfWorkerThreads() + 1;
     ++active_workers_;
+    // Raising the worker cap may leave room for more workers. Post them now,
+    // at the boosted priority, instead of waiting for the next DidRunTask().
+    const size_t max_concurrency = CappedMaxConcurrency(active_workers_);
+    if (max_concurrency > active_workers_ + pending_tasks_) {
+      num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
+      pending_tasks_ += num_tasks_to_post;
+    }
+  }
+  for (size_t i = 0; i < num_tasks_to_post; ++i) {
+    CallOnWorkerThread(TaskPriority::kUserBlocking,
+                       std::make_unique<DefaultJobWorker>(shared_from_this(),
+                                                          job_task_.get()));
+  }
+  {
+    base::MutexGuard guard(&mutex_);
     can_run = WaitForParticipationOpportunityLockRequired();
   }
   DefaultJobState::JobDelegate delegate(this, true);
@@ -117,7 +133,9 @@ void DefaultJobState::CancelAndWait() {
     base::MutexGuard guard(&mutex_);
     is_canceled_.store(true, std::memory_order_relaxed);
     while (active_workers_ > 0) {
+      has_waiter_ = true;
       worker_released_condition_.Wait(&mutex_);
+      has_waiter_ = false;
     }
   }
 }
@@ -153,9 +171,11 @@ bool DefaultJobState::DidRunTask() {
     const size_t max_concurrency = CappedMaxConcurrency(active_workers_ - 1);
     if (is_canceled_.load(std::memory_order_relaxed) ||
         active_workers_ > max_concurrency) {
-      // Release current worker and notify.
+      // Release current worker and notify. Workers usually return while
+      // nobody is blocked in Join() or CancelAndWait(), so skip the wakeup
+      // in that case.
       --active_workers_;
-      worker_released_condition_.NotifyOne();
+      if (has_waiter_) worker_released_condition_.NotifyOne();
       return false;
     }
     // Consider |pending_tasks_| to avoid posting too many tasks.
@@ -180,7 +200,9 @@ bool DefaultJobState::DidRunTask() {
 bool DefaultJobState::WaitForParticipationOpportunityLockRequired() {
   size_t max_concurrency = CappedMaxConcurrency(active_workers_ - 1);
   while (active_workers_ > max_concurrency && active_workers_ > 1) {
+    has_waiter_ = true;
     worker_released_condition_.Wait(&mutex_);
+    has_waiter_ = false;
     max_concurrency = CappedMaxConcurrency(active_workers_ - 1);
   }
   if (active_workers_ <= max_concurrency) return true;
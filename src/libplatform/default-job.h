@@ -97,6 +97,9 @@ class V8_PLATFORM_EXPORT DefaultJobState
   size_t num_worker_threads_;
   // Signaled when a worker returns.
   base::ConditionVariable worker_released_condition_;
+  // Whether the joining or canceling thread is waiting on
+  // |worker_released_condition_|. There is at most one such thread.
+  bool has_waiter_ = false;
 
   std::atomic<uint32_t> assigned_task_ids_{0};
 };
@@ -15,6 +15,7 @@
 #include "src/base/compiler-specific.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 
 namespace v8 {
@@ -31,7 +32,8 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   explicit DefaultPlatform(
       int thread_pool_size = 0,
       IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled,
-      std::unique_ptr<v8::TracingController> tracing_controller = {});
+      std::unique_ptr<v8::TracingController> tracing_controller = {},
+      PriorityMode priority_mode = PriorityMode::kDontApply);
 
   ~DefaultPlatform() override;
 
@@ -53,11 +55,18 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
 
   void SetTimeFunctionForTesting(TimeFunction time_function);
 
+  // Returns the OS-level priority of the worker threads that run tasks of
+  // the given |priority|.
+  base::Thread::Priority GetWorkerThreadPriorityForTesting(
+      TaskPriority priority) const;
+
   // v8::Platform implementation.
   int NumberOfWorkerThreads() override;
   std::shared_ptr<TaskRunner> GetForegroundTaskRunner(
       v8::Isolate* isolate) override;
   void CallOnWorkerThread(std::unique_ptr<Task> task) override;
+  void CallBlockingTaskOnWorkerThread(std::unique_ptr<Task> task) override;
+  void CallLowPriorityTaskOnWorkerThread(std::unique_ptr<Task> task) override;
   void CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                  double delay_in_seconds) override;
   bool IdleTasksEnabled(Isolate* isolate) override;
@@ -72,10 +81,23 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   void NotifyIsolateShutdown(Isolate* isolate);
 
  private:
+  static constexpr int kNumTaskPriorities =
+      static_cast<int>(TaskPriority::kUserBlocking) + 1;
+
+  // Returns the task runner for tasks of the given |priority|. All priorities
+  // share one runner unless |priority_mode_| is PriorityMode::kApply.
+  DefaultWorkerThreadsTaskRunner* worker_threads_task_runner(
+      TaskPriority priority) const;
+
   base::Mutex lock_;
   const int thread_pool_size_;
   IdleTaskSupport idle_task_support_;
-  std::shared_ptr<DefaultWorkerThreadsTaskRunner> worker_threads_task_runner_;
+  const PriorityMode priority_mode_;
+  // Indexed by TaskPriority. Unless |priority_mode_| is PriorityMode::kApply,
+  // all entries point to the same runner, whose threads use the default
+  // priority.
+  std::shared_ptr<DefaultWorkerThreadsTaskRunner>
+      worker_threads_task_runners_[kNumTaskPriorities];
   std::map<v8::Isolate*, std::shared_ptr<DefaultForegroundTaskRunner>>
       foreground_task_runner_map_;
 
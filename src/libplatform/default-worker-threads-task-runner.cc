@@ -10,10 +10,13 @@ namespace v8 {
 namespace platform {
 
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
-    uint32_t thread_pool_size, TimeFunction time_function)
-    : queue_(time_function), time_function_(time_function) {
+    uint32_t thread_pool_size, TimeFunction time_function,
+    base::Thread::Priority priority)
+    : queue_(time_function),
+      time_function_(time_function),
+      priority_(priority) {
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this));
+    thread_pool_.push_back(std::make_unique<WorkerThread>(this, priority));
   }
 }
 
@@ -60,8 +63,9 @@ std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext() {
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner)
-    : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
+    DefaultWorkerThreadsTaskRunner* runner, base::Thread::Priority priority)
+    : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread",
+                     priority)),
       runner_(runner) {
   CHECK(Start());
 }
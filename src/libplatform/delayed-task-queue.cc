@@ -25,9 +25,13 @@ double DelayedTaskQueue::MonotonicallyIncreasingTime() {
 }
 
 void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  DCHECK(!terminated_);
-  task_queue_.push(std::move(task));
+  {
+    base::MutexGuard guard(&lock_);
+    DCHECK(!terminated_);
+    task_queue_.push(std::move(task));
+  }
+  // Notify after unlocking, so that the woken thread does not immediately
+  // block on the lock that is still held by this thread.
   queues_condition_var_.NotifyOne();
 }
 
@@ -46,12 +50,17 @@ void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
 std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
   base::MutexGuard guard(&lock_);
   for (;;) {
-    // Move delayed tasks that have hit their deadline to the main queue.
-    double now = MonotonicallyIncreasingTime();
-    std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
-    while (task) {
-      task_queue_.push(std::move(task));
-      task = PopTaskFromDelayedQueue(now);
+    // Move delayed tasks that have hit their deadline to the main queue. The
+    // lock is contended by all worker threads, so only ask for the time when
+    // there are delayed tasks at all.
+    double now = 0;
+    if (!delayed_task_queue_.empty()) {
+      now = MonotonicallyIncreasingTime();
+      std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
+      while (task) {
+        task_queue_.push(std::move(task));
+        task = PopTaskFromDelayedQueue(now);
+      }
     }
     if (!task_queue_.empty()) {
       std::unique_ptr<Task> result = std::move(task_queue_.front());
@@ -134,12 +134,13 @@ uint64_t TracingController::AddTraceEventWithTimestamp(
     const uint64_t* arg_values,
     std::unique_ptr<v8::ConvertableToTraceFormat>* arg_convertables,
     unsigned int flags, int64_t timestamp) {
-  int64_t cpu_now_us = CurrentCpuTimestampMicroseconds();
-
   uint64_t handle = 0;
   if (recording_.load(std::memory_order_acquire)) {
     TraceObject* trace_object = trace_buffer_->AddTraceEvent(&handle);
     if (trace_object) {
+      // Reading the thread's CPU time is a system call on most platforms, so
+      // only do it once the event is known to be recorded.
+      int64_t cpu_now_us = CurrentCpuTimestampMicroseconds();
       {
         base::MutexGuard lock(mutex_.get());
         trace_object->Initialize(phase, category_enabled_flag, name, scope, id,
@@ -297,6 +297,9 @@ namespace internal {
   SC(inlined_copied_elements, V8.InlinedCopiedElements)            \
   SC(compilation_cache_hits, V8.CompilationCacheHits)              \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)          \
+  /* Off-thread code cache deserializations skipped because the */ \
+  /* script was already in the compilation cache. */               \
+  SC(deserialize_skipped, V8.DeserializeSkipped)                   \
   /* Amount of evaled source code. */                              \
   SC(total_eval_size, V8.TotalEvalSize)                            \
   /* Amount of loaded source code. */                              \
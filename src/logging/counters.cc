@@ -47,8 +47,11 @@ std::atomic<int>* StatsCounter::SetupPtrFromStatsTable() {
 }
 
 void Histogram::AddSample(int sample) {
-  if (Enabled()) {
-    counters_->AddHistogramSample(histogram_, sample);
+  // Load the embedder's histogram once; it is only ever published with a
+  // release store in EnsureCreated, so acquire is enough here.
+  void* histogram = histogram_.load(std::memory_order_acquire);
+  if (histogram != nullptr) {
+    counters_->AddHistogramSample(histogram, sample);
   }
 }
 
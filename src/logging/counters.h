@@ -158,7 +158,9 @@ class Histogram {
   void AddSample(int sample);
 
   // Returns true if this histogram is enabled.
-  bool Enabled() { return histogram_ != nullptr; }
+  bool Enabled() {
+    return histogram_.load(std::memory_order_acquire) != nullptr;
+  }
 
   const char* name() const { return name_; }
 
@@ -192,7 +194,7 @@ class Histogram {
 
   // Reset the cached internal pointer to nullptr; the histogram will be
   // created lazily, the first time it is needed.
-  void Reset() { histogram_ = nullptr; }
+  void Reset() { histogram_.store(nullptr, std::memory_order_relaxed); }
 
   // Lazily create the histogram, if it has not been created yet.
   void EnsureCreated(bool create_new = true) {
@@ -84,7 +84,13 @@ class RuntimeCallTimer final {
   void Snapshot();
 
   inline RuntimeCallTimer* Stop() {
-    if (!IsStarted()) return parent();
+    if (!IsStarted()) {
+      // Timers are not started in sampling mode, where CPU profiler ticks
+      // attribute the time to the current counter. Counting the call needs
+      // no clock read, so keep the call counts exact.
+      counter_->Increment();
+      return parent();
+    }
     base::TimeTicks now = RuntimeCallTimer::Now();
     Pause(now);
     counter_->Increment();
@@ -138,6 +144,7 @@ class RuntimeCallTimer final {
   V(ArrayBuffer_NewBackingStore)                           \
   V(ArrayBuffer_BackingStore_Reallocate)                   \
   V(Array_CloneElementAt)                                  \
+  V(Array_Iterate)                                         \
   V(Array_New)                                             \
   V(BigInt64Array_New)                                     \
   V(BigInt_NewFromWords)                                   \
@@ -173,6 +180,7 @@ class RuntimeCallTimer final {
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
   V(JSON_Stringify)                                        \
+  V(JSON_StringifyTo)                                      \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
   V(Map_Delete)                                            \
@@ -415,6 +423,9 @@ class RuntimeCallTimer final {
   V(DeoptimizeCode)                            \
   V(DeserializeContext)                        \
   V(DeserializeIsolate)                        \
+  V(DeserializeReadOnly)                       \
+  V(DeserializeRehash)                         \
+  V(DeserializeStartup)                        \
   V(FinalizationRegistryCleanupFromTask)       \
   V(FunctionCallback)                          \
   V(FunctionLengthGetter)                      \
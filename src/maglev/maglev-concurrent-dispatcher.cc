@@ -9,6 +9,7 @@
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/handles/persistent-handles.h"
+#include "src/heap/parked-scope.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-compiler.h"
 #include "src/maglev/maglev-graph-labeller.h"
@@ -111,7 +112,26 @@ CompilationJob::Status MaglevCompilationJob::FinalizeJobImpl(Isolate* isolate) {
            .ToHandle(&codet)) {
     return CompilationJob::FAILED;
   }
-  info()->function()->set_code(*codet);
+  Handle<JSFunction> function = info()->function();
+  function->set_code(*codet);
+  // Maglev doesn't specialize to the function context, so the code can be
+  // shared by all closures using the same feedback vector. This also lets
+  // closures that were created while the job was running pick it up.
+  FeedbackVector feedback_vector = function->feedback_vector();
+  feedback_vector.EvictOptimizedCodeMarkedForDeoptimization(
+      function->shared(), "MaglevCompilationJob::FinalizeJobImpl");
+  // Only the kInProgress marker set when this job was enqueued is ours to
+  // clear. A tiering request made while the job was running (e.g. for
+  // TurboFan) has to survive installing the code.
+  const TieringState tiering_state = feedback_vector.tiering_state();
+  if (!feedback_vector.has_optimized_code()) {
+    feedback_vector.SetOptimizedCode(codet);
+  }
+  if (tiering_state == TieringState::kInProgress) {
+    feedback_vector.reset_tiering_state();
+  } else {
+    feedback_vector.set_tiering_state(tiering_state);
+  }
   return CompilationJob::SUCCEEDED;
 }
 
@@ -179,6 +199,19 @@ void MaglevConcurrentDispatcher::EnqueueJob(
   job_handle_->NotifyConcurrencyIncrease();
 }
 
+void MaglevConcurrentDispatcher::AwaitCompileJobs() {
+  DCHECK(is_enabled());
+  {
+    // Background jobs may need to reach a safepoint while we wait.
+    ParkedScope parked(isolate_->main_thread_local_isolate());
+    job_handle_->Join();
+  }
+  // Join() invalidates the handle, so post a fresh job for later requests.
+  job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible, std::make_unique<JobTask>(this));
+  DCHECK(incoming_queue_.IsEmpty());
+}
+
 void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
   HandleScope handle_scope(isolate_);
   while (!outgoing_queue_.IsEmpty()) {
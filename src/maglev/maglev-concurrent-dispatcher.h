@@ -81,6 +81,10 @@ class MaglevConcurrentDispatcher final {
   // Called from the main thread.
   void FinalizeFinishedJobs();
 
+  // Called from the main thread. Blocks until all enqueued jobs have been
+  // executed; they still need to be finalized by FinalizeFinishedJobs.
+  void AwaitCompileJobs();
+
   bool is_enabled() const { return static_cast<bool>(job_handle_); }
 
  private:
@@ -161,15 +161,16 @@ void MaglevGraphBuilder::VisitBinaryOperation() {
     if (nexus.kind() == FeedbackSlotKind::kBinaryOp) {
       BinaryOperationHint hint = nexus.GetBinaryOperationFeedback();
 
-      if (hint == BinaryOperationHint::kSignedSmall) {
+      // Only untag the inputs for operations that have an Int32 version, so
+      // that the remaining ones don't pick up unused Smi checks (and their
+      // eager deopts) on top of the generic node.
+      if (hint == BinaryOperationHint::kSignedSmall &&
+          kOperation == Operation::kAdd) {
         ValueNode* left = AddNewNode<CheckedSmiUntag>({LoadRegister(0)});
         ValueNode* right = AddNewNode<CheckedSmiUntag>({GetAccumulator()});
-
-        if (kOperation == Operation::kAdd) {
-          ValueNode* result = AddNewNode<Int32AddWithOverflow>({left, right});
-          SetAccumulatorToNewNode<CheckedSmiTag>({result});
-          return;
-        }
+        ValueNode* result = AddNewNode<Int32AddWithOverflow>({left, right});
+        SetAccumulatorToNewNode<CheckedSmiTag>({result});
+        return;
       }
     }
   }
@@ -317,6 +318,20 @@ MAGLEV_UNIMPLEMENTED_BYTECODE(LdaLookupSlotInsideTypeof)
 MAGLEV_UNIMPLEMENTED_BYTECODE(LdaLookupContextSlotInsideTypeof)
 MAGLEV_UNIMPLEMENTED_BYTECODE(LdaLookupGlobalSlotInsideTypeof)
 MAGLEV_UNIMPLEMENTED_BYTECODE(StaLookupSlot)
+void MaglevGraphBuilder::BuildMapCheck(ValueNode* object,
+                                       const compiler::MapRef& map) {
+  ZoneMap<ValueNode*, compiler::MapRef>& known_maps =
+      current_interpreter_frame_.known_node_aspects().maps;
+  auto it = known_maps.find(object);
+  if (it != known_maps.end()) {
+    // The map has already been checked on this path.
+    if (it->second.equals(map)) return;
+    known_maps.erase(it);
+  }
+  AddNewNode<CheckMaps>({object}, map);
+  known_maps.emplace(object, map);
+}
+
 void MaglevGraphBuilder::VisitGetNamedProperty() {
   // GetNamedProperty <object> <name_index> <slot>
   ValueNode* object = LoadRegister(0);
@@ -335,8 +350,7 @@ void MaglevGraphBuilder::VisitGetNamedProperty() {
       LoadHandler::Kind kind = LoadHandler::KindBits::decode(handler);
       if (kind == LoadHandler::Kind::kField &&
           !LoadHandler::IsWasmStructBits::decode(handler)) {
-        AddNewNode<CheckMaps>({object},
-                              MakeRef(broker(), map_and_handler.first));
+        BuildMapCheck(object, MakeRef(broker(), map_and_handler.first));
         SetAccumulatorToNewNode<LoadField>({object}, handler);
         return;
       }
@@ -370,8 +384,7 @@ void MaglevGraphBuilder::VisitSetNamedProperty() {
       int handler = map_and_handler.second->ToSmi().value();
       StoreHandler::Kind kind = StoreHandler::KindBits::decode(handler);
       if (kind == StoreHandler::Kind::kField) {
-        AddNewNode<CheckMaps>({object},
-                              MakeRef(broker(), map_and_handler.first));
+        BuildMapCheck(object, MakeRef(broker(), map_and_handler.first));
         ValueNode* value = GetAccumulator();
         AddNewNode<StoreField>({object, value}, handler);
         return;
@@ -458,10 +471,36 @@ MAGLEV_UNIMPLEMENTED_BYTECODE(DeletePropertyStrict)
 MAGLEV_UNIMPLEMENTED_BYTECODE(DeletePropertySloppy)
 MAGLEV_UNIMPLEMENTED_BYTECODE(GetSuperConstructor)
 
-// TODO(v8:7700): Read feedback and implement inlining
+// Reports calls whose feedback has a single, small, inlineable target. This
+// uses the same criteria as a first version of inlining would, so that the
+// potential of the latter can be measured on real code.
+void MaglevGraphBuilder::TraceInliningCandidate(int slot_operand_index) {
+  if (!FLAG_trace_maglev_inlining) return;
+  compiler::FeedbackSource source(feedback(),
+                                  GetSlotOperand(slot_operand_index));
+  compiler::ProcessedFeedback const& processed_feedback =
+      broker()->GetFeedbackForCall(source);
+  if (processed_feedback.IsInsufficient()) return;
+  base::Optional<compiler::HeapObjectRef> target =
+      processed_feedback.AsCall().target();
+  if (!target.has_value() || !target->IsJSFunction()) return;
+  compiler::SharedFunctionInfoRef shared = target->AsJSFunction().shared();
+  if (!shared.IsInlineable()) return;
+  int bytecode_size = shared.GetBytecodeArray().length();
+  if (bytecode_size > FLAG_max_maglev_inlined_bytecode_size) return;
+  std::cout << "Maglev inlining candidate at offset "
+            << iterator_.current_offset() << " in "
+            << Brief(*compilation_unit_->shared_function_info().object())
+            << ": " << Brief(*shared.object()) << " (" << bytecode_size
+            << " bytes)" << std::endl;
+}
+
+// TODO(v8:7700): Implement inlining
 void MaglevGraphBuilder::BuildCallFromRegisterList(
     ConvertReceiverMode receiver_mode) {
   ValueNode* function = LoadRegister(0);
+  // Operands are the callee, the argument register list and the slot.
+  TraceInliningCandidate(3);
 
   interpreter::RegisterList args = iterator_.GetRegisterListOperand(1);
   ValueNode* context = GetContext();
@@ -493,6 +532,11 @@ void MaglevGraphBuilder::BuildCallFromRegisters(
   DCHECK_LE(argc_count, 2);
   ValueNode* function = LoadRegister(0);
   ValueNode* context = GetContext();
+  // Operands are the callee, the receiver unless it is known to be undefined,
+  // the arguments and the slot.
+  TraceInliningCandidate(
+      receiver_mode == ConvertReceiverMode::kNullOrUndefined ? argc_count + 1
+                                                             : argc_count + 2);
 
   int argc_count_with_recv = argc_count + 1;
   size_t input_count = argc_count_with_recv + Call::kFixedInputCount;
@@ -130,6 +130,11 @@ class MaglevGraphBuilder {
     if (node->properties().is_required_when_unused()) {
       MarkPossibleSideEffect();
     }
+    if (node->properties().is_call() ||
+        node->properties().non_memory_side_effects()) {
+      current_interpreter_frame_.known_node_aspects()
+          .ClearUnstableInformation();
+    }
     current_block_->nodes().Add(node);
     if (has_graph_labeller()) graph_labeller()->RegisterNode(node);
     return node;
@@ -320,10 +325,12 @@ class MaglevGraphBuilder {
     return block;
   }
 
+  void TraceInliningCandidate(int slot_operand_index);
   void BuildCallFromRegisterList(ConvertReceiverMode receiver_mode);
   void BuildCallFromRegisters(int argc_count,
                               ConvertReceiverMode receiver_mode);
 
+  void BuildMapCheck(ValueNode* object, const compiler::MapRef& map);
   void BuildPropertyCellAccess(const compiler::PropertyCellRef& property_cell);
 
   template <Operation kOperation>
@@ -14,6 +14,7 @@
 #include "src/maglev/maglev-ir.h"
 #include "src/maglev/maglev-regalloc-data.h"
 #include "src/maglev/maglev-register-frame-array.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone.h"
 
 namespace v8 {
@@ -23,20 +24,56 @@ namespace maglev {
 class BasicBlock;
 class MergePointInterpreterFrameState;
 
+// Information about nodes that holds on the current control path, because it
+// has already been checked on the way.
+struct KnownNodeAspects {
+  explicit KnownNodeAspects(Zone* zone) : maps(zone) {}
+
+  KnownNodeAspects* Clone(Zone* zone) const {
+    return zone->New<KnownNodeAspects>(*this);
+  }
+
+  // Keeps only the information that also holds in {other}, i.e. on another
+  // path into a merge point.
+  void Merge(const KnownNodeAspects& other) {
+    for (auto it = maps.begin(); it != maps.end();) {
+      auto other_it = other.maps.find(it->first);
+      if (other_it == other.maps.end() ||
+          !other_it->second.equals(it->second)) {
+        it = maps.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  // Forgets everything that may be invalidated by arbitrary side effects,
+  // e.g. maps that change when a call transitions an object.
+  void ClearUnstableInformation() { maps.clear(); }
+
+  // The map of each node that has passed a CheckMaps. As long as Maglev
+  // doesn't emit map transitions itself, maps can only change across nodes
+  // with arbitrary side effects.
+  ZoneMap<ValueNode*, compiler::MapRef> maps;
+};
+
 class InterpreterFrameState {
  public:
   explicit InterpreterFrameState(const MaglevCompilationUnit& info)
-      : frame_(info) {}
+      : frame_(info),
+        known_node_aspects_(info.zone()->New<KnownNodeAspects>(info.zone())) {}
 
   InterpreterFrameState(const MaglevCompilationUnit& info,
                         const InterpreterFrameState& state)
-      : frame_(info) {
+      : frame_(info),
+        known_node_aspects_(state.known_node_aspects_->Clone(info.zone())) {
     frame_.CopyFrom(info, state.frame_, nullptr);
   }
 
   void CopyFrom(const MaglevCompilationUnit& info,
                 const InterpreterFrameState& state) {
     frame_.CopyFrom(info, state.frame_, nullptr);
+    known_node_aspects_ = state.known_node_aspects_->Clone(info.zone());
   }
 
   inline void CopyFrom(const MaglevCompilationUnit& info,
@@ -68,8 +105,14 @@ class InterpreterFrameState {
 
   const RegisterFrameArray<ValueNode*>& frame() const { return frame_; }
 
+  KnownNodeAspects& known_node_aspects() { return *known_node_aspects_; }
+  const KnownNodeAspects& known_node_aspects() const {
+    return *known_node_aspects_;
+  }
+
  private:
   RegisterFrameArray<ValueNode*> frame_;
+  KnownNodeAspects* known_node_aspects_;
 };
 
 class CompactInterpreterFrameState {
@@ -249,7 +292,8 @@ class MergePointInterpreterFrameState {
       : predecessor_count_(predecessor_count),
         predecessors_so_far_(1),
         predecessors_(info.zone()->NewArray<BasicBlock*>(predecessor_count)),
-        frame_state_(info, liveness, state) {
+        frame_state_(info, liveness, state),
+        known_node_aspects_(state.known_node_aspects().Clone(info.zone())) {
     predecessors_[0] = predecessor;
   }
 
@@ -260,7 +304,10 @@ class MergePointInterpreterFrameState {
       : predecessor_count_(predecessor_count),
         predecessors_so_far_(1),
         predecessors_(info.zone()->NewArray<BasicBlock*>(predecessor_count)),
-        frame_state_(info, liveness) {
+        frame_state_(info, liveness),
+        // Nothing is known at a loop header, since the back edge may
+        // invalidate anything that holds on entry to the loop.
+        known_node_aspects_(info.zone()->New<KnownNodeAspects>(info.zone())) {
     auto& assignments = loop_info->assignments();
     frame_state_.ForEachParameter(
         info, [&](ValueNode*& entry, interpreter::Register reg) {
@@ -299,6 +346,7 @@ class MergePointInterpreterFrameState {
           value = MergeValue(compilation_unit.zone(), reg, value,
                              unmerged.get(reg), merge_offset);
         });
+    known_node_aspects_->Merge(unmerged.known_node_aspects());
     predecessors_so_far_++;
     DCHECK_LE(predecessors_so_far_, predecessor_count_);
   }
@@ -324,6 +372,9 @@ class MergePointInterpreterFrameState {
   const CompactInterpreterFrameState& frame_state() const {
     return frame_state_;
   }
+  const KnownNodeAspects& known_node_aspects() const {
+    return *known_node_aspects_;
+  }
   MergePointRegisterState& register_state() { return register_state_; }
 
   bool has_phi() const { return !phis_.is_empty(); }
@@ -422,6 +473,7 @@ class MergePointInterpreterFrameState {
 
   CompactInterpreterFrameState frame_state_;
   MergePointRegisterState register_state_;
+  KnownNodeAspects* known_node_aspects_;
 };
 
 void InterpreterFrameState::CopyFrom(
@@ -431,6 +483,7 @@ void InterpreterFrameState::CopyFrom(
       info, [&](ValueNode* value, interpreter::Register reg) {
         frame_[reg] = value;
       });
+  known_node_aspects_ = state.known_node_aspects().Clone(info.zone());
 }
 
 }  // namespace maglev
@@ -541,7 +541,7 @@ std::unique_ptr<BackingStore> BackingStore::AllocateWasmMemory(
   return backing_store;
 }
 
-std::unique_ptr<BackingStore> BackingStore::CopyWasmMemory(Isolate* isolate,
+std::unique_ptr<BackingStore> BackingStore::MoveWasmMemory(Isolate* isolate,
                                                            size_t new_pages,
                                                            size_t max_pages) {
   // Note that we could allocate uninitialized to save initialization cost here,
@@ -560,6 +560,22 @@ std::unique_ptr<BackingStore> BackingStore::CopyWasmMemory(Isolate* isolate,
     // If the allocation was successful, then the new buffer must be at least
     // as big as the old one.
     DCHECK_GE(new_pages * wasm::kWasmPageSize, byte_length_);
+#if V8_OS_LINUX && !defined(V8_SANDBOX)
+    // Non-shared memories are detached after growing, so instead of copying
+    // we can move the old pages over to the new reservation. This is O(1) in
+    // the size of the memory and avoids a long pause for large memories.
+    // Both reservations come from the platform page allocator. The old range
+    // stays mapped until the old backing store frees it, but reads as zeroes
+    // from now on.
+    if (!is_shared_ && free_on_destruct_ &&
+        base::OS::MovePages(buffer_start_, new_backing_store->buffer_start(),
+                            byte_length_)) {
+      TRACE_BS("BSw:move  bs=%p mem=%p -> bs=%p mem=%p (length=%zu)\n", this,
+               buffer_start_, new_backing_store.get(),
+               new_backing_store->buffer_start(), byte_length_.load());
+      return new_backing_store;
+    }
+#endif
     memcpy(new_backing_store->buffer_start(), buffer_start_, byte_length_);
   }
 
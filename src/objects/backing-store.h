@@ -119,9 +119,12 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
                                                size_t delta_pages,
                                                size_t max_pages);
 
-  // Allocate a new, larger, backing store for this Wasm memory and copy the
-  // contents of this backing store into it.
-  std::unique_ptr<BackingStore> CopyWasmMemory(Isolate* isolate,
+  // Allocate a new, larger, backing store for this Wasm memory and move the
+  // contents of this backing store into it. Afterwards the contents of this
+  // backing store are unspecified: its pages may have been moved out without
+  // copying, which leaves them zero-filled. It stays allocated and is freed as
+  // usual, but callers must detach any buffer using it right away.
+  std::unique_ptr<BackingStore> MoveWasmMemory(Isolate* isolate,
                                                size_t new_pages,
                                                size_t max_pages);
 
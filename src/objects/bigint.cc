@@ -1623,5 +1623,24 @@ void MutableBigInt_AbsoluteSubAndCanonicalize(Address result_addr,
   MutableBigInt::Canonicalize(result);
 }
 
+// Returns 0 on success. A non-zero result means that the multiplication was
+// interrupted and {result} holds no meaningful value; the caller has to redo
+// the operation on a path that can handle termination requests.
+int32_t MutableBigInt_AbsoluteMulAndCanonicalize(Address isolate_addr,
+                                                 Address result_addr,
+                                                 Address x_addr,
+                                                 Address y_addr) {
+  Isolate* isolate = reinterpret_cast<Isolate*>(isolate_addr);
+  BigInt x = BigInt::cast(Object(x_addr));
+  BigInt y = BigInt::cast(Object(y_addr));
+  MutableBigInt result = MutableBigInt::cast(Object(result_addr));
+
+  bigint::Status status = isolate->bigint_processor()->Multiply(
+      GetRWDigits(result), GetDigits(x), GetDigits(y));
+  if (status == bigint::Status::kInterrupted) return 1;
+  MutableBigInt::Canonicalize(result);
+  return 0;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -26,6 +26,9 @@ void MutableBigInt_AbsoluteAddAndCanonicalize(Address result_addr,
 int32_t MutableBigInt_AbsoluteCompare(Address x_addr, Address y_addr);
 void MutableBigInt_AbsoluteSubAndCanonicalize(Address result_addr,
                                               Address x_addr, Address y_addr);
+int32_t MutableBigInt_AbsoluteMulAndCanonicalize(Address isolate_addr,
+                                                 Address result_addr,
+                                                 Address x_addr, Address y_addr);
 
 class BigInt;
 class ValueDeserializer;
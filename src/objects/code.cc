@@ -156,10 +156,14 @@ void Code::ClearEmbeddedObjects(Heap* heap) {
 }
 
 void Code::Relocate(intptr_t delta) {
+  RelocateNoFlush(delta);
+  FlushICache();
+}
+
+void Code::RelocateNoFlush(intptr_t delta) {
   for (RelocIterator it(*this, RelocInfo::kApplyMask); !it.done(); it.next()) {
     it.rinfo()->apply(delta);
   }
-  FlushICache();
 }
 
 void Code::FlushICache() const {
@@ -535,6 +535,9 @@ class Code : public HeapObject {
   // Relocate the code by delta bytes. Called to signal that this code
   // object has been moved by delta bytes.
   void Relocate(intptr_t delta);
+  // Same as Relocate(), but the caller is responsible for flushing the
+  // instruction cache.
+  void RelocateNoFlush(intptr_t delta);
 
   // Migrate code from desc without flushing the instruction cache.
   void CopyFromNoFlush(ByteArray reloc_info, Heap* heap, const CodeDesc& desc);
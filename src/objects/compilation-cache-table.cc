@@ -4,6 +4,8 @@
 
 #include "src/objects/compilation-cache-table.h"
 
+#include <algorithm>
+
 #include "src/common/assert-scope.h"
 #include "src/objects/compilation-cache-table-inl.h"
 
@@ -20,6 +22,21 @@ const int kLiteralLiteralsOffset = 1;
 // The initial placeholder insertion of the eval cache survives this many GCs.
 const int kHashGenerations = 10;
 
+// Offset of the usage count in an entry, relative to the key.
+const int kUsageCountOffset = 3;
+STATIC_ASSERT(kUsageCountOffset < CompilationCacheShape::kEntrySize);
+
+// Usage counts saturate here, which bounds the number of rounds that
+// CompilationCacheTable::EvictUntil needs to evict any entry.
+const int kMaxUsageCount = 16;
+
+void RecordUsage(CompilationCacheTable table, int entry_index) {
+  int usage = Smi::ToInt(table.get(entry_index + kUsageCountOffset));
+  if (usage < kMaxUsageCount) {
+    table.set(entry_index + kUsageCountOffset, Smi::FromInt(usage + 1));
+  }
+}
+
 int SearchLiteralsMapEntry(CompilationCacheTable cache, int cache_entry,
                            Context native_context) {
   DisallowGarbageCollection no_gc;
@@ -257,6 +274,7 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheTable::LookupScript(
   }
   Object obj = table->get(index + 1);
   if (obj.IsSharedFunctionInfo()) {
+    RecordUsage(*table, index);
     return handle(SharedFunctionInfo::cast(obj), isolate);
   }
   return MaybeHandle<SharedFunctionInfo>();
@@ -278,8 +296,9 @@ InfoCellPair CompilationCacheTable::LookupEval(
   if (!table->get(index).IsFixedArray()) return empty_result;
   Object obj = table->get(index + 1);
   if (!obj.IsSharedFunctionInfo()) return empty_result;
+  RecordUsage(*table, index);
 
-  STATIC_ASSERT(CompilationCacheShape::kEntrySize == 3);
+  STATIC_ASSERT(CompilationCacheShape::kEntrySize == 4);
   FeedbackCell feedback_cell =
       SearchLiteralsMap(*table, index + 2, *native_context);
   return InfoCellPair(isolate, SharedFunctionInfo::cast(obj), feedback_cell);
@@ -302,10 +321,12 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutScript(
   src = String::Flatten(isolate, src);
   StringSharedKey key(src, language_mode);
   Handle<Object> k = key.AsHandle(isolate);
+  EnsureEntryLimit(cache);
   cache = EnsureCapacity(isolate, cache);
   InternalIndex entry = cache->FindInsertionEntry(isolate, key.Hash());
   cache->set(EntryToIndex(entry), *k);
   cache->set(EntryToIndex(entry) + 1, *value);
+  cache->set(EntryToIndex(entry) + kUsageCountOffset, Smi::zero());
   cache->ElementAdded();
   return cache;
 }
@@ -330,7 +351,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
       // AddToFeedbackCellsMap may allocate a new sub-array to live in the
       // entry, but it won't change the cache array. Therefore EntryToIndex
       // and entry remains correct.
-      STATIC_ASSERT(CompilationCacheShape::kEntrySize == 3);
+      STATIC_ASSERT(CompilationCacheShape::kEntrySize == 4);
       AddToFeedbackCellsMap(cache, EntryToIndex(entry) + 2, native_context,
                             feedback_cell);
       // Add hash again even on cache hit to avoid unnecessary cache delay in
@@ -339,12 +360,14 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
   }
 
   // Create a dummy entry to mark that this key has already been inserted once.
-  cache = EnsureCapacity(isolate, cache);
-  InternalIndex entry = cache->FindInsertionEntry(isolate, key.Hash());
   Handle<Object> k =
       isolate->factory()->NewNumber(static_cast<double>(key.Hash()));
+  EnsureEntryLimit(cache);
+  cache = EnsureCapacity(isolate, cache);
+  InternalIndex entry = cache->FindInsertionEntry(isolate, key.Hash());
   cache->set(EntryToIndex(entry), *k);
   cache->set(EntryToIndex(entry) + 1, Smi::FromInt(kHashGenerations));
+  cache->set(EntryToIndex(entry) + kUsageCountOffset, Smi::zero());
   cache->ElementAdded();
   return cache;
 }
@@ -359,6 +382,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutRegExp(
   // to the stored value with a custom IsMatch function during lookups.
   cache->set(EntryToIndex(entry), *value);
   cache->set(EntryToIndex(entry) + 1, *value);
+  cache->set(EntryToIndex(entry) + kUsageCountOffset, Smi::zero());
   cache->ElementAdded();
   return cache;
 }
@@ -387,15 +411,57 @@ void CompilationCacheTable::Age(Isolate* isolate) {
         NoWriteBarrierSet(*this, value_index, Smi::FromInt(new_count));
       }
     } else if (key.IsFixedArray()) {
-      // The ageing mechanism for script and eval caches.
+      // The ageing mechanism for script and eval caches. The usage counts
+      // of the surviving entries decay, so that EvictUntil prefers entries
+      // that were used recently.
       SharedFunctionInfo info = SharedFunctionInfo::cast(get(value_index));
       if (info.HasBytecodeArray() && info.GetBytecodeArray(isolate).IsOld()) {
         RemoveEntry(entry_index);
+      } else {
+        const int usage_index = entry_index + kUsageCountOffset;
+        const int usage = Smi::ToInt(get(usage_index));
+        NoWriteBarrierSet(*this, usage_index, Smi::FromInt(usage / 2));
       }
     }
   }
 }
 
+void CompilationCacheTable::EvictUntil(int max_entries) {
+  DisallowGarbageCollection no_gc;
+  while (true) {
+    for (InternalIndex entry : IterateEntries()) {
+      if (NumberOfElements() <= max_entries) return;
+      const int entry_index = EntryToIndex(entry);
+      Object key = get(entry_index);
+      if (!key.IsNumber() && !key.IsFixedArray()) continue;
+      if (get(entry_index + kUsageCountOffset) == Smi::zero()) {
+        RemoveEntry(entry_index);
+      }
+    }
+    if (NumberOfElements() <= max_entries) return;
+    // Not enough unused entries. Halving the usage counts makes every entry
+    // evictable after at most log2(kMaxUsageCount) + 1 rounds.
+    for (InternalIndex entry : IterateEntries()) {
+      const int entry_index = EntryToIndex(entry);
+      Object key = get(entry_index);
+      if (!key.IsNumber() && !key.IsFixedArray()) continue;
+      const int usage_index = entry_index + kUsageCountOffset;
+      const int usage = Smi::ToInt(get(usage_index));
+      NoWriteBarrierSet(*this, usage_index, Smi::FromInt(usage / 2));
+    }
+  }
+}
+
+// static
+void CompilationCacheTable::EnsureEntryLimit(
+    Handle<CompilationCacheTable> cache) {
+  const int max_entries = FLAG_compilation_cache_max_entries;
+  if (max_entries == 0 || cache->NumberOfElements() < max_entries) return;
+  // Evict a quarter of the entries at once, so that the cost of scanning
+  // the table is amortized over many insertions.
+  cache->EvictUntil(max_entries - std::max(1, max_entries / 4));
+}
+
 void CompilationCacheTable::Remove(Object value) {
   DisallowGarbageCollection no_gc;
   for (InternalIndex entry : IterateEntries()) {
@@ -43,8 +43,10 @@ class CompilationCacheShape : public BaseShape<HashTableKey*> {
   // An 'entry' is essentially a grouped collection of slots. Entries are used
   // in various ways by the different caches; most store the actual key in the
   // first entry slot, but it may also be used differently.
-  // Why 3 slots? Because of the eval cache.
-  static const int kEntrySize = 3;
+  // Why 4 slots? Because of the eval cache, which stores a literals map next
+  // to the key and the value. The last slot holds the usage count of script
+  // and eval entries.
+  static const int kEntrySize = 4;
   static const bool kMatchNeedsHoleCheck = true;
 };
 
@@ -126,11 +128,19 @@ class CompilationCacheTable
   void Remove(Object value);
   void Age(Isolate* isolate);
 
+  // Evicts entries until at most {max_entries} are left. Entries that were
+  // not used since they were added, or since their usage count last decayed,
+  // go first. Usage counts decay on every GC that ages the table.
+  void EvictUntil(int max_entries);
+
   DECL_CAST(CompilationCacheTable)
 
  private:
   void RemoveEntry(int entry_index);
 
+  // Evicts entries if the table has reached --compilation-cache-max-entries.
+  static void EnsureEntryLimit(Handle<CompilationCacheTable> cache);
+
   OBJECT_CONSTRUCTORS(CompilationCacheTable,
                       HashTable<CompilationCacheTable, CompilationCacheShape>);
 };
@@ -388,9 +388,11 @@ void FeedbackVector::SaturatingIncrementProfilerTicks() {
 
 void FeedbackVector::SetOptimizedCode(Handle<CodeT> code) {
   DCHECK(CodeKindIsOptimizedJSFunction(code->kind()));
-  // We should set optimized code only when there is no valid optimized code.
+  // We should set optimized code only when there is no valid optimized code,
+  // or when tiering up from lower-tier (i.e. Maglev) optimized code.
   DCHECK(!has_optimized_code() ||
          optimized_code().marked_for_deoptimization() ||
+         optimized_code().kind() < code->kind() ||
          FLAG_stress_concurrent_inlining_attach_code);
   // TODO(mythria): We could see a CompileOptimized state here either from
   // tests that use %OptimizeFunctionOnNextCall, --always-opt or because we
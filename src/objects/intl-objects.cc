@@ -864,6 +864,26 @@ Maybe<std::vector<std::string>> Intl::CanonicalizeLocaleList(
   return Just(seen);
 }
 
+namespace {
+
+// The special casing rules of az, el, lt and tr only apply to non-ASCII
+// characters, except for the dotted and dotless i of az and tr. Strings that
+// avoid those can use the fast root locale paths.
+bool HasRootLocaleCaseMapping(Handle<String> s, const std::string& language) {
+  DCHECK(s->IsFlat());
+  const bool has_turkic_i = language == "tr" || language == "az";
+  DisallowGarbageCollection no_gc;
+  String::FlatContent flat = s->GetFlatContent(no_gc);
+  if (!flat.IsOneByte()) return false;
+  base::Vector<const uint8_t> chars = flat.ToOneByteVector();
+  if (!String::IsAscii(chars.begin(), chars.length())) return false;
+  if (!has_turkic_i) return true;
+  return std::none_of(chars.begin(), chars.end(),
+                      [](uint8_t c) { return (c | 0x20) == 'i'; });
+}
+
+}  // namespace
+
 // ecma402 #sup-string.prototype.tolocalelowercase
 // ecma402 #sup-string.prototype.tolocaleuppercase
 MaybeHandle<String> Intl::StringLocaleConvertCase(Isolate* isolate,
@@ -897,12 +917,9 @@ MaybeHandle<String> Intl::StringLocaleConvertCase(Isolate* isolate,
     }
     return ConvertToLower(isolate, s);
   }
-  // TODO(jshin): Consider adding a fast path for ASCII or Latin-1. The fastpath
-  // in the root locale needs to be adjusted for az, lt and tr because even case
-  // mapping of ASCII range characters are different in those locales.
-  // Greek (el) does not require any adjustment.
   if (V8_UNLIKELY((requested_locale == "tr") || (requested_locale == "el") ||
-                  (requested_locale == "lt") || (requested_locale == "az"))) {
+                  (requested_locale == "lt") || (requested_locale == "az")) &&
+      !HasRootLocaleCaseMapping(s, requested_locale)) {
     return LocaleConvertCase(isolate, s, to_upper, requested_locale.c_str());
   } else {
     if (to_upper) {
@@ -912,6 +929,77 @@ MaybeHandle<String> Intl::StringLocaleConvertCase(Isolate* isolate,
   }
 }
 
+namespace {
+
+// Lists all of the available locales that are statically known to fulfill
+// fast path conditions. See the StringLocaleCompareFastPath test as a
+// starting point to update this list.
+//
+// Locale entries are roughly sorted s.t. common locales come first.
+//
+// The actual conditions are verified in debug builds in
+// CollatorAllowsFastComparison.
+const char* const kFastLocales[] = {
+    "en-US", "en", "fr", "es",    "de",    "pt",    "it", "ca",
+    "de-AT", "fi", "id", "id-ID", "ms",    "nl",    "pl", "ro",
+    "sl",    "sv", "sw", "vi",    "en-DE", "en-GB",
+};
+
+bool IsFastLocale(const std::string& locale) {
+  for (const char* fast_locale : kFastLocales) {
+    if (strcmp(fast_locale, locale.c_str()) == 0) return true;
+  }
+  return false;
+}
+
+// Checks the settings that options and -u- extensions may change on a
+// collator for one of the kFastLocales. These must match the defaults that
+// the fast path weights were computed for.
+bool CollatorHasDefaultSettings(const icu::Collator& icu_collator) {
+  UErrorCode status = U_ZERO_ERROR;
+
+  icu::Locale icu_locale(icu_collator.getLocale(ULOC_VALID_LOCALE, status));
+  DCHECK(U_SUCCESS(status));
+
+  static constexpr int kBufferSize = 64;
+  char buffer[kBufferSize];
+  const int collation_keyword_length =
+      icu_locale.getKeywordValue("collation", buffer, kBufferSize, status);
+  DCHECK(U_SUCCESS(status));
+  if (collation_keyword_length != 0) return false;
+
+  // These attributes must be set to the expected value for fast comparisons.
+  static constexpr struct {
+    UColAttribute attribute;
+    UColAttributeValue legal_value;
+  } kAttributeChecks[] = {
+      {UCOL_ALTERNATE_HANDLING, UCOL_NON_IGNORABLE},
+      {UCOL_CASE_FIRST, UCOL_OFF},
+      {UCOL_CASE_LEVEL, UCOL_OFF},
+      {UCOL_FRENCH_COLLATION, UCOL_OFF},
+      {UCOL_NUMERIC_COLLATION, UCOL_OFF},
+      {UCOL_STRENGTH, UCOL_TERTIARY},
+  };
+
+  for (const auto& check : kAttributeChecks) {
+    if (icu_collator.getAttribute(check.attribute, status) !=
+        check.legal_value) {
+      return false;
+    }
+    DCHECK(U_SUCCESS(status));
+  }
+
+  // No reordering codes are allowed.
+  int num_reorder_codes =
+      ucol_getReorderCodes(icu_collator.toUCollator(), nullptr, 0, &status);
+  if (num_reorder_codes != 0) return false;
+  DCHECK(U_SUCCESS(status));  // Must check *after* num_reorder_codes != 0.
+
+  return true;
+}
+
+}  // namespace
+
 // static
 template <class IsolateT>
 Intl::CompareStringsOptions Intl::CompareStringsOptionsFor(
@@ -920,29 +1008,10 @@ Intl::CompareStringsOptions Intl::CompareStringsOptionsFor(
     return CompareStringsOptions::kNone;
   }
 
-  // Lists all of the available locales that are statically known to fulfill
-  // fast path conditions. See the StringLocaleCompareFastPath test as a
-  // starting point to update this list.
-  //
-  // Locale entries are roughly sorted s.t. common locales come first.
-  //
-  // The actual conditions are verified in debug builds in
-  // CollatorAllowsFastComparison.
-  static const char* const kFastLocales[] = {
-      "en-US", "en", "fr", "es",    "de",    "pt",    "it", "ca",
-      "de-AT", "fi", "id", "id-ID", "ms",    "nl",    "pl", "ro",
-      "sl",    "sv", "sw", "vi",    "en-DE", "en-GB",
-  };
-
   if (locales->IsUndefined(isolate)) {
-    const std::string& default_locale = isolate->DefaultLocale();
-    for (const char* fast_locale : kFastLocales) {
-      if (strcmp(fast_locale, default_locale.c_str()) == 0) {
-        return CompareStringsOptions::kTryFastPath;
-      }
-    }
-
-    return CompareStringsOptions::kNone;
+    return IsFastLocale(isolate->DefaultLocale())
+               ? CompareStringsOptions::kTryFastPath
+               : CompareStringsOptions::kNone;
   }
 
   if (!locales->IsString()) return CompareStringsOptions::kNone;
@@ -963,6 +1032,15 @@ template Intl::CompareStringsOptions Intl::CompareStringsOptionsFor(
 template Intl::CompareStringsOptions Intl::CompareStringsOptionsFor(
     LocalIsolate*, Handle<Object>, Handle<Object>);
 
+// static
+Intl::CompareStringsOptions Intl::CompareStringsOptionsFor(
+    const icu::Collator& icu_collator, const std::string& locale) {
+  if (!IsFastLocale(locale) || !CollatorHasDefaultSettings(icu_collator)) {
+    return CompareStringsOptions::kNone;
+  }
+  return CompareStringsOptions::kTryFastPath;
+}
+
 base::Optional<int> Intl::StringLocaleCompare(
     Isolate* isolate, Handle<String> string1, Handle<String> string2,
     Handle<Object> locales, Handle<Object> options, const char* method_name) {
@@ -1003,8 +1081,11 @@ base::Optional<int> Intl::StringLocaleCompare(
         std::static_pointer_cast<icu::UMemory>(collator->icu_collator().get()));
   }
   icu::Collator* icu_collator = collator->icu_collator().raw();
+  // The options may still have resolved to the defaults.
   return Intl::CompareStrings(isolate, *icu_collator, string1, string2,
-                              compare_strings_options);
+                              collator->try_fast_compare()
+                                  ? CompareStringsOptions::kTryFastPath
+                                  : compare_strings_options);
 }
 
 namespace {
@@ -1218,44 +1299,9 @@ bool USetContainsAllAsciiItem(USet* set) {
 }
 
 bool CollatorAllowsFastComparison(const icu::Collator& icu_collator) {
-  UErrorCode status = U_ZERO_ERROR;
-
-  icu::Locale icu_locale(icu_collator.getLocale(ULOC_VALID_LOCALE, status));
-  DCHECK(U_SUCCESS(status));
-
-  static constexpr int kBufferSize = 64;
-  char buffer[kBufferSize];
-  const int collation_keyword_length =
-      icu_locale.getKeywordValue("collation", buffer, kBufferSize, status);
-  DCHECK(U_SUCCESS(status));
-  if (collation_keyword_length != 0) return false;
-
-  // These attributes must be set to the expected value for fast comparisons.
-  static constexpr struct {
-    UColAttribute attribute;
-    UColAttributeValue legal_value;
-  } kAttributeChecks[] = {
-      {UCOL_ALTERNATE_HANDLING, UCOL_NON_IGNORABLE},
-      {UCOL_CASE_FIRST, UCOL_OFF},
-      {UCOL_CASE_LEVEL, UCOL_OFF},
-      {UCOL_FRENCH_COLLATION, UCOL_OFF},
-      {UCOL_NUMERIC_COLLATION, UCOL_OFF},
-      {UCOL_STRENGTH, UCOL_TERTIARY},
-  };
+  if (!CollatorHasDefaultSettings(icu_collator)) return false;
 
-  for (const auto& check : kAttributeChecks) {
-    if (icu_collator.getAttribute(check.attribute, status) !=
-        check.legal_value) {
-      return false;
-    }
-    DCHECK(U_SUCCESS(status));
-  }
-
-  // No reordering codes are allowed.
-  int num_reorder_codes =
-      ucol_getReorderCodes(icu_collator.toUCollator(), nullptr, 0, &status);
-  if (num_reorder_codes != 0) return false;
-  DCHECK(U_SUCCESS(status));  // Must check *after* num_reorder_codes != 0.
+  UErrorCode status = U_ZERO_ERROR;
 
   // No tailored rules are allowed.
   int32_t rules_length = 0;
@@ -135,6 +135,10 @@ class Intl {
   template <class IsolateT>
   V8_EXPORT_PRIVATE static CompareStringsOptions CompareStringsOptionsFor(
       IsolateT* isolate, Handle<Object> locales, Handle<Object> options);
+  // As above, but for a collator that has already been created for the
+  // resolved {locale}, with all options applied to {icu_collator}.
+  V8_EXPORT_PRIVATE static CompareStringsOptions CompareStringsOptionsFor(
+      const icu::Collator& icu_collator, const std::string& locale);
   V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT static int CompareStrings(
       Isolate* isolate, const icu::Collator& collator, Handle<String> s1,
       Handle<String> s2,
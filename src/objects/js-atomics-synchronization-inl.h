@@ -0,0 +1,94 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_JS_ATOMICS_SYNCHRONIZATION_INL_H_
+#define V8_OBJECTS_JS_ATOMICS_SYNCHRONIZATION_INL_H_
+
+#include "src/common/assert-scope.h"
+#include "src/common/globals.h"
+#include "src/heap/heap-write-barrier-inl.h"
+#include "src/objects/js-atomics-synchronization.h"
+#include "src/objects/smi-inl.h"
+
+// Has to be the last include (doesn't have include guards):
+#include "src/objects/object-macros.h"
+
+namespace v8 {
+namespace internal {
+
+#include "torque-generated/src/objects/js-atomics-synchronization-tq-inl.inc"
+
+TQ_OBJECT_CONSTRUCTORS_IMPL(JSSynchronizationPrimitive)
+
+Tagged_t* JSSynchronizationPrimitive::state_location() {
+  return reinterpret_cast<Tagged_t*>(field_address(kStateOffset));
+}
+
+int JSSynchronizationPrimitive::AcquireLoadState() {
+  Tagged_t state = AsAtomicTagged::Acquire_Load(state_location());
+  return Smi(static_cast<Address>(state)).value();
+}
+
+void JSSynchronizationPrimitive::ReleaseStoreState(int state) {
+  AsAtomicTagged::Release_Store(
+      state_location(), static_cast<Tagged_t>(Smi::FromInt(state).ptr()));
+}
+
+bool JSSynchronizationPrimitive::CompareAndSwapState(int expected,
+                                                     int desired) {
+  Tagged_t old_value = static_cast<Tagged_t>(Smi::FromInt(expected).ptr());
+  Tagged_t new_value = static_cast<Tagged_t>(Smi::FromInt(desired).ptr());
+  return AsAtomicTagged::AcquireRelease_CompareAndSwap(
+             state_location(), old_value, new_value) == old_value;
+}
+
+TQ_OBJECT_CONSTRUCTORS_IMPL(JSAtomicsMutex)
+
+CAST_ACCESSOR(JSAtomicsMutex)
+
+JSAtomicsMutex::LockGuard::LockGuard(Isolate* isolate,
+                                     Handle<JSAtomicsMutex> mutex)
+    : isolate_(isolate), mutex_(mutex) {
+  JSAtomicsMutex::Lock(isolate, mutex);
+}
+
+JSAtomicsMutex::LockGuard::~LockGuard() { mutex_->Unlock(isolate_); }
+
+// static
+void JSAtomicsMutex::Lock(Isolate* isolate, Handle<JSAtomicsMutex> mutex) {
+  if (V8_LIKELY(mutex->CompareAndSwapState(0, kIsLockedBit))) return;
+  LockSlowPath(isolate, mutex);
+}
+
+bool JSAtomicsMutex::TryLock() {
+  DisallowGarbageCollection no_gc;
+  int state = AcquireLoadState();
+  while ((state & kIsLockedBit) == 0) {
+    if (CompareAndSwapState(state, state | kIsLockedBit)) return true;
+    state = AcquireLoadState();
+  }
+  return false;
+}
+
+void JSAtomicsMutex::Unlock(Isolate* isolate) {
+  DisallowGarbageCollection no_gc;
+  DCHECK(IsHeld());
+  if (V8_LIKELY(CompareAndSwapState(kIsLockedBit, 0))) return;
+  UnlockSlowPath(isolate);
+}
+
+bool JSAtomicsMutex::IsHeld() {
+  return (AcquireLoadState() & kIsLockedBit) != 0;
+}
+
+TQ_OBJECT_CONSTRUCTORS_IMPL(JSAtomicsCondition)
+
+CAST_ACCESSOR(JSAtomicsCondition)
+
+}  // namespace internal
+}  // namespace v8
+
+#include "src/objects/object-macros-undef.h"
+
+#endif  // V8_OBJECTS_JS_ATOMICS_SYNCHRONIZATION_INL_H_
@@ -0,0 +1,248 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/js-atomics-synchronization.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <unordered_map>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/yield-processor.h"
+#include "src/execution/isolate-inl.h"
+#include "src/heap/factory.h"
+#include "src/heap/parked-scope.h"
+#include "src/objects/js-atomics-synchronization-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// A thread that blocks on a synchronization primitive enqueues one of these,
+// allocated on its own stack, and waits on its condition variable until
+// another thread sets {should_wake}.
+struct WaiterQueueNode {
+  base::ConditionVariable cond;
+  bool should_wake = false;
+};
+
+// The waiter queues of all synchronization primitives in the process. A
+// primitive only has an entry while some thread is waiting on it, so the
+// table does not need to know about primitives dying.
+class WaiterQueueTable {
+ public:
+  void Enqueue(int id, WaiterQueueNode* node) {
+    queues_[id].push_back(node);
+  }
+
+  // Removes the oldest waiter on {id} and returns it, or returns nullptr if
+  // there is none. {is_empty} is set to whether the queue is drained.
+  WaiterQueueNode* Dequeue(int id, bool* is_empty) {
+    auto it = queues_.find(id);
+    if (it == queues_.end()) {
+      *is_empty = true;
+      return nullptr;
+    }
+    WaiterQueueNode* node = it->second.front();
+    it->second.pop_front();
+    *is_empty = it->second.empty();
+    if (*is_empty) queues_.erase(it);
+    return node;
+  }
+
+  // Removes {node}, whose wait timed out, from the queue of {id}.
+  void Remove(int id, WaiterQueueNode* node) {
+    auto it = queues_.find(id);
+    DCHECK(it != queues_.end());
+    std::deque<WaiterQueueNode*>& queue = it->second;
+    queue.erase(std::find(queue.begin(), queue.end(), node));
+    if (queue.empty()) queues_.erase(it);
+  }
+
+ private:
+  std::unordered_map<int, std::deque<WaiterQueueNode*>> queues_;
+};
+
+// `g_mutex` protects `g_waiter_queues`, the `should_wake` fields of the nodes
+// in it, and all updates of the kHasWaitersBit of primitives. It must be the
+// mutex used together with the `cond` condition variable of the nodes.
+base::LazyMutex g_mutex = LAZY_MUTEX_INITIALIZER;
+base::LazyInstance<WaiterQueueTable>::type g_waiter_queues =
+    LAZY_INSTANCE_INITIALIZER;
+
+std::atomic<int> g_next_waiter_queue_id{0};
+
+// Parks the current thread until {node} is woken up or {timeout} has passed.
+// Returns whether {node} was woken up. The caller must not touch the heap
+// while inside this function, since the GC may run concurrently.
+bool WaitOnNode(Isolate* isolate, WaiterQueueNode* node,
+                base::Optional<base::TimeDelta> timeout) {
+  ParkedScope parked(isolate->main_thread_local_heap());
+  base::MutexGuard guard(g_mutex.Pointer());
+  if (!timeout.has_value()) {
+    while (!node->should_wake) node->cond.Wait(g_mutex.Pointer());
+    return true;
+  }
+  base::TimeTicks deadline = base::TimeTicks::Now() + *timeout;
+  while (!node->should_wake) {
+    base::TimeDelta remaining = deadline - base::TimeTicks::Now();
+    if (remaining <= base::TimeDelta()) break;
+    // Spurious wakeups are handled by re-checking {should_wake}.
+    USE(node->cond.WaitFor(g_mutex.Pointer(), remaining));
+  }
+  return node->should_wake;
+}
+
+// Must be called with `g_mutex` held. The node is on the stack of the woken
+// thread, which cannot return before it has reacquired `g_mutex`.
+void WakeNode(WaiterQueueNode* node) {
+  node->should_wake = true;
+  node->cond.NotifyOne();
+}
+
+Handle<JSObject> NewSynchronizationPrimitive(Isolate* isolate,
+                                             Handle<Map> map) {
+  DCHECK(map->InSharedHeap());
+  Handle<JSObject> object =
+      isolate->factory()->NewJSObjectFromMap(map, AllocationType::kSharedOld);
+  DisallowGarbageCollection no_gc;
+  JSSynchronizationPrimitive primitive =
+      JSSynchronizationPrimitive::cast(*object);
+  primitive.set_state(Smi::zero());
+  primitive.set_waiter_queue_id(
+      Smi::FromInt(JSSynchronizationPrimitive::NextWaiterQueueId()));
+  return object;
+}
+
+}  // namespace
+
+// static
+int JSSynchronizationPrimitive::NextWaiterQueueId() {
+  // Ids only need to be distinct among the primitives that are alive at the
+  // same time, so wrapping around after Smi::kMaxValue is fine in practice.
+  int id = g_next_waiter_queue_id.fetch_add(1, std::memory_order_relaxed);
+  return id & Smi::kMaxValue;
+}
+
+// static
+Handle<JSAtomicsMutex> JSAtomicsMutex::Create(Isolate* isolate) {
+  Handle<Map> map(isolate->native_context()->js_atomics_mutex_map(), isolate);
+  return Handle<JSAtomicsMutex>::cast(
+      NewSynchronizationPrimitive(isolate, map));
+}
+
+bool JSAtomicsMutex::TryLockOrMarkHasWaiters() {
+  g_mutex.Pointer()->AssertHeld();
+  int state = AcquireLoadState();
+  for (;;) {
+    if ((state & kIsLockedBit) == 0) {
+      if (CompareAndSwapState(state, state | kIsLockedBit)) return true;
+    } else if ((state & kHasWaitersBit) != 0 ||
+               CompareAndSwapState(state, state | kHasWaitersBit)) {
+      return false;
+    }
+    state = AcquireLoadState();
+  }
+}
+
+// static
+void JSAtomicsMutex::LockSlowPath(Isolate* isolate,
+                                  Handle<JSAtomicsMutex> mutex) {
+  // Critical sections are expected to be short, so spin for a bit before
+  // paying for parking the thread.
+  for (int i = 0; i < kSpinCount; i++) {
+    if (mutex->TryLock()) return;
+    YIELD_PROCESSOR;
+  }
+
+  int id = mutex->waiter_queue_id().value();
+  for (;;) {
+    WaiterQueueNode node;
+    {
+      NoGarbageCollectionMutexGuard guard(g_mutex.Pointer());
+      if (mutex->TryLockOrMarkHasWaiters()) return;
+      g_waiter_queues.Pointer()->Enqueue(id, &node);
+    }
+    WaitOnNode(isolate, &node, base::nullopt);
+    // The unlocker does not hand the lock over, so compete for it again.
+    // This lets running threads barge ahead of woken ones, which keeps the
+    // lock throughput high under contention.
+    if (mutex->TryLock()) return;
+  }
+}
+
+void JSAtomicsMutex::UnlockSlowPath(Isolate* isolate) {
+  NoGarbageCollectionMutexGuard guard(g_mutex.Pointer());
+  bool is_empty;
+  WaiterQueueNode* node =
+      g_waiter_queues.Pointer()->Dequeue(waiter_queue_id().value(), &is_empty);
+  // The lock is held, and the waiters bit only changes under `g_mutex`, so
+  // nobody else can update the state concurrently.
+  ReleaseStoreState(is_empty ? 0 : kHasWaitersBit);
+  if (node != nullptr) WakeNode(node);
+}
+
+// static
+Handle<JSAtomicsCondition> JSAtomicsCondition::Create(Isolate* isolate) {
+  Handle<Map> map(isolate->native_context()->js_atomics_condition_map(),
+                  isolate);
+  return Handle<JSAtomicsCondition>::cast(
+      NewSynchronizationPrimitive(isolate, map));
+}
+
+// static
+bool JSAtomicsCondition::WaitFor(Isolate* isolate,
+                                 Handle<JSAtomicsCondition> cv,
+                                 Handle<JSAtomicsMutex> mutex,
+                                 base::Optional<base::TimeDelta> timeout) {
+  DCHECK(mutex->IsHeld());
+  int id = cv->waiter_queue_id().value();
+  WaiterQueueNode node;
+  {
+    // Enqueue before releasing the mutex, so that a notification sent by the
+    // next owner of the mutex cannot be missed.
+    NoGarbageCollectionMutexGuard guard(g_mutex.Pointer());
+    g_waiter_queues.Pointer()->Enqueue(id, &node);
+    cv->ReleaseStoreState(kHasWaitersBit);
+  }
+  mutex->Unlock(isolate);
+
+  bool woken = WaitOnNode(isolate, &node, timeout);
+  if (!woken) {
+    base::MutexGuard guard(g_mutex.Pointer());
+    // A notification may have come in since the wait timed out.
+    woken = node.should_wake;
+    if (!woken) g_waiter_queues.Pointer()->Remove(id, &node);
+    // A stale kHasWaitersBit is harmless; the next Notify clears it.
+  }
+
+  JSAtomicsMutex::Lock(isolate, mutex);
+  return woken;
+}
+
+uint32_t JSAtomicsCondition::Notify(Isolate* isolate, uint32_t count) {
+  // Fast path: nobody is waiting.
+  if ((AcquireLoadState() & kHasWaitersBit) == 0) return 0;
+
+  NoGarbageCollectionMutexGuard guard(g_mutex.Pointer());
+  int id = waiter_queue_id().value();
+  uint32_t num_woken = 0;
+  bool is_empty = false;
+  while (num_woken < count) {
+    WaiterQueueNode* node = g_waiter_queues.Pointer()->Dequeue(id, &is_empty);
+    if (node == nullptr) break;
+    WakeNode(node);
+    num_woken++;
+    if (is_empty) break;
+  }
+  if (is_empty) ReleaseStoreState(0);
+  return num_woken;
+}
+
+}  // namespace internal
+}  // namespace v8
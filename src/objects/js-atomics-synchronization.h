@@ -0,0 +1,137 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_JS_ATOMICS_SYNCHRONIZATION_H_
+#define V8_OBJECTS_JS_ATOMICS_SYNCHRONIZATION_H_
+
+#include "src/base/optional.h"
+#include "src/base/platform/time.h"
+#include "src/objects/js-objects.h"
+
+// Has to be the last include (doesn't have include guards):
+#include "src/objects/object-macros.h"
+
+namespace v8 {
+namespace internal {
+
+#include "torque-generated/src/objects/js-atomics-synchronization-tq.inc"
+
+// Base class for the synchronization primitives that live in the shared heap
+// and may be used from multiple isolates at once.
+//
+// The state is a Smi-encoded bit field that is only ever updated with atomic
+// operations, so the uncontended paths never leave user space. Threads that
+// have to block are queued on a process-wide table of waiter queues, keyed by
+// the primitive's waiter queue id, and parked on a condition variable.
+class JSSynchronizationPrimitive
+    : public TorqueGeneratedJSSynchronizationPrimitive<
+          JSSynchronizationPrimitive, JSObject> {
+ public:
+  // Set while the mutex is held. Unused by conditions.
+  static constexpr int kIsLockedBit = 1 << 0;
+  // Set while the waiter queue of the primitive may be non-empty. Only ever
+  // set while holding the waiter queue table's lock.
+  static constexpr int kHasWaitersBit = 1 << 1;
+
+  // Returns a fresh id for the waiter queue of a new primitive.
+  static int NextWaiterQueueId();
+
+  TQ_OBJECT_CONSTRUCTORS(JSSynchronizationPrimitive)
+
+ protected:
+  inline int AcquireLoadState();
+  inline void ReleaseStoreState(int state);
+  // Atomically replaces {expected} by {desired}. Returns whether the state
+  // was {expected}.
+  inline bool CompareAndSwapState(int expected, int desired);
+
+ private:
+  inline Tagged_t* state_location();
+};
+
+// A non-recursive mutex that is exposed to JS as Atomics.Mutex.
+//
+// Lock acquisition is a single compare-and-swap when uncontended. Contended
+// lockers spin for a short while before parking, and unlocking wakes one
+// waiter, which then competes for the lock again.
+class JSAtomicsMutex
+    : public TorqueGeneratedJSAtomicsMutex<JSAtomicsMutex,
+                                           JSSynchronizationPrimitive> {
+ public:
+  // Locks the mutex for the lifetime of the guard.
+  class V8_NODISCARD LockGuard {
+   public:
+    inline LockGuard(Isolate* isolate, Handle<JSAtomicsMutex> mutex);
+    inline ~LockGuard();
+    LockGuard(const LockGuard&) = delete;
+    LockGuard& operator=(const LockGuard&) = delete;
+
+   private:
+    Isolate* isolate_;
+    Handle<JSAtomicsMutex> mutex_;
+  };
+
+  DECL_CAST(JSAtomicsMutex)
+  DECL_PRINTER(JSAtomicsMutex)
+  EXPORT_DECL_VERIFIER(JSAtomicsMutex)
+
+  static Handle<JSAtomicsMutex> Create(Isolate* isolate);
+
+  // Blocks the current thread until the mutex is acquired.
+  static inline void Lock(Isolate* isolate, Handle<JSAtomicsMutex> mutex);
+
+  // Acquires the mutex if it is free. Never blocks.
+  inline bool TryLock();
+
+  inline void Unlock(Isolate* isolate);
+
+  inline bool IsHeld();
+
+  TQ_OBJECT_CONSTRUCTORS(JSAtomicsMutex)
+
+ private:
+  // Spin this many times on a contended lock before parking the thread.
+  static constexpr int kSpinCount = 64;
+
+  V8_EXPORT_PRIVATE static void LockSlowPath(Isolate* isolate,
+                                             Handle<JSAtomicsMutex> mutex);
+  V8_EXPORT_PRIVATE void UnlockSlowPath(Isolate* isolate);
+
+  // Must be called with the waiter queue table's lock held. Acquires the
+  // mutex if it is free, and otherwise marks it as having waiters.
+  bool TryLockOrMarkHasWaiters();
+};
+
+// A condition variable that is exposed to JS as Atomics.Condition.
+class JSAtomicsCondition
+    : public TorqueGeneratedJSAtomicsCondition<JSAtomicsCondition,
+                                               JSSynchronizationPrimitive> {
+ public:
+  DECL_CAST(JSAtomicsCondition)
+  DECL_PRINTER(JSAtomicsCondition)
+  EXPORT_DECL_VERIFIER(JSAtomicsCondition)
+
+  static Handle<JSAtomicsCondition> Create(Isolate* isolate);
+
+  // Releases {mutex}, which must be held, waits until notified or until
+  // {timeout} has passed, and reacquires {mutex}. Returns false iff the wait
+  // timed out.
+  V8_EXPORT_PRIVATE static bool WaitFor(
+      Isolate* isolate, Handle<JSAtomicsCondition> cv,
+      Handle<JSAtomicsMutex> mutex, base::Optional<base::TimeDelta> timeout);
+
+  static constexpr uint32_t kAllWaiters = UINT32_MAX;
+
+  // Wakes up to {count} waiters and returns the number of waiters woken.
+  V8_EXPORT_PRIVATE uint32_t Notify(Isolate* isolate, uint32_t count);
+
+  TQ_OBJECT_CONSTRUCTORS(JSAtomicsCondition)
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#include "src/objects/object-macros-undef.h"
+
+#endif  // V8_OBJECTS_JS_ATOMICS_SYNCHRONIZATION_H_
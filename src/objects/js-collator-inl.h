@@ -24,6 +24,9 @@ TQ_OBJECT_CONSTRUCTORS_IMPL(JSCollator)
 
 ACCESSORS(JSCollator, icu_collator, Managed<icu::Collator>, kIcuCollatorOffset)
 
+BOOL_ACCESSORS(JSCollator, flags, try_fast_compare,
+               TryFastCompareBit::kShift)
+
 }  // namespace internal
 }  // namespace v8
 
@@ -8,6 +8,12 @@
 
 #include "src/objects/js-collator.h"
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/execution/isolate.h"
 #include "src/objects/js-collator-inl.h"
 #include "src/objects/js-locale.h"
@@ -255,6 +261,41 @@ UColAttributeValue ToUColAttributeValue(CaseFirst case_first) {
   }
 }
 
+// Opening a collator loads and parses the tailoring of its locale, so keep
+// pristine instances around and hand out clones, which only copy the
+// attribute settings and share the immutable tailoring data.
+class CollatorCache {
+ public:
+  icu::Collator* Create(const icu::Locale& icu_locale, UErrorCode& status) {
+    std::string key(icu_locale.getName());
+
+    base::MutexGuard guard(&mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) return it->second->clone();
+
+    if (map_.size() > 8) {  // Cache at most 8 Collators.
+      map_.clear();
+    }
+    std::unique_ptr<icu::Collator> instance(
+        icu::Collator::createInstance(icu_locale, status));
+    if (U_FAILURE(status) || instance.get() == nullptr) return nullptr;
+    map_[key] = std::move(instance);
+    return map_[key]->clone();
+  }
+
+ private:
+  std::map<std::string, std::unique_ptr<icu::Collator>> map_;
+  base::Mutex mutex_;
+};
+
+std::unique_ptr<icu::Collator> CreateICUCollatorFromCache(
+    const icu::Locale& icu_locale, UErrorCode& status) {
+  static base::LazyInstance<CollatorCache>::type cache =
+      LAZY_INSTANCE_INITIALIZER;
+  return std::unique_ptr<icu::Collator>(
+      cache.Pointer()->Create(icu_locale, status));
+}
+
 void SetNumericOption(icu::Collator* icu_collator, bool numeric) {
   DCHECK_NOT_NULL(icu_collator);
   UErrorCode status = U_ZERO_ERROR;
@@ -419,14 +460,13 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
   // here. The collation value can be looked up from icu::Collator on
   // demand, as part of Intl.Collator.prototype.resolvedOptions.
 
-  std::unique_ptr<icu::Collator> icu_collator(
-      icu::Collator::createInstance(icu_locale, status));
+  std::unique_ptr<icu::Collator> icu_collator =
+      CreateICUCollatorFromCache(icu_locale, status);
   if (U_FAILURE(status) || icu_collator.get() == nullptr) {
     status = U_ZERO_ERROR;
     // Remove extensions and try again.
     icu::Locale no_extension_locale(icu_locale.getBaseName());
-    icu_collator.reset(
-        icu::Collator::createInstance(no_extension_locale, status));
+    icu_collator = CreateICUCollatorFromCache(no_extension_locale, status);
 
     if (U_FAILURE(status) || icu_collator.get() == nullptr) {
       THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError),
@@ -531,6 +571,10 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
     DCHECK(U_SUCCESS(status));
   }
 
+  const bool try_fast_compare =
+      Intl::CompareStringsOptionsFor(*icu_collator, r.locale) ==
+      Intl::CompareStringsOptions::kTryFastPath;
+
   Handle<Managed<icu::Collator>> managed_collator =
       Managed<icu::Collator>::FromUniquePtr(isolate, 0,
                                             std::move(icu_collator));
@@ -544,6 +588,8 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
   DisallowGarbageCollection no_gc;
   collator->set_icu_collator(*managed_collator);
   collator->set_locale(*locale_str);
+  collator->set_flags(0);
+  collator->set_try_fast_compare(try_fast_compare);
 
   // 29. Return collator.
   return collator;
@@ -48,6 +48,11 @@ class JSCollator : public TorqueGeneratedJSCollator<JSCollator, JSObject> {
 
   DECL_ACCESSORS(icu_collator, Managed<icu::Collator>)
 
+  DECL_BOOLEAN_ACCESSORS(try_fast_compare)
+
+  // Bit positions in |flags|.
+  DEFINE_TORQUE_GENERATED_JS_COLLATOR_FLAGS()
+
   TQ_OBJECT_CONSTRUCTORS(JSCollator)
 };
 
@@ -258,6 +258,49 @@ bool JSFunction::NeedsResetDueToFlushedBytecode() {
   return !shared.is_compiled() && code.builtin_id() != Builtin::kCompileLazy;
 }
 
+bool JSFunction::NeedsResetDueToColdFeedback(
+    base::EnumSet<CodeFlushMode> code_flush_mode) {
+  if (!FLAG_flush_cold_feedback || IsFlushingDisabled(code_flush_mode)) {
+    return false;
+  }
+  // See NeedsResetDueToFlushedBytecode for why the fields are read this way.
+  Object maybe_shared = ACQUIRE_READ_FIELD(*this, kSharedFunctionInfoOffset);
+  if (!maybe_shared.IsSharedFunctionInfo()) return false;
+
+  // Baseline and optimized code rely on the feedback vector being present.
+  Object maybe_code = ACQUIRE_READ_FIELD(*this, kCodeOffset);
+  if (!maybe_code.IsCodeT()) return false;
+  CodeT code = CodeT::cast(maybe_code);
+  if (code.builtin_id() != Builtin::kInterpreterEntryTrampoline) return false;
+
+  Object maybe_cell = ACQUIRE_READ_FIELD(*this, kFeedbackCellOffset);
+  if (!maybe_cell.IsFeedbackCell()) return false;
+  if (!FeedbackCell::cast(maybe_cell).value(kAcquireLoad).IsFeedbackVector()) {
+    return false;
+  }
+
+  SharedFunctionInfo shared = SharedFunctionInfo::cast(maybe_shared);
+  Object data = shared.function_data(kAcquireLoad);
+  if (!data.IsBytecodeArray()) return false;
+  return BytecodeArray::cast(data).IsOld();
+}
+
+void JSFunction::ResetIfFeedbackCold(
+    base::EnumSet<CodeFlushMode> code_flush_mode,
+    base::Optional<std::function<void(HeapObject object, ObjectSlot slot,
+                                      HeapObject target)>>
+        gc_notify_updated_slot) {
+  // The closure may have tiered up since it was found by the marker.
+  if (!NeedsResetDueToColdFeedback(code_flush_mode)) return;
+  FeedbackVector vector = feedback_vector();
+  if (vector.maybe_has_optimized_code() ||
+      vector.tiering_state() != TieringState::kNone ||
+      vector.osr_tiering_state() != TieringState::kNone) {
+    return;
+  }
+  raw_feedback_cell().reset_feedback_vector(gc_notify_updated_slot);
+}
+
 bool JSFunction::NeedsResetDueToFlushedBaselineCode() {
   return code().kind() == CodeKind::BASELINE && !shared().HasBaselineCode();
 }
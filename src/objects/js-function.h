@@ -245,6 +245,20 @@ class JSFunction : public TorqueGeneratedJSFunction<
                                         HeapObject target)>>
           gc_notify_updated_slot = base::nullopt);
 
+  // Returns if the closure runs in the interpreter and its bytecode has not
+  // been executed recently, in which case its feedback vector is mostly dead
+  // weight and can be dropped. This method is called from concurrent marking
+  // so we should be careful when accessing data fields.
+  inline bool NeedsResetDueToColdFeedback(
+      base::EnumSet<CodeFlushMode> code_flush_mode);
+  // Drops the feedback vector of a cold closure. It is reallocated once the
+  // function gets hot again.
+  inline void ResetIfFeedbackCold(
+      base::EnumSet<CodeFlushMode> code_flush_mode,
+      base::Optional<std::function<void(HeapObject object, ObjectSlot slot,
+                                        HeapObject target)>>
+          gc_notify_updated_slot = base::nullopt);
+
   // Returns if the closure's code field has to be updated because it has
   // stale baseline code.
   inline bool NeedsResetDueToFlushedBaselineCode();
@@ -1900,6 +1900,21 @@ MaybeHandle<JSTemporalPlainDate> ToTemporalDate(Isolate* isolate,
                             calendar);
 }
 
+// #sec-temporal-totemporaldate
+MaybeHandle<JSTemporalPlainDate> ToTemporalDate(Isolate* isolate,
+                                                Handle<Object> item_obj,
+                                                const char* method_name) {
+  // Plain dates are returned as is, so only create the options object when
+  // the item needs to be converted.
+  if (item_obj->IsJSTemporalPlainDate()) {
+    return Handle<JSTemporalPlainDate>::cast(item_obj);
+  }
+  // 1. If options is not present, set options to ! OrdinaryObjectCreate(null).
+  return ToTemporalDate(isolate, item_obj,
+                        isolate->factory()->NewJSObjectWithNullProto(),
+                        method_name);
+}
+
 }  // namespace
 
 namespace temporal {
@@ -5164,7 +5179,6 @@ MaybeHandle<Smi> JSTemporalCalendar::DaysInYear(
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, temporal_date_like,
         ToTemporalDate(isolate, temporal_date_like,
-                       isolate->factory()->NewJSObjectWithNullProto(),
                        "Temporal.Calendar.prototype.daysInYear"),
         Smi);
   }
@@ -5202,7 +5216,6 @@ MaybeHandle<Smi> JSTemporalCalendar::DaysInMonth(
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, temporal_date_like,
         ToTemporalDate(isolate, temporal_date_like,
-                       isolate->factory()->NewJSObjectWithNullProto(),
                        "Temporal.Calendar.prototype.daysInMonth"),
         Smi);
   }
@@ -5246,7 +5259,6 @@ MaybeHandle<Smi> JSTemporalCalendar::Year(Isolate* isolate,
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, temporal_date_like,
         ToTemporalDate(isolate, temporal_date_like,
-                       isolate->factory()->NewJSObjectWithNullProto(),
                        "Temporal.Calendar.prototype.year"),
         Smi);
   }
@@ -5281,7 +5293,6 @@ MaybeHandle<Smi> JSTemporalCalendar::DayOfYear(
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, temporal_date,
       ToTemporalDate(isolate, temporal_date_like,
-                     isolate->factory()->NewJSObjectWithNullProto(),
                      "Temporal.Calendar.prototype.dayOfYear"),
       Smi);
   // a. Let value be ! ToISODayOfYear(temporalDate.[[ISOYear]],
@@ -5305,7 +5316,6 @@ MaybeHandle<Smi> JSTemporalCalendar::DayOfWeek(
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, temporal_date,
       ToTemporalDate(isolate, temporal_date_like,
-                     isolate->factory()->NewJSObjectWithNullProto(),
                      "Temporal.Calendar.prototype.dayOfWeek"),
       Smi);
   // a. Let value be ! ToISODayOfWeek(temporalDate.[[ISOYear]],
@@ -5332,7 +5342,6 @@ MaybeHandle<Smi> JSTemporalCalendar::MonthsInYear(
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, temporal_date_like,
         ToTemporalDate(isolate, temporal_date_like,
-                       isolate->factory()->NewJSObjectWithNullProto(),
                        "Temporal.Calendar.prototype.monthsInYear"),
         Smi);
   }
@@ -5359,7 +5368,6 @@ MaybeHandle<Oddball> JSTemporalCalendar::InLeapYear(
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, temporal_date_like,
         ToTemporalDate(isolate, temporal_date_like,
-                       isolate->factory()->NewJSObjectWithNullProto(),
                        "Temporal.Calendar.prototype.inLeapYear"),
         Oddball);
   }
@@ -5392,7 +5400,6 @@ MaybeHandle<Smi> JSTemporalCalendar::DaysInWeek(
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, date,
       ToTemporalDate(isolate, temporal_date_like,
-                     isolate->factory()->NewJSObjectWithNullProto(),
                      "Temporal.Calendar.prototype.daysInWeek"),
       Smi);
   // 5. Return 7𝔽.
@@ -5701,6 +5708,30 @@ MaybeHandle<JSTemporalPlainDate> JSTemporalPlainDate::From(
   return ToTemporalDate(isolate, item, options, method_name);
 }
 
+// #sec-temporal.plaindate.compare
+MaybeHandle<Smi> JSTemporalPlainDate::Compare(Isolate* isolate,
+                                              Handle<Object> one_obj,
+                                              Handle<Object> two_obj) {
+  const char* method_name = "Temporal.PlainDate.compare";
+  // 1. Set one to ? ToTemporalDate(one).
+  Handle<JSTemporalPlainDate> one;
+  ASSIGN_RETURN_ON_EXCEPTION(isolate, one,
+                             ToTemporalDate(isolate, one_obj, method_name),
+                             Smi);
+  // 2. Set two to ? ToTemporalDate(two).
+  Handle<JSTemporalPlainDate> two;
+  ASSIGN_RETURN_ON_EXCEPTION(isolate, two,
+                             ToTemporalDate(isolate, two_obj, method_name),
+                             Smi);
+  // 3. Return 𝔽(! CompareISODate(one.[[ISOYear]], one.[[ISOMonth]],
+  // one.[[ISODay]], two.[[ISOYear]], two.[[ISOMonth]], two.[[ISODay]])).
+  int32_t result =
+      CompareISODate(isolate, one->iso_year(), one->iso_month(),
+                     one->iso_day(), two->iso_year(), two->iso_month(),
+                     two->iso_day());
+  return handle(Smi::FromInt(result), isolate);
+}
+
 #define DEFINE_INT_FIELD(obj, str, field, item)                \
   CHECK(JSReceiver::CreateDataProperty(                        \
             isolate, obj, factory->str##_string(),             \
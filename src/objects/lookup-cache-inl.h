@@ -37,6 +37,38 @@ void DescriptorLookupCache::Update(Map source, Name name, int result) {
   results_[index] = result;
 }
 
+// static
+int ObjectAssignCache::Hash(Map target, Map source) {
+  // Must be kept in sync with the probe in the ObjectAssign builtin.
+  uint32_t target_hash = static_cast<uint32_t>(target.ptr()) >> kTaggedSizeLog2;
+  uint32_t source_hash = static_cast<uint32_t>(source.ptr()) >> kTaggedSizeLog2;
+  return (target_hash ^ source_hash) & (kLength - 1);
+}
+
+template <typename IsLiveCallback>
+void ObjectAssignCache::ClearDeadEntries(IsLiveCallback is_live) {
+  for (int index = 0; index < kLength; index++) {
+    Entry& entry = entries_[index];
+    if (entry.target.is_null()) continue;
+    if (is_live(entry.target) && is_live(entry.source) &&
+        (entry.result.is_null() || is_live(entry.result)) &&
+        (!entry.validity_cell.IsHeapObject() ||
+         is_live(HeapObject::cast(entry.validity_cell)))) {
+      continue;
+    }
+    entry = Entry();
+  }
+}
+
+void ObjectAssignCache::Update(Map target, Map source, Map result,
+                               Cell validity_cell) {
+  Entry& entry = entries_[Hash(target, source)];
+  entry.target = target;
+  entry.source = source;
+  entry.result = result;
+  entry.validity_cell = validity_cell;
+}
+
 }  // namespace internal
 }  // namespace v8
 
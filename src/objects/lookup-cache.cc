@@ -4,6 +4,9 @@
 
 #include "src/objects/lookup-cache.h"
 
+#include "src/objects/slots-inl.h"
+#include "src/objects/visitors.h"
+
 namespace v8 {
 namespace internal {
 
@@ -11,5 +14,26 @@ void DescriptorLookupCache::Clear() {
   for (int index = 0; index < kLength; index++) keys_[index].source = Map();
 }
 
+void ObjectAssignCache::Clear() {
+  for (int index = 0; index < kLength; index++) entries_[index] = Entry();
+}
+
+void ObjectAssignCache::Iterate(RootVisitor* visitor) {
+  for (int index = 0; index < kLength; index++) {
+    Entry& entry = entries_[index];
+    if (entry.target.is_null()) continue;
+    visitor->VisitRootPointer(Root::kObjectAssignCache, nullptr,
+                              FullObjectSlot(&entry.target));
+    visitor->VisitRootPointer(Root::kObjectAssignCache, nullptr,
+                              FullObjectSlot(&entry.source));
+    if (!entry.result.is_null()) {
+      visitor->VisitRootPointer(Root::kObjectAssignCache, nullptr,
+                                FullObjectSlot(&entry.result));
+    }
+    visitor->VisitRootPointer(Root::kObjectAssignCache, nullptr,
+                              FullObjectSlot(&entry.validity_cell));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
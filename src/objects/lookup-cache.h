@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_H_
 #define V8_OBJECTS_LOOKUP_CACHE_H_
 
+#include "src/base/bits.h"
+#include "src/objects/cell.h"
 #include "src/objects/map.h"
 #include "src/objects/name.h"
 #include "src/objects/objects.h"
@@ -32,6 +34,23 @@ class DescriptorLookupCache {
 
   static const int kAbsent = -2;
 
+  // Generated code only consults the cache for maps with more own descriptors
+  // than this; shorter descriptor arrays are cheaper to scan directly.
+  static const int kMinDescriptorsForCaching = 8;
+
+  static const int kLength = 256;
+
+  // Layout of {keys_} and {results_} entries.
+  static const int kKeySize = 2 * kSystemPointerSize;
+  static const int kKeySourceOffset = 0;
+  static const int kKeyNameOffset = kSystemPointerSize;
+  static const int kResultSize = kInt32Size;
+
+  // Used by generated code to probe and update the cache, see
+  // CodeStubAssembler::DescriptorLookupWithCache().
+  Address keys_address() { return reinterpret_cast<Address>(&keys_[0]); }
+  Address results_address() { return reinterpret_cast<Address>(&results_[0]); }
+
  private:
   DescriptorLookupCache() {
     for (int i = 0; i < kLength; ++i) {
@@ -43,11 +62,12 @@ class DescriptorLookupCache {
 
   static inline int Hash(Map source, Name name);
 
-  static const int kLength = 64;
   struct Key {
     Map source;
     Name name;
   };
+  STATIC_ASSERT(sizeof(Key) == kKeySize);
+  STATIC_ASSERT(sizeof(int) == kResultSize);
 
   Key keys_[kLength];
   int results_[kLength];
@@ -55,6 +75,65 @@ class DescriptorLookupCache {
   friend class Isolate;
 };
 
+// Cache for mapping (target map, source map) into the map that
+// Object.assign(target, source) gives an empty {target} when that assignment
+// amounts to copying the fields of {source} verbatim. A null result means
+// that the assignment has to take the generic path. Every entry is guarded
+// by the prototype chain validity cell of the target map, since setters on
+// the prototype chain would intercept the assignment.
+// The entries are weak roots: they do not keep their maps and cells alive and
+// are cleared by mark-compact once any of them dies.
+class ObjectAssignCache {
+ public:
+  ObjectAssignCache(const ObjectAssignCache&) = delete;
+  ObjectAssignCache& operator=(const ObjectAssignCache&) = delete;
+
+  // Update the entry for (target, source).
+  inline void Update(Map target, Map source, Map result, Cell validity_cell);
+
+  // Clear the cache.
+  void Clear();
+
+  // Visits the maps and cells of all entries. Only used for weak roots, i.e.
+  // to update the pointers after objects moved.
+  void Iterate(RootVisitor* visitor);
+
+  // Clears the entries that refer to a map or cell for which {is_live}
+  // returns false.
+  template <typename IsLiveCallback>
+  inline void ClearDeadEntries(IsLiveCallback is_live);
+
+  static const int kLength = 128;
+
+  // Layout of {entries_}, probed by generated code in the ObjectAssign
+  // builtin.
+  static const int kEntrySize = 4 * kSystemPointerSize;
+  static const int kEntryTargetOffset = 0;
+  static const int kEntrySourceOffset = kSystemPointerSize;
+  static const int kEntryResultOffset = 2 * kSystemPointerSize;
+  static const int kEntryValidityCellOffset = 3 * kSystemPointerSize;
+
+  Address entries_address() { return reinterpret_cast<Address>(&entries_[0]); }
+
+ private:
+  ObjectAssignCache() { Clear(); }
+
+  static inline int Hash(Map target, Map source);
+
+  struct Entry {
+    Map target;
+    Map source;
+    Map result;
+    Object validity_cell;
+  };
+  STATIC_ASSERT(sizeof(Entry) == kEntrySize);
+  STATIC_ASSERT(base::bits::IsPowerOfTwo(kLength));
+
+  Entry entries_[kLength];
+
+  friend class Isolate;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -208,6 +208,23 @@ Handle<Map> MapUpdater::ReconfigureToDataField(InternalIndex descriptor,
     new_field_type_ =
         GeneralizeFieldType(old_representation, old_field_type,
                             new_representation_, field_type, isolate_);
+
+    // A field that already holds values and now needs a representation that
+    // cannot be changed to in-place would deprecate the whole transition
+    // tree below its owner and migrate every instance. If the field has
+    // already been overwritten before, i.e. it is no longer const, it is
+    // likely to churn again, so jump to Tagged, which can always be changed
+    // to in-place. The first such change of a const field still takes the
+    // regular path.
+    if (FLAG_generalize_reinitialized_fields_to_tagged &&
+        old_details.location() == PropertyLocation::kField &&
+        old_details.constness() == PropertyConstness::kMutable &&
+        !old_representation.IsNone() &&
+        !old_representation.CanBeInPlaceChangedTo(new_representation_) &&
+        old_representation.CanBeInPlaceChangedTo(Representation::Tagged())) {
+      new_representation_ = Representation::Tagged();
+      new_field_type_ = FieldType::Any(isolate_);
+    }
   } else {
     // We don't know if this is a first property kind reconfiguration
     // and we don't know which value was in this property previously
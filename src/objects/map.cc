@@ -251,6 +251,8 @@ VisitorId Map::GetVisitorId(Map map) {
     case JS_ASYNC_FROM_SYNC_ITERATOR_TYPE:
     case JS_ASYNC_FUNCTION_OBJECT_TYPE:
     case JS_ASYNC_GENERATOR_OBJECT_TYPE:
+    case JS_ATOMICS_CONDITION_TYPE:
+    case JS_ATOMICS_MUTEX_TYPE:
     case JS_CONTEXT_EXTENSION_OBJECT_TYPE:
     case JS_DATE_TYPE:
     case JS_ERROR_TYPE:
@@ -4650,6 +4650,35 @@ void Relocatable::Iterate(RootVisitor* v, Relocatable* top) {
 
 namespace {
 
+// Writes {count} copies of {separator} to {sink}. Only the first copy is read
+// from the separator; the remaining ones are filled in by repeatedly copying
+// the already written prefix, doubling it each time.
+template <typename sinkchar>
+sinkchar* WriteSeparatorsToFlat(String separator,
+                                const String::FlatContent& separator_content,
+                                int separator_length, uint32_t count,
+                                sinkchar* sink) {
+  DCHECK_GT(count, 0);
+  DCHECK_GT(separator_length, 0);
+  if (separator_content.IsOneByte()) {
+    CopyChars(sink, separator_content.ToOneByteVector().begin(),
+              separator_length);
+  } else if (separator_content.IsTwoByte()) {
+    CopyChars(sink, separator_content.ToUC16Vector().begin(),
+              separator_length);
+  } else {
+    String::WriteToFlat(separator, sink, 0, separator_length);
+  }
+  const size_t total = static_cast<size_t>(separator_length) * count;
+  size_t written = separator_length;
+  while (written < total) {
+    const size_t chunk = std::min(written, total - written);
+    MemCopy(sink + written, sink, chunk * sizeof(sinkchar));
+    written += chunk;
+  }
+  return sink + total;
+}
+
 template <typename sinkchar>
 void WriteFixedArrayToFlat(FixedArray fixed_array, int length, String separator,
                            sinkchar* sink, int sink_length) {
@@ -4670,6 +4699,10 @@ void WriteFixedArrayToFlat(FixedArray fixed_array, int length, String separator,
     CHECK_EQ(separator.length(), 1);
     separator_one_char = SeqOneByteString::cast(separator).GetChars(no_gc)[0];
   }
+  // Resolve the separator's characters once instead of dispatching on its
+  // shape for every element. Non-flat separators fall back to WriteToFlat.
+  const String::FlatContent separator_content =
+      separator.GetFlatContent(no_gc);
 
   uint32_t num_separators = 0;
   for (int i = 0; i < length; i++) {
@@ -4690,8 +4723,6 @@ void WriteFixedArrayToFlat(FixedArray fixed_array, int length, String separator,
 
     // Write separator(s) if necessary.
     if (num_separators > 0 && separator_length > 0) {
-      // TODO(pwong): Consider doubling strategy employed by runtime-strings.cc
-      //              WriteRepeatToFlat().
       // Fast path for single character, single byte separators.
       if (use_one_byte_separator_fast_path) {
         DCHECK_LE(sink + num_separators, sink_end);
@@ -4699,11 +4730,9 @@ void WriteFixedArrayToFlat(FixedArray fixed_array, int length, String separator,
         DCHECK_EQ(separator_length, 1);
         sink += num_separators;
       } else {
-        for (uint32_t j = 0; j < num_separators; j++) {
-          DCHECK_LE(sink + separator_length, sink_end);
-          String::WriteToFlat(separator, sink, 0, separator_length);
-          sink += separator_length;
-        }
+        DCHECK_LE(sink + separator_length * num_separators, sink_end);
+        sink = WriteSeparatorsToFlat(separator, separator_content,
+                                     separator_length, num_separators, sink);
       }
     }
 
@@ -150,21 +150,6 @@ std::vector<BytecodeOffset> OSROptimizedCodeCache::OsrOffsetsFor(
   return offsets;
 }
 
-base::Optional<BytecodeOffset> OSROptimizedCodeCache::FirstOsrOffsetFor(
-    SharedFunctionInfo shared) {
-  DisallowGarbageCollection gc;
-
-  const OSRCodeCacheStateOfSFI state = shared.osr_code_cache_state();
-  if (state == kNotCached) return {};
-
-  for (int index = 0; index < length(); index += kEntryLength) {
-    if (GetSFIFromEntry(index) != shared) continue;
-    return GetBytecodeOffsetFromEntry(index);
-  }
-
-  return {};
-}
-
 int OSROptimizedCodeCache::GrowOSRCache(
     Isolate* isolate, Handle<NativeContext> native_context,
     Handle<OSROptimizedCodeCache>* osr_cache) {
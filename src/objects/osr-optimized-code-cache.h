@@ -58,7 +58,6 @@ class V8_EXPORT OSROptimizedCodeCache : public WeakFixedArray {
                Isolate* isolate);
 
   std::vector<BytecodeOffset> OsrOffsetsFor(SharedFunctionInfo shared);
-  base::Optional<BytecodeOffset> FirstOsrOffsetFor(SharedFunctionInfo shared);
 
   // Remove all code objects marked for deoptimization from OSR code cache.
   void EvictDeoptimizedCode(Isolate* isolate);
@@ -261,6 +261,18 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
                     has_static_private_methods_or_accessors,
                     SharedFunctionInfo::HasStaticPrivateMethodsOrAccessorsBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, flush_count,
+                    SharedFunctionInfo::FlushCountBits)
+
+void SharedFunctionInfo::IncrementFlushCount() {
+  if (flush_count() < FlushCountBits::kMax) set_flush_count(flush_count() + 1);
+}
+
+bool SharedFunctionInfo::IsBytecodeRetainedAfterFlushes() const {
+  return flush_count() >= kFlushCountForBytecodeRetention &&
+         !FLAG_flush_recompiled_bytecode;
+}
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -619,7 +631,8 @@ bool SharedFunctionInfo::ShouldFlushCode(
   // check if it is old. Note, this is done this way since this function can be
   // called by the concurrent marker.
   Object data = function_data(kAcquireLoad);
-  if (data.IsCodeT()) {
+  const bool has_baseline_code = data.IsCodeT();
+  if (has_baseline_code) {
     CodeT baseline_code = CodeT::cast(data);
     DCHECK_EQ(baseline_code.kind(), CodeKind::BASELINE);
     // If baseline code flushing isn't enabled and we have baseline data on SFI
@@ -636,8 +649,16 @@ bool SharedFunctionInfo::ShouldFlushCode(
   if (IsStressFlushingEnabled(code_flush_mode)) return true;
 
   BytecodeArray bytecode = BytecodeArray::cast(data);
-
-  return bytecode.IsOld();
+  if (!bytecode.IsOld()) return false;
+
+  // The function keeps being recompiled after flushes, so flushing its
+  // bytecode again would likely just cause another synchronous recompile. Its
+  // baseline code can still be flushed; the marking visitor then keeps the
+  // bytecode alive.
+  if (IsBytecodeRetainedAfterFlushes()) {
+    return has_baseline_code;
+  }
+  return true;
 }
 
 CodeT SharedFunctionInfo::InterpreterTrampoline() const {
@@ -447,6 +447,16 @@ class SharedFunctionInfo
   DECL_BOOLEAN_ACCESSORS(class_scope_has_private_brand)
   DECL_BOOLEAN_ACCESSORS(has_static_private_methods_or_accessors)
 
+  // How often the bytecode of this function has been flushed, saturating at
+  // FlushCountBits::kMax. Functions that keep coming back after flushes are
+  // likely to be needed periodically, so their bytecode is retained once the
+  // count reaches kFlushCountForBytecodeRetention. The count is not part of
+  // the code cache.
+  DECL_PRIMITIVE_ACCESSORS(flush_count, uint32_t)
+  inline void IncrementFlushCount();
+  inline bool IsBytecodeRetainedAfterFlushes() const;
+  static constexpr uint32_t kFlushCountForBytecodeRetention = 2;
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
@@ -5,6 +5,7 @@
 #include "src/objects/string-table.h"
 
 #include <atomic>
+#include <vector>
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
@@ -106,6 +107,20 @@ class StringTable::Data {
     slot(index).Release_Store(entry);
   }
 
+  // Stores {entry} at {index} unless another thread filled the (previously
+  // empty) entry first.
+  bool TrySetEmpty(InternalIndex index, String entry) {
+#ifdef V8_COMPRESS_POINTERS
+    Tagged_t new_value = CompressTagged(entry.ptr());
+#else
+    Tagged_t new_value = entry.ptr();
+#endif
+    Tagged_t empty_value = static_cast<Tagged_t>(empty_element().ptr());
+    return AsAtomicTagged::Release_CompareAndSwap(
+               &elements_[index.as_uint32()], empty_value, new_value) ==
+           empty_value;
+  }
+
   void ElementAdded() {
     DCHECK_LT(number_of_elements_ + 1, capacity());
     DCHECK(StringTableHasSufficientCapacityToAdd(
@@ -127,12 +142,23 @@ class StringTable::Data {
     number_of_deleted_elements_ += count;
   }
 
+  // Reserves room for {count} elements to be added with InsertConcurrently.
+  // Fails if the table would have to be resized, or should be shrunk, first.
+  bool TryReserve(int count);
+  // Gives back the room reserved for an element that turned out to be in the
+  // table already.
+  void CancelReservation() {
+    number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
   void* operator new(size_t size, int capacity);
   void* operator new(size_t size) = delete;
   void operator delete(void* description);
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
   int number_of_deleted_elements() const { return number_of_deleted_elements_; }
 
   template <typename IsolateT, typename StringTableKey>
@@ -147,6 +173,12 @@ class StringTable::Data {
                                           StringTableKey* key,
                                           uint32_t hash) const;
 
+  // Inserts {key} into the first empty entry of its probe sequence, or
+  // returns the equal string another thread inserted first. Room for the
+  // element must have been reserved with TryReserve.
+  template <typename IsolateT, typename StringTableKey>
+  Handle<String> InsertConcurrently(IsolateT* isolate, StringTableKey* key);
+
   // Helper method for StringTable::TryStringToIndexOrLookupExisting.
   template <typename Char>
   static Address TryStringToIndexOrLookupExisting(Isolate* isolate,
@@ -176,7 +208,9 @@ class StringTable::Data {
 
  private:
   std::unique_ptr<Data> previous_data_;
-  int number_of_elements_;
+  // Concurrent insertions update this with atomic read-modify-writes; all
+  // other fields are only written with exclusive access to the table.
+  std::atomic<int> number_of_elements_;
   int number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
@@ -310,6 +344,51 @@ InternalIndex StringTable::Data::FindEntryOrInsertionEntry(
   }
 }
 
+bool StringTable::Data::TryReserve(int count) {
+  int nof = number_of_elements_.load(std::memory_order_relaxed);
+  do {
+    // Growing and shrinking the table are left to exclusive insertions.
+    // Deleted entries are only reused by those as well, which is what makes
+    // inserting into the first empty entry of a probe sequence safe: two
+    // threads inserting equal strings always race for the same entry.
+    if (!StringTableHasSufficientCapacityToAdd(
+            capacity_, nof, number_of_deleted_elements_, count) ||
+        ComputeStringTableCapacityWithShrink(capacity_, nof + count) <
+            capacity_) {
+      return false;
+    }
+  } while (!number_of_elements_.compare_exchange_weak(
+      nof, nof + count, std::memory_order_relaxed));
+  return true;
+}
+
+template <typename IsolateT, typename StringTableKey>
+Handle<String> StringTable::Data::InsertConcurrently(IsolateT* isolate,
+                                                     StringTableKey* key) {
+  DCHECK(!key->NeedsExclusiveInsertion());
+  uint32_t hash = key->hash();
+  uint32_t count = 1;
+  // The reservation guarantees the hash table is never full.
+  for (InternalIndex entry = FirstProbe(hash, capacity_);;
+       entry = NextProbe(entry, count++, capacity_)) {
+    Object element = Get(isolate, entry);
+    if (element == empty_element()) {
+      Handle<String> new_string = key->GetHandleForInsertion();
+      DCHECK_IMPLIES(FLAG_shared_string_table, new_string->IsShared());
+      if (TrySetEmpty(entry, *new_string)) return new_string;
+      // Another thread claimed the entry; it may have inserted our string.
+      element = Get(isolate, entry);
+      DCHECK_NE(element, empty_element());
+    }
+    if (element == deleted_element()) continue;
+    String string = String::cast(element);
+    if (KeyIsMatch(isolate, key, string)) {
+      CancelReservation();
+      return handle(string, isolate);
+    }
+  }
+}
+
 void StringTable::Data::IterateElements(RootVisitor* visitor) {
   OffHeapObjectSlot first_slot = slot(InternalIndex(0));
   OffHeapObjectSlot end_slot = slot(InternalIndex(capacity_));
@@ -335,10 +414,9 @@ int StringTable::Capacity() const {
   return data_.load(std::memory_order_acquire)->capacity();
 }
 int StringTable::NumberOfElements() const {
-  {
-    base::MutexGuard table_write_guard(&write_mutex_);
-    return data_.load(std::memory_order_relaxed)->number_of_elements();
-  }
+  // Concurrent insertions may make this count run slightly ahead of the
+  // entries that are actually filled.
+  return data_.load(std::memory_order_acquire)->number_of_elements();
 }
 
 // InternalizedStringKey carries a string/internalized-string object as key.
@@ -361,6 +439,12 @@ class InternalizedStringKey final : public StringTableKey {
     return string_->SlowEquals(string);
   }
 
+  // An in-place transition changes the map of {string_}, which must not
+  // happen unless the string actually ends up in the table.
+  bool NeedsExclusiveInsertion() const {
+    return !maybe_internalized_map_.is_null();
+  }
+
   void PrepareForInsertion(Isolate* isolate) {
     StringTransitionStrategy strategy =
         isolate->factory()->ComputeInternalizationStrategyForString(
@@ -481,7 +565,8 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
   //   - All writes to the string table are guarded by the Isolate string table
-  //     mutex,
+  //     mutex, either in shared mode for compare-and-swap insertions into
+  //     empty entries, or exclusively for everything else,
   //   - Resizes of the string table first copies the old contents to the new
   //     table, and only then sets the new string table pointer to the new
   //     table,
@@ -501,7 +586,9 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   // We therefore try to optimistically read from the string table without
   // taking the lock (both here and in the NoAllocate version of the lookup),
   // and on a miss we take the lock and try to write the entry, with a second
-  // read lookup in case the non-locked read missed a write.
+  // read lookup in case the non-locked read missed a write. Most misses only
+  // need the lock in shared mode, so that threads internalizing into a shared
+  // string table do not serialize on it.
   //
   // One complication is allocation -- we don't want to allocate while holding
   // the string table lock. This applies to both allocation of new strings, and
@@ -529,14 +616,47 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
 
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
+  return InsertPreparedKey(isolate, key);
+}
+
+// Holds the write mutex exclusively and records the owning thread, so that
+// callees can check for exclusive access.
+class V8_NODISCARD StringTable::ExclusiveWriteScope final {
+ public:
+  explicit ExclusiveWriteScope(StringTable* table)
+      : table_(table), guard_(&table->write_mutex_) {
+    table_->exclusive_writer_.store(ThreadId::Current().ToInteger(),
+                                    std::memory_order_relaxed);
+  }
+  ~ExclusiveWriteScope() {
+    table_->exclusive_writer_.store(ThreadId::Invalid().ToInteger(),
+                                    std::memory_order_relaxed);
+  }
+
+ private:
+  StringTable* const table_;
+  base::SharedMutexGuard<base::kExclusive> guard_;
+};
+
+template <typename StringTableKey, typename IsolateT>
+Handle<String> StringTable::InsertPreparedKey(IsolateT* isolate,
+                                              StringTableKey* key) {
+  if (!key->NeedsExclusiveInsertion()) {
+    base::SharedMutexGuard<base::kShared> table_write_guard(&write_mutex_);
+    // The table pointer can only be modified while the lock is held
+    // exclusively.
+    Data* data = data_.load(std::memory_order_relaxed);
+    if (data->TryReserve(1)) return data->InsertConcurrently(isolate, key);
+  }
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    ExclusiveWriteScope exclusive_write_scope(this);
 
     Data* data = EnsureCapacity(isolate, 1);
 
     // Check one last time if the key is present in the table, in case it was
     // added after the check.
-    entry = data->FindEntryOrInsertionEntry(isolate, key, key->hash());
+    InternalIndex entry =
+        data->FindEntryOrInsertionEntry(isolate, key, key->hash());
 
     Object element = data->Get(isolate, entry);
     if (element == empty_element()) {
@@ -562,6 +682,40 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   }
 }
 
+template <typename StringTableKey, typename IsolateT>
+void StringTable::LookupKeys(IsolateT* isolate,
+                             base::Vector<StringTableKey> keys,
+                             Handle<String>* results) {
+  // See LookupKey for why the lookups are allowed to race with insertions.
+  const Data* current_data = data_.load(std::memory_order_acquire);
+  std::vector<size_t> misses;
+  for (size_t i = 0; i < keys.size(); i++) {
+    StringTableKey* key = &keys[i];
+    InternalIndex entry = current_data->FindEntry(isolate, key, key->hash());
+    if (entry.is_found()) {
+      results[i] = handle(String::cast(current_data->Get(isolate, entry)),
+                          isolate);
+      continue;
+    }
+    key->PrepareForInsertion(isolate);
+    misses.push_back(i);
+  }
+  if (misses.empty()) return;
+
+  {
+    base::SharedMutexGuard<base::kShared> table_write_guard(&write_mutex_);
+    Data* data = data_.load(std::memory_order_relaxed);
+    if (data->TryReserve(static_cast<int>(misses.size()))) {
+      for (size_t i : misses) {
+        results[i] = data->InsertConcurrently(isolate, &keys[i]);
+      }
+      return;
+    }
+  }
+  // The table has to be resized first; the first insertion takes care of it.
+  for (size_t i : misses) results[i] = InsertPreparedKey(isolate, &keys[i]);
+}
+
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
                                                OneByteStringKey* key);
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
@@ -581,10 +735,24 @@ template Handle<String> StringTable::LookupKey(Isolate* isolate,
 template Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
                                                StringTableInsertionKey* key);
 
+template void StringTable::LookupKeys(Isolate* isolate,
+                                      base::Vector<OneByteStringKey> keys,
+                                      Handle<String>* results);
+template void StringTable::LookupKeys(Isolate* isolate,
+                                      base::Vector<TwoByteStringKey> keys,
+                                      Handle<String>* results);
+template void StringTable::LookupKeys(LocalIsolate* isolate,
+                                      base::Vector<OneByteStringKey> keys,
+                                      Handle<String>* results);
+template void StringTable::LookupKeys(LocalIsolate* isolate,
+                                      base::Vector<TwoByteStringKey> keys,
+                                      Handle<String>* results);
+
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
+  // This call is only allowed while the write mutex is held exclusively.
+  DCHECK_EQ(ThreadId::Current().ToInteger(),
+            exclusive_writer_.load(std::memory_order_relaxed));
 
   // This load can be relaxed as the table pointer can only be modified while
   // the lock is held.
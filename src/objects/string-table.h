@@ -5,7 +5,9 @@
 #ifndef V8_OBJECTS_STRING_TABLE_H_
 #define V8_OBJECTS_STRING_TABLE_H_
 
+#include "src/base/platform/mutex.h"
 #include "src/common/assert-scope.h"
+#include "src/execution/thread-id.h"
 #include "src/objects/string.h"
 #include "src/roots/roots.h"
 
@@ -30,6 +32,11 @@ class StringTableKey {
   inline uint32_t hash() const;
   int length() const { return length_; }
 
+  // Whether GetHandleForInsertion modifies an existing string, in which case
+  // the insertion must not race with other insertions into the table. Keys
+  // doing so hide this method.
+  bool NeedsExclusiveInsertion() const { return false; }
+
  protected:
   inline void set_raw_hash_field(uint32_t raw_hash_field);
 
@@ -66,6 +73,13 @@ class V8_EXPORT_PRIVATE StringTable {
   template <typename StringTableKey, typename IsolateT>
   Handle<String> LookupKey(IsolateT* isolate, StringTableKey* key);
 
+  // Same as LookupKey, for a batch of keys. Strings that are not in the table
+  // yet are inserted together, which amortizes the synchronization with
+  // other threads. {results} must have room for {keys.size()} handles.
+  template <typename StringTableKey, typename IsolateT>
+  void LookupKeys(IsolateT* isolate, base::Vector<StringTableKey> keys,
+                  Handle<String>* results);
+
   // {raw_string} must be a tagged String pointer.
   // Returns a tagged pointer: either a Smi if the string is an array index, an
   // internalized string, or a Smi sentinel.
@@ -86,13 +100,24 @@ class V8_EXPORT_PRIVATE StringTable {
 
  private:
   class Data;
+  class ExclusiveWriteScope;
 
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
+  // Inserts {key}, on which PrepareForInsertion was already called, unless
+  // another thread inserted an equal string first.
+  template <typename StringTableKey, typename IsolateT>
+  Handle<String> InsertPreparedKey(IsolateT* isolate, StringTableKey* key);
+
   std::atomic<Data*> data_;
-  // Write mutex is mutable so that readers of concurrently mutated values (e.g.
-  // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  // Insertions into empty entries hold the write mutex in shared mode and
+  // claim their entry with a compare-and-swap. Everything else that writes to
+  // the table (resizing, reusing deleted entries, in-place internalization)
+  // holds it exclusively.
+  base::SharedMutex write_mutex_;
+  // The id of the thread holding {write_mutex_} exclusively, or the invalid
+  // thread id. Set by ExclusiveWriteScope.
+  std::atomic<int> exclusive_writer_{ThreadId::Invalid().ToInteger()};
   Isolate* isolate_;
 };
 
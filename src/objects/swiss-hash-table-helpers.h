@@ -64,6 +64,21 @@
 #include <tmmintrin.h>
 #endif
 
+// NEON groups use the same width as the portable implementation, so they can
+// be used whenever host and target are both arm64 without affecting snapshot
+// compatibility.
+#ifndef V8_SWISS_TABLE_HAVE_NEON_HOST
+#if defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 1
+#else
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 0
+#endif
+#endif
+
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 namespace swiss_table {
@@ -405,6 +420,60 @@ struct GroupPortableImpl {
   uint64_t ctrl;
 };
 
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+// NEON version of GroupPortableImpl. It produces byte masks with the same
+// layout, but without the false positives of the portable Match().
+struct GroupNeonImpl {
+  static constexpr size_t kWidth = GroupPortableImpl::kWidth;
+
+  explicit GroupNeonImpl(const ctrl_t* pos) : ctrl(vld1_s8(pos)) {}
+
+  // Returns a bitmask representing the positions of slots that match |hash|.
+  BitMask<uint64_t, kWidth, 3> Match(h2_t hash) const {
+    return BitMask<uint64_t, kWidth, 3>(
+        ToByteMask(vceq_s8(ctrl, vdup_n_s8(static_cast<ctrl_t>(hash)))));
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  BitMask<uint64_t, kWidth, 3> MatchEmpty() const {
+    return BitMask<uint64_t, kWidth, 3>(
+        ToByteMask(vceq_s8(ctrl, vdup_n_s8(kEmpty))));
+  }
+
+  // Returns a bitmask representing the positions of empty or deleted slots.
+  BitMask<uint64_t, kWidth, 3> MatchEmptyOrDeleted() const {
+    return BitMask<uint64_t, kWidth, 3>(ToByteMask(EmptyOrDeletedLanes()));
+  }
+
+  // Returns the number of trailing empty or deleted elements in the group.
+  uint32_t CountLeadingEmptyOrDeleted() const {
+    return base::bits::CountTrailingZeros(~ToWord(EmptyOrDeletedLanes())) >> 3;
+  }
+
+  void ConvertSpecialToEmptyAndFullToDeleted(ctrl_t* dst) const {
+    uint8x8_t special = vclt_s8(ctrl, vdup_n_s8(0));
+    vst1_s8(dst, vbsl_s8(special, vdup_n_s8(kEmpty), vdup_n_s8(kDeleted)));
+  }
+
+  int8x8_t ctrl;
+
+ private:
+  uint8x8_t EmptyOrDeletedLanes() const {
+    return vclt_s8(ctrl, vdup_n_s8(kSentinel));
+  }
+
+  // Keeps only the most significant bit of each all-ones lane, as expected by
+  // BitMask<uint64_t, kWidth, 3>.
+  static uint64_t ToByteMask(uint8x8_t lanes) {
+    return ToWord(lanes) & GroupPortableImpl::kMsbs;
+  }
+
+  static uint64_t ToWord(uint8x8_t lanes) {
+    return vget_lane_u64(vreinterpret_u64_u8(lanes), 0);
+  }
+};
+#endif  // V8_SWISS_TABLE_HAVE_NEON_HOST
+
 // Determine which Group implementation SwissNameDictionary uses.
 #if defined(V8_ENABLE_SWISS_NAME_DICTIONARY) && DEBUG
 // TODO(v8:11388) If v8_enable_swiss_name_dictionary is enabled, we are supposed
@@ -436,6 +505,8 @@ using Group = GroupSse2Impl;
 #endif
 using Group = GroupSse2Polyfill;
 #endif
+#elif V8_SWISS_TABLE_HAVE_NEON_HOST && V8_TARGET_ARCH_ARM64
+using Group = GroupNeonImpl;
 #else
 using Group = GroupPortableImpl;
 #endif
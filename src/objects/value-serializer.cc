@@ -593,6 +593,9 @@ Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
       return WriteJSError(Handle<JSObject>::cast(receiver));
     case JS_SHARED_STRUCT_TYPE:
       return WriteJSSharedStruct(Handle<JSSharedStruct>::cast(receiver));
+    case JS_ATOMICS_MUTEX_TYPE:
+    case JS_ATOMICS_CONDITION_TYPE:
+      return WriteSharedObject(receiver);
 #if V8_ENABLE_WEBASSEMBLY
     case WASM_MODULE_OBJECT_TYPE:
       return WriteWasmModule(Handle<WasmModuleObject>::cast(receiver));
@@ -2194,6 +2197,20 @@ static bool IsValidObjectKey(Object value, Isolate* isolate) {
          InstanceTypeChecker::IsHeapNumber(instance_type);
 }
 
+MaybeHandle<Object> ValueDeserializer::ReadObjectKey() {
+  SerializationTag tag;
+  if (!PeekTag().To(&tag) || tag != SerializationTag::kOneByteString) {
+    return ReadObject();
+  }
+  ConsumeTag(tag);
+  uint32_t byte_length;
+  base::Vector<const uint8_t> bytes;
+  if (!ReadVarint<uint32_t>().To(&byte_length)) return {};
+  // byte_length is checked in ReadRawBytes.
+  if (!ReadRawBytes(byte_length).To(&bytes)) return {};
+  return isolate_->factory()->InternalizeString(bytes);
+}
+
 Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
     Handle<JSObject> object, SerializationTag end_tag,
     bool can_use_transitions) {
@@ -2235,7 +2252,8 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
       if (!expected_key.is_null() && ReadExpectedString(expected_key)) {
         key = expected_key;
       } else {
-        if (!ReadObject().ToHandle(&key) || !IsValidObjectKey(*key, isolate_)) {
+        if (!ReadObjectKey().ToHandle(&key) ||
+            !IsValidObjectKey(*key, isolate_)) {
           return Nothing<uint32_t>();
         }
         if (key->IsString(isolate_)) {
@@ -2319,7 +2337,7 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
     }
 
     Handle<Object> key;
-    if (!ReadObject().ToHandle(&key) || !IsValidObjectKey(*key, isolate_)) {
+    if (!ReadObjectKey().ToHandle(&key) || !IsValidObjectKey(*key, isolate_)) {
       return Nothing<uint32_t>();
     }
     Handle<Object> value;
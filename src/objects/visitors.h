@@ -27,6 +27,7 @@ class CodeDataContainer;
   V(kRelocatable, "(Relocatable)")                      \
   V(kDebug, "(Debugger)")                               \
   V(kCompilationCache, "(Compilation cache)")           \
+  V(kObjectAssignCache, "(Object.assign cache)")        \
   V(kHandleScope, "(Handle scope)")                     \
   V(kBuiltins, "(Builtins)")                            \
   V(kGlobalHandles, "(Global handles)")                 \
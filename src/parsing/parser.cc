@@ -2801,6 +2801,14 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   RecordFunctionLiteralSourceRange(function_literal);
 
+  // Posting a task costs more than compiling a tiny lazy function on demand,
+  // so only do it for functions whose size we now know is worth it.
+  if (should_post_parallel_task && is_lazy &&
+      scope->end_position() - scope->start_position() <
+          FLAG_parallel_compile_tasks_for_lazy_min_size) {
+    should_post_parallel_task = false;
+  }
+
   if (should_post_parallel_task && !has_error()) {
     function_literal->set_should_parallel_compile();
   }
@@ -621,10 +621,18 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   while (cursor < end && chars < position) {
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
-    if (t != unibrow::Utf8::kIncomplete) {
-      chars++;
-      if (t > unibrow::Utf16::kMaxNonSurrogateCharCode) chars++;
-    }
+    if (t == unibrow::Utf8::kIncomplete) continue;
+    chars++;
+    if (t > unibrow::Utf16::kMaxNonSurrogateCharCode) chars++;
+    if (chars >= position) break;
+    // Fast path for ascii sequences, which map 1:1 onto characters.
+    size_t remaining = end - cursor;
+    size_t max_chars = position - chars;
+    int max_length = static_cast<int>(std::min(remaining, max_chars));
+    DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
+    int ascii_length = NonAsciiStart(cursor, max_length);
+    cursor += ascii_length;
+    chars += ascii_length;
   }
 
   current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data.get());
@@ -319,24 +319,33 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
 }
 
 V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
-  int start_position = source_pos();
-
   // We won't skip behind the end of input.
   DCHECK(!IsWhiteSpaceOrLineTerminator(kEndOfInput));
 
-  // Advance as long as character is a WhiteSpace or LineTerminator.
-  while (IsWhiteSpaceOrLineTerminator(c0_)) {
-    if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
-      next().after_line_terminator = true;
-    }
-    Advance();
-  }
-
-  // Return whether or not we skipped any characters.
-  if (source_pos() == start_position) {
+  if (!IsWhiteSpaceOrLineTerminator(c0_)) {
     DCHECK_NE('0', c0_);
     return Token::ILLEGAL;
   }
+  if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
+    next().after_line_terminator = true;
+  }
+
+  // Advance as long as character is a WhiteSpace or LineTerminator. This scans
+  // the buffered chunk directly rather than advancing one character at a time.
+  // Runs of whitespace (indentation) usually repeat the same character, so
+  // remember the last one seen to skip the classification for it.
+  base::uc32 hint = c0_;
+  AdvanceUntil([this, &hint](base::uc32 c0) {
+    if (V8_LIKELY(c0 == hint)) return false;
+    if (IsWhiteSpaceOrLineTerminator(c0)) {
+      if (!next().after_line_terminator && unibrow::IsLineTerminator(c0)) {
+        next().after_line_terminator = true;
+      }
+      hint = c0;
+      return false;
+    }
+    return true;
+  });
 
   return Token::WHITESPACE;
 }
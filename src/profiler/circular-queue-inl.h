@@ -21,7 +21,9 @@ SamplingCircularQueue<T, L>::~SamplingCircularQueue() = default;
 
 template<typename T, unsigned L>
 T* SamplingCircularQueue<T, L>::Peek() {
-  base::SeqCst_MemoryFence();
+  // The acquire load pairs with the release store in FinishEnqueue, which is
+  // all a single consumer needs to see the complete record. No full fence is
+  // required on either side.
   if (base::Acquire_Load(&dequeue_pos_->marker) == kFull) {
     return &dequeue_pos_->record;
   }
@@ -38,7 +40,6 @@ void SamplingCircularQueue<T, L>::Remove() {
 
 template<typename T, unsigned L>
 T* SamplingCircularQueue<T, L>::StartEnqueue() {
-  base::SeqCst_MemoryFence();
   if (base::Acquire_Load(&enqueue_pos_->marker) == kEmpty) {
     return &enqueue_pos_->record;
   }
@@ -272,14 +272,22 @@ void SamplingEventsProcessor::Run() {
     base::TimeTicks now;
     SampleProcessingResult result;
     // Keep processing existing events until we need to do next sample
-    // or the ticks buffer is empty.
+    // or the ticks buffer is empty. Symbolizing a sample is cheap compared
+    // to reading the clock, so only check the time once per batch of
+    // samples.
+    int samples_since_clock_check = 0;
     do {
       result = ProcessOneSample();
+      if (result == OneSampleProcessed &&
+          ++samples_since_clock_check < kSamplesPerClockCheck) {
+        continue;
+      }
       if (result == FoundSampleForNextCodeEvent) {
         // All ticks of the current last_processed_code_event_id_ are
         // processed, proceed to the next code event.
         ProcessCodeEvent();
       }
+      samples_since_clock_check = 0;
       now = base::TimeTicks::Now();
     } while (result != NoSamplesInQueue && now < nextSampleTime);
 
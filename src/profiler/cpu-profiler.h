@@ -248,6 +248,9 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   static const size_t kTickSampleBufferSize = 512 * KB;
   static const size_t kTickSampleQueueLength =
       kTickSampleBufferSize / sizeof(TickSampleEventRecord);
+  // Number of consecutive samples that Run() processes between two checks
+  // of whether the next sample is due.
+  static const int kSamplesPerClockCheck = 16;
   SamplingCircularQueue<TickSampleEventRecord,
                         kTickSampleQueueLength> ticks_buffer_;
   std::unique_ptr<sampler::Sampler> sampler_;
@@ -706,25 +706,32 @@ void HeapObjectsMap::RemoveDeadEntries() {
     USE(result);
   }
 
+  // Most heaps have no merged native entries, so avoid the lookups then.
+  const bool has_merged_native_entries =
+      !reverse_merged_native_entries_map.empty();
   size_t first_free_entry = 1;
   for (size_t i = 1; i < entries_.size(); ++i) {
     EntryInfo& entry_info = entries_.at(i);
-    auto merged_reverse_it = reverse_merged_native_entries_map.find(i);
+    auto merged_reverse_it =
+        has_merged_native_entries ? reverse_merged_native_entries_map.find(i)
+                                  : reverse_merged_native_entries_map.end();
     if (entry_info.accessed) {
+      // The maps only need updating if the entry actually moves. Until the
+      // first dead entry is found, all entries stay where they are.
       if (first_free_entry != i) {
         entries_.at(first_free_entry) = entry_info;
+        base::HashMap::Entry* entry =
+            entries_map_.Lookup(reinterpret_cast<void*>(entry_info.addr),
+                                ComputeAddressHash(entry_info.addr));
+        DCHECK(entry);
+        entry->value = reinterpret_cast<void*>(first_free_entry);
+        if (merged_reverse_it != reverse_merged_native_entries_map.end()) {
+          auto it = merged_native_entries_map_.find(merged_reverse_it->second);
+          DCHECK_NE(merged_native_entries_map_.end(), it);
+          it->second = first_free_entry;
+        }
       }
       entries_.at(first_free_entry).accessed = false;
-      base::HashMap::Entry* entry =
-          entries_map_.Lookup(reinterpret_cast<void*>(entry_info.addr),
-                              ComputeAddressHash(entry_info.addr));
-      DCHECK(entry);
-      entry->value = reinterpret_cast<void*>(first_free_entry);
-      if (merged_reverse_it != reverse_merged_native_entries_map.end()) {
-        auto it = merged_native_entries_map_.find(merged_reverse_it->second);
-        DCHECK_NE(merged_native_entries_map_.end(), it);
-        it->second = first_free_entry;
-      }
       ++first_free_entry;
     } else {
       if (entry_info.addr) {
@@ -2647,6 +2654,12 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
+  // The object-to-entry maps have one node per heap object and are not
+  // needed anymore. Release them before FillChildren allocates the children
+  // array, so that both do not have to fit into memory at the same time.
+  HeapEntriesMap().swap(entries_map_);
+  SmiEntriesMap().swap(smis_map_);
+
   snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
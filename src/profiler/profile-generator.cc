@@ -690,6 +690,17 @@ void BuildNodeValue(const ProfileNode* node, TracedValue* value) {
 void CpuProfile::StreamPendingTraceEvents() {
   std::vector<const ProfileNode*> pending_nodes = top_down_.TakePendingNodes();
   if (pending_nodes.empty() && samples_.empty()) return;
+
+  // Nobody consumes the chunks unless the category is being traced, so don't
+  // pay for serializing them. Still consume the pending nodes and samples, so
+  // that they are not serialized later on.
+  bool streaming_enabled = false;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(
+      TRACE_DISABLED_BY_DEFAULT("v8.cpu_profiler"), &streaming_enabled);
+  if (!streaming_enabled) {
+    streaming_next_sample_ = samples_.size();
+    return;
+  }
   auto value = TracedValue::Create();
 
   if (!pending_nodes.empty() || streaming_next_sample_ != samples_.size()) {
@@ -85,8 +85,8 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
 
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
-  auto sample =
-      std::make_unique<Sample>(size, node, loc, this, next_sample_id());
+  auto sample = std::make_unique<Sample>(size, node, loc, this,
+                                         next_sample_id(), heap_->gc_count());
   sample->global.SetWeak(sample.get(), OnWeakCallback,
                          WeakCallbackType::kParameter);
   samples_.emplace(sample.get(), std::move(sample));
@@ -280,11 +280,14 @@ const std::vector<v8::AllocationProfile::Sample>
 SamplingHeapProfiler::BuildSamples() const {
   std::vector<v8::AllocationProfile::Sample> samples;
   samples.reserve(samples_.size());
+  int gc_count = heap_->gc_count();
   for (const auto& it : samples_) {
     const Sample* sample = it.second.get();
+    DCHECK_GE(gc_count, sample->gc_count_at_allocation);
     samples.emplace_back(v8::AllocationProfile::Sample{
         sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+        sample->sample_id,
+        static_cast<uint32_t>(gc_count - sample->gc_count_at_allocation)});
   }
   return samples;
 }
@@ -4,6 +4,8 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <bitset>
+
 #include "src/base/optional.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
@@ -153,12 +155,14 @@ class NfaInterpreter {
         blocked_threads_(0, zone),
         register_array_allocator_(zone),
         best_match_registers_(base::nullopt),
+        start_ranges_(0, zone),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
     DCHECK_LE(input_index_, input_.length());
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(), -1);
+    ComputeStartRanges();
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -354,6 +358,11 @@ class NfaInterpreter {
         if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
       }
 
+      if (CanSkipInputChar(input_char)) {
+        SkipToPossibleMatchStart();
+        continue;
+      }
+
       // We unblock all blocked_threads_ by feeding them the input char.
       FlushBlockedThreads(input_char);
 
@@ -460,6 +469,130 @@ class NfaInterpreter {
     blocked_threads_.DropAndClear();
   }
 
+  // The compiler emits the bytecode of unanchored regexps with the preamble
+  //
+  //     0: FORK 2
+  //     1: JMP 4
+  //     2: CONSUME_RANGE [0x0000, 0xFFFF]
+  //     3: FORK 2
+  //     4: SET_REGISTER_TO_CP 0
+  //     5: <pattern>
+  //
+  // If every match has to consume at least one character, we collect the
+  // ranges of the CONSUME_RANGE instructions that are reachable from the start
+  // of the pattern without consuming input.  An input character outside of
+  // these ranges cannot begin a match.
+  static constexpr int kPreambleConsumePc = 2;
+  static constexpr int kPatternStartPc = 5;
+
+  void ComputeStartRanges() {
+    if (bytecode_.length() <= kPatternStartPc) return;
+    const RegExpInstruction::Uc16Range any_char = {0x0000, 0xFFFF};
+    if (bytecode_[0].opcode != RegExpInstruction::FORK ||
+        bytecode_[0].payload.pc != kPreambleConsumePc ||
+        bytecode_[1].opcode != RegExpInstruction::JMP ||
+        bytecode_[1].payload.pc != 4 ||
+        bytecode_[2].opcode != RegExpInstruction::CONSUME_RANGE ||
+        bytecode_[2].payload.consume_range.min != any_char.min ||
+        bytecode_[2].payload.consume_range.max != any_char.max ||
+        bytecode_[3].opcode != RegExpInstruction::FORK ||
+        bytecode_[3].payload.pc != kPreambleConsumePc ||
+        bytecode_[4].opcode != RegExpInstruction::SET_REGISTER_TO_CP ||
+        bytecode_[4].payload.register_index != 0) {
+      return;
+    }
+
+    is_start_pc_ = base::Vector<bool>(zone_->NewArray<bool>(bytecode_.length()),
+                                      bytecode_.length());
+    std::fill(is_start_pc_.begin(), is_start_pc_.end(), false);
+    ZoneList<int> worklist(4, zone_);
+    worklist.Add(kPatternStartPc, zone_);
+    while (!worklist.is_empty()) {
+      int pc = worklist.RemoveLast();
+      if (is_start_pc_[pc]) continue;
+      is_start_pc_[pc] = true;
+      RegExpInstruction inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          if (inst.payload.consume_range.min == any_char.min &&
+              inst.payload.consume_range.max == any_char.max) {
+            // Every character can begin a match.
+            start_ranges_.DropAndClear();
+            return;
+          }
+          start_ranges_.Add(inst.payload.consume_range, zone_);
+          break;
+        case RegExpInstruction::FORK:
+          worklist.Add(inst.payload.pc, zone_);
+          worklist.Add(pc + 1, zone_);
+          break;
+        case RegExpInstruction::JMP:
+          worklist.Add(inst.payload.pc, zone_);
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+          worklist.Add(pc + 1, zone_);
+          break;
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::ACCEPT:
+          // Matches may be empty or depend on the context; don't skip.
+          start_ranges_.DropAndClear();
+          return;
+      }
+    }
+    DCHECK(!is_start_pc_[kPreambleConsumePc]);
+
+    for (const RegExpInstruction::Uc16Range& range : start_ranges_) {
+      for (int c = range.min; c <= range.max && c < kOneByteTableSize; ++c) {
+        one_byte_start_table_.set(c);
+      }
+    }
+  }
+
+  bool IsPossibleMatchStart(base::uc16 c) const {
+    if (c < kOneByteTableSize) return one_byte_start_table_.test(c);
+    for (const RegExpInstruction::Uc16Range& range : start_ranges_) {
+      if (c >= range.min && c <= range.max) return true;
+    }
+    return false;
+  }
+
+  // Whether feeding `input_char` to the blocked threads leaves nothing but the
+  // preamble thread, i.e. the same state as starting the search afresh at the
+  // next input position.  That's the case if no match has been found yet and
+  // all blocked threads wait at the beginning of the pattern for a character
+  // that `input_char` isn't.
+  bool CanSkipInputChar(base::uc16 input_char) const {
+    if (start_ranges_.is_empty() || FoundMatch()) return false;
+    if (IsPossibleMatchStart(input_char)) return false;
+    for (const InterpreterThread& t : blocked_threads_) {
+      if (t.pc != kPreambleConsumePc && !is_start_pc_[t.pc]) return false;
+    }
+    return true;
+  }
+
+  // Discards all threads and restarts the search from pc 0 at the next input
+  // position where a match could begin.  `input_index_` points to the
+  // character after the one that is skipped.
+  void SkipToPossibleMatchStart() {
+    for (InterpreterThread t : blocked_threads_) {
+      DestroyThread(t);
+    }
+    blocked_threads_.DropAndClear();
+
+    while (input_index_ != input_.length() &&
+           !IsPossibleMatchStart(input_[input_index_])) {
+      ++input_index_;
+    }
+    // Without remaining input, a match would have to be empty, which is
+    // impossible.
+    if (input_index_ == input_.length()) return;
+
+    active_threads_.Add(
+        InterpreterThread{0, NewRegisterArray(kUndefinedRegisterValue)}, zone_);
+    RunActiveThreads();
+  }
+
   bool FoundMatch() const { return best_match_registers_.has_value(); }
 
   base::Vector<int> GetRegisterArray(InterpreterThread t) {
@@ -551,6 +684,14 @@ class NfaInterpreter {
   // `register_array_allocator_`.
   base::Optional<base::Vector<int>> best_match_registers_;
 
+  // The character ranges that a match can begin with, empty if unknown.  See
+  // `ComputeStartRanges`.  `is_start_pc_` marks the instructions reachable
+  // from the start of the pattern without consuming input.
+  static constexpr int kOneByteTableSize = 256;
+  ZoneList<RegExpInstruction::Uc16Range> start_ranges_;
+  std::bitset<kOneByteTableSize> one_byte_start_table_;
+  base::Vector<bool> is_start_pc_;
+
   Zone* zone_;
 };
 
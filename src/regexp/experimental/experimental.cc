@@ -4,6 +4,7 @@
 
 #include "src/regexp/experimental/experimental.h"
 
+#include "src/codegen/compilation-cache.h"
 #include "src/common/assert-scope.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental-compiler.h"
@@ -14,17 +15,29 @@
 namespace v8 {
 namespace internal {
 
+#ifdef DEBUG
+namespace {
+
+// Besides regexps with the linear flag, the experimental engine also runs
+// regexps that were switched over after falling back to it.
+bool IsEnabled() {
+  return FLAG_enable_experimental_regexp_engine ||
+         FLAG_enable_experimental_regexp_engine_on_excessive_backtracks;
+}
+
+}  // namespace
+#endif  // DEBUG
+
 bool ExperimentalRegExp::CanBeHandled(RegExpTree* tree, RegExpFlags flags,
                                       int capture_count) {
-  DCHECK(FLAG_enable_experimental_regexp_engine ||
-         FLAG_enable_experimental_regexp_engine_on_excessive_backtracks);
+  DCHECK(IsEnabled());
   return ExperimentalRegExpCompiler::CanBeHandled(tree, flags, capture_count);
 }
 
 void ExperimentalRegExp::Initialize(Isolate* isolate, Handle<JSRegExp> re,
                                     Handle<String> source, RegExpFlags flags,
                                     int capture_count) {
-  DCHECK(FLAG_enable_experimental_regexp_engine);
+  DCHECK(IsEnabled());
   if (FLAG_trace_experimental_regexp_engine) {
     StdoutStream{} << "Initializing experimental regexp " << *source
                    << std::endl;
@@ -35,7 +48,7 @@ void ExperimentalRegExp::Initialize(Isolate* isolate, Handle<JSRegExp> re,
 }
 
 bool ExperimentalRegExp::IsCompiled(Handle<JSRegExp> re, Isolate* isolate) {
-  DCHECK(FLAG_enable_experimental_regexp_engine);
+  DCHECK(IsEnabled());
   DCHECK_EQ(re->type_tag(), JSRegExp::EXPERIMENTAL);
 #ifdef VERIFY_HEAP
   re->JSRegExpVerify(isolate);
@@ -99,7 +112,7 @@ base::Optional<CompilationResult> CompileImpl(Isolate* isolate,
 }  // namespace
 
 bool ExperimentalRegExp::Compile(Isolate* isolate, Handle<JSRegExp> re) {
-  DCHECK(FLAG_enable_experimental_regexp_engine);
+  DCHECK(IsEnabled());
   DCHECK_EQ(re->type_tag(), JSRegExp::EXPERIMENTAL);
 #ifdef VERIFY_HEAP
   re->JSRegExpVerify(isolate);
@@ -165,7 +178,7 @@ int32_t ExperimentalRegExp::ExecRaw(Isolate* isolate,
                                     int32_t* output_registers,
                                     int32_t output_register_count,
                                     int32_t subject_index) {
-  DCHECK(FLAG_enable_experimental_regexp_engine);
+  DCHECK(IsEnabled());
   DisallowGarbageCollection no_gc;
 
   if (FLAG_trace_experimental_regexp_engine) {
@@ -185,7 +198,7 @@ int32_t ExperimentalRegExp::MatchForCallFromJs(
     Address subject, int32_t start_position, Address input_start,
     Address input_end, int* output_registers, int32_t output_register_count,
     RegExp::CallOrigin call_origin, Isolate* isolate, Address regexp) {
-  DCHECK(FLAG_enable_experimental_regexp_engine);
+  DCHECK(IsEnabled());
   DCHECK_NOT_NULL(isolate);
   DCHECK_NOT_NULL(output_registers);
   DCHECK(call_origin == RegExp::CallOrigin::kFromJs);
@@ -207,7 +220,7 @@ MaybeHandle<Object> ExperimentalRegExp::Exec(
     Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
     int subject_index, Handle<RegExpMatchInfo> last_match_info,
     RegExp::ExecQuirks exec_quirks) {
-  DCHECK(FLAG_enable_experimental_regexp_engine);
+  DCHECK(IsEnabled());
   DCHECK_EQ(regexp->type_tag(), JSRegExp::EXPERIMENTAL);
 #ifdef VERIFY_HEAP
   regexp->JSRegExpVerify(isolate);
@@ -280,6 +293,40 @@ int32_t ExperimentalRegExp::OneshotExecRaw(Isolate* isolate,
                      output_register_count, subject_index);
 }
 
+bool ExperimentalRegExp::SwitchFromIrregexp(Isolate* isolate,
+                                            Handle<JSRegExp> regexp) {
+  DCHECK(FLAG_enable_experimental_regexp_engine_on_excessive_backtracks);
+  DCHECK_EQ(regexp->type_tag(), JSRegExp::IRREGEXP);
+
+  Handle<String> source(regexp->source(), isolate);
+  JSRegExp::Flags flags = regexp->flags();
+  Handle<FixedArray> irregexp_data(FixedArray::cast(regexp->data()), isolate);
+
+  if (FLAG_trace_experimental_regexp_engine) {
+    StdoutStream{} << "Switching regexp " << *source
+                   << " to the experimental engine" << std::endl;
+  }
+
+  isolate->factory()->SetRegExpExperimentalData(regexp, source, flags,
+                                                regexp->capture_count());
+  if (!Compile(isolate, regexp)) {
+    DCHECK(isolate->has_pending_exception());
+    return false;
+  }
+
+  // Regexps that are created from the same literal later on share the data
+  // through the compilation cache; let them start on the experimental engine
+  // right away.
+  CompilationCache* compilation_cache = isolate->compilation_cache();
+  Handle<FixedArray> cached;
+  if (compilation_cache->LookupRegExp(source, flags).ToHandle(&cached) &&
+      cached.is_identical_to(irregexp_data)) {
+    compilation_cache->PutRegExp(
+        source, flags, handle(FixedArray::cast(regexp->data()), isolate));
+  }
+  return true;
+}
+
 MaybeHandle<Object> ExperimentalRegExp::OneshotExec(
     Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
     int subject_index, Handle<RegExpMatchInfo> last_match_info,
@@ -287,6 +334,15 @@ MaybeHandle<Object> ExperimentalRegExp::OneshotExec(
   DCHECK(FLAG_enable_experimental_regexp_engine_on_excessive_backtracks);
   DCHECK_NE(regexp->type_tag(), JSRegExp::NOT_COMPILED);
 
+  // A regexp that backtracked excessively once is likely to do so again, so
+  // we stop running it on the backtracking engine first.
+  if (FLAG_experimental_regexp_engine_after_fallback &&
+      regexp->type_tag() == JSRegExp::IRREGEXP) {
+    if (!SwitchFromIrregexp(isolate, regexp)) return MaybeHandle<Object>();
+    return Exec(isolate, regexp, subject, subject_index, last_match_info,
+                exec_quirks);
+  }
+
   int capture_count = regexp->capture_count();
   int output_register_count = JSRegExp::RegistersForCaptureCount(capture_count);
 
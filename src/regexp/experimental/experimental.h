@@ -46,11 +46,16 @@ class ExperimentalRegExp final : public AllStatic {
                          int32_t output_register_count, int32_t subject_index);
 
   // Compile and execute a regexp with the experimental engine, regardless of
-  // its type tag.  The regexp itself is not changed (apart from lastIndex).
+  // its type tag.  The regexp itself is not changed (apart from lastIndex),
+  // unless --experimental-regexp-engine-after-fallback switches it to the
+  // experimental engine for good.
   static MaybeHandle<Object> OneshotExec(
       Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
       int index, Handle<RegExpMatchInfo> last_match_info,
       RegExp::ExecQuirks exec_quirks = RegExp::ExecQuirks::kNone);
+  // Replaces the irregexp data of `regexp` by compiled experimental data.
+  V8_WARN_UNUSED_RESULT
+  static bool SwitchFromIrregexp(Isolate* isolate, Handle<JSRegExp> regexp);
   static int32_t OneshotExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
                                 Handle<String> subject,
                                 int32_t* output_registers,
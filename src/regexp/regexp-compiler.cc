@@ -2924,6 +2924,17 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
 
   int lookahead_width = max_lookahead + 1 - min_lookahead;
 
+  // Scanning one position at a time is always safe here, since the loop
+  // below only ever skips positions whose character at {max_lookahead}
+  // differs from {single_character}. Assemblers with vector support do this
+  // faster than the strided loop.
+  if (found_single_character &&
+      masm->SkipUntilCharacterAfterAnd(
+          max_lookahead, single_character,
+          max_char_ > kSize ? RegExpMacroAssembler::kTableMask : 0xFFFF)) {
+    return;
+  }
+
   if (found_single_character && lookahead_width == 1 && max_lookahead < 3) {
     // The mask-compare can probably handle this better.
     return;
@@ -133,7 +133,7 @@ class BacktrackStack {
 
   V8_WARN_UNUSED_RESULT bool push(int v) {
     data_.emplace_back(v);
-    return (static_cast<int>(data_.size()) <= kMaxSize);
+    return (static_cast<int>(data_.size()) <= max_size_);
   }
   int peek() const {
     DCHECK(!data_.empty());
@@ -160,8 +160,8 @@ class BacktrackStack {
   using ValueT = int;
   base::SmallVector<ValueT, kStaticCapacity> data_;
 
-  static constexpr int kMaxSize =
-      RegExpStack::kMaximumStackSize / sizeof(ValueT);
+  const int max_size_ =
+      static_cast<int>(RegExpStack::MaximumStackSize() / sizeof(ValueT));
 };
 
 // Registers used during interpreter execution. These consist of output
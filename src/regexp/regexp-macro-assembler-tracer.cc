@@ -367,6 +367,16 @@ void RegExpMacroAssemblerTracer::CheckBitInTable(
   assembler_->CheckBitInTable(table, on_bit_set);
 }
 
+bool RegExpMacroAssemblerTracer::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                            uint32_t c,
+                                                            uint32_t mask) {
+  bool supported = assembler_->SkipUntilCharacterAfterAnd(cp_offset, c, mask);
+  PrintF(
+      " SkipUntilCharacterAfterAnd(cp_offset=%d, c=0x%04x, mask=0x%04x): %s;\n",
+      cp_offset, c, mask, supported ? "true" : "false");
+  return supported;
+}
+
 
 void RegExpMacroAssemblerTracer::CheckNotBackReference(int start_reg,
                                                        bool read_backward,
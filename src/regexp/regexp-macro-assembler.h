@@ -117,6 +117,18 @@ class RegExpMacroAssembler {
     return false;
   }
 
+  // Advances the current position to the first position (at or after the
+  // current one) at which the character at {cp_offset}, and-ed with {mask},
+  // equals {c}. If there is no such position, advances to the position at
+  // which the character at {cp_offset} would be just past the end of the
+  // input. Used to quickly skip over input that cannot match; returns false
+  // if no such (vectorized) skip is available, in which case nothing was
+  // emitted.
+  virtual bool SkipUntilCharacterAfterAnd(int cp_offset, uint32_t c,
+                                          uint32_t mask) {
+    return false;
+  }
+
   // Control-flow integrity:
   // Define a jump target and bind a label.
   virtual void BindJumpTarget(Label* label) { Bind(label); }
@@ -4,7 +4,10 @@
 
 #include "src/regexp/regexp-stack.h"
 
+#include <algorithm>
+
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/utils/memcopy.h"
 
 namespace v8 {
@@ -23,7 +26,10 @@ RegExpStackScope::~RegExpStackScope() {
 
 RegExpStack::RegExpStack() : thread_local_(this) {}
 
-RegExpStack::~RegExpStack() { thread_local_.FreeAndInvalidate(); }
+RegExpStack::~RegExpStack() {
+  thread_local_.FreeAndInvalidate();
+  ReleaseCachedMemory();
+}
 
 char* RegExpStack::ArchiveStack(char* to) {
   if (!thread_local_.owns_memory_) {
@@ -47,7 +53,7 @@ char* RegExpStack::RestoreStack(char* from) {
 }
 
 void RegExpStack::ThreadLocal::ResetToStaticStack(RegExpStack* regexp_stack) {
-  if (owns_memory_) DeleteArray(memory_);
+  if (owns_memory_) regexp_stack->ReleaseMemory(memory_, memory_size_);
 
   memory_ = regexp_stack->static_stack_;
   memory_top_ = regexp_stack->static_stack_ + kStaticStackSize;
@@ -70,16 +76,48 @@ void RegExpStack::ThreadLocal::FreeAndInvalidate() {
   limit_ = kMemoryTop;
 }
 
+void RegExpStack::ReleaseMemory(byte* memory, size_t size) {
+  if (size <= kMaximumCachedStackSize && size > cached_memory_size_) {
+    ReleaseCachedMemory();
+    cached_memory_ = memory;
+    cached_memory_size_ = size;
+  } else {
+    DeleteArray(memory);
+  }
+}
+
+void RegExpStack::ReleaseCachedMemory() {
+  if (cached_memory_ != nullptr) DeleteArray(cached_memory_);
+  cached_memory_ = nullptr;
+  cached_memory_size_ = 0;
+}
+
+// static
+size_t RegExpStack::MaximumStackSize() {
+  return std::min(kMaximumStackSize, FLAG_regexp_stack_size_limit * KB);
+}
+
 Address RegExpStack::EnsureCapacity(size_t size) {
-  if (size > kMaximumStackSize) return kNullAddress;
+  if (size > MaximumStackSize()) return kNullAddress;
   if (thread_local_.memory_size_ < size) {
     if (size < kMinimumDynamicStackSize) size = kMinimumDynamicStackSize;
-    byte* new_memory = NewArray<byte>(size);
+    byte* new_memory;
+    if (cached_memory_size_ >= size) {
+      // Reuse the cached buffer in its entirety.
+      new_memory = cached_memory_;
+      size = cached_memory_size_;
+      cached_memory_ = nullptr;
+      cached_memory_size_ = 0;
+    } else {
+      new_memory = NewArray<byte>(size);
+    }
     if (thread_local_.memory_size_ > 0) {
       // Copy original memory into top of new memory.
       MemCopy(new_memory + size - thread_local_.memory_size_,
               thread_local_.memory_, thread_local_.memory_size_);
-      if (thread_local_.owns_memory_) DeleteArray(thread_local_.memory_);
+      if (thread_local_.owns_memory_) {
+        ReleaseMemory(thread_local_.memory_, thread_local_.memory_size_);
+      }
     }
     ptrdiff_t delta = sp_top_delta();
     thread_local_.memory_ = new_memory;
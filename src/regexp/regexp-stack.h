@@ -76,9 +76,17 @@ class RegExpStack final {
   char* RestoreStack(char* from);
   void FreeThreadResources() { thread_local_.ResetToStaticStack(this); }
 
+  // Releases the dynamic stack memory kept around for reuse by later
+  // executions. Called by the GC when it is asked to reduce memory usage.
+  void ReleaseCachedMemory();
+
   // Maximal size of allocated stack area.
   static constexpr size_t kMaximumStackSize = 64 * MB;
 
+  // The maximal size of the stack area for this process, i.e.
+  // kMaximumStackSize further bounded by --regexp-stack-size-limit.
+  static size_t MaximumStackSize();
+
  private:
   // Artificial limit used when the thread-local state has been destroyed.
   static const Address kMemoryTop =
@@ -99,6 +107,17 @@ class RegExpStack final {
 
   STATIC_ASSERT(kStaticStackSize <= kMaximumStackSize);
 
+  // Dynamic stacks up to this size are not freed when a top-level execution
+  // finishes but kept in {cached_memory_}, so that repeated executions of
+  // regexps with moderate backtracking don't allocate and free a fresh
+  // buffer each time. Larger stacks are freed eagerly.
+  static constexpr size_t kMaximumCachedStackSize = 1 * MB;
+  byte* cached_memory_ = nullptr;
+  size_t cached_memory_size_ = 0;
+
+  // Frees {memory} or keeps it in {cached_memory_} for later reuse.
+  void ReleaseMemory(byte* memory, size_t size);
+
   // Structure holding the allocated memory, size and limit. Thread switching
   // archives and restores this struct.
   struct ThreadLocal {
@@ -4,6 +4,10 @@
 
 #include "src/regexp/regexp.h"
 
+#include <unordered_map>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/strings.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/diagnostics/code-tracer.h"
@@ -178,6 +182,12 @@ bool HasFewDifferentCharacters(Handle<String> pattern) {
   return true;
 }
 
+// Sticky atoms only compare the pattern at lastIndex, which the optimized
+// global atom paths (replace, match) do not support.
+bool CanUseAtomForStickiness(RegExpFlags flags) {
+  return !IsSticky(flags) || !IsGlobal(flags);
+}
+
 }  // namespace
 
 // Generic RegExp methods. Dispatches to implementation specific methods.
@@ -238,12 +248,13 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
     ExperimentalRegExp::Initialize(isolate, re, pattern, flags,
                                    parse_result.capture_count);
     has_been_compiled = true;
-  } else if (parse_result.simple && !IsIgnoreCase(flags) && !IsSticky(flags) &&
-             !HasFewDifferentCharacters(pattern)) {
+  } else if (parse_result.simple && !IsIgnoreCase(flags) &&
+             CanUseAtomForStickiness(flags) &&
+             (IsSticky(flags) || !HasFewDifferentCharacters(pattern))) {
     // Parse-tree is a single atom that is equal to the pattern.
     RegExpImpl::AtomCompile(isolate, re, pattern, flags, pattern);
     has_been_compiled = true;
-  } else if (parse_result.tree->IsAtom() && !IsSticky(flags) &&
+  } else if (parse_result.tree->IsAtom() && CanUseAtomForStickiness(flags) &&
              parse_result.capture_count == 0) {
     RegExpAtom* atom = parse_result.tree->AsAtom();
     // The pattern source might (?) contain escape sequences, but they're
@@ -253,7 +264,8 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, atom_string,
         isolate->factory()->NewStringFromTwoByte(atom_pattern), Object);
-    if (!IsIgnoreCase(flags) && !HasFewDifferentCharacters(atom_string)) {
+    if (!IsIgnoreCase(flags) &&
+        (IsSticky(flags) || !HasFewDifferentCharacters(atom_string))) {
       RegExpImpl::AtomCompile(isolate, re, pattern, flags, atom_string);
       has_been_compiled = true;
     }
@@ -349,6 +361,20 @@ void SetAtomLastCapture(Isolate* isolate,
   last_match_info->SetCapture(1, to);
 }
 
+// Returns the position of the first occurrence of {pattern} in {subject} at
+// or after {index}, or -1. Sticky atoms only match at exactly {index}.
+template <typename SubjectChar, typename PatternChar>
+int SearchAtom(Isolate* isolate, base::Vector<const SubjectChar> subject,
+               base::Vector<const PatternChar> pattern, int index,
+               bool sticky) {
+  if (!sticky) return SearchString(isolate, subject, pattern, index);
+  if (pattern.length() > subject.length() - index) return -1;
+  return CompareCharsEqual(subject.begin() + index, pattern.begin(),
+                           pattern.length())
+             ? index
+             : -1;
+}
+
 }  // namespace
 
 int RegExpImpl::AtomExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
@@ -369,6 +395,7 @@ int RegExpImpl::AtomExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
     return RegExp::RE_FAILURE;
   }
 
+  const bool sticky = IsSticky(JSRegExp::AsRegExpFlags(regexp->flags()));
   for (int i = 0; i < output_size; i += 2) {
     String::FlatContent needle_content = needle.GetFlatContent(no_gc);
     String::FlatContent subject_content = subject->GetFlatContent(no_gc);
@@ -378,15 +405,18 @@ int RegExpImpl::AtomExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
     index =
         (needle_content.IsOneByte()
              ? (subject_content.IsOneByte()
-                    ? SearchString(isolate, subject_content.ToOneByteVector(),
-                                   needle_content.ToOneByteVector(), index)
-                    : SearchString(isolate, subject_content.ToUC16Vector(),
-                                   needle_content.ToOneByteVector(), index))
+                    ? SearchAtom(isolate, subject_content.ToOneByteVector(),
+                                 needle_content.ToOneByteVector(), index,
+                                 sticky)
+                    : SearchAtom(isolate, subject_content.ToUC16Vector(),
+                                 needle_content.ToOneByteVector(), index,
+                                 sticky))
              : (subject_content.IsOneByte()
-                    ? SearchString(isolate, subject_content.ToOneByteVector(),
-                                   needle_content.ToUC16Vector(), index)
-                    : SearchString(isolate, subject_content.ToUC16Vector(),
-                                   needle_content.ToUC16Vector(), index)));
+                    ? SearchAtom(isolate, subject_content.ToOneByteVector(),
+                                 needle_content.ToUC16Vector(), index, sticky)
+                    : SearchAtom(isolate, subject_content.ToUC16Vector(),
+                                 needle_content.ToUC16Vector(), index,
+                                 sticky)));
     if (index == -1) {
       return i / 2;  // Return number of matches.
     } else {
@@ -527,6 +557,72 @@ Handle<FixedArray> RegExp::CreateCaptureNameMap(
   return array;
 }
 
+namespace {
+
+// Irregexp bytecode only consists of plain bytes and doesn't refer to any
+// heap objects, so it can be shared among all isolates of the process. This
+// cache maps the pattern, flags and backtrack limit of a regexp to the
+// bytecode generated for it, such that other isolates can skip parsing and
+// compiling the same regexps again. Regexps with named captures are not
+// cached, since their capture name map has to be created from the parse tree.
+class SharedRegExpBytecodeCache {
+ public:
+  struct Entry {
+    std::vector<uint8_t> bytecode;
+    int register_count;
+    uint32_t backtrack_limit;
+  };
+
+  static std::string KeyFor(String pattern, RegExpFlags flags,
+                            bool is_one_byte, uint32_t backtrack_limit) {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = pattern.GetFlatContent(no_gc);
+    DCHECK(content.IsFlat());
+    std::string key;
+    key.push_back(content.IsOneByte() ? 1 : 2);
+    key.push_back(is_one_byte ? 1 : 2);
+    key.append(reinterpret_cast<const char*>(&flags), sizeof(flags));
+    key.append(reinterpret_cast<const char*>(&backtrack_limit),
+               sizeof(backtrack_limit));
+    if (content.IsOneByte()) {
+      base::Vector<const uint8_t> chars = content.ToOneByteVector();
+      key.append(reinterpret_cast<const char*>(chars.begin()), chars.size());
+    } else {
+      base::Vector<const base::uc16> chars = content.ToUC16Vector();
+      key.append(reinterpret_cast<const char*>(chars.begin()),
+                 chars.size() * sizeof(base::uc16));
+    }
+    return key;
+  }
+
+  bool Lookup(const std::string& key, Entry* entry) {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return false;
+    *entry = it->second;
+    return true;
+  }
+
+  void Insert(std::string key, Entry entry) {
+    base::MutexGuard guard(&mutex_);
+    // The cache is only meant for the regexp literals of an application, so
+    // we simply stop adding new entries once it is full.
+    if (entries_.size() >= kMaxEntries) return;
+    entries_.emplace(std::move(key), std::move(entry));
+  }
+
+ private:
+  static constexpr size_t kMaxEntries = 1024;
+
+  base::Mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SharedRegExpBytecodeCache,
+                                GetSharedRegExpBytecodeCache)
+
+}  // namespace
+
 bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                  Handle<String> sample_subject,
                                  bool is_one_byte) {
@@ -540,6 +636,31 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
 
   Handle<String> pattern(re->source(), isolate);
   pattern = String::Flatten(isolate, pattern);
+
+  std::string shared_cache_key;
+  if (FLAG_regexp_shared_bytecode_cache && re->ShouldProduceBytecode()) {
+    shared_cache_key = SharedRegExpBytecodeCache::KeyFor(
+        *pattern, flags, is_one_byte, re->backtrack_limit());
+    SharedRegExpBytecodeCache::Entry entry;
+    if (GetSharedRegExpBytecodeCache()->Lookup(shared_cache_key, &entry)) {
+      Handle<ByteArray> bytecode = isolate->factory()->NewByteArray(
+          static_cast<int>(entry.bytecode.size()), AllocationType::kOld);
+      bytecode->copy_in(0, entry.bytecode.data(),
+                        static_cast<int>(entry.bytecode.size()));
+      FixedArray data = FixedArray::cast(re->data());
+      data.set(JSRegExp::bytecode_index(is_one_byte), *bytecode);
+      data.set(JSRegExp::code_index(is_one_byte),
+               *BUILTIN_CODE(isolate, RegExpInterpreterTrampoline));
+      re->set_capture_name_map(Handle<FixedArray>());
+      if (entry.register_count > IrregexpMaxRegisterCount(data)) {
+        SetIrregexpMaxRegisterCount(data, entry.register_count);
+      }
+      data.set(JSRegExp::kIrregexpBacktrackLimit,
+               Smi::FromInt(entry.backtrack_limit));
+      return true;
+    }
+  }
+
   RegExpCompileData compile_data;
   if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, pattern, flags,
                                                &compile_data)) {
@@ -585,6 +706,17 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
     Handle<CodeT> trampoline =
         BUILTIN_CODE(isolate, RegExpInterpreterTrampoline);
     data->set(JSRegExp::code_index(is_one_byte), *trampoline);
+
+    if (!shared_cache_key.empty() && compile_data.named_captures == nullptr) {
+      ByteArray bytecode = ByteArray::cast(*compile_data.code);
+      SharedRegExpBytecodeCache::Entry entry;
+      entry.bytecode.assign(bytecode.GetDataStartAddress(),
+                            bytecode.GetDataEndAddress());
+      entry.register_count = compile_data.register_count;
+      entry.backtrack_limit = backtrack_limit;
+      GetSharedRegExpBytecodeCache()->Insert(std::move(shared_cache_key),
+                                             std::move(entry));
+    }
   }
   Handle<FixedArray> capture_name_map =
       RegExp::CreateCaptureNameMap(isolate, compile_data.named_captures);
@@ -1057,11 +1189,12 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
     case JSRegExp::NOT_COMPILED:
       UNREACHABLE();
     case JSRegExp::ATOM: {
-      // ATOM regexps do not have a global loop, so we search for one match at
-      // a time.
+      // ATOM regexps are searched for repeatedly by AtomExecRaw until the
+      // register array is filled, so we can batch matches just like native
+      // irregexp code does.
       static const int kAtomRegistersPerMatch = 2;
       registers_per_match_ = kAtomRegistersPerMatch;
-      register_array_size_ = registers_per_match_;
+      register_array_size_ = Isolate::kJSRegexpStaticOffsetsVectorSize;
       break;
     }
     case JSRegExp::IRREGEXP: {
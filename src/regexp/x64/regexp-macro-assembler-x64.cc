@@ -578,6 +578,78 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
   BranchOrBacktrack(not_equal, on_bit_set);
 }
 
+bool RegExpMacroAssemblerX64::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                         uint32_t c,
+                                                         uint32_t mask) {
+  // Only one-byte subjects are supported: 16 characters are compared at once
+  // with SSE2, the remaining ones one by one.
+  if (mode_ != LATIN1) return false;
+  DCHECK_LE(c, String::kMaxOneByteCharCode);
+  mask &= String::kMaxOneByteCharCode;
+  // Masking may only clear the topmost bit, such that at most two different
+  // characters have to be compared.
+  uint32_t other = c;
+  if (mask == (String::kMaxOneByteCharCode >> 1)) {
+    other = c | (mask + 1);
+  } else if (mask != String::kMaxOneByteCharCode) {
+    return false;
+  }
+  if ((c & mask) != c) return false;
+
+  Label vector_loop, vector_found, scalar_loop, done;
+  // rax: offset (from the end of input) of the character to check next.
+  __ leaq(rax, Operand(rdi, cp_offset));
+  __ movl(rbx, Immediate(c * 0x01010101));
+  __ movd(xmm0, rbx);
+  __ pshufd(xmm0, xmm0, 0);
+  if (other != c) {
+    __ movl(rbx, Immediate(other * 0x01010101));
+    __ movd(xmm1, rbx);
+    __ pshufd(xmm1, xmm1, 0);
+  }
+
+  __ bind(&vector_loop);
+  __ cmpq(rax, Immediate(-kSimd128Size));
+  __ j(greater, &scalar_loop);
+  __ movdqu(xmm2, Operand(rsi, rax, times_1, 0));
+  if (other != c) {
+    __ movdqa(xmm3, xmm2);
+    __ pcmpeqb(xmm3, xmm1);
+  }
+  __ pcmpeqb(xmm2, xmm0);
+  if (other != c) __ por(xmm2, xmm3);
+  __ pmovmskb(rbx, xmm2);
+  __ testl(rbx, rbx);
+  __ j(not_zero, &vector_found);
+  __ addq(rax, Immediate(kSimd128Size));
+  __ jmp(&vector_loop);
+
+  __ bind(&vector_found);
+  __ bsfl(rbx, rbx);
+  __ addq(rax, rbx);
+  __ jmp(&done);
+
+  // Fewer than 16 characters are left.
+  __ bind(&scalar_loop);
+  __ testq(rax, rax);
+  // If no character was found, {rax} is at the end of input now.
+  __ j(greater_equal, &done);
+  __ movzxbl(rbx, Operand(rsi, rax, times_1, 0));
+  if (other != c) __ andl(rbx, Immediate(mask));
+  __ cmpl(rbx, Immediate(c));
+  __ j(equal, &done);
+  __ incq(rax);
+  __ jmp(&scalar_loop);
+
+  __ bind(&done);
+  // Never move backwards, e.g. if the current position was already beyond
+  // the end of input - {cp_offset}.
+  __ subq(rax, Immediate(cp_offset));
+  __ cmpq(rax, rdi);
+  __ cmovq(greater, rdi, rax);
+  return true;
+}
+
 bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(
     StandardCharacterSet type, Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
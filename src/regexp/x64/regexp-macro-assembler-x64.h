@@ -53,6 +53,8 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
   bool CheckCharacterNotInRangeArray(const ZoneList<CharacterRange>* ranges,
                                      Label* on_not_in_range) override;
   void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) override;
+  bool SkipUntilCharacterAfterAnd(int cp_offset, uint32_t c,
+                                  uint32_t mask) override;
 
   // Checks whether the given offset from the current position is before
   // the end of the string.
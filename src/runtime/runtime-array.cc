@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <vector>
+
 #include "src/debug/debug.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
@@ -216,6 +219,36 @@ RUNTIME_FUNCTION(Runtime_IsArray) {
   return isolate->heap()->ToBoolean(obj.IsJSArray());
 }
 
+// Sorts the first {length} elements of the Array.prototype.sort work array
+// with the default comparator, provided they are all Smis. Comparing Smis as
+// strings has no side effects, so the elements can be sorted directly instead
+// of going through the TimSort builtin. Returns false and leaves the work
+// array untouched if any element is not a Smi.
+RUNTIME_FUNCTION(Runtime_ArraySortSmisDefault) {
+  SealHandleScope shs(isolate);
+  DCHECK_EQ(2, args.length());
+  FixedArray work_array = FixedArray::cast(args[0]);
+  int length = args.smi_value_at(1);
+  CHECK_LE(length, work_array.length());
+
+  std::vector<Smi> elements;
+  elements.reserve(length);
+  for (int i = 0; i < length; i++) {
+    Object element = work_array.get(i);
+    if (!element.IsSmi()) return ReadOnlyRoots(isolate).false_value();
+    elements.push_back(Smi::cast(element));
+  }
+
+  // The spec requires a stable sort.
+  std::stable_sort(elements.begin(), elements.end(), [=](Smi x, Smi y) {
+    return Smi(Smi::LexicographicCompare(isolate, x, y)).value() < 0;
+  });
+  for (int i = 0; i < length; i++) {
+    work_array.set(i, elements[i], SKIP_WRITE_BARRIER);
+  }
+  return ReadOnlyRoots(isolate).true_value();
+}
+
 RUNTIME_FUNCTION(Runtime_ArraySpeciesConstructor) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
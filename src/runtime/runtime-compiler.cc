@@ -253,23 +253,30 @@ RUNTIME_FUNCTION(Runtime_CompileOptimizedOSR) {
 
   Handle<JSFunction> function(frame->function(), isolate);
   if (IsConcurrent(mode)) {
-    // The synchronous fallback mechanism triggers if we've already got OSR'd
-    // code for the current function but at a different OSR offset - that may
-    // indicate we're having trouble hitting the correct JumpLoop for code
-    // installation. In this case, fall back to synchronous OSR.
-    base::Optional<BytecodeOffset> cached_osr_offset =
-        function->native_context().osr_code_cache().FirstOsrOffsetFor(
+    // The cache may hold entries for several loops of the same function, and
+    // any of them is entered from its own JumpLoop. If we've already got OSR'd
+    // code for the current function but only at other OSR offsets, we missed
+    // the loop the code was compiled for. Queue another concurrent job for
+    // the current loop, which is likely to still be running once the job
+    // completes. Only if that keeps happening do we fall back to synchronous
+    // OSR, since we seem to have trouble hitting the correct JumpLoop for
+    // code installation.
+    std::vector<BytecodeOffset> cached_osr_offsets =
+        function->native_context().osr_code_cache().OsrOffsetsFor(
             function->shared());
-    if (cached_osr_offset.has_value() &&
-        cached_osr_offset.value() != osr_offset) {
+    const bool is_cached =
+        std::find(cached_osr_offsets.begin(), cached_osr_offsets.end(),
+                  osr_offset) != cached_osr_offsets.end();
+    if (!is_cached && static_cast<int>(cached_osr_offsets.size()) >=
+                          FLAG_concurrent_osr_max_cached_entries) {
       if (V8_UNLIKELY(FLAG_trace_osr)) {
         CodeTracer::Scope scope(isolate->GetCodeTracer());
         PrintF(
             scope.file(),
             "[OSR - falling back to synchronous compilation due to mismatched "
-            "cached entry. function: %s, requested: %d, cached: %d]\n",
+            "cached entries. function: %s, requested: %d, cached: %zu]\n",
             function->DebugNameCStr().get(), osr_offset.ToInt(),
-            cached_osr_offset.value().ToInt());
+            cached_osr_offsets.size());
       }
       mode = ConcurrencyMode::kSynchronous;
     }
@@ -19,6 +19,7 @@
 #include "src/logging/counters.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/js-array-inl.h"
+#include "src/objects/lookup-cache-inl.h"
 #include "src/objects/map-updater.h"
 #include "src/objects/property-descriptor-object.h"
 #include "src/objects/property-descriptor.h"
@@ -517,6 +518,100 @@ RUNTIME_FUNCTION(Runtime_AddPrivateBrand) {
   return *receiver;
 }
 
+namespace {
+
+// Computes the map of the empty {target} after Object.assign(target, source)
+// for the case where that assignment just copies the fields of {source_map}
+// to the same offsets, or returns an empty handle otherwise.
+MaybeHandle<Map> ComputeObjectAssignCloneMap(Isolate* isolate,
+                                             Handle<JSObject> target,
+                                             Handle<Map> source_map) {
+  Handle<Map> target_map(target->map(), isolate);
+  DCHECK_EQ(0, target_map->NumberOfOwnDescriptors());
+  if (source_map->instance_type() != JS_OBJECT_TYPE ||
+      source_map->is_dictionary_map() || source_map->is_deprecated() ||
+      source_map->IsInobjectSlackTrackingInProgress() ||
+      target_map->IsInobjectSlackTrackingInProgress() ||
+      source_map->NumberOfOwnDescriptors() == 0 ||
+      source_map->GetInObjectPropertiesStartInWords() !=
+          target_map->GetInObjectPropertiesStartInWords()) {
+    return {};
+  }
+
+  // All fields have to keep their offsets: either both maps have the same
+  // number of in-object properties, or all fields of {source_map} are
+  // in-object and fit into the in-object properties of {target_map}.
+  int source_inobject = source_map->GetInObjectProperties();
+  int target_inobject = target_map->GetInObjectProperties();
+  int fields = source_map->NumberOfFields(ConcurrencyMode::kSynchronous);
+  if (source_inobject != target_inobject &&
+      (source_inobject > target_inobject || fields > source_inobject)) {
+    return {};
+  }
+
+  Handle<DescriptorArray> source_descriptors(
+      source_map->instance_descriptors(isolate), isolate);
+  for (InternalIndex i : source_map->IterateOwnDescriptors()) {
+    PropertyDetails details = source_descriptors->GetDetails(i);
+    Handle<Name> key(source_descriptors->GetKey(i), isolate);
+    if (details.kind() != PropertyKind::kData ||
+        details.location() != PropertyLocation::kField ||
+        !details.IsEnumerable() || key->IsPrivate()) {
+      return {};
+    }
+    // The [[Set]] on {target} must define a new own data property, i.e. the
+    // prototype chain must not have a setter, a read-only property or an
+    // interceptor for {key}.
+    PropertyKey lookup_key(isolate, key);
+    LookupIterator it(isolate, target, lookup_key);
+    if (it.state() != LookupIterator::NOT_FOUND &&
+        (it.state() != LookupIterator::DATA || it.IsReadOnly())) {
+      return {};
+    }
+  }
+
+  Handle<Map> map = Map::Copy(isolate, target_map, "ObjectAssignClone");
+  int size = source_map->NumberOfOwnDescriptors();
+  Handle<DescriptorArray> descriptors = DescriptorArray::CopyForFastObjectClone(
+      isolate, source_descriptors, size, 0);
+  map->InitializeDescriptors(isolate, *descriptors);
+  if (source_inobject == target_inobject) {
+    map->CopyUnusedPropertyFieldsAdjustedForInstanceSize(*source_map);
+  } else {
+    map->SetInObjectUnusedPropertyFields(target_inobject - fields);
+  }
+  map->set_may_have_interesting_symbols(
+      source_map->may_have_interesting_symbols());
+  return map;
+}
+
+}  // namespace
+
+// Called by the ObjectAssign builtin when the ObjectAssignCache has no valid
+// entry for the maps of the empty {target} and the JSObject {source}. Returns
+// the map for copying the fields of {source} into {target}, or undefined.
+RUNTIME_FUNCTION(Runtime_ObjectAssignCloneMap) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  Handle<JSObject> target = args.at<JSObject>(0);
+  Handle<JSObject> source = args.at<JSObject>(1);
+  Handle<Map> target_map(target->map(), isolate);
+  Handle<Map> source_map(source->map(), isolate);
+
+  Handle<Object> validity_cell =
+      Map::GetOrCreatePrototypeChainValidityCell(target_map, isolate);
+  Handle<Map> result_map;
+  bool found = ComputeObjectAssignCloneMap(isolate, target, source_map)
+                   .ToHandle(&result_map);
+  if (validity_cell->IsCell()) {
+    isolate->object_assign_cache()->Update(
+        *target_map, *source_map, found ? *result_map : Map(),
+        Cell::cast(*validity_cell));
+  }
+  if (!found) return ReadOnlyRoots(isolate).undefined_value();
+  return *result_map;
+}
+
 // ES6 section 19.1.2.2 Object.create ( O [ , Properties ] )
 // TODO(verwaest): Support the common cases with precached map directly in
 // an Object.create stub.
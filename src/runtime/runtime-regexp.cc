@@ -1227,6 +1227,13 @@ static Object SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
 
   FixedArrayBuilder builder(result_elements);
 
+  // Arguments array to replace function is match, captures, index and
+  // subject, i.e., 3 + capture count in total. If the RegExp contains named
+  // captures, they are also passed as the last argument.
+  Handle<Object> maybe_capture_map(regexp->capture_name_map(), isolate);
+  const bool has_named_captures = maybe_capture_map->IsFixedArray();
+  const int argc = has_named_captures ? 4 + capture_count : 3 + capture_count;
+
   // Position to search from.
   int match_start = -1;
   int match_end = 0;
@@ -1259,16 +1266,6 @@ static Object SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
       }
 
       if (has_capture) {
-        // Arguments array to replace function is match, captures, index and
-        // subject, i.e., 3 + capture count in total. If the RegExp contains
-        // named captures, they are also passed as the last argument.
-
-        Handle<Object> maybe_capture_map(regexp->capture_name_map(), isolate);
-        const bool has_named_captures = maybe_capture_map->IsFixedArray();
-
-        const int argc =
-            has_named_captures ? 4 + capture_count : 3 + capture_count;
-
         Handle<FixedArray> elements = isolate->factory()->NewFixedArray(argc);
         int cursor = 0;
 
@@ -1278,6 +1275,12 @@ static Object SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
           if (start >= 0) {
             int end = current_match[i * 2 + 1];
             DCHECK(start <= end);
+            if (start == match_start && end == match_end) {
+              // Captures spanning the entire match, e.g. in /(\w+)/, share
+              // the match string.
+              elements->set(cursor++, *match);
+              continue;
+            }
             Handle<String> substring =
                 isolate->factory()->NewSubString(subject, start, end);
             elements->set(cursor++, *substring);
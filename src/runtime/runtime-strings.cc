@@ -176,6 +176,40 @@ RUNTIME_FUNCTION(Runtime_InternalizeString) {
   return *isolate->factory()->InternalizeString(string);
 }
 
+namespace {
+
+// Flattening copies the whole string, which for large strings that are still
+// being built (e.g. by repeated appending) dominates the cost of reading a
+// character. With --lazy-cons-string-flattening such strings are only
+// flattened if the character is deeper than kMaxConsStringAccessDepth levels
+// in the tree. A string that stops growing is then never flattened, and every
+// read keeps paying for the walk, which is why this is off by default.
+constexpr int kMinConsStringLengthToAccessInPlace = 64 * KB;
+constexpr int kMaxConsStringAccessDepth = 32;
+
+bool TryGetConsStringCharacter(Isolate* isolate, ConsString cons, int index,
+                               uint16_t* result) {
+  DisallowGarbageCollection no_gc;
+  String string = cons;
+  for (int depth = 0; depth < kMaxConsStringAccessDepth; depth++) {
+    ConsString current = ConsString::cast(string);
+    String first = current.first();
+    if (index < first.length()) {
+      string = first;
+    } else {
+      index -= first.length();
+      string = current.second();
+    }
+    if (!string.IsConsString()) {
+      *result = string.Get(index, isolate);
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 RUNTIME_FUNCTION(Runtime_StringCharCodeAt) {
   HandleScope handle_scope(isolate);
   DCHECK_EQ(2, args.length());
@@ -183,9 +217,21 @@ RUNTIME_FUNCTION(Runtime_StringCharCodeAt) {
   Handle<String> subject = args.at<String>(0);
   uint32_t i = NumberToUint32(args[1]);
 
+  if (FLAG_lazy_cons_string_flattening && subject->IsConsString() &&
+      !subject->IsFlat() &&
+      subject->length() >= kMinConsStringLengthToAccessInPlace &&
+      i < static_cast<uint32_t>(subject->length())) {
+    uint16_t result;
+    if (TryGetConsStringCharacter(isolate, ConsString::cast(*subject),
+                                  static_cast<int>(i), &result)) {
+      return Smi::FromInt(result);
+    }
+  }
+
   // Flatten the string.  If someone wants to get a char at an index
   // in a cons string, it is likely that more indices will be
-  // accessed.
+  // accessed. This is skipped above for large strings with
+  // --lazy-cons-string-flattening.
   subject = String::Flatten(isolate, subject);
 
   if (i >= static_cast<uint32_t>(subject->length())) {
@@ -81,6 +81,36 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Integer element types with at most 16 bits have few enough distinct values
+// that a counting sort is cheaper than std::sort once the array is at least
+// as long as the histogram. Returns false if {data} was left unsorted.
+template <typename T>
+bool TryCountingSort(T* data, size_t length) {
+  if constexpr (!std::is_integral<T>::value || sizeof(T) > 2) {
+    return false;
+  } else {
+    using U = typename std::make_unsigned<T>::type;
+    constexpr size_t kNumValues = size_t{1} << (kBitsPerByte * sizeof(T));
+    if (length < kNumValues) return false;
+
+    // Flipping the sign bit of signed values maps them to histogram buckets
+    // in ascending order.
+    constexpr U kBias =
+        std::is_signed<T>::value ? U{1} << (kBitsPerByte * sizeof(T) - 1) : 0;
+    std::vector<size_t> counts(kNumValues, 0);
+    for (size_t i = 0; i < length; i++) {
+      counts[static_cast<U>(static_cast<U>(data[i]) ^ kBias)]++;
+    }
+    T* out = data;
+    for (size_t bucket = 0; bucket < kNumValues; bucket++) {
+      const T value = static_cast<T>(static_cast<U>(bucket ^ kBias));
+      out = std::fill_n(out, counts[bucket], value);
+    }
+    DCHECK_EQ(out, data + length);
+    return true;
+  }
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -144,6 +174,8 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
       } else {                                                             \
         std::sort(data, data + length, CompareNum<ctype>);                 \
       }                                                                    \
+    } else if (TryCountingSort(data, length)) {                            \
+      /* Sorted in place. */                                               \
     } else {                                                               \
       if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
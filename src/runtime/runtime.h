@@ -44,6 +44,7 @@ namespace internal {
   F(ArrayIncludes_Slow, 3, 1)          \
   F(ArrayIndexOf, 3, 1)                \
   F(ArrayIsArray, 1, 1)                \
+  F(ArraySortSmisDefault, 2, 1)        \
   F(ArraySpeciesConstructor, 1, 1)     \
   F(GrowArrayElements, 2, 1)           \
   F(IsArray, 1, 1)                     \
@@ -325,6 +326,7 @@ namespace internal {
   F(LoadPrivateGetter, 1, 1)                                           \
   F(LoadPrivateSetter, 1, 1)                                           \
   F(NewObject, 2, 1)                                                   \
+  F(ObjectAssignCloneMap, 2, 1)                                        \
   F(ObjectCreate, 2, 1)                                                \
   F(ObjectEntries, 1, 1)                                               \
   F(ObjectEntriesSkipFastPath, 1, 1)                                   \
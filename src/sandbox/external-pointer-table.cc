@@ -28,8 +28,11 @@ uint32_t ExternalPointerTable::Sweep(Isolate* isolate) {
   // which helps defragment the table. This method must run either on the
   // mutator thread or while the mutator is stopped. Also clear marking bits on
   // live entries.
-  // TODO(v8:10391, saelo) could also shrink the table using DecommitPages() if
-  // elements at the end are free. This might require some form of compaction.
+  // TODO(v8:10391, saelo) entries in the middle of the table are never moved,
+  // so a few live entries can still keep otherwise empty blocks alive. This
+  // would require some form of compaction.
+  Shrink();
+
   uint32_t freelist_size = 0;
   uint32_t current_freelist_head = 0;
 
@@ -56,6 +59,32 @@ uint32_t ExternalPointerTable::Sweep(Isolate* isolate) {
   return num_active_entries;
 }
 
+void ExternalPointerTable::Shrink() {
+  // Find the last live entry. Everything above it is garbage.
+  uint32_t last_live = 0;
+  for (uint32_t i = capacity_ - 1; i > 0; i--) {
+    if (is_marked(load(i))) {
+      last_live = i;
+      break;
+    }
+  }
+
+  // Keep one empty block as slack, so that a table with a fluctuating number
+  // of entries doesn't have to grow again right after every GC.
+  uint32_t new_capacity = static_cast<uint32_t>(
+      RoundUp(last_live + 1, kEntriesPerBlock) + kEntriesPerBlock);
+  if (new_capacity >= capacity_) return;
+
+  // Decommitted pages read as zero once they are made accessible again by
+  // Grow(), which then re-initializes them anyway.
+  VirtualAddressSpace* root_space = GetPlatformVirtualAddressSpace();
+  Address start = entry_address(new_capacity);
+  size_t size = (capacity_ - new_capacity) * sizeof(Address);
+  DCHECK(IsAligned(size, root_space->page_size()));
+  CHECK(root_space->DecommitPages(start, size));
+  capacity_ = new_capacity;
+}
+
 uint32_t ExternalPointerTable::Grow() {
   // Freelist should be empty.
   DCHECK_EQ(0, freelist_head_);
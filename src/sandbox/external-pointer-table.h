@@ -51,7 +51,8 @@ class Isolate;
  *    marking bit using an atomic CAS operation.
  *  - When marking is finished, Sweep() iterates of the table once while the
  *    mutator is stopped and builds a freelist from all dead entries while also
- *    removing the marking bit from any live entry.
+ *    removing the marking bit from any live entry. Blocks at the end of the
+ *    table that only contain dead entries are decommitted first.
  *
  * The freelist is a singly-linked list, using the lower 32 bits of each entry
  * to store the index of the next free entry. When the freelist is empty and a
@@ -127,6 +128,10 @@ class V8_EXPORT_PRIVATE ExternalPointerTable {
   // TODO(saelo) this can fail, deal with that appropriately.
   uint32_t Grow();
 
+  // Decommits the blocks at the end of the table that only contain dead
+  // entries, except for one. Must only be called from Sweep().
+  void Shrink();
+
   // Computes the address of the specified entry.
   inline Address entry_address(uint32_t index) const {
     return buffer_ + index * sizeof(Address);
@@ -47,6 +47,28 @@ CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
 
+namespace {
+
+// Returns a bitmap with the bits for the function literal ids of the
+// functions of |script| that currently have bytecode set, i.e. of the ones a
+// code cache produced now would contain compiled.
+std::vector<byte> CompiledFunctionsBitmap(Isolate* isolate, Script script) {
+  DisallowGarbageCollection no_gc;
+  std::vector<byte> bitmap;
+  SharedFunctionInfo::ScriptIterator iter(isolate, script);
+  for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (!info.is_compiled()) continue;
+    const size_t id = static_cast<size_t>(info.function_literal_id());
+    const size_t index = id / kBitsPerByte;
+    if (index >= bitmap.size()) bitmap.resize(index + 1);
+    bitmap[index] |= 1 << (id % kBitsPerByte);
+  }
+  return bitmap;
+}
+
+}  // namespace
+
 // static
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
     Handle<SharedFunctionInfo> info) {
@@ -76,6 +98,7 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   HandleScope scope(isolate);
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
                                  source, script->origin_options()));
+  cs.compiled_functions_ = CompiledFunctionsBitmap(isolate, *script);
   DisallowGarbageCollection no_gc;
   cs.reference_map()->AddAttachedReference(*source);
   AlignedCachedData* cached_data = cs.SerializeSharedFunctionInfo(info);
@@ -95,6 +118,34 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   return result;
 }
 
+// static
+bool CodeSerializer::HasNewCompiledFunctions(Handle<SharedFunctionInfo> info,
+                                             AlignedCachedData* cached_data) {
+  Isolate* isolate = info->GetIsolate();
+  HandleScope scope(isolate);
+  Handle<Script> script(Script::cast(info->script()), isolate);
+  Handle<String> source(String::cast(script->source()), isolate);
+  SerializedCodeSanityCheckResult sanity_check_result =
+      SerializedCodeSanityCheckResult::kSuccess;
+  const SerializedCodeData scd = SerializedCodeData::FromCachedData(
+      cached_data,
+      SerializedCodeData::SourceHash(source, script->origin_options()),
+      &sanity_check_result);
+  if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
+    return true;
+  }
+  // Compare the compiled state function by function. Comparing counts would
+  // miss e.g. one function having been flushed and another one compiled
+  // since the cache was produced.
+  const base::Vector<const byte> cached = scd.CompiledFunctions();
+  const std::vector<byte> current = CompiledFunctionsBitmap(isolate, *script);
+  for (size_t i = 0; i < current.size(); ++i) {
+    const byte cached_bits = i < cached.size() ? cached[i] : 0;
+    if ((current[i] & ~cached_bits) != 0) return true;
+  }
+  return false;
+}
+
 AlignedCachedData* CodeSerializer::SerializeSharedFunctionInfo(
     Handle<SharedFunctionInfo> info) {
   DisallowGarbageCollection no_gc;
@@ -143,6 +194,11 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
     if (SerializeReadOnlyObject(raw, no_gc)) return;
 
     instance_type = raw.map().instance_type();
+    // The code cache only contains bytecode and its metadata. Optimized code
+    // is deliberately never serialized: it embeds isolate-specific heap
+    // constants and maps, and its validity hinges on CompilationDependencies
+    // that are registered on the heap objects of the compiling isolate and
+    // cannot be re-established after deserialization.
     CHECK(!InstanceTypeChecker::IsCode(instance_type));
 
     if (ElideObject(raw)) {
@@ -184,6 +240,7 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
   } else if (InstanceTypeChecker::IsSharedFunctionInfo(instance_type)) {
     Handle<DebugInfo> debug_info;
     bool restore_bytecode = false;
+    uint32_t flush_count;
     {
       DisallowGarbageCollection no_gc;
       SharedFunctionInfo sfi = SharedFunctionInfo::cast(*obj);
@@ -205,8 +262,13 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
         debug_info = handle(raw_debug_info, isolate());
       }
       DCHECK(!sfi.HasDebugInfo());
+      // The flush count reflects how this isolate used the function, which
+      // doesn't carry over to the isolates consuming the cache.
+      flush_count = sfi.flush_count();
+      sfi.set_flush_count(0);
     }
     SerializeGeneric(obj);
+    SharedFunctionInfo::cast(*obj).set_flush_count(flush_count);
     // Restore debug info
     if (!debug_info.is_null()) {
       DisallowGarbageCollection no_gc;
@@ -580,14 +642,19 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
   DisallowGarbageCollection no_gc;
 
   // Calculate sizes.
-  uint32_t size = kHeaderSize + static_cast<uint32_t>(payload->size());
+  const std::vector<byte>& compiled_functions = cs->compiled_functions();
+  const uint32_t compiled_functions_size =
+      static_cast<uint32_t>(compiled_functions.size());
+  const uint32_t payload_offset =
+      kHeaderSize + POINTER_SIZE_ALIGN(compiled_functions_size);
+  uint32_t size = payload_offset + static_cast<uint32_t>(payload->size());
   DCHECK(IsAligned(size, kPointerAlignment));
 
   // Allocate backing store and create result data.
   AllocateData(size);
 
   // Zero out pre-payload data. Part of that is only used for padding.
-  memset(data_, 0, kHeaderSize);
+  memset(data_, 0, payload_offset);
 
   // Set header values.
   SetMagicNumber();
@@ -595,12 +662,15 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
   SetHeaderValue(kSourceHashOffset, cs->source_hash());
   SetHeaderValue(kFlagHashOffset, FlagList::Hash());
   SetHeaderValue(kPayloadLengthOffset, static_cast<uint32_t>(payload->size()));
+  SetHeaderValue(kCompiledFunctionsLengthOffset, compiled_functions_size);
 
   // Zero out any padding in the header.
   memset(data_ + kUnalignedHeaderSize, 0, kHeaderSize - kUnalignedHeaderSize);
 
-  // Copy serialized data.
-  CopyBytes(data_ + kHeaderSize, payload->data(),
+  // Copy the compiled functions bitmap and the serialized data.
+  CopyBytes(data_ + kHeaderSize, compiled_functions.data(),
+            compiled_functions.size());
+  CopyBytes(data_ + payload_offset, payload->data(),
             static_cast<size_t>(payload->size()));
   uint32_t checksum =
       FLAG_verify_snapshot_checksum ? Checksum(ChecksummedContent()) : 0;
@@ -640,9 +710,13 @@ SerializedCodeSanityCheckResult SerializedCodeData::SanityCheckWithoutSource()
   if (flags_hash != FlagList::Hash()) {
     return SerializedCodeSanityCheckResult::kFlagsMismatch;
   }
+  uint32_t compiled_functions_length =
+      GetHeaderValue(kCompiledFunctionsLengthOffset);
   uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
   uint32_t max_payload_length = this->size_ - kHeaderSize;
-  if (payload_length > max_payload_length) {
+  if (compiled_functions_length > max_payload_length ||
+      payload_length > max_payload_length -
+                           POINTER_SIZE_ALIGN(compiled_functions_length)) {
     return SerializedCodeSanityCheckResult::kLengthMismatch;
   }
   if (FLAG_verify_snapshot_checksum) {
@@ -675,8 +749,15 @@ AlignedCachedData* SerializedCodeData::GetScriptData() {
   return result;
 }
 
+base::Vector<const byte> SerializedCodeData::CompiledFunctions() const {
+  return base::Vector<const byte>(
+      data_ + kHeaderSize, GetHeaderValue(kCompiledFunctionsLengthOffset));
+}
+
 base::Vector<const byte> SerializedCodeData::Payload() const {
-  const byte* payload = data_ + kHeaderSize;
+  const byte* payload =
+      data_ + kHeaderSize +
+      POINTER_SIZE_ALIGN(GetHeaderValue(kCompiledFunctionsLengthOffset));
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(payload), kPointerAlignment));
   int length = GetHeaderValue(kPayloadLengthOffset);
   DCHECK_EQ(data_ + size_, payload + length);
@@ -75,6 +75,13 @@ class CodeSerializer : public Serializer {
   V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* Serialize(
       Handle<SharedFunctionInfo> info);
 
+  // Returns whether serializing |info| now would produce a cache with more
+  // compiled functions than |cached_data|, e.g. because functions were
+  // compiled lazily after |cached_data| was produced. Also returns true if
+  // |cached_data| would be rejected for |info|.
+  V8_EXPORT_PRIVATE static bool HasNewCompiledFunctions(
+      Handle<SharedFunctionInfo> info, AlignedCachedData* cached_data);
+
   AlignedCachedData* SerializeSharedFunctionInfo(
       Handle<SharedFunctionInfo> info);
 
@@ -93,6 +100,9 @@ class CodeSerializer : public Serializer {
                              ScriptOriginOptions origin_options);
 
   uint32_t source_hash() const { return source_hash_; }
+  const std::vector<byte>& compiled_functions() const {
+    return compiled_functions_;
+  }
 
  protected:
   CodeSerializer(Isolate* isolate, uint32_t source_hash);
@@ -109,6 +119,8 @@ class CodeSerializer : public Serializer {
 
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
+  // Bitmap of the function literal ids of the script's compiled functions.
+  std::vector<byte> compiled_functions_;
 };
 
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
@@ -120,13 +132,18 @@ class SerializedCodeData : public SerializedData {
   // [2] source hash
   // [3] flag hash
   // [4] payload length
-  // [5] payload checksum
+  // [5] length of the compiled functions bitmap
+  // [6] checksum of the bitmap and the payload
+  // ...  compiled functions bitmap, padded to pointer size
   // ...  serialized payload
   static const uint32_t kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
   static const uint32_t kSourceHashOffset = kVersionHashOffset + kUInt32Size;
   static const uint32_t kFlagHashOffset = kSourceHashOffset + kUInt32Size;
   static const uint32_t kPayloadLengthOffset = kFlagHashOffset + kUInt32Size;
-  static const uint32_t kChecksumOffset = kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kCompiledFunctionsLengthOffset =
+      kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kChecksumOffset =
+      kCompiledFunctionsLengthOffset + kUInt32Size;
   static const uint32_t kUnalignedHeaderSize = kChecksumOffset + kUInt32Size;
   static const uint32_t kHeaderSize = POINTER_SIZE_ALIGN(kUnalignedHeaderSize);
 
@@ -155,6 +172,10 @@ class SerializedCodeData : public SerializedData {
 
   base::Vector<const byte> Payload() const;
 
+  // Bitmap of the function literal ids of the functions that were compiled
+  // when the cache was produced. See CodeSerializer::HasNewCompiledFunctions.
+  base::Vector<const byte> CompiledFunctions() const;
+
   static uint32_t SourceHash(Handle<String> source,
                              ScriptOriginOptions origin_options);
 
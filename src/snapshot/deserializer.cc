@@ -19,6 +19,7 @@
 #include "src/interpreter/interpreter.h"
 #include "src/logging/local-logger.h"
 #include "src/logging/log.h"
+#include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/backing-store.h"
 #include "src/objects/cell-inl.h"
@@ -264,6 +265,7 @@ Deserializer<IsolateT>::Deserializer(IsolateT* isolate,
 template <typename IsolateT>
 void Deserializer<IsolateT>::Rehash() {
   DCHECK(should_rehash());
+  RCS_SCOPE(isolate(), RuntimeCallCounterId::kDeserializeRehash);
   for (Handle<HeapObject> item : to_rehash_) {
     item->RehashBasedOnMap(isolate());
   }
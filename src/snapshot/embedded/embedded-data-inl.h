@@ -153,6 +153,14 @@ uint32_t EmbeddedData::PaddedInstructionSizeOfBuiltin(Builtin builtin) const {
   return PadAndAlignCode(size);
 }
 
+Builtin EmbeddedData::BuiltinInCodeOrder(int index) const {
+  DCHECK_LE(0, index);
+  DCHECK_LT(index, Builtins::kBuiltinCount);
+  const uint32_t* table =
+      reinterpret_cast<const uint32_t*>(data_ + CodeOrderTableOffset());
+  return Builtins::FromInt(static_cast<int>(table[index]));
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -4,6 +4,9 @@
 
 #include "src/snapshot/embedded/embedded-data.h"
 
+#include <algorithm>
+
+#include "src/builtins/profile-data-reader.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/callable.h"
 #include "src/codegen/interface-descriptors-inl.h"
@@ -21,7 +24,7 @@ namespace {
 Builtin TryLookupCode(const EmbeddedData& d, Address address) {
   if (!d.IsInCodeRange(address)) return Builtin::kNoBuiltinId;
 
-  if (address < d.InstructionStartOfBuiltin(static_cast<Builtin>(0))) {
+  if (address < d.InstructionStartOfBuiltin(d.BuiltinInCodeOrder(0))) {
     return Builtin::kNoBuiltinId;
   }
 
@@ -32,7 +35,7 @@ Builtin TryLookupCode(const EmbeddedData& d, Address address) {
   int l = 0, r = Builtins::kBuiltinCount;
   while (l < r) {
     const int mid = (l + r) / 2;
-    const Builtin builtin = Builtins::FromInt(mid);
+    const Builtin builtin = d.BuiltinInCodeOrder(mid);
     Address start = d.InstructionStartOfBuiltin(builtin);
     Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin);
 
@@ -263,6 +266,40 @@ void FinalizeEmbeddedCodeTargets(Isolate* isolate, EmbeddedData* blob) {
   }
 }
 
+// Returns the order in which builtins are laid out in the code section. By
+// default this is ID order. With --reorder-builtins, builtins are sorted by
+// how often their entry block was hit while profiling so that hot builtins
+// are packed together at the start of the section and never-executed ones
+// end up at the back. Bytecode handlers are left at the end, in ID order,
+// since they are required to form a single contiguous range.
+std::vector<Builtin> ComputeCodeOrder() {
+  std::vector<Builtin> order;
+  order.reserve(Builtins::kBuiltinCount);
+  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+       ++builtin) {
+    order.push_back(builtin);
+  }
+  if (!FLAG_reorder_builtins || FLAG_turbo_profiling_log_file == nullptr) {
+    return order;
+  }
+
+  std::vector<double> entry_counts(Builtins::kBuiltinCount);
+  for (Builtin builtin : order) {
+    const ProfileDataFromFile* profile =
+        ProfileDataFromFile::TryRead(Builtins::name(builtin));
+    entry_counts[static_cast<int>(builtin)] =
+        profile == nullptr ? 0 : profile->GetCounter(0);
+  }
+  auto first_bytecode_handler =
+      order.begin() + static_cast<int>(Builtin::kFirstBytecodeHandler);
+  std::stable_sort(order.begin(), first_bytecode_handler,
+                   [&entry_counts](Builtin a, Builtin b) {
+                     return entry_counts[static_cast<int>(a)] >
+                            entry_counts[static_cast<int>(b)];
+                   });
+  return order;
+}
+
 }  // namespace
 
 // static
@@ -297,12 +334,10 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
         static_cast<uint32_t>(code.raw_instruction_size());
     uint32_t metadata_size = static_cast<uint32_t>(code.raw_metadata_size());
 
-    DCHECK_EQ(0, raw_code_size % kCodeAlignment);
     {
       const int builtin_index = static_cast<int>(builtin);
       struct LayoutDescription& layout_desc =
           layout_descriptions[builtin_index];
-      layout_desc.instruction_offset = raw_code_size;
       layout_desc.instruction_length = instruction_size;
       layout_desc.metadata_offset = raw_data_size;
       layout_desc.metadata_length = metadata_size;
@@ -319,7 +354,6 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
           raw_data_size + static_cast<uint32_t>(code.unwinding_info_offset());
     }
     // Align the start of each section.
-    raw_code_size += PadAndAlignCode(instruction_size);
     raw_data_size += PadAndAlignData(metadata_size);
   }
   CHECK_WITH_MSG(
@@ -328,6 +362,20 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
       "isolate-dependent code or aliases the off-heap trampoline register. "
       "If in doubt, ask jgruber@");
 
+  // Metadata is laid out in ID order above; instruction streams follow the
+  // (possibly profile-guided) code order.
+  const std::vector<Builtin> code_order = ComputeCodeOrder();
+  DCHECK_EQ(code_order.size(), kTableSize);
+  std::vector<uint32_t> code_order_table(kTableSize);
+  for (size_t i = 0; i < code_order.size(); i++) {
+    const int builtin_index = static_cast<int>(code_order[i]);
+    struct LayoutDescription& layout_desc = layout_descriptions[builtin_index];
+    DCHECK_EQ(0, raw_code_size % kCodeAlignment);
+    layout_desc.instruction_offset = raw_code_size;
+    raw_code_size += PadAndAlignCode(layout_desc.instruction_length);
+    code_order_table[i] = static_cast<uint32_t>(builtin_index);
+  }
+
   // Allocate space for the code section, value-initialized to 0.
   STATIC_ASSERT(RawCodeOffset() == 0);
   const uint32_t blob_code_size = RawCodeOffset() + raw_code_size;
@@ -355,6 +403,12 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   std::memcpy(blob_data + LayoutDescriptionTableOffset(),
               layout_descriptions.data(), LayoutDescriptionTableSize());
 
+  // .. and the code order table.
+  DCHECK_EQ(CodeOrderTableSize(),
+            sizeof(code_order_table[0]) * code_order_table.size());
+  std::memcpy(blob_data + CodeOrderTableOffset(), code_order_table.data(),
+              CodeOrderTableSize());
+
   // .. and the variable-size data section.
   uint8_t* const raw_metadata_start = blob_data + RawMetadataOffset();
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
@@ -162,6 +162,11 @@ class EmbeddedData final {
   // TODO(v8:11045): Consider removing code alignment.
   inline uint32_t PaddedInstructionSizeOfBuiltin(Builtin builtin) const;
 
+  // Builtins are not necessarily laid out in ID order (see
+  // --reorder-builtins). Returns the builtin whose instruction section is
+  // the {index}-th one in the code section.
+  inline Builtin BuiltinInCodeOrder(int index) const;
+
   size_t CreateEmbeddedBlobDataHash() const;
   size_t CreateEmbeddedBlobCodeHash() const;
   size_t EmbeddedBlobDataHash() const {
@@ -232,11 +237,12 @@ class EmbeddedData final {
   // [2] hash of embedded-blob-relevant heap objects
   // [3] layout description of instruction stream 0
   // ... layout descriptions
-  // [x] metadata section of builtin 0
+  // [x] builtin ids, sorted by instruction offset
+  // [y] metadata section of builtin 0
   // ... metadata sections
   //
   // code:
-  // [0] instruction section of builtin 0
+  // [0] instruction section of the first builtin in code order
   // ... instruction sections
 
   static constexpr uint32_t kTableSize = Builtins::kBuiltinCount;
@@ -256,9 +262,15 @@ class EmbeddedData final {
   static constexpr uint32_t LayoutDescriptionTableSize() {
     return sizeof(struct LayoutDescription) * kTableSize;
   }
-  static constexpr uint32_t FixedDataSize() {
+  static constexpr uint32_t CodeOrderTableOffset() {
     return LayoutDescriptionTableOffset() + LayoutDescriptionTableSize();
   }
+  static constexpr uint32_t CodeOrderTableSize() {
+    return kUInt32Size * kTableSize;
+  }
+  static constexpr uint32_t FixedDataSize() {
+    return CodeOrderTableOffset() + CodeOrderTableSize();
+  }
   // The variable-size data section starts here.
   static constexpr uint32_t RawMetadataOffset() { return FixedDataSize(); }
 
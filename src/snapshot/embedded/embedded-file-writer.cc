@@ -160,9 +160,10 @@ void EmbeddedFileWriter::WriteCodeSection(PlatformEmbeddedFileWriterBase* w,
   w->DeclareLabel(EmbeddedBlobCodeDataSymbol().c_str());
 
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-       ++builtin) {
-    WriteBuiltin(w, blob, builtin);
+  // Emit builtins in the order they are laid out in the blob, which is not
+  // necessarily ID order (see --reorder-builtins).
+  for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+    WriteBuiltin(w, blob, blob->BuiltinInCodeOrder(i));
   }
   w->PaddingAfterCode();
   w->Newline();
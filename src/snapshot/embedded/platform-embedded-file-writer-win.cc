@@ -111,8 +111,10 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   {
     STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
     Address prev_builtin_end_offset = 0;
-    for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-         ++builtin) {
+    // PDATA entries must be sorted by address, so walk the builtins in the
+    // order they are laid out in the blob (see --reorder-builtins).
+    for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+      const Builtin builtin = blob->BuiltinInCodeOrder(i);
       const int builtin_index = static_cast<int>(builtin);
       // Some builtins are leaf functions from the point of view of Win64 stack
       // walking: they do not move the stack pointer and do not require a PDATA
@@ -122,6 +124,7 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
       uint64_t builtin_start_offset = blob->InstructionStartOfBuiltin(builtin) -
                                       reinterpret_cast<Address>(blob->code());
       uint32_t builtin_size = blob->InstructionSizeOfBuiltin(builtin);
+      DCHECK_LE(prev_builtin_end_offset, builtin_start_offset);
 
       const std::vector<int>& xdata_desc =
           unwind_infos[builtin_index].fp_offsets();
@@ -197,14 +200,19 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   std::vector<win64_unwindinfo::FrameOffsets> fp_adjustments;
 
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-       ++builtin) {
+  // PDATA entries must be sorted by address, so walk the builtins in the
+  // order they are laid out in the blob (see --reorder-builtins).
+  uint64_t prev_builtin_end_offset = 0;
+  for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+    const Builtin builtin = blob->BuiltinInCodeOrder(i);
     const int builtin_index = static_cast<int>(builtin);
     if (unwind_infos[builtin_index].is_leaf_function()) continue;
 
     uint64_t builtin_start_offset = blob->InstructionStartOfBuiltin(builtin) -
                                     reinterpret_cast<Address>(blob->code());
     uint32_t builtin_size = blob->InstructionSizeOfBuiltin(builtin);
+    DCHECK_LE(prev_builtin_end_offset, builtin_start_offset);
+    prev_builtin_end_offset = builtin_start_offset + builtin_size;
 
     const std::vector<int>& xdata_desc =
         unwind_infos[builtin_index].fp_offsets();
@@ -235,6 +243,7 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
       }
     }
   }
+  USE(prev_builtin_end_offset);
   w->EndPdataSection();
   w->Newline();
 
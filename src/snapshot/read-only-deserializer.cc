@@ -8,6 +8,7 @@
 #include "src/execution/v8threads.h"
 #include "src/heap/heap-inl.h"  // crbug.com/v8/8499
 #include "src/heap/read-only-heap.h"
+#include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/slots.h"
 #include "src/snapshot/snapshot.h"
 
@@ -15,6 +16,7 @@ namespace v8 {
 namespace internal {
 
 void ReadOnlyDeserializer::DeserializeIntoIsolate() {
+  RCS_SCOPE(isolate(), RuntimeCallCounterId::kDeserializeReadOnly);
   HandleScope scope(isolate());
 
   ReadOnlyHeap* ro_heap = isolate()->read_only_heap();
@@ -6,12 +6,16 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include <atomic>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/platform.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/isolate-inl.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/numbers/hash-seed-inl.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/snapshot/context-deserializer.h"
@@ -27,6 +31,8 @@
 #include "src/utils/version.h"
 
 #ifdef V8_SNAPSHOT_COMPRESSION
+#include "src/base/optional.h"
+#include "src/init/v8.h"
 #include "src/snapshot/snapshot-compression.h"
 #endif
 
@@ -42,9 +48,10 @@ class SnapshotImpl : public AllStatic {
       const SnapshotData* read_only_snapshot_in,
       const SnapshotData* shared_heap_snapshot_in,
       const std::vector<SnapshotData*>& context_snapshots_in,
-      bool can_be_rehashed);
+      bool can_be_rehashed, uint64_t hash_seed);
 
   static uint32_t ExtractNumContexts(const v8::StartupData* data);
+  static uint64_t ExtractHashSeed(const v8::StartupData* data);
   static uint32_t ExtractContextOffset(const v8::StartupData* data,
                                        uint32_t index);
   static base::Vector<const byte> ExtractStartupData(
@@ -70,12 +77,13 @@ class SnapshotImpl : public AllStatic {
   // Snapshot blob layout:
   // [0] number of contexts N
   // [1] rehashability
-  // [2] checksum
-  // [3] (64 bytes) version string
-  // [4] offset to readonly
-  // [5] offset to shared heap
-  // [6] offset to context 0
-  // [7] offset to context 1
+  // [2] (8 bytes) hash seed the snapshot was created with
+  // [3] checksum
+  // [4] (64 bytes) version string
+  // [5] offset to readonly
+  // [6] offset to shared heap
+  // [7] offset to context 0
+  // [8] offset to context 1
   // ...
   // ... offset to context N - 1
   // ... startup snapshot data
@@ -88,7 +96,8 @@ class SnapshotImpl : public AllStatic {
   // TODO(yangguo): generalize rehashing, and remove this flag.
   static const uint32_t kRehashabilityOffset =
       kNumberOfContextsOffset + kUInt32Size;
-  static const uint32_t kChecksumOffset = kRehashabilityOffset + kUInt32Size;
+  static const uint32_t kHashSeedOffset = kRehashabilityOffset + kUInt32Size;
+  static const uint32_t kChecksumOffset = kHashSeedOffset + kInt64Size;
   static const uint32_t kVersionStringOffset = kChecksumOffset + kUInt32Size;
   static const uint32_t kVersionStringLength = 64;
   static const uint32_t kReadOnlyOffsetOffset =
@@ -119,6 +128,20 @@ class SnapshotImpl : public AllStatic {
 
 }  // namespace
 
+namespace {
+
+// Returns whether the hash tables in the snapshot have to be rehashed. That is
+// not the case if the runtime uses a fixed --hash-seed that matches the seed
+// the snapshot was created with, so embedders that opt out of a random seed
+// can use the deserialized tables as they are.
+bool ShouldRehash(const v8::StartupData* blob) {
+  if (!Snapshot::ExtractRehashability(blob)) return false;
+  return FLAG_hash_seed == 0 ||
+         FLAG_hash_seed != SnapshotImpl::ExtractHashSeed(blob);
+}
+
+}  // namespace
+
 SnapshotData MaybeDecompress(Isolate* isolate,
                              const base::Vector<const byte>& snapshot_data) {
 #ifdef V8_SNAPSHOT_COMPRESSION
@@ -130,6 +153,38 @@ SnapshotData MaybeDecompress(Isolate* isolate,
 #endif
 }
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+namespace {
+
+// Decompresses a single snapshot as a job. The job has a single work item,
+// so at most one thread runs it. Joining the job from the main thread runs
+// the decompression there if no worker has picked it up yet, rather than
+// blocking on a worker that might never get scheduled.
+class SnapshotDecompressionJob final : public JobTask {
+ public:
+  SnapshotDecompressionJob(base::Vector<const byte> compressed_data,
+                           base::Optional<SnapshotData>* result)
+      : compressed_data_(compressed_data), result_(result) {}
+
+  void Run(JobDelegate* delegate) final {
+    if (claimed_.exchange(true, std::memory_order_relaxed)) return;
+    TRACE_EVENT0("v8", "V8.SnapshotDecompress");
+    result_->emplace(SnapshotCompression::Decompress(compressed_data_));
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const final {
+    return claimed_.load(std::memory_order_relaxed) ? 0 : 1;
+  }
+
+ private:
+  const base::Vector<const byte> compressed_data_;
+  base::Optional<SnapshotData>* const result_;
+  std::atomic<bool> claimed_{false};
+};
+
+}  // namespace
+#endif  // V8_SNAPSHOT_COMPRESSION
+
 #ifdef DEBUG
 bool Snapshot::SnapshotIsValid(const v8::StartupData* snapshot_blob) {
   return SnapshotImpl::ExtractNumContexts(snapshot_blob) > 0;
@@ -175,6 +230,33 @@ bool Snapshot::Initialize(Isolate* isolate) {
   base::Vector<const byte> shared_heap_data =
       SnapshotImpl::ExtractSharedHeapData(blob);
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+  // Decompression dominates here, so overlap decompressing the read-only
+  // snapshot with the startup and shared heap snapshots.
+  base::Optional<SnapshotData> read_only_snapshot_data;
+  std::unique_ptr<JobHandle> read_only_decompression_job;
+  if (FLAG_concurrent_snapshot_decompression) {
+    read_only_decompression_job = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserBlocking,
+        std::make_unique<SnapshotDecompressionJob>(read_only_data,
+                                                   &read_only_snapshot_data));
+  } else {
+    read_only_snapshot_data.emplace(MaybeDecompress(isolate, read_only_data));
+  }
+  SnapshotData startup_snapshot_data(MaybeDecompress(isolate, startup_data));
+  SnapshotData shared_heap_snapshot_data(
+      MaybeDecompress(isolate, shared_heap_data));
+  if (read_only_decompression_job) {
+    // Either waits for the worker or decompresses on this thread.
+    RCS_SCOPE(isolate, RuntimeCallCounterId::kSnapshotDecompress);
+    read_only_decompression_job->Join();
+  }
+  DCHECK(read_only_snapshot_data.has_value());
+
+  bool success = isolate->InitWithSnapshot(
+      &startup_snapshot_data, &read_only_snapshot_data.value(),
+      &shared_heap_snapshot_data, ShouldRehash(blob));
+#else
   SnapshotData startup_snapshot_data(MaybeDecompress(isolate, startup_data));
   SnapshotData read_only_snapshot_data(
       MaybeDecompress(isolate, read_only_data));
@@ -183,7 +265,8 @@ bool Snapshot::Initialize(Isolate* isolate) {
 
   bool success = isolate->InitWithSnapshot(
       &startup_snapshot_data, &read_only_snapshot_data,
-      &shared_heap_snapshot_data, ExtractRehashability(blob));
+      &shared_heap_snapshot_data, ShouldRehash(blob));
+#endif  // V8_SNAPSHOT_COMPRESSION
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
     int bytes = startup_data.length();
@@ -202,7 +285,7 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   if (FLAG_profile_deserialization) timer.Start();
 
   const v8::StartupData* blob = isolate->snapshot_blob();
-  bool can_rehash = ExtractRehashability(blob);
+  bool can_rehash = ShouldRehash(blob);
   base::Vector<const byte> context_data = SnapshotImpl::ExtractContextData(
       blob, static_cast<uint32_t>(context_index));
   SnapshotData snapshot_data(MaybeDecompress(isolate, context_data));
@@ -437,7 +520,7 @@ v8::StartupData Snapshot::Create(
   SnapshotData startup_snapshot(&startup_serializer);
   v8::StartupData result = SnapshotImpl::CreateSnapshotBlob(
       &startup_snapshot, &read_only_snapshot, &shared_heap_snapshot,
-      context_snapshots, can_be_rehashed);
+      context_snapshots, can_be_rehashed, HashSeed(isolate));
 
   for (const SnapshotData* ptr : context_snapshots) delete ptr;
 
@@ -461,7 +544,7 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
     const SnapshotData* read_only_snapshot_in,
     const SnapshotData* shared_heap_snapshot_in,
     const std::vector<SnapshotData*>& context_snapshots_in,
-    bool can_be_rehashed) {
+    bool can_be_rehashed, uint64_t hash_seed) {
   TRACE_EVENT0("v8", "V8.SnapshotCompress");
   // Have these separate from snapshot_in for compression, since we need to
   // access the compressed data as well as the uncompressed reservations.
@@ -516,6 +599,11 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
                                num_contexts);
   SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kRehashabilityOffset,
                                can_be_rehashed ? 1 : 0);
+  SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kHashSeedOffset,
+                               static_cast<uint32_t>(hash_seed));
+  SnapshotImpl::SetHeaderValue(data,
+                               SnapshotImpl::kHashSeedOffset + kUInt32Size,
+                               static_cast<uint32_t>(hash_seed >> 32));
 
   // Write version string into snapshot data.
   memset(data + SnapshotImpl::kVersionStringOffset, 0,
@@ -619,6 +707,13 @@ uint32_t SnapshotImpl::ExtractContextOffset(const v8::StartupData* data,
   return context_offset;
 }
 
+uint64_t SnapshotImpl::ExtractHashSeed(const v8::StartupData* data) {
+  CHECK_LT(kHashSeedOffset + kInt64Size, static_cast<uint32_t>(data->raw_size));
+  uint64_t low = GetHeaderValue(data, kHashSeedOffset);
+  uint64_t high = GetHeaderValue(data, kHashSeedOffset + kUInt32Size);
+  return (high << 32) | low;
+}
+
 bool Snapshot::ExtractRehashability(const v8::StartupData* data) {
   CHECK_LT(SnapshotImpl::kRehashabilityOffset,
            static_cast<uint32_t>(data->raw_size));
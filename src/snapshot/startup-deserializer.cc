@@ -8,13 +8,16 @@
 #include "src/codegen/assembler-inl.h"
 #include "src/execution/v8threads.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/paged-spaces-inl.h"
 #include "src/logging/log.h"
+#include "src/logging/runtime-call-stats-scope.h"
 #include "src/snapshot/snapshot.h"
 
 namespace v8 {
 namespace internal {
 
 void StartupDeserializer::DeserializeIntoIsolate() {
+  RCS_SCOPE(isolate(), RuntimeCallCounterId::kDeserializeStartup);
   HandleScope scope(isolate());
 
   // No active threads.
@@ -80,9 +83,18 @@ void StartupDeserializer::LogNewMapEvents() {
 
 void StartupDeserializer::FlushICache() {
   DCHECK(!deserializing_user_code());
-  // The entire isolate is newly deserialized. Simply flush all code pages.
-  for (Page* p : *isolate()->heap()->code_space()) {
-    FlushInstructionCache(p->area_start(), p->area_end() - p->area_start());
+  // The entire isolate is newly deserialized. With embedded builtins, almost
+  // all of code space is taken up by off-heap trampolines whose instructions
+  // live in the (already flushed) embedded blob, so only flush the on-heap
+  // instruction streams rather than every code page.
+  PagedSpaceObjectIterator it(isolate()->heap(),
+                              isolate()->heap()->code_space());
+  for (HeapObject obj = it.Next(); !obj.is_null(); obj = it.Next()) {
+    if (!obj.IsCode()) continue;
+    Code code = Code::cast(obj);
+    if (code.is_off_heap_trampoline()) continue;
+    FlushInstructionCache(code.raw_instruction_start(),
+                          code.raw_instruction_size());
   }
 }
 
@@ -5,6 +5,8 @@
 #ifndef V8_STRINGS_STRING_BUILDER_INL_H_
 #define V8_STRINGS_STRING_BUILDER_INL_H_
 
+#include <memory>
+
 #include "src/common/assert-scope.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
@@ -15,6 +17,9 @@
 #include "src/utils/utils.h"
 
 namespace v8 {
+
+class OutputStream;
+
 namespace internal {
 
 const int kStringBuilderConcatHelperLengthBits = 11;
@@ -193,6 +198,15 @@ class IncrementalStringBuilder {
 
   MaybeHandle<String> Finish();
 
+  // Writes the result as UTF-8 to {stream} while it is being built, in chunks
+  // of stream->GetChunkSize() bytes, instead of accumulating it into a
+  // string. Finish() then ends the stream and returns the empty string. Must
+  // be called before anything is appended.
+  void StreamTo(v8::OutputStream* stream);
+
+  // Whether the output stream asked to abort. Further output is dropped.
+  bool HasAbortedStream() const { return stream_aborted_; }
+
   V8_INLINE bool HasOverflowed() const { return overflowed_; }
 
   int Length() const;
@@ -317,6 +331,13 @@ class IncrementalStringBuilder {
   // Add the current part to the accumulator.
   void Accumulate(Handle<String> new_part);
 
+  // Encode {part} as UTF-8 into the output stream's chunks.
+  void WriteToStream(Handle<String> part);
+  template <typename Char>
+  void WriteCharsToStream(base::Vector<const Char> chars);
+  void WriteCodePointToStream(base::uc32 c);
+  void WriteChunkToStream();
+
   // Finish the current part and allocate a new part.
   void Extend();
 
@@ -344,6 +365,15 @@ class IncrementalStringBuilder {
   int current_index_;
   Handle<String> accumulator_;
   Handle<String> current_part_;
+
+  v8::OutputStream* stream_ = nullptr;
+  std::unique_ptr<char[]> stream_chunk_;
+  int stream_chunk_size_ = 0;
+  int stream_chunk_pos_ = 0;
+  // A lead surrogate at the end of a part is combined with a trail surrogate
+  // at the start of the next one.
+  base::uc16 stream_lead_surrogate_ = 0;
+  bool stream_aborted_ = false;
 };
 
 template <typename SrcChar, typename DestChar>
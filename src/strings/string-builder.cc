@@ -2,11 +2,13 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "include/v8-profiler.h"
 #include "src/base/strings.h"
 #include "src/execution/isolate-inl.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -251,6 +253,10 @@ bool IncrementalStringBuilder::HasValidCurrentIndex() const {
 }
 
 void IncrementalStringBuilder::Accumulate(Handle<String> new_part) {
+  if (stream_ != nullptr) {
+    WriteToStream(new_part);
+    return;
+  }
   Handle<String> new_accumulator;
   if (accumulator()->length() + new_part->length() > String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
@@ -269,6 +275,13 @@ void IncrementalStringBuilder::Extend() {
   if (part_length_ <= kMaxPartLength / kPartLengthGrowthFactor) {
     part_length_ *= kPartLengthGrowthFactor;
   }
+  // A streamed part has been written out already, so it can be refilled.
+  if (stream_ != nullptr && current_part()->length() == part_length_ &&
+      current_part()->IsSeqOneByteString() ==
+          (encoding_ == String::ONE_BYTE_ENCODING)) {
+    current_index_ = 0;
+    return;
+  }
   Handle<String> new_part;
   if (encoding_ == String::ONE_BYTE_ENCODING) {
     new_part = factory()->NewRawOneByteString(part_length_).ToHandleChecked();
@@ -283,12 +296,86 @@ void IncrementalStringBuilder::Extend() {
 MaybeHandle<String> IncrementalStringBuilder::Finish() {
   ShrinkCurrentPart();
   Accumulate(current_part());
+  if (stream_ != nullptr) {
+    if (stream_lead_surrogate_ != 0) {
+      WriteCodePointToStream(stream_lead_surrogate_);
+      stream_lead_surrogate_ = 0;
+    }
+    if (stream_chunk_pos_ > 0) WriteChunkToStream();
+    if (!stream_aborted_) stream_->EndOfStream();
+  }
   if (overflowed_) {
     THROW_NEW_ERROR(isolate_, NewInvalidStringLengthError(), String);
   }
   return accumulator();
 }
 
+void IncrementalStringBuilder::StreamTo(v8::OutputStream* stream) {
+  DCHECK_NULL(stream_);
+  DCHECK_EQ(0, Length());
+  stream_ = stream;
+  stream_chunk_size_ = stream->GetChunkSize();
+  DCHECK_GT(stream_chunk_size_, 0);
+  stream_chunk_.reset(new char[stream_chunk_size_]);
+}
+
+void IncrementalStringBuilder::WriteToStream(Handle<String> part) {
+  if (stream_aborted_) return;
+  part = String::Flatten(isolate_, part);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = part->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    WriteCharsToStream(content.ToOneByteVector());
+  } else {
+    WriteCharsToStream(content.ToUC16Vector());
+  }
+}
+
+template <typename Char>
+void IncrementalStringBuilder::WriteCharsToStream(
+    base::Vector<const Char> chars) {
+  for (Char c : chars) {
+    if (stream_aborted_) return;
+    if (sizeof(Char) == 2 && stream_lead_surrogate_ != 0) {
+      base::uc16 lead = stream_lead_surrogate_;
+      stream_lead_surrogate_ = 0;
+      if (unibrow::Utf16::IsTrailSurrogate(c)) {
+        WriteCodePointToStream(
+            unibrow::Utf16::CombineSurrogatePair(lead, c));
+        continue;
+      }
+      WriteCodePointToStream(lead);
+    }
+    if (c <= unibrow::Utf8::kMaxOneByteChar) {
+      stream_chunk_[stream_chunk_pos_++] = static_cast<char>(c);
+      if (stream_chunk_pos_ == stream_chunk_size_) WriteChunkToStream();
+    } else if (sizeof(Char) == 2 && unibrow::Utf16::IsLeadSurrogate(c)) {
+      stream_lead_surrogate_ = c;
+    } else {
+      WriteCodePointToStream(c);
+    }
+  }
+}
+
+void IncrementalStringBuilder::WriteCodePointToStream(base::uc32 c) {
+  char buffer[unibrow::Utf8::kMaxEncodedSize];
+  unsigned length = unibrow::Utf8::Encode(
+      buffer, c, unibrow::Utf16::kNoPreviousCharacter, false);
+  for (unsigned i = 0; i < length; i++) {
+    stream_chunk_[stream_chunk_pos_++] = buffer[i];
+    if (stream_chunk_pos_ == stream_chunk_size_) WriteChunkToStream();
+  }
+}
+
+void IncrementalStringBuilder::WriteChunkToStream() {
+  if (!stream_aborted_ &&
+      stream_->WriteAsciiChunk(stream_chunk_.get(), stream_chunk_pos_) ==
+          v8::OutputStream::kAbort) {
+    stream_aborted_ = true;
+  }
+  stream_chunk_pos_ = 0;
+}
+
 // Short strings can be copied directly to {current_part_}.
 // Requires the IncrementalStringBuilder to either have two byte encoding or
 // the incoming string to have one byte representation "underneath" (The
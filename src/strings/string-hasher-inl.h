@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/memory.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/objects.h"
 #include "src/objects/string.h"
@@ -37,6 +38,70 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash;
 }
 
+#ifdef V8_USE_BLOCKWISE_STRING_HASH
+namespace detail {
+
+// Loads four characters into the 16-bit lanes of a 64-bit word, lowest lane
+// first, so that the word does not depend on the string's representation.
+V8_INLINE uint64_t LoadCharBlock(const uint8_t* chars) {
+#if V8_TARGET_LITTLE_ENDIAN
+  uint64_t block = base::ReadUnalignedValue<uint32_t>(
+      reinterpret_cast<Address>(chars));
+  block = (block | (block << 16)) & uint64_t{0x0000FFFF0000FFFF};
+  return (block | (block << 8)) & uint64_t{0x00FF00FF00FF00FF};
+#else
+  return uint64_t{chars[0]} | (uint64_t{chars[1]} << 16) |
+         (uint64_t{chars[2]} << 32) | (uint64_t{chars[3]} << 48);
+#endif
+}
+
+V8_INLINE uint64_t LoadCharBlock(const uint16_t* chars) {
+#if V8_TARGET_LITTLE_ENDIAN
+  return base::ReadUnalignedValue<uint64_t>(reinterpret_cast<Address>(chars));
+#else
+  return uint64_t{chars[0]} | (uint64_t{chars[1]} << 16) |
+         (uint64_t{chars[2]} << 32) | (uint64_t{chars[3]} << 48);
+#endif
+}
+
+}  // namespace detail
+
+template <typename uchar>
+uint32_t StringHasher::HashBlocks(const uchar* chars, int length,
+                                  uint64_t seed) {
+  // MurmurHash64A-style mixing over 64-bit blocks.
+  constexpr uint64_t kMul = uint64_t{0xC6A4A7935BD1E995};
+  constexpr int kShift = 47;
+  uint64_t running_hash = seed ^ (static_cast<uint64_t>(length) * kMul);
+  const uchar* end = chars + length;
+  for (; end - chars >= 4; chars += 4) {
+    uint64_t block = detail::LoadCharBlock(chars);
+    block *= kMul;
+    block ^= block >> kShift;
+    block *= kMul;
+    running_hash ^= block;
+    running_hash *= kMul;
+  }
+  if (chars != end) {
+    // The length is already mixed in, so zero padding is unambiguous.
+    uint64_t block = 0;
+    for (int shift = 0; chars != end; shift += 16) {
+      block |= uint64_t{*chars++} << shift;
+    }
+    running_hash ^= block;
+    running_hash *= kMul;
+  }
+  running_hash ^= running_hash >> kShift;
+  running_hash *= kMul;
+  running_hash ^= running_hash >> kShift;
+
+  uint32_t hash = static_cast<uint32_t>(running_hash ^ (running_hash >> 32));
+  // Ensure that the hash is kZeroHash, if the computed value is 0.
+  if ((hash & String::HashBits::kMax) == 0) hash |= kZeroHash;
+  return hash;
+}
+#endif  // V8_USE_BLOCKWISE_STRING_HASH
+
 uint32_t StringHasher::GetTrivialHash(int length) {
   DCHECK_GT(length, String::kMaxHashCalcLength);
   // The hash of a large string is simply computed from the length.
@@ -113,6 +178,10 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
   }
 
   // Non-index hash.
+#ifdef V8_USE_BLOCKWISE_STRING_HASH
+  return String::CreateHashFieldValue(HashBlocks(chars, length, seed),
+                                      String::HashFieldType::kHash);
+#else
   uint32_t running_hash = static_cast<uint32_t>(seed);
   const uchar* end = &chars[length];
   while (chars != end) {
@@ -121,6 +190,7 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
 
   return String::CreateHashFieldValue(GetHashCore(running_hash),
                                       String::HashFieldType::kHash);
+#endif  // V8_USE_BLOCKWISE_STRING_HASH
 }
 
 std::size_t SeededStringHasher::operator()(const char* name) const {
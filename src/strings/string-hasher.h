@@ -39,6 +39,14 @@ class V8_EXPORT_PRIVATE StringHasher final {
   V8_INLINE static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c);
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
+#ifdef V8_USE_BLOCKWISE_STRING_HASH
+  // Hashes {length} characters in blocks of four 16-bit lanes. Produces the
+  // same value for one- and two-byte representations of the same string.
+  template <typename uchar>
+  V8_INLINE static uint32_t HashBlocks(const uchar* chars, int length,
+                                       uint64_t seed);
+#endif  // V8_USE_BLOCKWISE_STRING_HASH
+
   static inline uint32_t GetTrivialHash(int length);
 };
 
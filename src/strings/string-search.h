@@ -5,6 +5,7 @@
 #ifndef V8_STRINGS_STRING_SEARCH_H_
 #define V8_STRINGS_STRING_SEARCH_H_
 
+#include "src/base/memory.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
@@ -227,6 +228,59 @@ inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
   return -1;
 }
 
+// Finds the first index at which both the first and the last character of
+// {pattern} occur, testing a word's worth of subject positions at a time.
+// Filtering on two characters rejects far more candidates than looking for
+// the first character alone, in particular in natural-language text.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacter(base::Vector<const PatternChar> pattern,
+                                     base::Vector<const SubjectChar> subject,
+                                     int index) {
+  DCHECK_GT(pattern.length(), 1);
+  using Word = uint64_t;
+  constexpr int kLanes = sizeof(Word) / sizeof(SubjectChar);
+  constexpr int kLaneBits = kBitsPerByte * sizeof(SubjectChar);
+  // One in every lane, and the high bit of every lane, respectively.
+  constexpr Word kLaneOnes = ~Word{0} / ((Word{1} << kLaneBits) - 1);
+  constexpr Word kLaneHighBits = kLaneOnes << (kLaneBits - 1);
+  constexpr Word kLaneLowBits = ~kLaneHighBits;
+
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const int last_offset = pattern.length() - 1;
+  const SubjectChar last_char = static_cast<SubjectChar>(pattern[last_offset]);
+  const Word first_word = kLaneOnes * first_char;
+  const Word last_word = kLaneOnes * last_char;
+  const int max_n = subject.length() - pattern.length() + 1;
+
+  int i = index;
+  for (; i + kLanes <= max_n; i += kLanes) {
+    const SubjectChar* chars = subject.begin() + i;
+    Word mismatch =
+        (base::ReadUnalignedValue<Word>(reinterpret_cast<Address>(chars)) ^
+         first_word) |
+        (base::ReadUnalignedValue<Word>(
+             reinterpret_cast<Address>(chars + last_offset)) ^
+         last_word);
+    // Sets the high bit of exactly those lanes that are zero, i.e. the
+    // positions where both characters match. No carry crosses lanes.
+    Word matches =
+        ~(((mismatch & kLaneLowBits) + kLaneLowBits) | mismatch | kLaneLowBits);
+    if (matches == 0) continue;
+    for (int j = 0; j < kLanes; j++) {
+      if (chars[j] == first_char && chars[j + last_offset] == last_char) {
+        return i + j;
+      }
+    }
+    UNREACHABLE();
+  }
+  for (; i < max_n; i++) {
+    if (subject[i] == first_char && subject[i + last_offset] == last_char) {
+      return i;
+    }
+  }
+  return -1;
+}
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -274,16 +328,16 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = FindFirstAndLastCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
-    i++;
-    // Loop extracted to separate function to allow using return to do
-    // a deeper break.
-    if (CharCompare(pattern.begin() + 1, subject.begin() + i,
-                    pattern_length - 1)) {
-      return i - 1;
+    // The first and the last character are known to match.
+    if (pattern_length == 2 ||
+        CharCompare(pattern.begin() + 1, subject.begin() + i + 1,
+                    pattern_length - 2)) {
+      return i;
     }
+    i++;
   }
   return -1;
 }
@@ -509,7 +563,7 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
   for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
     badness++;
     if (badness <= 0) {
-      i = FindFirstCharacter(pattern, subject, i);
+      i = FindFirstAndLastCharacter(pattern, subject, i);
       if (i == -1) return -1;
       DCHECK_LE(i, n);
       int j = 1;
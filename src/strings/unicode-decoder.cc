@@ -24,6 +24,14 @@ Utf8Decoder::Utf8Decoder(const base::Vector<const uint8_t>& chars)
   unibrow::Utf8::State state = unibrow::Utf8::State::kAccept;
 
   while (cursor < end) {
+    if (*cursor <= unibrow::Utf8::kMaxOneByteChar &&
+        state == unibrow::Utf8::State::kAccept) {
+      // Skip a run of ASCII characters a word at a time.
+      int ascii_length = NonAsciiStart(cursor, static_cast<int>(end - cursor));
+      utf16_length_ += ascii_length;
+      cursor += ascii_length;
+      continue;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -55,6 +63,14 @@ void Utf8Decoder::Decode(Char* out, const base::Vector<const uint8_t>& data) {
   const uint8_t* end = data.begin() + data.length();
 
   while (cursor < end) {
+    if (*cursor <= unibrow::Utf8::kMaxOneByteChar &&
+        state == unibrow::Utf8::State::kAccept) {
+      int ascii_length = NonAsciiStart(cursor, static_cast<int>(end - cursor));
+      CopyChars(out, cursor, ascii_length);
+      out += ascii_length;
+      cursor += ascii_length;
+      continue;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -466,10 +466,21 @@ bool VirtualMemoryCage::InitReservation(
   return true;
 }
 
+void VirtualMemoryCage::AdviseTransparentHugePages() {
+  DCHECK(IsReserved());
+  DCHECK_EQ(0, huge_page_advised_size_);
+  // Only the huge page aligned interior of the cage is advised, so the
+  // reservation itself does not need a stricter alignment.
+  huge_page_advised_size_ = base::OS::AdviseTransparentHugePages(
+      reinterpret_cast<void*>(page_allocator_->begin()),
+      page_allocator_->size());
+}
+
 void VirtualMemoryCage::Free() {
   if (IsReserved()) {
     base_ = kNullAddress;
     size_ = 0;
+    huge_page_advised_size_ = 0;
     page_allocator_.reset();
     reservation_.Free();
   }
@@ -390,9 +390,19 @@ class VirtualMemoryCage {
 
   void Free();
 
+  // Advises the OS to back the allocatable area of the cage with transparent
+  // huge pages. Must be called at most once per reservation, so that memory
+  // shared by several isolates is only accounted for once.
+  void AdviseTransparentHugePages();
+
+  // Number of bytes of this cage that were advised to be backed by
+  // transparent huge pages.
+  size_t huge_page_advised_size() const { return huge_page_advised_size_; }
+
  protected:
   Address base_ = kNullAddress;
   size_t size_ = 0;
+  size_t huge_page_advised_size_ = 0;
   std::unique_ptr<base::BoundedPageAllocator> page_allocator_;
   VirtualMemory reservation_;
 };
@@ -886,6 +886,14 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::SpillLocalsWithSharedRegisters() {
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    VarState& slot = cache_state_.stack_state[i];
+    if (slot.is_reg() && cache_state_.get_use_count(slot.reg()) == 1) continue;
+    Spill(&slot);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (uint32_t i = 0, e = cache_state_.stack_height(); i < e; ++i) {
     auto& slot = cache_state_.stack_state[i];
@@ -596,6 +596,9 @@ class LiftoffAssembler : public TurboAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Spills all locals that are not the only user of their register, so that
+  // the remaining ones can stay in their registers across loop back edges.
+  void SpillLocalsWithSharedRegisters();
   void SpillAllRegisters();
 
   // Clear any uses of {reg} in both the cache and in {possible_uses}.
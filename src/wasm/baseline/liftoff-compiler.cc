@@ -1165,13 +1165,64 @@ class LiftoffCompiler {
 
   void Block(FullDecoder* decoder, Control* block) { PushControl(block); }
 
+  // Scans the loop starting at {decoder->pc()} and returns whether it is short
+  // and does not contain calls. Registers are spilled at calls anyway, so
+  // keeping locals in registers across the back edges only pays off in such
+  // loops.
+  bool IsShortLoopWithoutCalls(FullDecoder* decoder) {
+    constexpr ptrdiff_t kMaxScannedLoopLength = 1024;
+    const byte* pc = decoder->pc();
+    const byte* end = decoder->end() - pc > kMaxScannedLoopLength
+                          ? pc + kMaxScannedLoopLength
+                          : decoder->end();
+    int depth = 0;
+    while (pc < end) {
+      WasmOpcode opcode = static_cast<WasmOpcode>(*pc);
+      switch (opcode) {
+        case kExprBlock:
+        case kExprLoop:
+        case kExprIf:
+        case kExprTry:
+          ++depth;
+          break;
+        case kExprEnd:
+        case kExprDelegate:
+          if (--depth == 0) return true;
+          break;
+        case kExprCallFunction:
+        case kExprCallIndirect:
+        case kExprCallRef:
+        case kExprReturnCall:
+        case kExprReturnCallIndirect:
+        case kExprReturnCallRef:
+        case kExprThrow:
+        case kExprRethrow:
+        case kExprMemoryGrow:
+          return false;
+        default:
+          // Many prefixed instructions call builtins.
+          if (WasmOpcodes::IsPrefixOpcode(opcode)) return false;
+          break;
+      }
+      unsigned length = OpcodeLength(pc, decoder->end());
+      if (length == 0) return false;
+      pc += length;
+    }
+    return false;
+  }
+
   void Loop(FullDecoder* decoder, Control* loop) {
-    // Before entering a loop, spill all locals to the stack, in order to free
-    // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
-    // TODO(clemensb): Come up with a better strategy here, involving
-    // pre-analysis of the function.
-    __ SpillLocals();
+    // Before entering a loop, spill locals to the stack, in order to free the
+    // cache registers, and to avoid unnecessarily reloading stack values into
+    // registers at branches. In short loops without calls, locals that own
+    // their register stay there instead; the back edges then merge into the
+    // same registers.
+    if (FLAG_liftoff_loop_locals_in_registers &&
+        for_debugging_ == kNoDebugging && IsShortLoopWithoutCalls(decoder)) {
+      __ SpillLocalsWithSharedRegisters();
+    } else {
+      __ SpillLocals();
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
@@ -2800,13 +2851,24 @@ class LiftoffCompiler {
     }
 
     // Early return for trap handler.
-    DCHECK_IMPLIES(env_->module->is_memory64,
+    DCHECK_IMPLIES(env_->module->is_memory64 && kSystemPointerSize == 4,
                    env_->bounds_checks == kExplicitBoundsChecks);
     if (!force_check && !statically_oob &&
         env_->bounds_checks == kTrapHandler) {
       // With trap handlers we should not have a register pair as input (we
       // would only return the lower half).
       DCHECK(index.is_gp());
+      if (env_->module->is_memory64) {
+        // The guard regions cover 32-bit indexes plus 32-bit offsets. Larger
+        // indexes are always out of bounds, since memories are at most 4GB.
+        CODE_COMMENT("bounds check memory64 high word");
+        Label* trap_label = AddOutOfLineTrap(
+            decoder, WasmCode::kThrowWasmTrapMemOutOfBounds, 0);
+        LiftoffRegister high_word =
+            __ GetUnusedRegister(kGpReg, pinned | LiftoffRegList{index});
+        __ emit_i64_shri(high_word, index, 32);
+        __ emit_cond_jump(kNotEqualZero, trap_label, kI32, high_word.gp());
+      }
       return index_ptrsize;
     }
 
@@ -5174,11 +5236,26 @@ class LiftoffCompiler {
   void StructNew(FullDecoder* decoder,
                  const StructIndexImmediate<validate>& imm, const Value& rtt,
                  bool initial_values_on_stack) {
+    int size = WasmStruct::Size(imm.struct_type);
+    Label slow_path;
+    Label done;
+    bool inline_allocation = CanAllocateInline(size);
+    if (inline_allocation) {
+      // Spill everything up front, like the runtime stub call on the slow path
+      // would, such that both paths agree on the cache state at {done}.
+      __ SpillAllRegisters();
+      AllocateInYoungGeneration(size, &slow_path);
+      InitializeWasmObjectHeader(kReturnRegister0,
+                                 __ cache_state()->stack_state.back());
+      __ emit_jump(&done);
+      __ bind(&slow_path);
+    }
     LiftoffAssembler::VarState rtt_value =
         __ cache_state()->stack_state.end()[-1];
     CallRuntimeStub(WasmCode::kWasmAllocateStructWithRtt,
                     MakeSig::Returns(kRef).Params(rtt.type.kind()), {rtt_value},
                     decoder->position());
+    if (inline_allocation) __ bind(&done);
     // Drop the RTT.
     __ cache_state()->stack_state.pop_back(1);
 
@@ -6285,6 +6362,74 @@ class LiftoffCompiler {
                       index.gp(), length.gp());
   }
 
+  bool CanAllocateInline(int size) {
+#ifdef V8_MAP_PACKING
+    return false;
+#else
+    return FLAG_inline_new && !FLAG_single_generation &&
+           size <= kMaxRegularHeapObjectSize;
+#endif
+  }
+
+  // Bump-pointer allocates {size} bytes in the young generation and places the
+  // tagged result in {kReturnRegister0}, or jumps to {slow_path} if the linear
+  // allocation area is exhausted. Only uses scratch registers without
+  // changing the cache state, so all registers must have been spilled before.
+  void AllocateInYoungGeneration(int size, Label* slow_path) {
+    DCHECK(__ cache_state()->used_registers.is_empty());
+    Register top = kReturnRegister0;
+    LiftoffRegList pinned = {LiftoffRegister(top)};
+    Register top_address =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned)).gp();
+    Register limit = pinned.set(__ GetUnusedRegister(kGpReg, pinned)).gp();
+    Register new_top = pinned.set(__ GetUnusedRegister(kGpReg, pinned)).gp();
+    __ LoadInstanceFromFrame(new_top);
+    __ LoadFromInstance(
+        top_address, new_top,
+        WASM_INSTANCE_OBJECT_FIELD_OFFSET(NewAllocationTopAddress),
+        kSystemPointerSize);
+    __ LoadFromInstance(
+        limit, new_top,
+        WASM_INSTANCE_OBJECT_FIELD_OFFSET(NewAllocationLimitAddress),
+        kSystemPointerSize);
+    __ Load(LiftoffRegister(limit), limit, no_reg, 0, kPointerLoadType, pinned);
+    __ Load(LiftoffRegister(top), top_address, no_reg, 0, kPointerLoadType,
+            pinned);
+    __ emit_ptrsize_addi(new_top, top, size);
+    __ emit_cond_jump(kUnsignedGreaterThan, slow_path, kPointerKind, new_top,
+                      limit);
+    __ Store(
+        top_address, no_reg, 0, LiftoffRegister(new_top),
+        kSystemPointerSize == 8 ? StoreType::kI64Store : StoreType::kI32Store,
+        pinned);
+    __ emit_ptrsize_addi(top, top, kHeapObjectTag);
+  }
+
+  // Initializes the map and the properties field of the freshly allocated
+  // {object}, like the {WasmAllocateStructWithRtt} builtin does. The {rtt} must
+  // be spilled. No write barrier is needed for a new young object.
+  void InitializeWasmObjectHeader(Register object,
+                                  const LiftoffAssembler::VarState& rtt) {
+    DCHECK(rtt.is_stack());
+    LiftoffRegList pinned = {LiftoffRegister(object)};
+    LiftoffRegister value = pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    __ Fill(value, rtt.offset(), rtt.kind());
+    __ StoreTaggedPointer(object, no_reg,
+                          wasm::ObjectAccess::ToTagged(HeapObject::kMapOffset),
+                          value, pinned, LiftoffAssembler::kSkipWriteBarrier);
+    __ LoadInstanceFromFrame(value.gp());
+    __ LoadFromInstance(value.gp(), value.gp(),
+                        WASM_INSTANCE_OBJECT_FIELD_OFFSET(IsolateRoot),
+                        kSystemPointerSize);
+    __ LoadFullPointer(
+        value.gp(), value.gp(),
+        IsolateData::root_slot_offset(RootIndex::kEmptyFixedArray));
+    __ StoreTaggedPointer(
+        object, no_reg,
+        wasm::ObjectAccess::ToTagged(JSReceiver::kPropertiesOrHashOffset),
+        value, pinned, LiftoffAssembler::kSkipWriteBarrier);
+  }
+
   int StructFieldOffset(const StructType* struct_type, int field_index) {
     return wasm::ObjectAccess::ToTagged(WasmStruct::kHeaderSize +
                                         struct_type->field_offset(field_index));
@@ -159,7 +159,8 @@ class V8_EXPORT_PRIVATE CompilationState {
 
   void InitializeAfterDeserialization(
       base::Vector<const int> lazy_functions,
-      base::Vector<const int> liftoff_functions);
+      base::Vector<const int> liftoff_functions,
+      base::Vector<const int> tier_up_functions);
 
   // Wait until top tier compilation finished, or compilation failed.
   void WaitForTopTierFinished();
@@ -27,6 +27,7 @@
 #include "src/utils/identity-map.h"
 #include "src/wasm/code-space-access.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
@@ -557,7 +558,8 @@ class CompilationStateImpl {
   // for recompilation (e.g. for tier down) to work later.
   void InitializeCompilationProgressAfterDeserialization(
       base::Vector<const int> lazy_functions,
-      base::Vector<const int> liftoff_functions);
+      base::Vector<const int> liftoff_functions,
+      base::Vector<const int> tier_up_functions);
 
   // Initializes compilation units based on the information encoded in the
   // {compilation_progress_}.
@@ -851,9 +853,10 @@ void CompilationState::SetHighPriority() { Impl(this)->SetHighPriority(); }
 
 void CompilationState::InitializeAfterDeserialization(
     base::Vector<const int> lazy_functions,
-    base::Vector<const int> liftoff_functions) {
+    base::Vector<const int> liftoff_functions,
+    base::Vector<const int> tier_up_functions) {
   Impl(this)->InitializeCompilationProgressAfterDeserialization(
-      lazy_functions, liftoff_functions);
+      lazy_functions, liftoff_functions, tier_up_functions);
 }
 
 bool CompilationState::failed() const { return Impl(this)->failed(); }
@@ -1133,6 +1136,107 @@ void ValidateSequentially(
   }
 }
 
+class ValidateFunctionsJob final : public JobTask {
+ public:
+  ValidateFunctionsJob(const WasmModule* module, ModuleWireBytes wire_bytes,
+                       WasmFeatures enabled_features, bool lazy_module,
+                       OnlyLazyFunctions only_lazy_functions,
+                       Counters* counters, AccountingAllocator* allocator)
+      : module_(module),
+        wire_bytes_(wire_bytes),
+        enabled_features_(enabled_features),
+        lazy_module_(lazy_module),
+        only_lazy_functions_(only_lazy_functions),
+        counters_(counters),
+        allocator_(allocator),
+        end_(module->num_imported_functions + module->num_declared_functions),
+        next_function_(module->num_imported_functions),
+        first_failed_function_(end_) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (true) {
+      int func_index = next_function_.fetch_add(1, std::memory_order_relaxed);
+      // Functions with a higher index than a failed one do not need to be
+      // validated any more, the lowest failing index is reported.
+      int failed = first_failed_function_.load(std::memory_order_relaxed);
+      if (func_index >= failed) return;
+      if (!ValidateFunction(func_index)) {
+        while (func_index < failed &&
+               !first_failed_function_.compare_exchange_weak(
+                   failed, func_index, std::memory_order_relaxed)) {
+        }
+      }
+      if (delegate && delegate->ShouldYield()) return;
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    int remaining = first_failed_function_.load(std::memory_order_relaxed) -
+                    next_function_.load(std::memory_order_relaxed);
+    return std::min(static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
+                    worker_count + std::max(remaining, 0));
+  }
+
+  // Returns the lowest index of a function that failed validation, or -1.
+  int first_failed_function() const {
+    int failed = first_failed_function_.load(std::memory_order_relaxed);
+    return failed < end_ ? failed : -1;
+  }
+
+ private:
+  bool ValidateFunction(int func_index) {
+    if (only_lazy_functions_) {
+      CompileStrategy strategy = GetCompileStrategy(
+          module_, enabled_features_, func_index, lazy_module_);
+      if (strategy != CompileStrategy::kLazy &&
+          strategy != CompileStrategy::kLazyBaselineEagerTopTier) {
+        return true;
+      }
+    }
+    const WasmFunction* func = &module_->functions[func_index];
+    base::Vector<const uint8_t> code = wire_bytes_.GetFunctionBytes(func);
+    return ValidateSingleFunction(module_, func_index, code, counters_,
+                                  allocator_, enabled_features_)
+        .ok();
+  }
+
+  const WasmModule* const module_;
+  const ModuleWireBytes wire_bytes_;
+  const WasmFeatures enabled_features_;
+  const bool lazy_module_;
+  const OnlyLazyFunctions only_lazy_functions_;
+  Counters* const counters_;
+  AccountingAllocator* const allocator_;
+  const int end_;
+  std::atomic<int> next_function_;
+  std::atomic<int> first_failed_function_;
+};
+
+// Validates functions like {ValidateSequentially}, but distributes the work
+// over the compilation worker threads, with the calling thread contributing.
+// Returns the lowest index of a function that failed validation, or -1 if
+// all validated functions are valid.
+int ValidateFunctions(const WasmModule* module, ModuleWireBytes wire_bytes,
+                      WasmFeatures enabled_features, bool lazy_module,
+                      OnlyLazyFunctions only_lazy_functions,
+                      Counters* counters, AccountingAllocator* allocator) {
+  TRACE_EVENT1("v8.wasm", "wasm.ValidateFunctions", "num_functions",
+               module->num_declared_functions);
+  auto job = std::make_unique<ValidateFunctionsJob>(
+      module, wire_bytes, enabled_features, lazy_module, only_lazy_functions,
+      counters, allocator);
+  ValidateFunctionsJob* job_ptr = job.get();
+  if (FLAG_wasm_num_compilation_tasks > 0) {
+    auto job_handle = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserBlocking, std::move(job));
+    job_handle->Join();
+    // {Join} keeps the job alive until all workers have finished.
+    return job_ptr->first_failed_function();
+  }
+  job->Run(nullptr);
+  return job->first_failed_function();
+}
+
 bool IsLazyModule(const WasmModule* module) {
   return FLAG_wasm_lazy_compilation ||
          (FLAG_asm_wasm_lazy_compilation && is_asmjs_module(module));
@@ -1140,6 +1244,27 @@ bool IsLazyModule(const WasmModule* module) {
 
 }  // namespace
 
+WasmError ValidateFunctionBodies(const WasmModule* module,
+                                 ModuleWireBytes wire_bytes,
+                                 WasmFeatures enabled_features,
+                                 Counters* counters,
+                                 AccountingAllocator* allocator) {
+  int failed_func_index =
+      ValidateFunctions(module, wire_bytes, enabled_features, false,
+                        kAllFunctions, counters, allocator);
+  if (failed_func_index < 0) return {};
+  // Re-validate the failing function to get the error message.
+  const WasmFunction* func = &module->functions[failed_func_index];
+  DecodeResult result = ValidateSingleFunction(
+      module, failed_func_index, wire_bytes.GetFunctionBytes(func), counters,
+      allocator, enabled_features);
+  DCHECK(result.failed());
+  WasmFunctionName func_name(func, wire_bytes.GetNameOrNull(func, module));
+  std::ostringstream error_msg;
+  error_msg << "in function " << func_name << ": " << result.error().message();
+  return WasmError{result.error().offset(), error_msg.str()};
+}
+
 bool CompileLazy(Isolate* isolate, Handle<WasmInstanceObject> instance,
                  int func_index) {
   Handle<WasmModuleObject> module_object(instance->module_object(), isolate);
@@ -1635,6 +1760,27 @@ void InitializeLazyCompilation(NativeModule* native_module) {
   }
 }
 
+// Schedules TurboFan compilation for the functions that tiered up while the
+// same module was run before (see --wasm-pgo-from-file), so that they do not
+// have to exhaust their tiering budget again.
+void ApplyProfileFromFile(NativeModule* native_module) {
+  if (!FLAG_wasm_pgo_from_file) return;
+  CompilationStateImpl* compilation_state =
+      Impl(native_module->compilation_state());
+  if (compilation_state->dynamic_tiering() != DynamicTiering::kEnabled ||
+      native_module->IsTieredDown()) {
+    return;
+  }
+  std::vector<int> tiered_up_functions =
+      LoadProfileFromFile(native_module->module(), native_module->wire_bytes());
+  // Functions are sorted hottest first; keep that order in the queue.
+  size_t priority = tiered_up_functions.size();
+  for (int func_index : tiered_up_functions) {
+    compilation_state->AddTopTierPriorityCompilationUnit(
+        {func_index, ExecutionTier::kTurbofan, kNoDebugging}, priority--);
+  }
+}
+
 std::unique_ptr<CompilationUnitBuilder> InitializeCompilation(
     Isolate* isolate, NativeModule* native_module) {
   InitializeLazyCompilation(native_module);
@@ -1768,11 +1914,20 @@ void CompileNativeModule(Isolate* isolate,
     // Validate wasm modules for lazy compilation if requested. Never validate
     // asm.js modules as these are valid by construction (additionally a CHECK
     // will catch this during lazy compilation).
-    ValidateSequentially(wasm_module, native_module.get(), isolate->counters(),
-                         isolate->allocator(), thrower, lazy_module,
-                         kOnlyLazyFunctions);
-    // On error: Return and leave the module in an unexecutable state.
-    if (thrower->error()) return;
+    int failed_func_index = ValidateFunctions(
+        wasm_module, wire_bytes, native_module->enabled_features(),
+        lazy_module, kOnlyLazyFunctions, isolate->counters(),
+        isolate->allocator());
+    if (failed_func_index >= 0) {
+      const WasmFunction* func = &wasm_module->functions[failed_func_index];
+      DecodeResult result = ValidateSingleFunction(
+          wasm_module, failed_func_index, wire_bytes.GetFunctionBytes(func),
+          isolate->counters(), isolate->allocator(),
+          native_module->enabled_features());
+      SetCompileError(thrower, wire_bytes, func, wasm_module, result.error());
+      // Return and leave the module in an unexecutable state.
+      return;
+    }
   }
 
   DCHECK_GE(kMaxInt, native_module->module()->num_declared_functions);
@@ -1789,6 +1944,7 @@ void CompileNativeModule(Isolate* isolate,
   std::unique_ptr<CompilationUnitBuilder> builder =
       InitializeCompilation(isolate, native_module.get());
   compilation_state->InitializeCompilationUnits(std::move(builder));
+  ApplyProfileFromFile(native_module.get());
 
   compilation_state->WaitForCompilationEvent(
       CompilationEvent::kFinishedExportWrappers);
@@ -2037,6 +2193,9 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   ModuleDecoder decoder_;
   AsyncCompileJob* job_;
   std::unique_ptr<CompilationUnitBuilder> compilation_unit_builder_;
+  // Size of the function bodies added to {compilation_unit_builder_} since
+  // the last commit.
+  size_t uncommitted_bytes_ = 0;
   int num_functions_ = 0;
   bool prefix_cache_hit_ = false;
   bool before_code_section_ = true;
@@ -2183,8 +2342,7 @@ void AsyncCompileJob::FinishCompile(bool is_after_cache_hit) {
   if (!is_after_deserialization) {
     Handle<FixedArray> export_wrappers;
     if (is_after_cache_hit) {
-      // TODO(thibaudm): Look into sharing wrappers.
-      CompileJsToWasmWrappers(isolate_, module, &export_wrappers);
+      GetOrCompileJsToWasmWrappers(isolate_, script, module, &export_wrappers);
     } else {
       compilation_state->FinalizeJSToWasmWrappers(isolate_, module,
                                                   &export_wrappers);
@@ -2461,28 +2619,17 @@ class AsyncCompileJob::DecodeModule : public AsyncCompileJob::CompileStep {
         const bool lazy_module = job->wasm_lazy_compilation_;
         if (MayCompriseLazyFunctions(module, enabled_features, lazy_module)) {
           auto allocator = GetWasmEngine()->allocator();
-          int start = module->num_imported_functions;
-          int end = start + module->num_declared_functions;
-
-          for (int func_index = start; func_index < end; func_index++) {
-            const WasmFunction* func = &module->functions[func_index];
-            base::Vector<const uint8_t> code =
-                job->wire_bytes_.GetFunctionBytes(func);
-
-            CompileStrategy strategy = GetCompileStrategy(
-                module, enabled_features, func_index, lazy_module);
-            bool validate_lazily_compiled_function =
-                strategy == CompileStrategy::kLazy ||
-                strategy == CompileStrategy::kLazyBaselineEagerTopTier;
-            if (validate_lazily_compiled_function) {
-              DecodeResult function_result =
-                  ValidateSingleFunction(module, func_index, code, counters_,
-                                         allocator, enabled_features);
-              if (function_result.failed()) {
-                result = ModuleResult(function_result.error());
-                break;
-              }
-            }
+          int failed_func_index = ValidateFunctions(
+              module, job->wire_bytes_, enabled_features, lazy_module,
+              kOnlyLazyFunctions, counters_, allocator);
+          if (failed_func_index >= 0) {
+            const WasmFunction* func = &module->functions[failed_func_index];
+            DecodeResult function_result = ValidateSingleFunction(
+                module, failed_func_index,
+                job->wire_bytes_.GetFunctionBytes(func), counters_, allocator,
+                enabled_features);
+            DCHECK(function_result.failed());
+            result = ModuleResult(function_result.error());
           }
         }
       }
@@ -2570,6 +2717,7 @@ class AsyncCompileJob::PrepareAndStartCompile : public CompileStep {
       std::unique_ptr<CompilationUnitBuilder> builder =
           InitializeCompilation(job->isolate(), job->native_module_.get());
       compilation_state->InitializeCompilationUnits(std::move(builder));
+      ApplyProfileFromFile(job->native_module_.get());
       // We are in single-threaded mode, so there are no worker tasks that will
       // do the compilation. We call {WaitForCompilationEvent} here so that the
       // main thread paticipates and finishes the compilation.
@@ -2857,12 +3005,22 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(
                                         func_index);
   ++num_functions_;
 
+  // Network chunks can be large, so do not let compilation units pile up
+  // until the end of the chunk; start compiling them as soon as there is a
+  // reasonable amount of work for the background tasks.
+  uncommitted_bytes_ += bytes.size();
+  if (FLAG_wasm_streaming_commit_bytes != 0 &&
+      uncommitted_bytes_ >= FLAG_wasm_streaming_commit_bytes) {
+    CommitCompilationUnits();
+  }
+
   return true;
 }
 
 void AsyncStreamingProcessor::CommitCompilationUnits() {
   DCHECK(compilation_unit_builder_);
   compilation_unit_builder_->Commit();
+  uncommitted_bytes_ = 0;
 }
 
 void AsyncStreamingProcessor::OnFinishedChunk() {
@@ -2929,6 +3087,8 @@ void AsyncStreamingProcessor::OnFinishedStream(
   } else {
     job_->native_module_->SetWireBytes(
         {std::move(job_->bytes_copy_), job_->wire_bytes_.length()});
+    // The profile is keyed by the full wire bytes, which are only known now.
+    ApplyProfileFromFile(job_->native_module_.get());
   }
   const bool needs_finish = job_->DecrementAndCheckFinisherCount();
   DCHECK_IMPLIES(!has_code_section, needs_finish);
@@ -3192,10 +3352,12 @@ void CompilationStateImpl::AddCompilationUnit(CompilationUnitBuilder* builder,
 
 void CompilationStateImpl::InitializeCompilationProgressAfterDeserialization(
     base::Vector<const int> lazy_functions,
-    base::Vector<const int> liftoff_functions) {
+    base::Vector<const int> liftoff_functions,
+    base::Vector<const int> tier_up_functions) {
   TRACE_EVENT2("v8.wasm", "wasm.CompilationAfterDeserialization",
                "num_lazy_functions", lazy_functions.size(),
-               "num_liftoff_functions", liftoff_functions.size());
+               "num_liftoff_functions",
+               liftoff_functions.size() + tier_up_functions.size());
   TimedHistogramScope lazy_compile_time_scope(
       counters()->wasm_compile_after_deserialize());
 
@@ -3214,14 +3376,16 @@ void CompilationStateImpl::InitializeCompilationProgressAfterDeserialization(
         RequiredTopTierField::encode(ExecutionTier::kTurbofan) |
         ReachedTierField::encode(ExecutionTier::kTurbofan);
     finished_events_.Add(CompilationEvent::kFinishedExportWrappers);
-    if (liftoff_functions.empty() || lazy_module) {
+    if ((liftoff_functions.empty() && tier_up_functions.empty()) ||
+        lazy_module) {
       // We have to trigger the compilation events to finish compilation.
       // Typically the events get triggered when a CompilationUnit finishes, but
       // with lazy compilation there are no compilation units.
       // The {kFinishedBaselineCompilation} event is needed for module
       // compilation to finish.
       finished_events_.Add(CompilationEvent::kFinishedBaselineCompilation);
-      if (liftoff_functions.empty() && lazy_functions.empty()) {
+      if (liftoff_functions.empty() && lazy_functions.empty() &&
+          tier_up_functions.empty()) {
         // All functions exist now as TurboFan functions, so we can trigger the
         // {kFinishedTopTierCompilation} event.
         // The {kFinishedTopTierCompilation} event is needed for the C-API so
@@ -3251,6 +3415,26 @@ void CompilationStateImpl::InitializeCompilationProgressAfterDeserialization(
           SetupCompilationProgressForFunction(lazy_module, native_module_,
                                               enabled_features, func_index);
     }
+    for (auto func_index : tier_up_functions) {
+      if (lazy_module) {
+        native_module_->UseLazyStub(func_index);
+      }
+      DCHECK_EQ(
+          compilation_progress_[declared_function_index(module, func_index)],
+          kProgressAfterTurbofanDeserialization);
+      uint8_t function_progress = SetupCompilationProgressForFunction(
+          lazy_module, native_module_, enabled_features, func_index);
+      // These functions were hot when the module was serialized, so request
+      // TurboFan for them right away, even under dynamic tiering. They are
+      // already counted in {outstanding_top_tier_functions_}.
+      if (RequiredTopTierField::decode(function_progress) ==
+          ExecutionTier::kLiftoff) {
+        function_progress = RequiredTopTierField::update(
+            function_progress, ExecutionTier::kTurbofan);
+      }
+      compilation_progress_[declared_function_index(module, func_index)] =
+          function_progress;
+    }
   }
   auto builder = std::make_unique<CompilationUnitBuilder>(native_module_);
   InitializeCompilationUnits(std::move(builder));
@@ -3893,6 +4077,26 @@ void CompileJsToWasmWrappers(Isolate* isolate, const WasmModule* module,
   }
 }
 
+void GetOrCompileJsToWasmWrappers(Isolate* isolate, Handle<Script> script,
+                                  const WasmModule* module,
+                                  Handle<FixedArray>* export_wrappers_out) {
+  // All module objects for the same {NativeModule} in an isolate share one
+  // {Script}. The wrappers only depend on the module, so the ones compiled for
+  // an earlier module object can be used directly.
+  WeakArrayList weak_instance_list = script->wasm_weak_instance_list();
+  for (int i = 0; i < weak_instance_list.length(); ++i) {
+    if (weak_instance_list.Get(i)->IsCleared()) continue;
+    FixedArray export_wrappers =
+        WasmInstanceObject::cast(weak_instance_list.Get(i)->GetHeapObject())
+            .module_object()
+            .export_wrappers();
+    if (export_wrappers.length() != MaxNumExportWrappers(module)) continue;
+    *export_wrappers_out = handle(export_wrappers, isolate);
+    return;
+  }
+  CompileJsToWasmWrappers(isolate, module, export_wrappers_out);
+}
+
 WasmCode* CompileImportWrapper(
     NativeModule* native_module, Counters* counters,
     compiler::WasmImportCallKind kind, const FunctionSig* sig,
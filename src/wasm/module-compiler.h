@@ -32,6 +32,7 @@ class Vector;
 
 namespace internal {
 
+class AccountingAllocator;
 class JSArrayBuffer;
 class JSPromise;
 class Counters;
@@ -63,6 +64,13 @@ V8_EXPORT_PRIVATE
 void CompileJsToWasmWrappers(Isolate* isolate, const WasmModule* module,
                              Handle<FixedArray>* export_wrappers_out);
 
+// Like {CompileJsToWasmWrappers}, but reuses the export wrappers of another
+// module object in the same isolate that shares the {NativeModule} of
+// {script}, if any of its instances is still alive.
+void GetOrCompileJsToWasmWrappers(Isolate* isolate, Handle<Script> script,
+                                  const WasmModule* module,
+                                  Handle<FixedArray>* export_wrappers_out);
+
 // Compiles the wrapper for this (kind, sig) pair and sets the corresponding
 // cache entry. Assumes the key already exists in the cache but has not been
 // compiled yet.
@@ -73,6 +81,17 @@ WasmCode* CompileImportWrapper(
     int expected_arity, Suspend suspend,
     WasmImportWrapperCache::ModificationScope* cache_scope);
 
+// Validates all function bodies of a decoded {module}, distributing the work
+// over the compilation worker threads. Returns the error of the function with
+// the lowest index that fails validation, or an empty error if all functions
+// are valid.
+V8_EXPORT_PRIVATE
+WasmError ValidateFunctionBodies(const WasmModule* module,
+                                 ModuleWireBytes wire_bytes,
+                                 WasmFeatures enabled_features,
+                                 Counters* counters,
+                                 AccountingAllocator* allocator);
+
 // Triggered by the WasmCompileLazy builtin. The return value indicates whether
 // compilation was successful. Lazy compilation can fail only if validation is
 // also lazy.
@@ -0,0 +1,171 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/pgo.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "src/base/functional.h"
+#include "src/base/strings.h"
+#include "src/flags/flags.h"
+#include "src/utils/utils.h"
+#include "src/wasm/wasm-module.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+namespace {
+
+// Any line in a profile beginning with this string describes a function that
+// tiered up. The format is:
+//   literal kFunctionMarker , func_index , tierup_priority , num_call_sites
+constexpr char kFunctionMarker[] = "function";
+
+// Any line in a profile beginning with this string describes the feedback of
+// a single call_ref site of the preceding function. The format is:
+//   literal kCallSiteMarker , position , slot , target_index , call_count
+constexpr char kCallSiteMarker[] = "call";
+
+// Reads {N} comma-separated integers from {line_stream} into {values}.
+// Returns false if the line is malformed.
+template <size_t N>
+bool ReadValues(std::istringstream& line_stream, int (&values)[N]) {
+  for (size_t i = 0; i < N; i++) {
+    std::string token;
+    if (!std::getline(line_stream, token, ',')) return false;
+    char* end = nullptr;
+    errno = 0;
+    long value = strtol(token.c_str(), &end, 10);  // NOLINT(runtime/int)
+    if (errno != 0 || end == token.c_str() || value < 0 || value > kMaxInt) {
+      return false;
+    }
+    values[i] = static_cast<int>(value);
+  }
+  return line_stream.eof();
+}
+
+// Profiles only refer to functions defined in the module itself, since only
+// those tier up.
+bool IsDeclaredFunction(const WasmModule* module, int func_index) {
+  return func_index >= static_cast<int>(module->num_imported_functions) &&
+         func_index < static_cast<int>(module->num_imported_functions +
+                                       module->num_declared_functions);
+}
+
+}  // namespace
+
+std::string GetProfileFileName(base::Vector<const uint8_t> wire_bytes) {
+  size_t hash = base::hash_range(wire_bytes.begin(), wire_bytes.end());
+  base::EmbeddedVector<char, 32> filename;
+  base::SNPrintF(filename, "profile-wasm-%08zx", hash);
+  return std::string(filename.begin());
+}
+
+void DumpProfileToFile(const WasmModule* module,
+                       base::Vector<const uint8_t> wire_bytes) {
+  std::string filename = GetProfileFileName(wire_bytes);
+  std::ofstream file(filename);
+  if (!file.good()) {
+    PrintF("Could not write wasm profile to %s\n", filename.c_str());
+    return;
+  }
+
+  base::MutexGuard mutex_guard(&module->type_feedback.mutex);
+  int num_functions = 0;
+  for (const auto& entry : module->type_feedback.feedback_for_function) {
+    const FunctionTypeFeedback& feedback = entry.second;
+    // Only functions that asked for tier-up are relevant for the next run.
+    if (feedback.tierup_priority == 0) continue;
+    ++num_functions;
+    file << kFunctionMarker << ',' << entry.first << ','
+         << feedback.tierup_priority << ',' << feedback.feedback_vector.size()
+         << '\n';
+    for (const auto& position_and_slot : feedback.positions) {
+      int slot = position_and_slot.second;
+      if (slot >= static_cast<int>(feedback.feedback_vector.size())) continue;
+      const CallSiteFeedback& call_site = feedback.feedback_vector[slot];
+      file << kCallSiteMarker << ',' << position_and_slot.first << ','
+           << slot << ',' << call_site.function_index << ','
+           << call_site.absolute_call_frequency << '\n';
+    }
+  }
+  if (FLAG_trace_wasm_pgo) {
+    PrintF("Wrote wasm profile for %d functions to %s\n", num_functions,
+           filename.c_str());
+  }
+}
+
+std::vector<int> LoadProfileFromFile(const WasmModule* module,
+                                     base::Vector<const uint8_t> wire_bytes) {
+  std::string filename = GetProfileFileName(wire_bytes);
+  std::ifstream file(filename);
+  if (!file.good()) return {};
+
+  std::vector<std::pair<int, int>> tiered_up;  // (priority, func_index)
+  base::MutexGuard mutex_guard(&module->type_feedback.mutex);
+  auto& feedback_for_function = module->type_feedback.feedback_for_function;
+  FunctionTypeFeedback* current = nullptr;
+  for (std::string line; std::getline(file, line);) {
+    std::istringstream line_stream(line);
+    std::string token;
+    if (!std::getline(line_stream, token, ',')) continue;
+    if (token == kFunctionMarker) {
+      int values[3];
+      current = nullptr;
+      if (!ReadValues(line_stream, values)) continue;
+      int func_index = values[0];
+      // The profile belongs to a module with exactly these wire bytes, but
+      // stay robust against hash collisions and truncated files.
+      if (!IsDeclaredFunction(module, func_index)) continue;
+      // Every call site takes at least one byte of the function body, which
+      // also bounds the size of the feedback vector allocated below.
+      if (values[2] >
+          static_cast<int>(module->functions[func_index].code.length())) {
+        continue;
+      }
+      current = &feedback_for_function[func_index];
+      current->tierup_priority =
+          std::max(current->tierup_priority, values[1]);
+      if (current->feedback_vector.size() < static_cast<size_t>(values[2])) {
+        current->feedback_vector.resize(values[2], CallSiteFeedback{-1, 0});
+      }
+      tiered_up.emplace_back(values[1], func_index);
+    } else if (token == kCallSiteMarker) {
+      int values[4];
+      if (current == nullptr || !ReadValues(line_stream, values)) continue;
+      int slot = values[1];
+      int target_index = values[2];
+      if (slot >= static_cast<int>(current->feedback_vector.size()) ||
+          !IsDeclaredFunction(module, target_index)) {
+        continue;
+      }
+      current->positions[values[0]] = slot;
+      current->feedback_vector[slot] =
+          CallSiteFeedback{target_index, values[3]};
+    }
+  }
+
+  std::stable_sort(
+      tiered_up.begin(), tiered_up.end(),
+      [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.first > b.first;
+      });
+  std::vector<int> result;
+  result.reserve(tiered_up.size());
+  for (const auto& entry : tiered_up) result.push_back(entry.second);
+  if (FLAG_trace_wasm_pgo) {
+    PrintF("Read wasm profile for %zu functions from %s\n", result.size(),
+           filename.c_str());
+  }
+  return result;
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,48 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_WASM_PGO_H_
+#define V8_WASM_PGO_H_
+
+#include <string>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/base/vector.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+struct WasmModule;
+
+// Returns the name of the profile file for the module with the given
+// {wire_bytes}, relative to the current working directory.
+V8_EXPORT_PRIVATE std::string GetProfileFileName(
+    base::Vector<const uint8_t> wire_bytes);
+
+// Writes the dynamic tiering decisions and the call_ref feedback collected in
+// {module->type_feedback} to a file in the current working directory. The file
+// name is derived from a hash of {wire_bytes}, so that a later run of the same
+// module can find it (see --wasm-pgo-to-file).
+V8_EXPORT_PRIVATE void DumpProfileToFile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes);
+
+// Reads a profile written by {DumpProfileToFile} for the module with the given
+// {wire_bytes}, installs its call_ref feedback into {module->type_feedback} and
+// returns the indices of the functions that tiered up during the profiling run,
+// hottest first. Returns an empty vector if there is no such profile (see
+// --wasm-pgo-from-file).
+V8_EXPORT_PRIVATE std::vector<int> LoadProfileFromFile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes);
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_WASM_PGO_H_
@@ -127,27 +127,59 @@ base::AddressRegion DisjointAllocationPool::AllocateInRegion(
     base::AddressRegion overlap = it->GetOverlap(region);
     if (size > overlap.size()) continue;
     base::AddressRegion ret{overlap.begin(), size};
-    base::AddressRegion old = *it;
-    auto insert_pos = regions_.erase(it);
-    if (size == old.size()) {
-      // We use the full region --> nothing to add back.
-    } else if (ret.begin() == old.begin()) {
-      // We return a region at the start --> shrink old region from front.
-      regions_.insert(insert_pos, {old.begin() + size, old.size() - size});
-    } else if (ret.end() == old.end()) {
-      // We return a region at the end --> shrink remaining region.
-      regions_.insert(insert_pos, {old.begin(), old.size() - size});
-    } else {
-      // We return something in the middle --> split the remaining region
-      // (insert the region with smaller address first).
-      regions_.insert(insert_pos, {old.begin(), ret.begin() - old.begin()});
-      regions_.insert(insert_pos, {ret.end(), old.end() - ret.end()});
-    }
+    RemoveFromRegion(it, ret);
     return ret;
   }
   return {};
 }
 
+base::AddressRegion DisjointAllocationPool::AllocateFromEndInRegion(
+    size_t size, base::AddressRegion region) {
+  // Walk the contained regions from the highest address down, skipping the
+  // ones starting above {region}.
+  auto it = regions_.lower_bound({region.end(), 0});
+  while (it != regions_.begin()) {
+    --it;
+    base::AddressRegion overlap = it->GetOverlap(region);
+    if (overlap.end() <= region.begin()) break;
+    if (size > overlap.size()) continue;
+    base::AddressRegion ret{overlap.end() - size, size};
+    RemoveFromRegion(it, ret);
+    return ret;
+  }
+  return {};
+}
+
+bool DisjointAllocationPool::Contains(base::AddressRegion region) const {
+  // Find the last contained region whose start address is not bigger than
+  // the start address of {region}.
+  auto it = regions_.upper_bound(region);
+  if (it == regions_.begin()) return false;
+  --it;
+  return it->contains(region);
+}
+
+void DisjointAllocationPool::RemoveFromRegion(RegionSet::iterator it,
+                                              base::AddressRegion ret) {
+  base::AddressRegion old = *it;
+  DCHECK(old.contains(ret));
+  auto insert_pos = regions_.erase(it);
+  if (ret.size() == old.size()) {
+    // We use the full region --> nothing to add back.
+  } else if (ret.begin() == old.begin()) {
+    // We return a region at the start --> shrink old region from front.
+    regions_.insert(insert_pos, {ret.end(), old.size() - ret.size()});
+  } else if (ret.end() == old.end()) {
+    // We return a region at the end --> shrink remaining region.
+    regions_.insert(insert_pos, {old.begin(), old.size() - ret.size()});
+  } else {
+    // We return something in the middle --> split the remaining region
+    // (insert the region with smaller address first).
+    regions_.insert(insert_pos, {old.begin(), ret.begin() - old.begin()});
+    regions_.insert(insert_pos, {ret.end(), old.end() - ret.end()});
+  }
+}
+
 Address WasmCode::constant_pool() const {
   if (FLAG_enable_embedded_constant_pool) {
     if (constant_pool_offset_ < code_comments_offset_) {
@@ -751,21 +783,62 @@ base::Vector<byte> WasmCodeAllocator::AllocateForCodeInRegion(
     async_counters_->wasm_module_num_code_spaces()->AddSample(
         static_cast<int>(owned_code_space_.size()));
   }
-  const Address commit_page_size = CommitPageSize();
-  Address commit_start = RoundUp(code_space.begin(), commit_page_size);
-  if (commit_start != code_space.begin()) {
-    MakeWritable({commit_start - commit_page_size, commit_page_size});
+  CommitForAllocation(code_space);
+  DCHECK(IsAligned(code_space.begin(), kCodeAlignment));
+  allocated_code_space_.Merge(code_space);
+  generated_code_size_.fetch_add(code_space.size(), std::memory_order_relaxed);
+
+  TRACE_HEAP("Code alloc for %p: 0x%" PRIxPTR ",+%zu\n", this,
+             code_space.begin(), size);
+  return {reinterpret_cast<byte*>(code_space.begin()), code_space.size()};
+}
+
+base::Vector<byte> WasmCodeAllocator::AllocateForHotCode(
+    NativeModule* native_module, size_t size) {
+  if (!FLAG_wasm_separate_hot_code) {
+    return AllocateForCodeInRegion(native_module, size, kUnrestrictedRegion);
+  }
+  DCHECK_LT(0, size);
+  size = RoundUp<kCodeAlignment>(size);
+  base::AddressRegion code_space =
+      free_code_space_.AllocateFromEndInRegion(size, kUnrestrictedRegion);
+  // If there is no space left, fall back to the regular allocation which
+  // reserves a new code space.
+  if (code_space.is_empty()) {
+    return AllocateForCodeInRegion(native_module, size, kUnrestrictedRegion);
   }
+  CommitForAllocation(code_space);
+  DCHECK(IsAligned(code_space.begin(), kCodeAlignment));
+  allocated_code_space_.Merge(code_space);
+  generated_code_size_.fetch_add(code_space.size(), std::memory_order_relaxed);
 
+  TRACE_HEAP("Hot code alloc for %p: 0x%" PRIxPTR ",+%zu\n", this,
+             code_space.begin(), size);
+  return {reinterpret_cast<byte*>(code_space.begin()), code_space.size()};
+}
+
+void WasmCodeAllocator::CommitForAllocation(base::AddressRegion code_space) {
+  auto* code_manager = GetWasmCodeManager();
+  // Pages which are only partially covered by {code_space} are already
+  // committed iff the rest of the page was allocated before, i.e. is not part
+  // of {free_code_space_} any more. Code which was freed is never handed out
+  // again, so its pages stay committed unless they were fully discarded.
+  const Address commit_page_size = CommitPageSize();
+  Address commit_start = RoundDown(code_space.begin(), commit_page_size);
+  if (commit_start != code_space.begin() &&
+      !free_code_space_.Contains(
+          {commit_start, code_space.begin() - commit_start})) {
+    MakeWritable({commit_start, commit_page_size});
+    commit_start += commit_page_size;
+  }
   Address commit_end = RoundUp(code_space.end(), commit_page_size);
-  // {commit_start} will be either code_space.start or the start of the next
-  // page. {commit_end} will be the start of the page after the one in which
-  // the allocation ends.
-  // We start from an aligned start, and we know we allocated vmem in
-  // page multiples.
-  // We just need to commit what's not committed. The page in which we
-  // start is already committed (or we start at the beginning of a page).
-  // The end needs to be committed all through the end of the page.
+  if (commit_end != code_space.end() &&
+      !free_code_space_.Contains(
+          {code_space.end(), commit_end - code_space.end()})) {
+    MakeWritable({commit_end - commit_page_size, commit_page_size});
+    commit_end -= commit_page_size;
+  }
+  // Everything between {commit_start} and {commit_end} is not committed yet.
   if (commit_start < commit_end) {
     for (base::AddressRegion split_range : SplitRangeByReservationsIfNeeded(
              {commit_start, commit_end - commit_start}, owned_code_space_)) {
@@ -780,13 +853,6 @@ base::Vector<byte> WasmCodeAllocator::AllocateForCodeInRegion(
                                 false);
     }
   }
-  DCHECK(IsAligned(code_space.begin(), kCodeAlignment));
-  allocated_code_space_.Merge(code_space);
-  generated_code_size_.fetch_add(code_space.size(), std::memory_order_relaxed);
-
-  TRACE_HEAP("Code alloc for %p: 0x%" PRIxPTR ",+%zu\n", this,
-             code_space.begin(), size);
-  return {reinterpret_cast<byte*>(code_space.begin()), code_space.size()};
 }
 
 // TODO(dlehmann): Ensure that {AddWriter()} is always paired up with a
@@ -964,8 +1030,15 @@ namespace {
 BoundsCheckStrategy GetBoundsChecks(const WasmModule* module) {
   if (!FLAG_wasm_bounds_checks) return kNoBoundsChecks;
   if (FLAG_wasm_enforce_bounds_checks) return kExplicitBoundsChecks;
-  // We do not have trap handler support for memory64 yet.
-  if (module->is_memory64) return kExplicitBoundsChecks;
+  // Memory64 can use the trap handler on 64-bit systems, after checking that
+  // the upper half of the index is zero (see {BoundsCheckMem}). This relies on
+  // the guard regions covering any 32-bit index plus 32-bit offset.
+  static_assert(uint64_t{kV8MaxWasmMemoryPages} * kWasmPageSize <=
+                    uint64_t{4} * GB,
+                "memory64 trap handler support assumes 4GB memories");
+  if (module->is_memory64 && kSystemPointerSize == kInt32Size) {
+    return kExplicitBoundsChecks;
+  }
   if (trap_handler::IsTrapHandlerEnabled()) return kTrapHandler;
   return kExplicitBoundsChecks;
 }
@@ -1280,6 +1353,9 @@ std::unique_ptr<WasmCode> NativeModule::AddCodeWithCodeSpace(
 WasmCode* NativeModule::PublishCode(std::unique_ptr<WasmCode> code) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed"),
                "wasm.PublishCode");
+  // Registering with the trap handler takes a process-wide lock; do it before
+  // taking the {allocation_mutex_}.
+  code->RegisterTrapHandlerData();
   base::RecursiveMutexGuard lock(&allocation_mutex_);
   CodeSpaceWriteScope code_space_write_scope(this);
   return PublishCodeLocked(std::move(code));
@@ -1294,6 +1370,10 @@ std::vector<WasmCode*> NativeModule::PublishCode(
                "wasm.PublishCode", "number", codes.size());
   std::vector<WasmCode*> published_code;
   published_code.reserve(codes.size());
+  // Registering with the trap handler takes a process-wide lock; do it before
+  // taking the {allocation_mutex_}, so that concurrently publishing threads
+  // hold it as short as possible.
+  for (auto& code : codes) code->RegisterTrapHandlerData();
   base::RecursiveMutexGuard lock(&allocation_mutex_);
   // The published code is put into the top-most surrounding {WasmCodeRefScope}.
   for (auto& code : codes) {
@@ -1330,7 +1410,8 @@ WasmCode* NativeModule::PublishCodeLocked(
 
   DCHECK_LT(code->index(), num_functions());
 
-  code->RegisterTrapHandlerData();
+  // The code might have been registered before taking the lock already.
+  if (!code->has_trap_handler_index()) code->RegisterTrapHandlerData();
 
   // Put the code in the debugging cache, if needed.
   if (V8_UNLIKELY(cached_code_)) InsertToCodeCache(code);
@@ -2004,6 +2085,12 @@ VirtualMemory WasmCodeManager::TryAllocate(size_t size, void* hint) {
   TRACE_HEAP("VMem alloc: 0x%" PRIxPTR ":0x%" PRIxPTR " (%zu)\n", mem.address(),
              mem.end(), mem.size());
 
+  if (FLAG_transparent_huge_pages) {
+    // Only the huge page aligned interior of the reservation is advised.
+    USE(base::OS::AdviseTransparentHugePages(
+        reinterpret_cast<void*>(mem.address()), mem.size()));
+  }
+
   // TODO(v8:8462): Remove eager commit once perf supports remapping.
   if (FLAG_perf_prof) {
     SetPermissions(GetPlatformPageAllocator(), mem.address(), mem.size(),
@@ -2294,9 +2381,12 @@ std::vector<std::unique_ptr<WasmCode>> NativeModule::AddCompiledCode(
   DCHECK(!results.empty());
   // First, allocate code space for all the results.
   size_t total_code_space = 0;
+  bool all_turbofan = true;
   for (auto& result : results) {
     DCHECK(result.succeeded());
     total_code_space += RoundUp<kCodeAlignment>(result.code_desc.instr_size);
+    all_turbofan &= result.result_tier == ExecutionTier::kTurbofan &&
+                    result.for_debugging == kNoDebugging;
     if (result.result_tier == ExecutionTier::kLiftoff) {
       int index = result.func_index;
       int* slots = &module()->functions[index].feedback_slots;
@@ -2313,7 +2403,12 @@ std::vector<std::unique_ptr<WasmCode>> NativeModule::AddCompiledCode(
   CodeSpaceWriteScope code_space_write_scope(this);
   {
     base::RecursiveMutexGuard guard{&allocation_mutex_};
-    code_space = code_allocator_.AllocateForCode(this, total_code_space);
+    // Keep TurboFan code apart from Liftoff code, which will be freed after
+    // tier-up.
+    code_space = all_turbofan ? code_allocator_.AllocateForHotCode(
+                                    this, total_code_space)
+                              : code_allocator_.AllocateForCode(
+                                    this, total_code_space);
     // Lookup the jump tables to use once, then use for all code objects.
     jump_tables =
         FindJumpTablesForRegionLocked(base::AddressRegionOf(code_space));
@@ -148,12 +148,27 @@ class V8_EXPORT_PRIVATE DisjointAllocationPool final {
   // empty pool on failure.
   base::AddressRegion AllocateInRegion(size_t size, base::AddressRegion);
 
+  // Allocate a contiguous region of size {size} at the highest possible address
+  // within {region}. Return an empty pool on failure.
+  base::AddressRegion AllocateFromEndInRegion(size_t size,
+                                              base::AddressRegion);
+
+  // Whether {region} is completely contained in one of the regions of this
+  // pool.
+  bool Contains(base::AddressRegion) const;
+
   bool IsEmpty() const { return regions_.empty(); }
 
   const auto& regions() const { return regions_; }
 
  private:
-  std::set<base::AddressRegion, base::AddressRegion::StartAddressLess> regions_;
+  using RegionSet =
+      std::set<base::AddressRegion, base::AddressRegion::StartAddressLess>;
+
+  // Remove {ret} from the region pointed to by {it}, which contains it.
+  void RemoveFromRegion(RegionSet::iterator it, base::AddressRegion ret);
+
+  RegionSet regions_;
 };
 
 class V8_EXPORT_PRIVATE WasmCode final {
@@ -547,6 +562,14 @@ class WasmCodeAllocator {
   base::Vector<byte> AllocateForCodeInRegion(NativeModule*, size_t size,
                                              base::AddressRegion);
 
+  // Allocate code space for code which is expected to stay alive (TurboFan
+  // code). With --wasm-separate-hot-code, this is allocated from the end of
+  // the code space, such that it does not interleave with Liftoff code which
+  // will be freed on tier-up. Returns a valid buffer or fails with OOM
+  // (crash).
+  // Hold the {NativeModule}'s {allocation_mutex_} when calling this method.
+  base::Vector<byte> AllocateForHotCode(NativeModule*, size_t size);
+
   // Increases or decreases the {writers_count_} field. While there is at least
   // one writer, it is allowed to call {MakeWritable} to make regions writable.
   // When the last writer is removed, all code is switched back to
@@ -580,6 +603,10 @@ class WasmCodeAllocator {
   void InsertIntoWritableRegions(base::AddressRegion region,
                                  bool switch_to_writable);
 
+  // Commits the pages of a region returned from {free_code_space_}, plus make
+  // already committed pages at either end writable.
+  void CommitForAllocation(base::AddressRegion code_space);
+
   //////////////////////////////////////////////////////////////////////////////
   // These fields are protected by the mutex in {NativeModule}.
 
@@ -25,6 +25,7 @@
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/module-instantiate.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-limits.h"
@@ -470,11 +471,19 @@ bool WasmEngine::SyncValidate(Isolate* isolate, const WasmFeatures& enabled,
     if (error_message) *error_message = "empty module wire bytes";
     return false;
   }
+  // Decode the module without verifying function bodies; those are then
+  // validated in parallel.
   auto result = DecodeWasmModule(
-      enabled, bytes.start(), bytes.end(), true, kWasmOrigin,
+      enabled, bytes.start(), bytes.end(), false, kWasmOrigin,
       isolate->counters(), isolate->metrics_recorder(),
       isolate->GetOrRegisterRecorderContextId(isolate->native_context()),
       DecodingMethod::kSync, allocator());
+  if (result.ok()) {
+    WasmError error =
+        ValidateFunctionBodies(result.value().get(), bytes, enabled,
+                               isolate->counters(), allocator());
+    if (error.has_error()) result = ModuleResult{std::move(error)};
+  }
   if (result.failed() && error_message) {
     *error_message = result.error().message();
   }
@@ -865,7 +874,8 @@ Handle<WasmModuleObject> WasmEngine::ImportNativeModule(
   Handle<Script> script =
       GetOrCreateScript(isolate, shared_native_module, source_url);
   Handle<FixedArray> export_wrappers;
-  CompileJsToWasmWrappers(isolate, native_module->module(), &export_wrappers);
+  GetOrCompileJsToWasmWrappers(isolate, script, native_module->module(),
+                               &export_wrappers);
   Handle<WasmModuleObject> module_object = WasmModuleObject::New(
       isolate, std::move(shared_native_module), script, export_wrappers);
   {
@@ -1054,6 +1064,8 @@ void WasmEngine::RemoveIsolate(Isolate* isolate) {
   }
 #endif  // V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
 
+  if (FLAG_wasm_pgo_to_file) DumpProfiles(isolate);
+
   base::MutexGuard guard(&mutex_);
   auto it = isolates_.find(isolate);
   DCHECK_NE(isolates_.end(), it);
@@ -1086,6 +1098,26 @@ void WasmEngine::RemoveIsolate(Isolate* isolate) {
   DCHECK(info->code_to_log.empty());
 }
 
+void WasmEngine::DumpProfiles(Isolate* isolate) {
+  std::vector<std::shared_ptr<NativeModule>> native_modules;
+  {
+    base::MutexGuard guard(&mutex_);
+    DCHECK_EQ(1, isolates_.count(isolate));
+    for (auto* native_module : isolates_[isolate]->native_modules) {
+      DCHECK_EQ(1, native_modules_.count(native_module));
+      if (auto shared_ptr = native_modules_[native_module]->weak_ptr.lock()) {
+        native_modules.emplace_back(std::move(shared_ptr));
+      }
+    }
+  }
+  // Write the files without holding the engine mutex.
+  for (auto& native_module : native_modules) {
+    if (native_module->module()->origin != kWasmOrigin) continue;
+    if (native_module->wire_bytes().empty()) continue;
+    DumpProfileToFile(native_module->module(), native_module->wire_bytes());
+  }
+}
+
 void WasmEngine::LogCode(base::Vector<WasmCode*> code_vec) {
   if (code_vec.empty()) return;
   base::MutexGuard guard(&mutex_);
@@ -386,6 +386,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
   // calling this method.
   void PotentiallyFinishCurrentGC();
 
+  // Writes the profiles of all live modules used by {isolate} (see
+  // --wasm-pgo-to-file). Do not hold {mutex_} when calling this method.
+  void DumpProfiles(Isolate* isolate);
+
   AccountingAllocator allocator_;
 
 #ifdef V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
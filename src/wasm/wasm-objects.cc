@@ -930,7 +930,7 @@ int32_t WasmMemoryObject::Grow(Isolate* isolate,
 
   // Check for maximum memory size.
   // Note: The {wasm::max_mem_pages()} limit is already checked in
-  // {BackingStore::CopyWasmMemory}, and is irrelevant for
+  // {BackingStore::MoveWasmMemory}, and is irrelevant for
   // {GrowWasmMemoryInPlace} because memory is never allocated with more
   // capacity than that limit.
   size_t old_size = old_buffer->byte_length();
@@ -994,7 +994,7 @@ int32_t WasmMemoryObject::Grow(Isolate* isolate,
 
   size_t new_pages = old_pages + pages;
   DCHECK_LT(old_pages, new_pages);
-  // Try allocating a new backing store and copying.
+  // Try allocating a new backing store and moving the contents over.
   // To avoid overall quadratic complexity of many small grow operations, we
   // grow by at least 0.5 MB + 12.5% of the existing memory size.
   // These numbers are kept small because we must be careful about address
@@ -1002,7 +1002,7 @@ int32_t WasmMemoryObject::Grow(Isolate* isolate,
   size_t min_growth = old_pages + 8 + (old_pages >> 3);
   size_t new_capacity = std::max(new_pages, min_growth);
   std::unique_ptr<BackingStore> new_backing_store =
-      backing_store->CopyWasmMemory(isolate, new_pages, new_capacity);
+      backing_store->MoveWasmMemory(isolate, new_pages, new_capacity);
   if (!new_backing_store) {
     // Crash on out-of-memory if the correctness fuzzer is running.
     if (FLAG_correctness_fuzzer_suppressions) {
@@ -1011,7 +1011,8 @@ int32_t WasmMemoryObject::Grow(Isolate* isolate,
     return -1;
   }
 
-  // Detach old and create a new one with the new backing store.
+  // Detach old and create a new one with the new backing store. The old
+  // backing store's contents are unspecified now.
   old_buffer->Detach(true);
   Handle<JSArrayBuffer> new_buffer =
       isolate->factory()->NewJSArrayBuffer(std::move(new_backing_store));
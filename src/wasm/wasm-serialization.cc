@@ -33,6 +33,7 @@ namespace {
 constexpr uint8_t kLazyFunction = 2;
 constexpr uint8_t kLiftoffFunction = 3;
 constexpr uint8_t kTurboFanFunction = 4;
+constexpr uint8_t kTierUpFunction = 5;
 
 // TODO(bbudge) Try to unify the various implementations of readers and writers
 // in Wasm, e.g. StreamProcessor and ZoneBuffer, with these.
@@ -347,13 +348,27 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
     // get compiled with Liftoff eagerly. If the function has not been executed
     // yet, we serialize it as {kLazyFunction}, and the function will not get
     // compiled upon deserialization.
+    // Functions that were already found to be hot, but whose TurboFan code
+    // was not ready yet, are serialized as {kTierUpFunction} so that they get
+    // compiled with TurboFan right after deserialization instead of having to
+    // exhaust their tiering budget again.
     NativeModule* native_module = code->native_module();
-    uint32_t budget =
-        native_module->tiering_budget_array()[declared_function_index(
-            native_module->module(), code->index())];
-    writer->Write(budget == static_cast<uint32_t>(FLAG_wasm_tiering_budget)
-                      ? kLazyFunction
-                      : kLiftoffFunction);
+    const WasmModule* module = native_module->module();
+    uint32_t budget = native_module->tiering_budget_array()
+                          [declared_function_index(module, code->index())];
+    if (budget == static_cast<uint32_t>(FLAG_wasm_tiering_budget)) {
+      writer->Write(kLazyFunction);
+      return;
+    }
+    bool tier_up_triggered;
+    {
+      base::MutexGuard mutex_guard(&module->type_feedback.mutex);
+      auto& feedback = module->type_feedback.feedback_for_function;
+      auto it = feedback.find(code->index());
+      tier_up_triggered =
+          it != feedback.end() && it->second.tierup_priority > 0;
+    }
+    writer->Write(tier_up_triggered ? kTierUpFunction : kLiftoffFunction);
     return;
   }
 
@@ -559,6 +574,10 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
     return base::VectorOf(liftoff_functions_);
   }
 
+  base::Vector<const int> tier_up_functions() {
+    return base::VectorOf(tier_up_functions_);
+  }
+
  private:
   friend class DeserializeCodeTask;
 
@@ -578,6 +597,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   NativeModule::JumpTablesRef current_jump_tables_;
   std::vector<int> lazy_functions_;
   std::vector<int> liftoff_functions_;
+  std::vector<int> tier_up_functions_;
 };
 
 class DeserializeCodeTask : public JobTask {
@@ -714,6 +734,10 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
     liftoff_functions_.push_back(fn_index);
     return {};
   }
+  if (code_kind == kTierUpFunction) {
+    tier_up_functions_.push_back(fn_index);
+    return {};
+  }
 
   int constant_pool_offset = reader->Read<int>();
   int safepoint_table_offset = reader->Read<int>();
@@ -894,16 +918,16 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
       return {};
     }
     shared_native_module->compilation_state()->InitializeAfterDeserialization(
-        deserializer.lazy_functions(), deserializer.liftoff_functions());
+        deserializer.lazy_functions(), deserializer.liftoff_functions(),
+        deserializer.tier_up_functions());
     wasm_engine->UpdateNativeModuleCache(error, &shared_native_module, isolate);
   }
 
-  Handle<FixedArray> export_wrappers;
-  CompileJsToWasmWrappers(isolate, shared_native_module->module(),
-                          &export_wrappers);
-
   Handle<Script> script =
       wasm_engine->GetOrCreateScript(isolate, shared_native_module, source_url);
+  Handle<FixedArray> export_wrappers;
+  GetOrCompileJsToWasmWrappers(isolate, script, shared_native_module->module(),
+                               &export_wrappers);
   Handle<WasmModuleObject> module_object = WasmModuleObject::New(
       isolate, shared_native_module, script, export_wrappers);
 
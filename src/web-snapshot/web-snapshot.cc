@@ -4,20 +4,28 @@
 
 #include "src/web-snapshot/web-snapshot.h"
 
+#include <atomic>
 #include <limits>
 
 #include "include/v8-isolate.h"
 #include "include/v8-local-handle.h"
 #include "include/v8-object.h"
+#include "include/v8-platform.h"
 #include "include/v8-primitive.h"
 #include "include/v8-script.h"
 #include "src/api/api-inl.h"
 #include "src/base/platform/wrappers.h"
+#include "src/execution/local-isolate.h"
 #include "src/handles/handles.h"
+#include "src/handles/persistent-handles.h"
+#include "src/heap/local-factory-inl.h"
+#include "src/heap/parked-scope.h"
+#include "src/init/v8.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/contexts.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/script.h"
+#include "src/strings/unicode-decoder.h"
 
 namespace v8 {
 namespace internal {
@@ -343,10 +351,27 @@ void WebSnapshotSerializer::SerializePendingItems() {
     Handle<JSArray> array = handle(JSArray::cast(arrays_->Get(i)), isolate_);
     SerializeArray(array);
   }
-  for (int i = objects_->Length() - 1; i >= 0; --i) {
+  for (int i = objects_->Length() - 1; i >= 0;) {
     Handle<JSObject> object =
         handle(JSObject::cast(objects_->Get(i)), isolate_);
-    SerializeObject(object);
+    Handle<Map> map(object->map(), isolate_);
+    // Objects of the same shape which are discovered together, e.g. the
+    // records in an array, get consecutive ids. Serialize runs of them
+    // column-wise if they don't have elements.
+    int count = 1;
+    if (object->elements().length() == 0) {
+      while (i - count >= 0) {
+        JSObject next = JSObject::cast(objects_->Get(i - count));
+        if (next.map() != *map || next.elements().length() != 0) break;
+        ++count;
+      }
+    }
+    if (count == 1) {
+      SerializeObject(object);
+    } else {
+      SerializeObjectRun(map, i, count);
+    }
+    i -= count;
   }
 }
 
@@ -958,6 +983,7 @@ void WebSnapshotSerializer::SerializeContext(Handle<Context> context) {
 
 // Format (serialized object):
 // - Shape id
+// - 1 (the run length, see SerializeObjectRun)
 // - For each property:
 //   - Serialized value
 // - Max element index + 1 (or 0 if there are no elements)
@@ -969,6 +995,7 @@ void WebSnapshotSerializer::SerializeObject(Handle<JSObject> object) {
   Handle<Map> map(object->map(), isolate_);
   uint32_t map_id = GetMapId(*map);
   object_serializer_.WriteUint32(map_id);
+  object_serializer_.WriteUint32(1);
 
   // Properties.
   for (InternalIndex i : map->IterateOwnDescriptors()) {
@@ -1009,6 +1036,84 @@ void WebSnapshotSerializer::SerializeObject(Handle<JSObject> object) {
   }
 }
 
+// Format (serialized run of objects):
+// - Shape id
+// - Run length (> 1)
+// - For each property:
+//   - Column type
+//   - For each object in the run:
+//     - Value, encoded according to the column type
+// The objects in a run have no elements.
+void WebSnapshotSerializer::SerializeObjectRun(Handle<Map> map,
+                                               int first_index, int count) {
+  object_serializer_.WriteUint32(GetMapId(*map));
+  object_serializer_.WriteUint32(static_cast<uint32_t>(count));
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    PropertyDetails details =
+        map->instance_descriptors(kRelaxedLoad).GetDetails(i);
+    FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
+    ColumnType column_type = GetColumnType(map, i, first_index, count);
+    object_serializer_.WriteUint32(column_type);
+    for (int j = first_index; j > first_index - count; --j) {
+      Handle<JSObject> object =
+          handle(JSObject::cast(objects_->Get(j)), isolate_);
+      Handle<Object> value = JSObject::FastPropertyAt(
+          isolate_, object, details.representation(), field_index);
+      switch (column_type) {
+        case INTEGER_COLUMN:
+          object_serializer_.WriteZigZag<int32_t>(Smi::cast(*value).value());
+          break;
+        case DOUBLE_COLUMN:
+          object_serializer_.WriteDouble(HeapNumber::cast(*value).value());
+          break;
+        case STRING_ID_COLUMN:
+          WriteStringId(Handle<String>::cast(value), object_serializer_);
+          break;
+        case TAGGED_COLUMN:
+          WriteValue(value, object_serializer_);
+          break;
+      }
+    }
+  }
+}
+
+WebSnapshotSerializer::ColumnType WebSnapshotSerializer::GetColumnType(
+    Handle<Map> map, InternalIndex descriptor, int first_index, int count) {
+  PropertyDetails details =
+      map->instance_descriptors(kRelaxedLoad).GetDetails(descriptor);
+  FieldIndex field_index = FieldIndex::ForDescriptor(*map, descriptor);
+  bool all_smis = true;
+  bool all_doubles = true;
+  bool all_string_ids = true;
+  for (int j = first_index; j > first_index - count; --j) {
+    Handle<JSObject> object =
+        handle(JSObject::cast(objects_->Get(j)), isolate_);
+    Handle<Object> value = JSObject::FastPropertyAt(
+        isolate_, object, details.representation(), field_index);
+    if (value->IsSmi()) {
+      all_doubles = all_string_ids = false;
+      continue;
+    }
+    all_smis = false;
+    int external_id;
+    if (external_objects_ids_.Lookup(HeapObject::cast(*value), &external_id)) {
+      return TAGGED_COLUMN;
+    }
+    if (!value->IsHeapNumber()) all_doubles = false;
+    if (all_string_ids) {
+      bool in_place = true;
+      if (value->IsString()) GetStringId(Handle<String>::cast(value), in_place);
+      // Strings referred to only once are written in place.
+      if (in_place) all_string_ids = false;
+    }
+    if (!all_doubles && !all_string_ids) return TAGGED_COLUMN;
+  }
+  if (all_smis) return INTEGER_COLUMN;
+  if (all_doubles) return DOUBLE_COLUMN;
+  if (all_string_ids) return STRING_ID_COLUMN;
+  return TAGGED_COLUMN;
+}
+
 // Format (serialized array):
 // - Length
 // - For each element:
@@ -1439,6 +1544,90 @@ bool WebSnapshotDeserializer::DeserializeScript() {
   return !has_error();
 }
 
+namespace {
+
+// Same as Factory::NewStringFromUtf8, for use on a background thread.
+Handle<String> NewStringFromUtf8(LocalIsolate* isolate,
+                                 base::Vector<const uint8_t> utf8_data) {
+  Utf8Decoder decoder(utf8_data);
+  if (decoder.utf16_length() == 0) return isolate->factory()->empty_string();
+  if (decoder.is_one_byte()) {
+    Handle<SeqOneByteString> result =
+        isolate->factory()
+            ->NewRawOneByteString(decoder.utf16_length(), AllocationType::kOld)
+            .ToHandleChecked();
+    DisallowGarbageCollection no_gc;
+    decoder.Decode(
+        result->GetChars(no_gc, SharedStringAccessGuardIfNeeded::NotNeeded()),
+        utf8_data);
+    return result;
+  }
+  Handle<SeqTwoByteString> result =
+      isolate->factory()
+          ->NewRawTwoByteString(decoder.utf16_length(), AllocationType::kOld)
+          .ToHandleChecked();
+  DisallowGarbageCollection no_gc;
+  decoder.Decode(
+      result->GetChars(no_gc, SharedStringAccessGuardIfNeeded::NotNeeded()),
+      utf8_data);
+  return result;
+}
+
+// Decodes a part of the string table on a background LocalIsolate. The job
+// has a single work item that is claimed by the first thread to get to it:
+// either a worker, or the main thread once it is done with its own part (see
+// DeserializeStringsConcurrently).
+class StringTableDecodingJob final : public JobTask {
+ public:
+  StringTableDecodingJob(
+      Isolate* isolate,
+      base::Vector<const base::Vector<const uint8_t>> utf8_strings,
+      std::vector<Handle<String>>* strings,
+      std::unique_ptr<PersistentHandles>* persistent_handles)
+      : isolate_(isolate),
+        utf8_strings_(utf8_strings),
+        strings_(strings),
+        persistent_handles_(persistent_handles) {}
+
+  void Run(JobDelegate* delegate) final {
+    // The main thread never joins this job to run it; it claims the work
+    // instead and decodes on its own isolate.
+    DCHECK(!delegate->IsJoiningThread());
+    if (!TryClaim()) return;
+    LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
+    UnparkedScope unparked_scope(&local_isolate);
+    LocalHandleScope handle_scope(&local_isolate);
+    for (base::Vector<const uint8_t> utf8_string : utf8_strings_) {
+      strings_->push_back(local_isolate.heap()->NewPersistentHandle(
+          NewStringFromUtf8(&local_isolate, utf8_string)));
+      local_isolate.heap()->Safepoint();
+    }
+    *persistent_handles_ = local_isolate.heap()->DetachPersistentHandles();
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const final {
+    return claimed_.load(std::memory_order_relaxed) ? 0 : 1;
+  }
+
+  // Returns whether the caller is the one to decode the strings.
+  bool TryClaim() {
+    return !claimed_.exchange(true, std::memory_order_relaxed);
+  }
+
+ private:
+  Isolate* const isolate_;
+  const base::Vector<const base::Vector<const uint8_t>> utf8_strings_;
+  std::vector<Handle<String>>* const strings_;
+  std::unique_ptr<PersistentHandles>* const persistent_handles_;
+  std::atomic<bool> claimed_{false};
+};
+
+// String tables with less UTF-8 data than this are decoded on the main thread
+// only.
+constexpr size_t kMinStringTableSizeForConcurrentDecoding = 64 * KB;
+
+}  // namespace
+
 void WebSnapshotDeserializer::DeserializeStrings() {
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kWebSnapshotDeserialize_Strings);
   if (!deserializer_.ReadUint32(&string_count_) ||
@@ -1449,6 +1638,10 @@ void WebSnapshotDeserializer::DeserializeStrings() {
   STATIC_ASSERT(kMaxItemCount <= FixedArray::kMaxLength);
   strings_handle_ = factory()->NewFixedArray(string_count_);
   strings_ = *strings_handle_;
+  if (FLAG_concurrent_web_snapshot_strings &&
+      DeserializeStringsConcurrently()) {
+    return;
+  }
   for (uint32_t i = 0; i < string_count_; ++i) {
     MaybeHandle<String> maybe_string =
         deserializer_.ReadUtf8String(AllocationType::kOld);
@@ -1461,6 +1654,83 @@ void WebSnapshotDeserializer::DeserializeStrings() {
   }
 }
 
+bool WebSnapshotDeserializer::DeserializeStringsConcurrently() {
+  // Find the UTF-8 data of all strings first, which is cheap compared to
+  // decoding it, and give up on small or malformed tables. Those are decoded
+  // (or rejected) by the serial loop.
+  const uint8_t* start = deserializer_.position_;
+  std::vector<base::Vector<const uint8_t>> utf8_strings(string_count_);
+  size_t total_size = 0;
+  for (uint32_t i = 0; i < string_count_; ++i) {
+    uint32_t utf8_length;
+    const void* utf8_data;
+    if (!deserializer_.ReadUint32(&utf8_length) ||
+        utf8_length > static_cast<uint32_t>(String::kMaxLength) ||
+        !deserializer_.ReadRawBytes(utf8_length, &utf8_data)) {
+      deserializer_.position_ = start;
+      return false;
+    }
+    utf8_strings[i] = base::Vector<const uint8_t>(
+        reinterpret_cast<const uint8_t*>(utf8_data), utf8_length);
+    total_size += utf8_length;
+  }
+  if (total_size < kMinStringTableSizeForConcurrentDecoding) {
+    deserializer_.position_ = start;
+    return false;
+  }
+
+  // Decode the second half of the data on a worker thread while the main
+  // thread decodes the first half.
+  uint32_t split = 0;
+  for (size_t size = 0; size < total_size / 2; ++split) {
+    size += utf8_strings[split].length();
+  }
+  base::Vector<const base::Vector<const uint8_t>> background_strings(
+      utf8_strings.data() + split, string_count_ - split);
+  std::vector<Handle<String>> decoded_strings;
+  decoded_strings.reserve(background_strings.size());
+  std::unique_ptr<PersistentHandles> persistent_handles;
+  auto job = std::make_unique<StringTableDecodingJob>(
+      isolate_, background_strings, &decoded_strings, &persistent_handles);
+  StringTableDecodingJob* decoding_job = job.get();
+  std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserBlocking, std::move(job));
+
+  auto decode_on_main_thread = [&](uint32_t begin, uint32_t end) {
+    for (uint32_t i = begin; i < end; ++i) {
+      Handle<String> string =
+          factory()
+              ->NewStringFromUtf8(
+                  base::Vector<const char>::cast(utf8_strings[i]),
+                  AllocationType::kOld)
+              .ToHandleChecked();
+      strings_.set(i, *string);
+    }
+  };
+  decode_on_main_thread(0, split);
+
+  if (decoding_job->TryClaim()) {
+    // No worker got to the second half of the table while the main thread
+    // was decoding the first one, e.g. because all of them are busy. Decode
+    // it here instead of waiting for one.
+    job_handle->Cancel();
+    decode_on_main_thread(split, string_count_);
+    return true;
+  }
+
+  {
+    // The worker allocates on the heap and may wait for a safepoint, so park
+    // the main thread while waiting for it.
+    ParkedScope parked_scope(isolate_->main_thread_local_isolate());
+    job_handle->Join();
+  }
+  DCHECK_EQ(decoded_strings.size(), background_strings.size());
+  for (size_t i = 0; i < decoded_strings.size(); ++i) {
+    strings_.set(split + static_cast<int>(i), *decoded_strings[i]);
+  }
+  return true;
+}
+
 String WebSnapshotDeserializer::ReadString(bool internalize) {
   DCHECK(!strings_handle_->is_null());
   uint32_t string_id;
@@ -1941,10 +2211,20 @@ void WebSnapshotDeserializer::DeserializeObjects() {
   objects_ = *objects_handle_;
   for (; current_object_count_ < object_count_; ++current_object_count_) {
     uint32_t map_id;
-    if (!deserializer_.ReadUint32(&map_id) || map_id >= map_count_) {
+    uint32_t run_length;
+    if (!deserializer_.ReadUint32(&map_id) || map_id >= map_count_ ||
+        !deserializer_.ReadUint32(&run_length) || run_length == 0 ||
+        run_length > object_count_ - current_object_count_) {
       Throw("Malformed object");
       return;
     }
+    if (run_length > 1) {
+      DeserializeObjectRun(handle(Map::cast(maps_.get(map_id)), isolate_),
+                           run_length);
+      if (has_error()) return;
+      current_object_count_ += run_length - 1;
+      continue;
+    }
     Map raw_map = Map::cast(maps_.get(map_id));
     Handle<DescriptorArray> descriptors =
         handle(raw_map.instance_descriptors(kRelaxedLoad), isolate_);
@@ -2009,6 +2289,72 @@ void WebSnapshotDeserializer::DeserializeObjects() {
   }
 }
 
+void WebSnapshotDeserializer::DeserializeObjectRun(Handle<Map> map,
+                                                   uint32_t count) {
+  Handle<DescriptorArray> descriptors =
+      handle(map->instance_descriptors(kRelaxedLoad), isolate_);
+  int no_properties = map->NumberOfOwnDescriptors();
+  // Allocate all property arrays up front, so that values can be read
+  // column by column.
+  Handle<FixedArray> property_arrays = factory()->NewFixedArray(count);
+  for (uint32_t j = 0; j < count; ++j) {
+    Handle<PropertyArray> property_array =
+        factory()->NewPropertyArray(no_properties);
+    property_arrays->set(j, *property_array);
+  }
+  for (int i = 0; i < no_properties; ++i) {
+    {
+      DisallowGarbageCollection no_gc;
+      DescriptorArray raw_descriptors = *descriptors;
+      PropertyDetails details = raw_descriptors.GetDetails(InternalIndex(i));
+      CHECK_EQ(details.location(), PropertyLocation::kField);
+      CHECK_EQ(PropertyKind::kData, details.kind());
+      Representation r = details.representation();
+      if (r.IsNone()) {
+        details = details.CopyWithRepresentation(Representation::Tagged());
+        raw_descriptors.SetDetails(InternalIndex(i), details);
+      } else if (!r.Equals(Representation::Tagged())) {
+        // TODO(v8:11525): Support this case too.
+        UNREACHABLE();
+      }
+    }
+    uint32_t column_type;
+    if (!deserializer_.ReadUint32(&column_type)) {
+      Throw("Malformed object");
+      return;
+    }
+    for (uint32_t j = 0; j < count; ++j) {
+      Handle<PropertyArray> property_array(
+          PropertyArray::cast(property_arrays->get(j)), isolate_);
+      Object value;
+      switch (column_type) {
+        case ColumnType::TAGGED_COLUMN:
+          value = ReadValue(property_array, i);
+          break;
+        case ColumnType::INTEGER_COLUMN:
+          value = ReadInteger();
+          break;
+        case ColumnType::DOUBLE_COLUMN:
+          value = ReadNumber();
+          break;
+        case ColumnType::STRING_ID_COLUMN:
+          value = ReadString(false);
+          break;
+        default:
+          Throw("Unsupported column type");
+          return;
+      }
+      property_array->set(i, value);
+    }
+  }
+  for (uint32_t j = 0; j < count; ++j) {
+    Handle<JSObject> object = factory()->NewJSObjectFromMap(map);
+    DisallowGarbageCollection no_gc;
+    object->set_raw_properties_or_hash(property_arrays->get(j), kRelaxedStore);
+    objects_.set(static_cast<int>(current_object_count_ + j), *object);
+  }
+}
+
 void WebSnapshotDeserializer::DeserializeArrays() {
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kWebSnapshotDeserialize_Arrays);
   if (!deserializer_.ReadUint32(&array_count_) ||
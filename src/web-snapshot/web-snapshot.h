@@ -63,6 +63,14 @@ class WebSnapshotSerializerDeserializer {
 
   enum PropertyAttributesType : uint8_t { DEFAULT, CUSTOM };
 
+  // Encodings of a property in a run of objects with the same shape.
+  enum ColumnType : uint8_t {
+    TAGGED_COLUMN,     // Serialized values.
+    INTEGER_COLUMN,    // Zigzag encoded Smis, without value types.
+    DOUBLE_COLUMN,     // Doubles, without value types.
+    STRING_ID_COLUMN,  // String ids, without value types.
+  };
+
   uint32_t FunctionKindToFunctionFlags(FunctionKind kind);
   FunctionKind FunctionFlagsToFunctionKind(uint32_t flags);
   bool IsFunctionOrMethod(uint32_t flags);
@@ -201,6 +209,9 @@ class V8_EXPORT WebSnapshotSerializer
   void SerializeContext(Handle<Context> context);
   void SerializeArray(Handle<JSArray> array);
   void SerializeObject(Handle<JSObject> object);
+  void SerializeObjectRun(Handle<Map> map, int first_index, int count);
+  ColumnType GetColumnType(Handle<Map> map, InternalIndex descriptor,
+                           int first_index, int count);
 
   void SerializeExport(Handle<Object> object, Handle<String> export_name);
   void WriteValue(Handle<Object> object, ValueSerializer& serializer);
@@ -312,6 +323,7 @@ class V8_EXPORT WebSnapshotDeserializer
   WebSnapshotDeserializer& operator=(const WebSnapshotDeserializer&) = delete;
 
   void DeserializeStrings();
+  bool DeserializeStringsConcurrently();
   void DeserializeMaps();
   void DeserializeContexts();
   Handle<ScopeInfo> CreateScopeInfo(uint32_t variable_count, bool has_parent,
@@ -324,6 +336,7 @@ class V8_EXPORT WebSnapshotDeserializer
   void DeserializeClasses();
   void DeserializeArrays();
   void DeserializeObjects();
+  void DeserializeObjectRun(Handle<Map> map, uint32_t count);
   void DeserializeExports(bool skip_exports);
 
   Object ReadValue(
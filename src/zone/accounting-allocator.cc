@@ -10,9 +10,11 @@
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/base/platform/wrappers.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
+#include "src/zone/zone.h"
 
 namespace v8 {
 namespace internal {
@@ -80,16 +82,69 @@ AccountingAllocator::AccountingAllocator()
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
+
+// static
+int AccountingAllocator::PoolIndexForSize(size_t bytes) {
+  if (bytes == Zone::kMinimumSegmentSize) return 0;
+  if (bytes == Zone::kMaximumSegmentSize) return 1;
+  return -1;
+}
+
+Segment* AccountingAllocator::TryAllocatePooledSegment(size_t bytes) {
+  int index = PoolIndexForSize(bytes);
+  if (index < 0) return nullptr;
+  base::MutexGuard guard(&pool_mutex_);
+  Segment* segment = pooled_segments_[index];
+  if (segment == nullptr) return nullptr;
+  pooled_segments_[index] = segment->next();
+  pooled_bytes_ -= bytes;
+  return segment;
+}
+
+bool AccountingAllocator::TryPoolSegment(Segment* segment) {
+  size_t bytes = segment->total_size();
+  int index = PoolIndexForSize(bytes);
+  if (index < 0) return false;
+  base::MutexGuard guard(&pool_mutex_);
+  if (pooled_bytes_ + bytes > FLAG_zone_segment_pool_size) return false;
+  segment->set_zone(nullptr);
+  segment->set_next(pooled_segments_[index]);
+  pooled_segments_[index] = segment;
+  pooled_bytes_ += bytes;
+  return true;
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  Segment* segments[kNumPooledSegmentSizes];
+  {
+    base::MutexGuard guard(&pool_mutex_);
+    for (int i = 0; i < kNumPooledSegmentSizes; i++) {
+      segments[i] = pooled_segments_[i];
+      pooled_segments_[i] = nullptr;
+    }
+    pooled_bytes_ = 0;
+  }
+  for (Segment* segment : segments) {
+    while (segment != nullptr) {
+      Segment* next = segment->next();
+      segment->ZapHeader();
+      zone_backing_free_(segment);
+      segment = next;
+    }
+  }
+}
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
-  void* memory;
+  void* memory = nullptr;
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     bytes = RoundUp(bytes, kZonePageSize);
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
+  } else if (Segment* pooled = TryAllocatePooledSegment(bytes)) {
+    memory = pooled;
   } else {
     memory = AllocWithRetry(bytes, zone_backing_malloc_);
   }
@@ -111,10 +166,11 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
-  } else {
+  } else if (!TryPoolSegment(segment)) {
+    segment->ZapHeader();
     zone_backing_free_(segment);
   }
 }
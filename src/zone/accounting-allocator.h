@@ -10,6 +10,7 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -38,6 +39,9 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   // them if the pool is already full or memory pressure is high.
   void ReturnSegment(Segment* memory, bool supports_compression);
 
+  // Frees all segments held in the pool.
+  void ReleasePooledSegments();
+
   size_t GetCurrentMemoryUsage() const {
     return current_memory_usage_.load(std::memory_order_relaxed);
   }
@@ -67,6 +71,16 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Segments of these sizes are the first and the steady-state segments of
+  // every zone and are kept in a bounded pool when returned, so that short
+  // lived zones (e.g. those of concurrent compilation jobs) do not hit
+  // malloc for every segment.
+  static constexpr int kNumPooledSegmentSizes = 2;
+  static int PoolIndexForSize(size_t bytes);
+
+  Segment* TryAllocatePooledSegment(size_t bytes);
+  bool TryPoolSegment(Segment* segment);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
@@ -75,6 +89,10 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
 
   ZoneBackingAllocator::MallocFn zone_backing_malloc_ = nullptr;
   ZoneBackingAllocator::FreeFn zone_backing_free_ = nullptr;
+
+  base::Mutex pool_mutex_;
+  Segment* pooled_segments_[kNumPooledSegmentSizes] = {};
+  size_t pooled_bytes_ = 0;
 };
 
 }  // namespace internal
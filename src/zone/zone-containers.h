@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "src/base/functional.h"
+#include "src/base/small-vector.h"
 #include "src/zone/zone-allocator.h"
 
 namespace v8 {
@@ -53,6 +54,23 @@ class ZoneVector : public std::vector<T, ZoneAllocator<T>> {
       : std::vector<T, ZoneAllocator<T>>(first, last, ZoneAllocator<T>(zone)) {}
 };
 
+// A wrapper subclass for base::SmallVector that keeps up to {kSize} elements
+// inline and only falls back to zone memory when it outgrows them. Prefer it
+// over ZoneVector for short-lived, usually small lists, which would otherwise
+// leave every intermediate backing store behind in the zone.
+template <typename T, size_t kSize>
+class ZoneSmallVector : public base::SmallVector<T, kSize, ZoneAllocator<T>> {
+ public:
+  // Constructs an empty vector.
+  explicit ZoneSmallVector(Zone* zone)
+      : base::SmallVector<T, kSize, ZoneAllocator<T>>(ZoneAllocator<T>(zone)) {}
+
+  // Constructs a new vector with {size} uninitialized elements.
+  ZoneSmallVector(size_t size, Zone* zone)
+      : base::SmallVector<T, kSize, ZoneAllocator<T>>(size,
+                                                      ZoneAllocator<T>(zone)) {}
+};
+
 // A wrapper subclass for std::deque to make it easy to construct one
 // that uses a zone allocator.
 template <typename T>
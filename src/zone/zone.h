@@ -232,6 +232,8 @@ class V8_EXPORT_PRIVATE Zone final {
   stdd::atomic<size_t> freed_size_for_tracing_ = {0};
 #endif
 
+  // For pooling segments of the standard sizes.
+  friend class AccountingAllocator;
   friend class ZoneScope;
 };
 
@@ -48,6 +48,46 @@ BENCHMARK_F(Allocate, Large)(benchmark::State& st) {
   st.SetBytesProcessed(st.iterations() * sizeof(LargeObject));
 }
 
+template <size_t Size>
+class SizedObject final : public GarbageCollected<SizedObject<Size>> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+  char padding[Size];
+};
+
+// Alternates between the regular size classes, so that every allocation
+// switches to the linear allocation buffer of another space.
+BENCHMARK_F(Allocate, MixedSizes)(benchmark::State& st) {
+  subtle::NoGarbageCollectionScope no_gc(*Heap::From(&heap()));
+  AllocationHandle& handle = heap().GetAllocationHandle();
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<8>>(handle));
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<40>>(handle));
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<100>>(handle));
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<200>>(handle));
+  }
+  st.SetBytesProcessed(st.iterations() *
+                       (sizeof(SizedObject<8>) + sizeof(SizedObject<40>) +
+                        sizeof(SizedObject<100>) + sizeof(SizedObject<200>)));
+}
+
+// Heaps are bound to the thread that creates them. Threads that allocate
+// garbage-collected objects concurrently each use their own heap, which keeps
+// the allocation fast path free of synchronization.
+void AllocateOnThreadHeap(benchmark::State& st) {
+  std::unique_ptr<cppgc::Heap> heap =
+      cppgc::Heap::Create(testing::BenchmarkWithHeap::GetPlatform());
+  subtle::NoGarbageCollectionScope no_gc(*Heap::From(heap.get()));
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(
+        cppgc::MakeGarbageCollected<TinyObject>(heap->GetAllocationHandle()));
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(TinyObject));
+}
+BENCHMARK(AllocateOnThreadHeap)->Threads(1)->Threads(2)->Threads(4)->Threads(8);
+
 }  // namespace
 }  // namespace internal
 }  // namespace cppgc
@@ -0,0 +1,111 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/benchmarks/cpp/internals/benchmark_utils.h"
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-initialization.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/logging/counters.h"
+#include "src/logging/runtime-call-stats.h"
+#include "src/logging/tracing-flags.h"
+
+namespace v8 {
+namespace internal {
+namespace testing {
+
+// static
+std::unique_ptr<v8::Platform> BenchmarkWithIsolate::platform_;
+
+// static
+void BenchmarkWithIsolate::InitializeProcess(int* argc, char** argv) {
+  v8::V8::SetFlagsFromCommandLine(argc, argv, true);
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  platform_ = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform_.get());
+#ifdef V8_SANDBOX
+  CHECK(v8::V8::InitializeSandbox());
+#endif  // V8_SANDBOX
+  v8::V8::Initialize();
+}
+
+// static
+void BenchmarkWithIsolate::ShutdownProcess() {
+  v8::V8::Dispose();
+  v8::V8::DisposePlatform();
+  platform_.reset();
+}
+
+void BenchmarkWithIsolate::SetUp(::benchmark::State& state) {
+  array_buffer_allocator_.reset(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = array_buffer_allocator_.get();
+  v8_isolate_ = v8::Isolate::New(create_params);
+  v8_isolate_->Enter();
+  v8::HandleScope handle_scope(v8_isolate_);
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate_);
+  context->Enter();
+  context_.Reset(v8_isolate_, context);
+}
+
+void BenchmarkWithIsolate::TearDown(::benchmark::State& state) {
+  {
+    v8::HandleScope handle_scope(v8_isolate_);
+    context()->Exit();
+  }
+  context_.Reset();
+  while (v8::platform::PumpMessageLoop(platform_.get(), v8_isolate_)) {
+  }
+  v8_isolate_->Exit();
+  v8_isolate_->Dispose();
+  v8_isolate_ = nullptr;
+  array_buffer_allocator_.reset();
+}
+
+Isolate* BenchmarkWithIsolate::isolate() const {
+  return reinterpret_cast<Isolate*>(v8_isolate_);
+}
+
+Factory* BenchmarkWithIsolate::factory() const {
+  return isolate()->factory();
+}
+
+v8::Local<v8::Value> BenchmarkWithIsolate::RunJS(const char* source) {
+  v8::EscapableHandleScope handle_scope(v8_isolate_);
+  v8::Local<v8::String> source_string =
+      v8::String::NewFromUtf8(v8_isolate_, source).ToLocalChecked();
+  v8::Local<v8::Script> script =
+      v8::Script::Compile(context(), source_string).ToLocalChecked();
+  return handle_scope.Escape(script->Run(context()).ToLocalChecked());
+}
+
+void RuntimeCallStatsCollector::Collect(v8::Isolate* v8_isolate) {
+#ifdef V8_RUNTIME_CALL_STATS
+  if (!TracingFlags::is_runtime_stats_enabled()) return;
+  RuntimeCallStats* stats =
+      reinterpret_cast<Isolate*>(v8_isolate)->counters()->runtime_call_stats();
+  for (int i = 0; i < RuntimeCallStats::kNumberOfCounters; i++) {
+    RuntimeCallCounter* counter = stats->GetCounter(i);
+    if (counter->count() == 0) continue;
+    time_ms_[counter->name()] += counter->time().InMillisecondsF();
+  }
+  stats->Reset();
+#endif  // V8_RUNTIME_CALL_STATS
+}
+
+void RuntimeCallStatsCollector::Report(::benchmark::State& state) const {
+  for (const auto& entry : time_ms_) {
+    state.counters["RCS:" + entry.first] = ::benchmark::Counter(
+        entry.second, ::benchmark::Counter::kAvgIterations);
+  }
+}
+
+}  // namespace testing
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,80 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TEST_BENCHMARK_CPP_INTERNALS_BENCHMARK_UTILS_H_
+#define TEST_BENCHMARK_CPP_INTERNALS_BENCHMARK_UTILS_H_
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-platform.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+
+class Factory;
+class Isolate;
+
+namespace testing {
+
+// Provides a fresh isolate with an entered context to each benchmark run.
+// The isolate is entered but not locked, and no HandleScope is open, so
+// benchmarks must open their own HandleScope before creating handles
+// (including calling context() or RunJS()), and should open another one per
+// iteration to keep the handle count from growing.
+class BenchmarkWithIsolate : public benchmark::Fixture {
+ public:
+  static void InitializeProcess(int* argc, char** argv);
+  static void ShutdownProcess();
+
+  static v8::Platform* GetPlatform() { return platform_.get(); }
+
+ protected:
+  void SetUp(::benchmark::State& state) override;
+  void TearDown(::benchmark::State& state) override;
+
+  v8::Isolate* v8_isolate() const { return v8_isolate_; }
+  Isolate* isolate() const;
+  Factory* factory() const;
+  v8::Local<v8::Context> context() const {
+    return context_.Get(v8_isolate_);
+  }
+
+  // Compiles and runs {source} in the benchmark's context.
+  v8::Local<v8::Value> RunJS(const char* source);
+
+ private:
+  static std::unique_ptr<v8::Platform> platform_;
+
+  std::unique_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_;
+  v8::Isolate* v8_isolate_ = nullptr;
+  v8::Global<v8::Context> context_;
+};
+
+// Sums up the RuntimeCallStats of isolates over all iterations of a
+// benchmark and reports the time of every counter that ran as "RCS:<name>",
+// in milliseconds per iteration. Only has data when the benchmark binary runs
+// with --runtime-call-stats.
+class RuntimeCallStatsCollector final {
+ public:
+  // Adds the current stats of {isolate} and resets them.
+  void Collect(v8::Isolate* isolate);
+  void Report(::benchmark::State& state) const;
+
+ private:
+  std::map<std::string, double> time_ms_;
+};
+
+}  // namespace testing
+}  // namespace internal
+}  // namespace v8
+
+#endif  // TEST_BENCHMARK_CPP_INTERNALS_BENCHMARK_UTILS_H_
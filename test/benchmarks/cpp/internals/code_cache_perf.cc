@@ -0,0 +1,80 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+#include "src/codegen/compilation-cache.h"
+#include "src/execution/isolate.h"
+#include "test/benchmarks/cpp/internals/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+class CodeCacheBenchmark : public testing::BenchmarkWithIsolate {
+ protected:
+  void SetUp(::benchmark::State& st) override {
+    testing::BenchmarkWithIsolate::SetUp(st);
+    // Otherwise every compilation after the first one is a cache hit.
+    isolate()->compilation_cache()->DisableScriptAndEval();
+    for (int i = 0; i < 200; i++) {
+      std::string index = std::to_string(i);
+      source_ += "function f" + index + "(a, b) { return a * " + index +
+                 " + b; }\n";
+    }
+  }
+
+  v8::Local<v8::String> Source() {
+    return v8::String::NewFromUtf8(v8_isolate(), source_.c_str())
+        .ToLocalChecked();
+  }
+
+  std::string source_;
+};
+
+BENCHMARK_F(CodeCacheBenchmark, Produce)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::ScriptCompiler::Source source(Source());
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(v8_isolate(), &source)
+          .ToLocalChecked();
+  for (auto _ : st) {
+    USE(_);
+    delete v8::ScriptCompiler::CreateCodeCache(script);
+  }
+}
+
+BENCHMARK_F(CodeCacheBenchmark, Consume)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::ScriptCompiler::CachedData* cache;
+  {
+    v8::ScriptCompiler::Source source(Source());
+    cache = v8::ScriptCompiler::CreateCodeCache(
+        v8::ScriptCompiler::CompileUnboundScript(v8_isolate(), &source)
+            .ToLocalChecked());
+  }
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    // The source takes ownership of the cached data, so hand it a view.
+    v8::ScriptCompiler::Source source(
+        Source(), new v8::ScriptCompiler::CachedData(cache->data,
+                                                     cache->length));
+    benchmark::DoNotOptimize(
+        v8::ScriptCompiler::CompileUnboundScript(
+            v8_isolate(), &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked());
+    CHECK(!source.GetCachedData()->rejected);
+  }
+  st.SetBytesProcessed(st.iterations() * cache->length);
+  delete cache;
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,208 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Steady-state GC latency of a server-like heap. Pause percentiles are
+// reported per GC type, together with the mutator utilization, i.e. the
+// share of wall time not spent in pauses. Pass GC flags such as
+// --minor-mc to the binary to compare configurations.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "include/v8-callbacks.h"
+#include "include/v8-function.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "src/base/macros.h"
+#include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/time.h"
+#include "test/benchmarks/cpp/internals/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+// Records the duration of every atomic pause between the GC prologue and
+// epilogue callbacks, which bracket all main-thread GC work.
+class PauseRecorder final {
+ public:
+  explicit PauseRecorder(v8::Isolate* isolate) : isolate_(isolate) {
+    isolate_->AddGCPrologueCallback(&OnPrologue, this, kPauseTypes);
+    isolate_->AddGCEpilogueCallback(&OnEpilogue, this, kPauseTypes);
+  }
+
+  ~PauseRecorder() {
+    isolate_->RemoveGCPrologueCallback(&OnPrologue, this);
+    isolate_->RemoveGCEpilogueCallback(&OnEpilogue, this);
+  }
+
+  PauseRecorder(const PauseRecorder&) = delete;
+  PauseRecorder& operator=(const PauseRecorder&) = delete;
+
+  void Reset() {
+    for (std::vector<double>& pauses : pauses_ms_) pauses.clear();
+  }
+
+  double TotalPauseMs() const {
+    double total = 0;
+    for (const std::vector<double>& pauses : pauses_ms_) {
+      for (double pause : pauses) total += pause;
+    }
+    return total;
+  }
+
+  void Report(benchmark::State& st) {
+    static constexpr const char* kNames[] = {"scavenge", "minor_mc", "full"};
+    for (size_t i = 0; i < arraysize(kNames); i++) {
+      std::vector<double>& pauses = pauses_ms_[i];
+      std::string name = kNames[i];
+      st.counters[name + "_count"] = static_cast<double>(pauses.size());
+      if (pauses.empty()) continue;
+      std::sort(pauses.begin(), pauses.end());
+      st.counters[name + "_p50_ms"] = Percentile(pauses, 0.5);
+      st.counters[name + "_p99_ms"] = Percentile(pauses, 0.99);
+      st.counters[name + "_max_ms"] = pauses.back();
+    }
+  }
+
+ private:
+  static constexpr GCType kPauseTypes = static_cast<GCType>(
+      kGCTypeScavenge | kGCTypeMinorMarkCompact | kGCTypeMarkSweepCompact);
+
+  static size_t IndexOf(GCType type) {
+    switch (type) {
+      case kGCTypeScavenge:
+        return 0;
+      case kGCTypeMinorMarkCompact:
+        return 1;
+      default:
+        return 2;
+    }
+  }
+
+  // Nearest-rank percentile of the sorted {values}.
+  static double Percentile(const std::vector<double>& values, double p) {
+    size_t rank = static_cast<size_t>(p * values.size());
+    return values[std::min(rank, values.size() - 1)];
+  }
+
+  static void OnPrologue(v8::Isolate*, GCType, GCCallbackFlags, void* data) {
+    static_cast<PauseRecorder*>(data)->pause_start_ = base::TimeTicks::Now();
+  }
+
+  static void OnEpilogue(v8::Isolate*, GCType type, GCCallbackFlags,
+                         void* data) {
+    PauseRecorder* recorder = static_cast<PauseRecorder*>(data);
+    recorder->pauses_ms_[IndexOf(type)].push_back(
+        (base::TimeTicks::Now() - recorder->pause_start_).InMillisecondsF());
+  }
+
+  v8::Isolate* const isolate_;
+  base::TimeTicks pause_start_;
+  std::vector<double> pauses_ms_[3];
+};
+
+// Builds the long-lived part of the heap and defines handleRequests(n),
+// which simulates {n} requests that mostly allocate short-lived objects.
+// Some requests replace cache entries and ArrayBuffers, so old space keeps
+// turning over slowly as well.
+std::string WorkloadSource(int64_t cache_entries, int64_t num_buffers,
+                           int64_t list_depth) {
+  std::string source =
+      "const kCacheEntries = " + std::to_string(cache_entries) + ";\n";
+  source += "const kNumBuffers = " + std::to_string(num_buffers) + ";\n";
+  source += "const kListDepth = " + std::to_string(list_depth) + ";\n";
+  source += R"(
+const cache = new Map();
+function makeEntry(i) {
+  return {id: i, name: 'entry-' + i, tags: ['a', 'b', 'c'],
+          payload: new Array(16).fill(i)};
+}
+for (let i = 0; i < kCacheEntries; i++) cache.set(i, makeEntry(i));
+
+const buffers = [];
+for (let i = 0; i < kNumBuffers; i++) {
+  buffers.push(new ArrayBuffer(256 * 1024));
+}
+
+let list = null;
+for (let i = 0; i < kListDepth; i++) list = {next: list, value: i};
+
+const weakMap = new WeakMap();
+const registry = new FinalizationRegistry(() => {});
+
+let sequence = 0;
+function handleRequest(i) {
+  const request = {
+    id: i,
+    headers: {host: 'example.com', path: '/item/' + i, accept: '*/*'},
+    body: JSON.parse('{"items":[1,2,3,4,5],"user":{"name":"u","id":7}}'),
+    scratch: new Array(32).fill(i),
+  };
+  const token = {request};
+  weakMap.set(token, request.headers);
+  if (i % 16 == 0) registry.register(token, i);
+  if (kCacheEntries > 0 && i % 64 == 0) {
+    cache.set(i % kCacheEntries, makeEntry(i));
+  }
+  if (kNumBuffers > 0 && i % 1024 == 0) {
+    buffers[(i >> 10) % kNumBuffers] = new ArrayBuffer(256 * 1024);
+  }
+  return request.body.items.length + request.scratch.length;
+}
+
+function handleRequests(n) {
+  let result = 0;
+  for (let i = 0; i < n; i++) result += handleRequest(sequence++);
+  return result;
+}
+)";
+  return source;
+}
+
+using GCLatency = testing::BenchmarkWithIsolate;
+
+BENCHMARK_DEFINE_F(GCLatency, SteadyState)(benchmark::State& st) {
+  constexpr int kRequestsPerIteration = 1000;
+  v8::HandleScope handle_scope(v8_isolate());
+  RunJS(WorkloadSource(st.range(0), st.range(1), st.range(2)).c_str());
+  v8::Local<v8::Function> handle_requests =
+      v8::Local<v8::Function>::Cast(RunJS("handleRequests"));
+  v8::Local<v8::Value> argv[] = {
+      v8::Integer::New(v8_isolate(), kRequestsPerIteration)};
+
+  // Warm up until the long-lived objects are promoted, so that only the
+  // steady state is measured.
+  handle_requests->Call(context(), context()->Global(), 1, argv)
+      .ToLocalChecked();
+  PauseRecorder recorder(v8_isolate());
+  base::ElapsedTimer timer;
+  timer.Start();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        handle_requests->Call(context(), context()->Global(), 1, argv)
+            .ToLocalChecked());
+  }
+  double elapsed_ms = timer.Elapsed().InMillisecondsF();
+  recorder.Report(st);
+  st.counters["mutator_utilization"] =
+      elapsed_ms > 0 ? 1 - recorder.TotalPauseMs() / elapsed_ms : 1;
+  st.SetItemsProcessed(st.iterations() * kRequestsPerIteration);
+}
+BENCHMARK_REGISTER_F(GCLatency, SteadyState)
+    ->ArgNames({"cache", "buffers", "depth"})
+    ->Args({1000, 0, 0})
+    ->Args({100000, 0, 0})
+    ->Args({10000, 64, 0})
+    ->Args({10000, 0, 100000})
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,61 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap.h"
+#include "test/benchmarks/cpp/internals/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using GCBenchmark = testing::BenchmarkWithIsolate;
+
+// Measures a scavenge of a young generation holding {st.range(0)} small
+// arrays, half of which are kept alive through a retainer in old space.
+BENCHMARK_DEFINE_F(GCBenchmark, Scavenge)(benchmark::State& st) {
+  const int num_objects = static_cast<int>(st.range(0));
+  HandleScope scope(isolate());
+  Handle<FixedArray> retainer =
+      factory()->NewFixedArray(num_objects / 2, AllocationType::kOld);
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    {
+      HandleScope allocation_scope(isolate());
+      for (int i = 0; i < num_objects; i++) {
+        Handle<FixedArray> array = factory()->NewFixedArray(4);
+        if (i % 2 == 0) retainer->set(i / 2, *array);
+      }
+    }
+    st.ResumeTiming();
+    isolate()->heap()->CollectGarbage(NEW_SPACE,
+                                      GarbageCollectionReason::kTesting);
+  }
+}
+BENCHMARK_REGISTER_F(GCBenchmark, Scavenge)->Arg(1000)->Arg(10000);
+
+// Measures a full mark-compact of a heap with {st.range(0)} live objects.
+BENCHMARK_DEFINE_F(GCBenchmark, MarkCompact)(benchmark::State& st) {
+  const int num_objects = static_cast<int>(st.range(0));
+  HandleScope scope(isolate());
+  Handle<FixedArray> retainer =
+      factory()->NewFixedArray(num_objects, AllocationType::kOld);
+  for (int i = 0; i < num_objects; i++) {
+    retainer->set(i, *factory()->NewFixedArray(4, AllocationType::kOld));
+  }
+  for (auto _ : st) {
+    USE(_);
+    isolate()->heap()->CollectGarbage(OLD_SPACE,
+                                      GarbageCollectionReason::kTesting);
+  }
+}
+BENCHMARK_REGISTER_F(GCBenchmark, MarkCompact)->Arg(10000)->Arg(100000);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
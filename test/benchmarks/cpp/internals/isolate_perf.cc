@@ -0,0 +1,246 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Startup benchmarks. Run with --runtime-call-stats to also get the time per
+// RuntimeCallStats counter, e.g. the DeserializeReadOnly, DeserializeStartup,
+// DeserializeContext and DeserializeRehash phases of snapshot
+// deserialization.
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-platform.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+#include "src/base/platform/semaphore.h"
+#include "src/codegen/compilation-cache.h"
+#include "src/execution/isolate.h"
+#include "test/benchmarks/cpp/internals/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using testing::RuntimeCallStatsCollector;
+
+// Isolate creation is dominated by deserializing the startup snapshot.
+void BM_IsolateNewDispose(benchmark::State& st) {
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator.get();
+  RuntimeCallStatsCollector rcs;
+  for (auto _ : st) {
+    USE(_);
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    rcs.Collect(isolate);
+    isolate->Dispose();
+  }
+  rcs.Report(st);
+}
+BENCHMARK(BM_IsolateNewDispose);
+
+class StartupBenchmark : public testing::BenchmarkWithIsolate {
+ protected:
+  void SetUp(::benchmark::State& st) override {
+    testing::BenchmarkWithIsolate::SetUp(st);
+    // Every iteration compiles the same source, which would otherwise be a
+    // cache hit.
+    isolate()->compilation_cache()->DisableScriptAndEval();
+    // Do not attribute the fixture's own startup to the benchmark.
+    RuntimeCallStatsCollector().Collect(v8_isolate());
+  }
+
+  v8::Local<v8::String> NewString(const std::string& source) {
+    return v8::String::NewFromUtf8(v8_isolate(), source.data(),
+                                   v8::NewStringType::kNormal,
+                                   static_cast<int>(source.size()))
+        .ToLocalChecked();
+  }
+
+  RuntimeCallStatsCollector rcs_;
+};
+
+BENCHMARK_F(StartupBenchmark, NewContext)(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(v8_isolate());
+    benchmark::DoNotOptimize(v8::Context::New(v8_isolate()));
+  }
+  rcs_.Collect(v8_isolate());
+  rcs_.Report(st);
+}
+
+// Returns a bundle-like script of roughly {size} bytes: many module
+// closures that run at the top level, while most of their inner functions
+// stay lazy, as in typical web bundles.
+std::string MakeBundle(size_t size) {
+  std::string bundle;
+  bundle.reserve(size + 512);
+  for (int i = 0; bundle.size() < size; i++) {
+    std::string index = std::to_string(i);
+    bundle += "var m" + index + " = (function() {\n";
+    bundle += "  var state = {count: 0, name: 'module" + index + "'};\n";
+    bundle += R"(  function get(key) { return state[key]; }
+  function set(key, value) { state[key] = value; }
+  function update(items) {
+    var result = [];
+    for (var j = 0; j < items.length; j++) {
+      if (items[j] % 2) result.push(items[j] * state.count);
+    }
+    state.count += result.length;
+    return result;
+  }
+  return {get: get, set: set, update: update};
+})();
+)";
+  }
+  bundle += "m0.update([1, 2, 3]);\n";
+  return bundle;
+}
+
+BENCHMARK_DEFINE_F(StartupBenchmark, CodeCacheDeserialize)
+(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::String> source_string =
+      NewString(MakeBundle(static_cast<size_t>(st.range(0)) * MB));
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache;
+  {
+    // Run the script first, so that the cache contains the eagerly compiled
+    // functions as well, like caches created after execution do.
+    v8::ScriptCompiler::Source source(source_string);
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(context(), &source).ToLocalChecked();
+    script->Run(context()).ToLocalChecked();
+    cache.reset(
+        v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+  }
+  rcs_.Collect(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    // The source owns its cached data, so hand it a non-owning view.
+    v8::ScriptCompiler::Source source(
+        source_string,
+        new v8::ScriptCompiler::CachedData(cache->data, cache->length));
+    benchmark::DoNotOptimize(
+        v8::ScriptCompiler::CompileUnboundScript(
+            v8_isolate(), &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked());
+    CHECK(!source.GetCachedData()->rejected);
+  }
+  rcs_.Collect(v8_isolate());
+  rcs_.Report(st);
+  st.SetBytesProcessed(st.iterations() * cache->length);
+}
+BENCHMARK_REGISTER_F(StartupBenchmark, CodeCacheDeserialize)->Arg(1)->Arg(10);
+
+// Compiles and runs a bundle of {st.range(0)} MB on the main thread.
+BENCHMARK_DEFINE_F(StartupBenchmark, FirstExecution)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  const std::string bundle =
+      MakeBundle(static_cast<size_t>(st.range(0)) * MB);
+  v8::Local<v8::String> source_string = NewString(bundle);
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::ScriptCompiler::Source source(source_string);
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(context(), &source).ToLocalChecked();
+    benchmark::DoNotOptimize(script->Run(context()).ToLocalChecked());
+  }
+  rcs_.Collect(v8_isolate());
+  rcs_.Report(st);
+  st.SetBytesProcessed(st.iterations() * bundle.size());
+}
+BENCHMARK_REGISTER_F(StartupBenchmark, FirstExecution)->Arg(1)->Arg(10);
+
+// Hands out a script in network-sized chunks.
+class ChunkedSourceStream final
+    : public v8::ScriptCompiler::ExternalSourceStream {
+ public:
+  explicit ChunkedSourceStream(const std::string& source) : source_(source) {}
+
+  size_t GetMoreData(const uint8_t** src) override {
+    size_t length = std::min(kChunkSize, source_.size() - position_);
+    if (length == 0) return 0;
+    // The caller takes ownership of the chunk.
+    uint8_t* chunk = new uint8_t[length];
+    memcpy(chunk, source_.data() + position_, length);
+    position_ += length;
+    *src = chunk;
+    return length;
+  }
+
+ private:
+  static constexpr size_t kChunkSize = 64 * KB;
+
+  const std::string& source_;
+  size_t position_ = 0;
+};
+
+class StreamingTask final : public v8::Task {
+ public:
+  StreamingTask(v8::ScriptCompiler::ScriptStreamingTask* task,
+                base::Semaphore* done)
+      : task_(task), done_(done) {}
+
+  void Run() override {
+    task_->Run();
+    done_->Signal();
+  }
+
+ private:
+  v8::ScriptCompiler::ScriptStreamingTask* task_;
+  base::Semaphore* done_;
+};
+
+// Like FirstExecution, but parses and compiles the bundle on a worker
+// thread while it streams in, as browsers do for network loads. The main
+// thread only finalizes the compilation and runs the script.
+BENCHMARK_DEFINE_F(StartupBenchmark, FirstExecutionStreaming)
+(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  const std::string bundle =
+      MakeBundle(static_cast<size_t>(st.range(0)) * MB);
+  v8::Local<v8::String> source_string = NewString(bundle);
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::ScriptCompiler::StreamedSource streamed_source(
+        std::make_unique<ChunkedSourceStream>(bundle),
+        v8::ScriptCompiler::StreamedSource::UTF8);
+    std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> task(
+        v8::ScriptCompiler::StartStreaming(v8_isolate(), &streamed_source));
+    base::Semaphore done(0);
+    GetPlatform()->CallOnWorkerThread(
+        std::make_unique<StreamingTask>(task.get(), &done));
+    done.Wait();
+    v8::ScriptOrigin origin(v8_isolate(), v8::Undefined(v8_isolate()));
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(context(), &streamed_source,
+                                    source_string, origin)
+            .ToLocalChecked();
+    benchmark::DoNotOptimize(script->Run(context()).ToLocalChecked());
+  }
+  rcs_.Collect(v8_isolate());
+  rcs_.Report(st);
+  st.SetBytesProcessed(st.iterations() * bundle.size());
+}
+BENCHMARK_REGISTER_F(StartupBenchmark, FirstExecutionStreaming)
+    ->Arg(1)
+    ->Arg(10)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
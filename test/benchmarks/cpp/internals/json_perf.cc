@@ -0,0 +1,53 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-json.h"
+#include "include/v8-primitive.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/internals/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using JsonBenchmark = testing::BenchmarkWithIsolate;
+
+constexpr char kJsonSource[] =
+    "{\"id\":12345,\"name\":\"benchmark\",\"active\":true,\"score\":98.6,"
+    "\"tags\":[\"a\",\"b\",\"c\",\"d\"],\"nested\":{\"x\":1,\"y\":2,"
+    "\"z\":[1,2,3,4,5,6,7,8]},\"items\":[{\"k\":\"v1\",\"n\":1},"
+    "{\"k\":\"v2\",\"n\":2},{\"k\":\"v3\",\"n\":3}]}";
+
+BENCHMARK_F(JsonBenchmark, Parse)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::String> source =
+      v8::String::NewFromUtf8Literal(v8_isolate(), kJsonSource);
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        v8::JSON::Parse(context(), source).ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * (sizeof(kJsonSource) - 1));
+}
+
+BENCHMARK_F(JsonBenchmark, Stringify)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Value> value =
+      v8::JSON::Parse(context(), v8::String::NewFromUtf8Literal(v8_isolate(),
+                                                                kJsonSource))
+          .ToLocalChecked();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        v8::JSON::Stringify(context(), value).ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * (sizeof(kJsonSource) - 1));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
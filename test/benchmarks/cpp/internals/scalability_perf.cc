@@ -0,0 +1,361 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Benchmarks for how V8's thread-parallel parts scale with the number of
+// threads. Run them with --benchmark_counters_tabular=true to compare the
+// per-thread rates across thread counts.
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-platform.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+#include "src/base/optional.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+#include "src/base/platform/yield-processor.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap.h"
+#include "src/heap/local-heap-inl.h"
+#include "src/heap/parked-scope.h"
+#include "src/objects/fixed-array-inl.h"
+#include "test/benchmarks/cpp/internals/benchmark_utils.h"
+#include "test/common/flag-utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+// Creates an isolate with an entered context on the current thread. Unlike
+// BenchmarkWithIsolate, which shares its state between all threads of a
+// benchmark, this is meant to be used once per benchmark thread.
+class ThreadLocalIsolate final {
+ public:
+  explicit ThreadLocalIsolate(v8::Isolate* shared_isolate = nullptr)
+      : allocator_(v8::ArrayBuffer::Allocator::NewDefaultAllocator()) {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+    create_params.experimental_attach_to_shared_isolate = shared_isolate;
+    isolate_ = v8::Isolate::New(create_params);
+    isolate_->Enter();
+    handle_scope_.emplace(isolate_);
+    context_ = v8::Context::New(isolate_);
+    context_->Enter();
+  }
+
+  ~ThreadLocalIsolate() {
+    context_->Exit();
+    handle_scope_.reset();
+    isolate_->Exit();
+    isolate_->Dispose();
+  }
+
+  ThreadLocalIsolate(const ThreadLocalIsolate&) = delete;
+  ThreadLocalIsolate& operator=(const ThreadLocalIsolate&) = delete;
+
+  v8::Isolate* v8_isolate() const { return isolate_; }
+  Isolate* isolate() const { return reinterpret_cast<Isolate*>(isolate_); }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  v8::Isolate* isolate_;
+  base::Optional<v8::HandleScope> handle_scope_;
+  v8::Local<v8::Context> context_;
+};
+
+// Reports {value} divided by the number of threads as a rate, which makes
+// perfect scaling show up as a constant across thread counts.
+void SetPerThreadRate(benchmark::State& st, const char* name, double value) {
+  st.counters[name] = benchmark::Counter(
+      value, benchmark::Counter::kIsRate | benchmark::Counter::kAvgThreads);
+}
+
+v8::Local<v8::Value> RunJS(v8::Isolate* isolate, const std::string& source) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Script> script =
+      v8::Script::Compile(
+          context,
+          v8::String::NewFromUtf8(isolate, source.c_str()).ToLocalChecked())
+          .ToLocalChecked();
+  return script->Run(context).ToLocalChecked();
+}
+
+// --- Concurrent allocation --------------------------------------------------
+
+constexpr int kAllocationsPerThread = 2000;
+constexpr int kSmallObjectSize = 10 * kTaggedSize;
+
+class AllocationThread final : public base::Thread {
+ public:
+  AllocationThread(Heap* heap, std::atomic<int>* pending)
+      : base::Thread(base::Thread::Options("AllocationThread")),
+        heap_(heap),
+        pending_(pending) {}
+
+  void Run() override {
+    LocalHeap local_heap(heap_, ThreadKind::kBackground);
+    UnparkedScope unparked_scope(&local_heap);
+    for (int i = 0; i < kAllocationsPerThread; i++) {
+      Address address = local_heap.AllocateRawOrFail(
+          kSmallObjectSize, AllocationType::kOld, AllocationOrigin::kRuntime,
+          AllocationAlignment::kTaggedAligned);
+      // Keep the heap iterable for the GC.
+      HeapObject object = HeapObject::FromAddress(address);
+      object.set_map_after_allocation(ReadOnlyRoots(heap_).fixed_array_map(),
+                                      SKIP_WRITE_BARRIER);
+      FixedArray array = FixedArray::cast(object);
+      int length = (kSmallObjectSize - FixedArray::kHeaderSize) / kTaggedSize;
+      array.set_length(length);
+      MemsetTagged(array.data_start(), ReadOnlyRoots(heap_).undefined_value(),
+                   length);
+      if (i % 64 == 0) local_heap.Safepoint();
+    }
+    pending_->fetch_sub(1);
+  }
+
+ private:
+  Heap* heap_;
+  std::atomic<int>* pending_;
+};
+
+using ConcurrentAllocation = testing::BenchmarkWithIsolate;
+
+// {st.range(0)} background threads of the same isolate allocate in old space
+// through their ConcurrentAllocator, contending for free-list refills and
+// fresh pages.
+BENCHMARK_DEFINE_F(ConcurrentAllocation, OldSpace)(benchmark::State& st) {
+  FLAG_VALUE_SCOPE(stress_concurrent_allocation, false);
+  const int num_threads = static_cast<int>(st.range(0));
+  for (auto _ : st) {
+    USE(_);
+    std::atomic<int> pending(num_threads);
+    std::vector<std::unique_ptr<AllocationThread>> threads;
+    for (int i = 0; i < num_threads; i++) {
+      threads.push_back(
+          std::make_unique<AllocationThread>(isolate()->heap(), &pending));
+      CHECK(threads.back()->Start());
+    }
+    // Background allocation failures request a GC from the main thread.
+    while (pending > 0) {
+      v8::platform::PumpMessageLoop(GetPlatform(), v8_isolate());
+    }
+    for (auto& thread : threads) thread->Join();
+  }
+  const double bytes = static_cast<double>(st.iterations()) * num_threads *
+                       kAllocationsPerThread * kSmallObjectSize;
+  st.SetBytesProcessed(static_cast<int64_t>(bytes));
+  st.counters["bytes_per_thread"] = benchmark::Counter(
+      bytes / num_threads, benchmark::Counter::kIsRate);
+}
+BENCHMARK_REGISTER_F(ConcurrentAllocation, OldSpace)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+
+// Every benchmark thread has its own isolate and allocates young objects.
+// Isolates do not share heaps, so any slowdown comes from process-wide
+// resources such as the page allocator.
+void BM_IsolatesAllocating(benchmark::State& st) {
+  ThreadLocalIsolate thread_isolate;
+  Factory* factory = thread_isolate.isolate()->factory();
+  constexpr int kArraysPerIteration = 64;
+  for (auto _ : st) {
+    USE(_);
+    HandleScope scope(thread_isolate.isolate());
+    for (int i = 0; i < kArraysPerIteration; i++) {
+      benchmark::DoNotOptimize(factory->NewFixedArray(16));
+    }
+  }
+  SetPerThreadRate(st, "arrays_per_thread",
+                   static_cast<double>(st.iterations()) * kArraysPerIteration);
+}
+BENCHMARK(BM_IsolatesAllocating)->ThreadRange(1, 16)->UseRealTime();
+
+// --- String table ------------------------------------------------------------
+
+// With --shared-string-table all benchmark threads attach to one shared
+// isolate and hit the same table; otherwise the per-isolate tables serve as
+// the baseline. The shared isolate lives until the process exits.
+v8::Isolate* SharedIsolateIfNeeded() {
+  if (!FLAG_shared_string_table) return nullptr;
+  static v8::Isolate* shared_isolate = [] {
+    static std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+        v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator.get();
+    return reinterpret_cast<v8::Isolate*>(Isolate::NewShared(create_params));
+  }();
+  return shared_isolate;
+}
+
+// Internalizes a fixed set of names from every thread. The first iteration
+// inserts them, all later ones are lookups, which is the common case for
+// property names.
+void BM_StringTableInternalize(benchmark::State& st) {
+  constexpr int kNumStrings = 1024;
+  ThreadLocalIsolate thread_isolate(SharedIsolateIfNeeded());
+  Factory* factory = thread_isolate.isolate()->factory();
+  std::vector<std::string> names;
+  names.reserve(kNumStrings);
+  for (int i = 0; i < kNumStrings; i++) {
+    names.push_back("property_name_" + std::to_string(i));
+  }
+  for (auto _ : st) {
+    USE(_);
+    HandleScope scope(thread_isolate.isolate());
+    for (const std::string& name : names) {
+      benchmark::DoNotOptimize(factory->InternalizeUtf8String(name.c_str()));
+    }
+  }
+  SetPerThreadRate(st, "lookups_per_thread",
+                   static_cast<double>(st.iterations()) * kNumStrings);
+}
+BENCHMARK(BM_StringTableInternalize)->ThreadRange(1, 16)->UseRealTime();
+
+// --- Compile dispatchers ----------------------------------------------------
+
+// Queues {st.range(0)} functions for concurrent optimization at once and waits
+// until all of them are installed.
+void BM_OptimizingCompileDispatcher(benchmark::State& st) {
+  FLAG_SCOPE(allow_natives_syntax);
+  FLAG_SCOPE(concurrent_recompilation);
+  ThreadLocalIsolate thread_isolate;
+  v8::Isolate* isolate = thread_isolate.v8_isolate();
+  const int num_functions = static_cast<int>(st.range(0));
+  int round = 0;
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    v8::HandleScope scope(isolate);
+    // Fresh functions every round, so that no optimized code is reused.
+    std::string prefix = "r" + std::to_string(round++) + "_";
+    RunJS(isolate,
+          "var fs = [];"
+          "for (let i = 0; i < " + std::to_string(num_functions) + "; i++) {"
+          "  let f = new Function('a', 'b', '/*" + prefix + "' + i + '*/"
+          "      let s = 0; for (let j = 0; j < a; j++) s += j * b;"
+          "      return s;');"
+          "  %PrepareFunctionForOptimization(f);"
+          "  f(10, 2); f(10, 3);"
+          "  fs.push(f);"
+          "}");
+    st.ResumeTiming();
+    RunJS(isolate,
+          "for (let f of fs) {"
+          "  %OptimizeFunctionOnNextCall(f, 'concurrent');"
+          "  f(10, 4);"
+          "}"
+          "%FinalizeOptimization();");
+  }
+  st.SetItemsProcessed(st.iterations() * num_functions);
+}
+BENCHMARK(BM_OptimizingCompileDispatcher)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(256)
+    ->UseRealTime();
+
+// Compiles and runs a script with {st.range(0)} lazy functions, which the
+// parser hands to the LazyCompileDispatcher for compilation on background
+// threads. Calling the functions waits for the outstanding jobs.
+void BM_LazyCompileDispatcher(benchmark::State& st) {
+  FLAG_SCOPE(lazy_compile_dispatcher);
+  FLAG_SCOPE(parallel_compile_tasks_for_lazy);
+  ThreadLocalIsolate thread_isolate;
+  v8::Isolate* isolate = thread_isolate.v8_isolate();
+  const int num_functions = static_cast<int>(st.range(0));
+  int round = 0;
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    std::string prefix = "f" + std::to_string(round++) + "_";
+    std::string source;
+    for (int i = 0; i < num_functions; i++) {
+      std::string name = prefix + std::to_string(i);
+      source += "function " + name +
+                "(a) { let s = 0; for (let j = 0; j < a; j++) { s += j; }"
+                " return s + " + std::to_string(i) + "; }\n";
+    }
+    for (int i = 0; i < num_functions; i++) {
+      source += prefix + std::to_string(i) + "(2);\n";
+    }
+    v8::HandleScope scope(isolate);
+    st.ResumeTiming();
+    RunJS(isolate, source);
+  }
+  st.SetItemsProcessed(st.iterations() * num_functions);
+}
+BENCHMARK(BM_LazyCompileDispatcher)->Arg(64)->Arg(512)->UseRealTime();
+
+// --- Platform jobs -----------------------------------------------------------
+
+// Waits until {target} workers run concurrently and records when the last of
+// them started.
+class RampUpJob final : public v8::JobTask {
+ public:
+  explicit RampUpJob(size_t target) : target_(target) {}
+
+  void Run(v8::JobDelegate* delegate) override {
+    if (started_.fetch_add(1, std::memory_order_relaxed) + 1 == target_) {
+      ramped_up_time_ = base::TimeTicks::Now();
+      ramped_up_.store(true, std::memory_order_release);
+    }
+    while (!ramped_up_.load(std::memory_order_acquire) &&
+           !delegate->ShouldYield()) {
+      YIELD_PROCESSOR;
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t started = started_.load(std::memory_order_relaxed);
+    return started >= target_ ? 0 : target_ - started + worker_count;
+  }
+
+  bool ramped_up() const { return ramped_up_.load(std::memory_order_acquire); }
+  base::TimeTicks ramped_up_time() const { return ramped_up_time_; }
+
+ private:
+  const size_t target_;
+  std::atomic<size_t> started_{0};
+  std::atomic<bool> ramped_up_{false};
+  base::TimeTicks ramped_up_time_;
+};
+
+// Measures the time from posting a job until {st.range(0)} of its workers
+// run at the same time.
+void BM_JobRampUp(benchmark::State& st) {
+  v8::Platform* platform = testing::BenchmarkWithIsolate::GetPlatform();
+  const size_t target =
+      std::min(static_cast<size_t>(st.range(0)),
+               static_cast<size_t>(platform->NumberOfWorkerThreads()));
+  for (auto _ : st) {
+    USE(_);
+    auto job = std::make_unique<RampUpJob>(target);
+    RampUpJob* job_ptr = job.get();
+    base::TimeTicks start = base::TimeTicks::Now();
+    std::unique_ptr<v8::JobHandle> handle =
+        platform->PostJob(v8::TaskPriority::kUserBlocking, std::move(job));
+    while (!job_ptr->ramped_up()) YIELD_PROCESSOR;
+    st.SetIterationTime((job_ptr->ramped_up_time() - start).InSecondsF());
+    handle->Join();
+  }
+  st.counters["workers"] = static_cast<double>(target);
+}
+BENCHMARK(BM_JobRampUp)->RangeMultiplier(2)->Range(1, 16)->UseManualTime();
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
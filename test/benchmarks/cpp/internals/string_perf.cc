@@ -0,0 +1,70 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/numbers/hash-seed-inl.h"
+#include "src/strings/string-hasher-inl.h"
+#include "test/benchmarks/cpp/internals/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using StringBenchmark = testing::BenchmarkWithIsolate;
+
+std::string MakeString(size_t length) {
+  std::string result;
+  result.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    result.push_back(static_cast<char>('a' + (i * 7) % 26));
+  }
+  return result;
+}
+
+BENCHMARK_DEFINE_F(StringBenchmark, HashSequentialString)
+(benchmark::State& st) {
+  const std::string chars = MakeString(static_cast<size_t>(st.range(0)));
+  const uint64_t seed = HashSeed(isolate());
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(StringHasher::HashSequentialString(
+        reinterpret_cast<const uint8_t*>(chars.data()),
+        static_cast<int>(chars.size()), seed));
+  }
+  st.SetBytesProcessed(st.iterations() * chars.size());
+}
+BENCHMARK_REGISTER_F(StringBenchmark, HashSequentialString)
+    ->RangeMultiplier(4)
+    ->Range(4, 4096);
+
+// Looks up strings that are already in the string table, which is the common
+// case for property names coming from the parser or from JSON.
+BENCHMARK_DEFINE_F(StringBenchmark, InternalizeHit)(benchmark::State& st) {
+  constexpr int kNumStrings = 256;
+  std::string names[kNumStrings];
+  for (int i = 0; i < kNumStrings; i++) {
+    names[i] = MakeString(static_cast<size_t>(st.range(0))) + std::to_string(i);
+    HandleScope scope(isolate());
+    factory()->InternalizeUtf8String(names[i].c_str());
+  }
+  for (auto _ : st) {
+    USE(_);
+    HandleScope scope(isolate());
+    for (int i = 0; i < kNumStrings; i++) {
+      benchmark::DoNotOptimize(
+          factory()->InternalizeUtf8String(names[i].c_str()));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * kNumStrings);
+}
+BENCHMARK_REGISTER_F(StringBenchmark, InternalizeHit)->Arg(8)->Arg(64);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
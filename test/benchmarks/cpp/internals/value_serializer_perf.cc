@@ -0,0 +1,65 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdlib>
+#include <utility>
+
+#include "include/v8-value-serializer.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/internals/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+class ValueSerializerBenchmark : public testing::BenchmarkWithIsolate {
+ protected:
+  v8::Local<v8::Value> MakeValue() {
+    return RunJS(
+        "({ numbers: [1, 2, 3, 4.5, -1e10], str: 'serialize me',"
+        "   nested: { a: true, b: null, c: [{}, {}, {}] },"
+        "   date: new Date(0), map: new Map([[1, 'one'], [2, 'two']]) })");
+  }
+};
+
+BENCHMARK_F(ValueSerializerBenchmark, Serialize)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Value> value = MakeValue();
+  for (auto _ : st) {
+    USE(_);
+    v8::ValueSerializer serializer(v8_isolate());
+    serializer.WriteHeader();
+    CHECK(serializer.WriteValue(context(), value).FromJust());
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    benchmark::DoNotOptimize(buffer.first);
+    free(buffer.first);
+  }
+}
+
+BENCHMARK_F(ValueSerializerBenchmark, Deserialize)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  std::pair<uint8_t*, size_t> buffer;
+  {
+    v8::ValueSerializer serializer(v8_isolate());
+    serializer.WriteHeader();
+    CHECK(serializer.WriteValue(context(), MakeValue()).FromJust());
+    buffer = serializer.Release();
+  }
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::ValueDeserializer deserializer(v8_isolate(), buffer.first,
+                                       buffer.second);
+    CHECK(deserializer.ReadHeader(context()).FromJust());
+    benchmark::DoNotOptimize(
+        deserializer.ReadValue(context()).ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * buffer.second);
+  free(buffer.first);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
@@ -5,6 +5,8 @@
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -33,11 +35,13 @@ int PrintHelp(char** argv) {
   V(kBarrett, "barrett")             \
   V(kBurnikel, "burnikel")           \
   V(kFFT, "fft")                     \
+  V(kFFTParallel, "fftparallel")     \
   V(kFromString, "fromstring")       \
   V(kFromStringBase2, "fromstring2") \
   V(kKaratsuba, "karatsuba")         \
   V(kToom, "toom")                   \
-  V(kToString, "tostring")
+  V(kToString, "tostring")           \
+  V(kToStringCached, "tostringcached")
 
 enum Operation { kNoOp, kList, kTest };
 
@@ -200,6 +204,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestFFT(&count);
       }
+    } else if (test_ == kFFTParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestFFTParallel(&count);
+      }
     } else if (test_ == kKaratsuba) {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
@@ -212,6 +220,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestToString(&count);
       }
+    } else if (test_ == kToStringCached) {
+      for (int i = 0; i < runs_; i++) {
+        TestToStringCached(&count);
+      }
     } else if (test_ == kFromString) {
       for (int i = 0; i < runs_; i++) {
         TestFromString(&count);
@@ -311,6 +323,45 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  // Runs every task on its own thread.
+  class ThreadedPlatform : public Platform {
+   public:
+    void RunInParallel(ParallelTask* task, int num_tasks) override {
+      std::vector<std::thread> threads;
+      for (int i = 0; i < num_tasks; i++) {
+        threads.emplace_back([task, i]() { task->Run(i); });
+      }
+      for (std::thread& thread : threads) thread.join();
+    }
+  };
+
+  void TestFFTParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    ProcessorImpl threaded_processor(new ThreadedPlatform());
+    // These are slow, so only test a few random sizes per run.
+    constexpr int kSamples = 3;
+    for (int i = 0; i < kSamples; i++) {
+      uint64_t random_bits = rng_.NextUint64();
+      int right_size = kFftParallelThreshold + (random_bits & 1023);
+      random_bits >>= 10;
+      int left_size = right_size + (random_bits & 1023);
+      ScratchDigits A(left_size);
+      ScratchDigits B(right_size);
+      int result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits result_toom(result_len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      threaded_processor.MultiplyFFT(result, A, B);
+      // Using Toom-Cook as reference.
+      processor()->MultiplyToomCook(result_toom, A, B);
+      AssertEquals(A, B, result_toom, result);
+      if (error_) return;
+      (*count)++;
+    }
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr int kMin = kBurnikelThreshold / 2;
@@ -412,6 +463,37 @@ class Runner {
     }
   }
 
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+  // Converts inputs of random lengths in a row, so that the processor's
+  // cached recursion levels have to be reused, grown and cut short.
+  void TestToStringCached(int* count) {
+    constexpr int kMin = kToStringFastThreshold;
+    constexpr int kMax = kToStringFastThreshold * 16;
+    constexpr int kRadixes[] = {10, 10, 10, 7};
+    for (int i = 0; i < 100; i++) {
+      int size = kMin + static_cast<int>(rng_.NextUint64() % (kMax - kMin));
+      int radix = kRadixes[rng_.NextUint64() & 3];
+      ScratchDigits X(size);
+      GenerateRandom(X);
+      int chars_required = ToStringResultLength(X, radix, false);
+      int result_len = chars_required;
+      int reference_len = chars_required;
+      std::unique_ptr<char[]> result(new char[result_len]);
+      std::unique_ptr<char[]> reference(new char[reference_len]);
+      processor()->ToStringImpl(result.get(), &result_len, X, radix, false,
+                                true);
+      processor()->ToStringImpl(reference.get(), &reference_len, X, radix,
+                                false, false);
+      AssertEquals(X, radix, reference.get(), reference_len, result.get(),
+                   result_len);
+      if (error_) return;
+      (*count)++;
+    }
+  }
+#else
+  void TestToStringCached(int* count) {}
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+
   void TestFromString(int* count) {
     constexpr int kMaxDigits = 1 << 20;  // Any large-enough value will do.
     constexpr int kMin = kFromStringLargeThreshold / 2;
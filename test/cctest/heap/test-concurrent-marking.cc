@@ -126,6 +126,41 @@ TEST(ConcurrentMarkingMarkedBytes) {
   CHECK_GE(heap->concurrent_marking()->TotalMarkedBytes(), root->Size());
 }
 
+TEST(ConcurrentMarkingObjectStatsSampling) {
+  if (!i::FLAG_concurrent_marking) return;
+  FLAG_concurrent_marking_object_stats_sample_rate = 1;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  CcTest::CollectAllGarbage();
+  if (!heap->incremental_marking()->IsStopped()) return;
+  MarkCompactCollector* collector = CcTest::heap()->mark_compact_collector();
+  if (collector->sweeping_in_progress()) {
+    collector->EnsureSweepingCompleted(
+        MarkCompactCollector::SweepingForcedFinalizationMode::kV8Only);
+  }
+
+  MarkingWorklists marking_worklists;
+  WeakObjects weak_objects;
+  ConcurrentMarking* concurrent_marking =
+      new ConcurrentMarking(heap, &marking_worklists, &weak_objects);
+  PublishSegment(marking_worklists.shared(),
+                 ReadOnlyRoots(heap).undefined_value());
+  concurrent_marking->ScheduleJob();
+  concurrent_marking->Join();
+  auto stats = std::make_unique<SampledObjectStats>();
+  concurrent_marking->FlushObjectStats(stats.get());
+  CHECK_EQ(MarkingWorklist::kSegmentSize, stats->count[ODDBALL_TYPE]);
+  delete concurrent_marking;
+}
+
+TEST(ConcurrentMarkingObjectStatsNotAllocatedWithoutSampling) {
+  FLAG_concurrent_marking_object_stats_sample_rate = 0;
+  CcTest::InitializeVM();
+  CcTest::CollectAllGarbage();
+  MarkCompactCollector* collector = CcTest::heap()->mark_compact_collector();
+  CHECK_NULL(collector->sampled_object_stats_at_last_gc());
+}
+
 UNINITIALIZED_TEST(ConcurrentMarkingStoppedOnTeardown) {
   if (!FLAG_incremental_marking) return;
   if (!i::FLAG_concurrent_marking) return;
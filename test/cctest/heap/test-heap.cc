@@ -1162,6 +1162,156 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+namespace {
+
+// Ages all bytecode past the flushing threshold with full GCs.
+void AgeAndFlushBytecode() {
+  const int kAgingThreshold = 6;
+  for (int i = 0; i < kAgingThreshold; i++) {
+    CcTest::CollectAllGarbage();
+  }
+}
+
+Handle<JSFunction> GetFunction(Isolate* isolate, const char* name) {
+  Handle<Object> value =
+      JSReceiver::GetProperty(isolate, isolate->global_object(), name)
+          .ToHandleChecked();
+  return Handle<JSFunction>::cast(value);
+}
+
+}  // namespace
+
+TEST(TestBytecodeRetainedAfterRepeatedRecompiles) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+#if ENABLE_SPARKPLUG
+  FLAG_always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_flush_recompiled_bytecode = false;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  v8::HandleScope scope(isolate);
+  v8::Context::New(isolate)->Enter();
+  {
+    v8::HandleScope new_scope(isolate);
+    CompileRun(
+        "function once() { return 1; }"
+        "function periodic() { return 2; }"
+        "once(); periodic();");
+  }
+  Handle<JSFunction> once = GetFunction(i_isolate, "once");
+  Handle<JSFunction> periodic = GetFunction(i_isolate, "periodic");
+  CHECK_EQ(0u, once->shared().flush_count());
+  CHECK_EQ(0u, periodic->shared().flush_count());
+
+  // Old bytecode is flushed the first time around.
+  AgeAndFlushBytecode();
+  CHECK(!once->shared().is_compiled());
+  CHECK(!periodic->shared().is_compiled());
+  CHECK_EQ(1u, once->shared().flush_count());
+  CHECK_EQ(1u, periodic->shared().flush_count());
+
+  // A single recompile after a flush doesn't protect a function.
+  {
+    v8::HandleScope new_scope(isolate);
+    CompileRun("once(); periodic();");
+  }
+  AgeAndFlushBytecode();
+  CHECK(!once->shared().is_compiled());
+  CHECK(!periodic->shared().is_compiled());
+  CHECK_EQ(2u, periodic->shared().flush_count());
+
+  // Coming back once more does: from now on periodic keeps its bytecode.
+  {
+    v8::HandleScope new_scope(isolate);
+    CompileRun("periodic();");
+  }
+  AgeAndFlushBytecode();
+  CHECK(periodic->shared().is_compiled());
+  CHECK(periodic->is_compiled());
+  CHECK(!once->shared().is_compiled());
+
+  // The count saturates instead of wrapping around to zero.
+  for (int i = 0; i < 4; i++) periodic->shared().IncrementFlushCount();
+  CHECK(periodic->shared().IsBytecodeRetainedAfterFlushes());
+  AgeAndFlushBytecode();
+  CHECK(periodic->shared().is_compiled());
+}
+
+TEST(TestColdFeedbackVectorIsDropped) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+#if ENABLE_SPARKPLUG
+  FLAG_always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::FLAG_lazy_feedback_allocation = false;
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_flush_recompiled_bytecode = false;
+  i::FLAG_flush_cold_feedback = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+
+    // Flush and recompile foo until it keeps its bytecode.
+    while (!function->shared().IsBytecodeRetainedAfterFlushes()) {
+      AgeAndFlushBytecode();
+      CHECK(!function->shared().is_compiled());
+      CompileRun("foo()");
+    }
+    CHECK(function->shared().is_compiled());
+    CHECK(function->has_feedback_vector());
+
+    // Once the bytecode is old again only the feedback vector is dropped.
+    AgeAndFlushBytecode();
+    CHECK(function->shared().is_compiled());
+    CHECK(function->is_compiled());
+    CHECK(!function->has_feedback_vector());
+    CHECK(function->has_closure_feedback_cell_array());
+
+    // The function still runs without a vector, and gets a fresh one once it
+    // is hot again.
+    CompileRun("foo()");
+    IsCompiledScope is_compiled_scope(
+        function->shared().is_compiled_scope(i_isolate));
+    JSFunction::EnsureFeedbackVector(i_isolate, function, &is_compiled_scope);
+    CHECK(function->has_feedback_vector());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::FLAG_flush_bytecode = true;
   i::FLAG_allow_natives_syntax = true;
@@ -1472,6 +1622,48 @@ TEST(CompilationCacheCachingBehavior) {
   }
 }
 
+TEST(CompilationCacheEntryLimit) {
+  if (!FLAG_compilation_cache) return;
+  FLAG_compilation_cache_max_entries = 8;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  CompilationCache* compilation_cache = isolate->compilation_cache();
+  LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
+  v8::HandleScope outer_scope(CcTest::isolate());
+  ScriptDetails script_details(Handle<Object>(),
+                               v8::ScriptOriginOptions(true, false));
+
+  auto is_cached = [&](const char* raw_source) {
+    HandleScope scope(isolate);
+    Handle<String> source = factory->InternalizeUtf8String(raw_source);
+    return !compilation_cache->LookupScript(source, script_details,
+                                            language_mode)
+                .is_null();
+  };
+
+  // A script that is used over and over again.
+  const char* hot_source = "var hot = 1;";
+  for (int i = 0; i < 4; i++) CompileRun(hot_source);
+  CHECK(is_cached(hot_source));
+
+  // Many scripts that are only run once.
+  constexpr int kNumColdScripts = 32;
+  base::EmbeddedVector<char, 32> cold_sources[kNumColdScripts];
+  for (int i = 0; i < kNumColdScripts; i++) {
+    base::SNPrintF(cold_sources[i], "var cold%d = %d;", i, i);
+    CompileRun(cold_sources[i].begin());
+  }
+
+  // The table stays bounded, and the hot script survived the evictions.
+  int num_cached = 0;
+  for (int i = 0; i < kNumColdScripts; i++) {
+    if (is_cached(cold_sources[i].begin())) num_cached++;
+  }
+  CHECK_LT(num_cached, FLAG_compilation_cache_max_entries);
+  CHECK(is_cached(hot_source));
+}
+
 
 static void OptimizeEmptyFunction(const char* name) {
   HandleScope scope(CcTest::i_isolate());
@@ -7342,6 +7534,33 @@ TEST(LongTaskStatsYoung) {
       v8::metrics::LongTaskStats::Get(isolate).gc_young_wall_clock_duration_us);
 }
 
+TEST(MoveRangeWhileMarking) {
+  if (!FLAG_incremental_marking) return;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  const int kLength = 64;
+  Handle<FixedArray> array = isolate->factory()->NewFixedArray(kLength);
+  heap::SimulateIncrementalMarking(heap, false);
+  CHECK(heap->incremental_marking()->IsMarking());
+
+  // Exercise both directions with even and odd distances, so that the slots
+  // are moved both word-wise and one at a time with compressed pointers.
+  for (int distance : {-3, -2, -1, 1, 2, 3}) {
+    for (int i = 0; i < kLength; i++) array->set(i, Smi::FromInt(i));
+    const int len = kLength - std::abs(distance);
+    const int src = distance < 0 ? -distance : 0;
+    const int dst = distance < 0 ? 0 : distance;
+    heap->MoveRange(*array, array->RawFieldOfElementAt(dst),
+                    array->RawFieldOfElementAt(src), len,
+                    UPDATE_WRITE_BARRIER);
+    for (int i = 0; i < len; i++) {
+      CHECK_EQ(Smi::FromInt(src + i), array->get(dst + i));
+    }
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
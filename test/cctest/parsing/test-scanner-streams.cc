@@ -213,6 +213,44 @@ TEST(Utf8StreamBOM) {
   CHECK_EQ(unicode_ucs2[5], stream->Advance());
 }
 
+TEST(Utf8StreamSeekIntoAsciiRuns) {
+  // Non-ascii characters surrounding long ascii runs, so that seeking has to
+  // skip over both within a single chunk.
+  std::string data = "\xc3\xa4";  // U+00E4
+  data += std::string(100, 'a');
+  data += "\xe2\x82\xac";  // U+20AC
+  data += std::string(50, 'b');
+  data += "\xf0\x9f\x98\x80";  // U+1F600
+  data += "cd";
+  std::vector<uint16_t> expected;
+  expected.push_back(0xE4);
+  expected.insert(expected.end(), 100, 'a');
+  expected.push_back(0x20AC);
+  expected.insert(expected.end(), 50, 'b');
+  expected.push_back(0xD83D);
+  expected.push_back(0xDE00);
+  expected.push_back('c');
+  expected.push_back('d');
+
+  const char* chunks[] = {data.c_str(), "\0"};
+  ChunkSource chunk_source(chunks);
+  std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+      v8::internal::ScannerStream::For(
+          &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+
+  for (size_t i = 0; i < expected.size(); i++) {
+    // Don't seek into the middle of a surrogate pair.
+    if (expected[i] == 0xDE00) continue;
+    // Read to the end so that the seek has to skip from the chunk start.
+    while (v8::internal::Utf16CharacterStream::kEndOfInput !=
+           stream->Advance()) {
+      // Do nothing. We merely advance the stream to the end of its input.
+    }
+    stream->Seek(i);
+    CHECK_EQ(expected[i], stream->Advance());
+  }
+}
+
 TEST(Utf8SplitBOM) {
   // Construct chunks with a BOM split into two chunks.
   char partial_bom[] = "\xef\xbb";
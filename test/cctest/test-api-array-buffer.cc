@@ -5,6 +5,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/strings.h"
 #include "src/objects/js-array-buffer-inl.h"
+#include "src/utils/allocation.h"
 #include "test/cctest/test-api.h"
 
 using ::v8::Array;
@@ -776,3 +777,59 @@ TEST(BackingStore_ReallocateShared) {
       v8::BackingStore::Reallocate(isolate, std::move(backing_store), 10);
   CHECK(new_backing_store->IsShared());
 }
+
+#ifdef V8_SANDBOXED_POINTERS
+TEST(ArrayBufferAllocator_PooledAllocateAndReuse) {
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  uint8_t* data = static_cast<uint8_t*>(allocator->Allocate(100));
+  CHECK_NOT_NULL(data);
+  for (size_t i = 0; i < 100; i++) CHECK_EQ(0, data[i]);
+  memset(data, 0xAB, 100);
+  allocator->Free(data, 100);
+
+  // A block of the same size class comes back, zeroed again.
+  uint8_t* reused = static_cast<uint8_t*>(allocator->Allocate(120));
+  CHECK_EQ(data, reused);
+  for (size_t i = 0; i < 120; i++) CHECK_EQ(0, reused[i]);
+  allocator->Free(reused, 120);
+
+  // Other size classes do not share blocks.
+  void* other = allocator->AllocateUninitialized(1000);
+  CHECK_NOT_NULL(other);
+  CHECK_NE(data, other);
+  allocator->Free(other, 1000);
+}
+
+TEST(ArrayBufferAllocator_PooledReleasesEmptyChunks) {
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  // Enough blocks of the largest pooled size class to need several chunks.
+  constexpr size_t kBlockSize = 16 * i::KB;
+  constexpr int kNumBlocks = 64;
+  std::vector<void*> blocks;
+  for (int i = 0; i < kNumBlocks; i++) {
+    void* block = allocator->AllocateUninitialized(kBlockSize);
+    CHECK_NOT_NULL(block);
+    blocks.push_back(block);
+  }
+  // The first block starts the first chunk, which is not the one blocks are
+  // currently carved from by the time all of them are freed.
+  void* first_chunk = blocks.front();
+  for (void* block : blocks) allocator->Free(block, kBlockSize);
+
+  // Blocks of the released chunk are not handed out anymore...
+  void* block = allocator->AllocateUninitialized(kBlockSize);
+  CHECK_NOT_NULL(block);
+  CHECK_NE(first_chunk, block);
+  allocator->Free(block, kBlockSize);
+
+  // ... and its pages are available to the page allocator again.
+  v8::PageAllocator* page_allocator = i::GetArrayBufferPageAllocator();
+  const size_t page_size = page_allocator->AllocatePageSize();
+  void* pages = page_allocator->AllocatePages(
+      first_chunk, page_size, page_size, v8::PageAllocator::kReadWrite);
+  CHECK_EQ(first_chunk, pages);
+  CHECK(page_allocator->FreePages(pages, page_size));
+}
+#endif  // V8_SANDBOXED_POINTERS
@@ -47,6 +47,7 @@
 #include "include/v8-json.h"
 #include "include/v8-locker.h"
 #include "include/v8-primitive-object.h"
+#include "include/v8-profiler.h"
 #include "include/v8-regexp.h"
 #include "include/v8-util.h"
 #include "src/api/api-inl.h"
@@ -8624,6 +8625,55 @@ THREADED_TEST(OverlongSequencesAndSurrogates) {
                                    unicode_expected);
 }
 
+THREADED_TEST(Utf8AsciiRuns) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // Non-ASCII characters between ASCII runs of every length around the word
+  // size, so that runs start and end at every alignment.
+  const char* non_ascii[] = {"\xC3\xA9", "\xE2\x98\x83", "\xF0\x9F\x98\x80"};
+  for (const char* special : non_ascii) {
+    std::string utf8;
+    for (int run = 0; run < 40; run++) {
+      utf8.append(run, static_cast<char>('a' + run % 26));
+      utf8.append(special);
+    }
+    v8::Local<v8::String> str =
+        v8::String::NewFromUtf8(isolate, utf8.data(),
+                                v8::NewStringType::kNormal,
+                                static_cast<int>(utf8.size()))
+            .ToLocalChecked();
+    CHECK_EQ(static_cast<int>(utf8.size()), str->Utf8Length(isolate));
+    std::vector<char> buffer(utf8.size() + 1);
+    int chars_read;
+    int written = str->WriteUtf8(isolate, buffer.data(),
+                                 static_cast<int>(buffer.size()), &chars_read);
+    CHECK_EQ(static_cast<int>(utf8.size()) + 1, written);
+    CHECK_EQ(str->Length(), chars_read);
+    CHECK_EQ(0, strcmp(utf8.c_str(), buffer.data()));
+  }
+
+  // Latin-1 strings take the one-byte encoding path.
+  std::string latin1_utf8;
+  for (int run = 0; run < 40; run++) {
+    latin1_utf8.append(run, 'x');
+    latin1_utf8.append("\xC3\xBF");
+  }
+  v8::Local<v8::String> latin1 =
+      v8::String::NewFromUtf8(isolate, latin1_utf8.data(),
+                              v8::NewStringType::kNormal,
+                              static_cast<int>(latin1_utf8.size()))
+          .ToLocalChecked();
+  CHECK(latin1->IsOneByte());
+  std::vector<char> buffer(latin1_utf8.size());
+  int written =
+      latin1->WriteUtf8(isolate, buffer.data(), static_cast<int>(buffer.size()),
+                        nullptr, String::NO_NULL_TERMINATION);
+  CHECK_EQ(static_cast<int>(latin1_utf8.size()), written);
+  CHECK_EQ(0, memcmp(latin1_utf8.data(), buffer.data(), buffer.size()));
+}
+
 THREADED_TEST(Utf16) {
   LocalContext context;
   v8::HandleScope scope(context->GetIsolate());
@@ -21133,6 +21183,101 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+
+class JSONStringifyTestStream : public v8::OutputStream {
+ public:
+  explicit JSONStringifyTestStream(int chunk_size, int abort_after = -1)
+      : chunk_size_(chunk_size), abort_after_(abort_after) {}
+
+  int GetChunkSize() override { return chunk_size_; }
+  void EndOfStream() override { ++end_of_stream_count_; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    CHECK_GT(size, 0);
+    CHECK_LE(size, chunk_size_);
+    CHECK_EQ(0, end_of_stream_count_);
+    if (abort_after_ >= 0 && chunk_count_ == abort_after_) return kAbort;
+    chunk_count_++;
+    output_.append(data, size);
+    return kContinue;
+  }
+
+  const std::string& output() const { return output_; }
+  int chunk_count() const { return chunk_count_; }
+  int end_of_stream_count() const { return end_of_stream_count_; }
+
+ private:
+  std::string output_;
+  const int chunk_size_;
+  const int abort_after_;
+  int chunk_count_ = 0;
+  int end_of_stream_count_ = 0;
+};
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyTo) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  const char* kSources[] = {
+      "({x: 42, y: [1, 'two', null], z: {nested: true}})",
+      "({s: 'a'.repeat(100000), t: '\\u00e9\\u2603\\ud83d\\ude00'})",
+      "Array.from({length: 5000}, (_, i) => ({i, s: '\\ud83d\\ude00' + i}))",
+      "'lone \\ud83d surrogate'",
+  };
+  for (const char* source : kSources) {
+    Local<Value> value = CompileRun(source);
+    for (int chunk_size : {1, 7, 1024}) {
+      JSONStringifyTestStream stream(chunk_size);
+      CHECK(v8::JSON::StringifyTo(context.local(), value, &stream).FromJust());
+      CHECK_EQ(1, stream.end_of_stream_count());
+      Local<String> expected =
+          v8::JSON::Stringify(context.local(), value).ToLocalChecked();
+      v8::String::Utf8Value utf8(context->GetIsolate(), expected);
+      CHECK_EQ(std::string(*utf8, utf8.length()), stream.output());
+    }
+  }
+
+  // With a gap.
+  {
+    Local<Value> value = CompileRun("({a: [1, 2]})");
+    JSONStringifyTestStream stream(3);
+    CHECK(v8::JSON::StringifyTo(context.local(), value, &stream, v8_str("  "))
+              .FromJust());
+    CHECK_EQ("{\n  \"a\": [\n    1,\n    2\n  ]\n}", stream.output());
+  }
+
+  // Values that don't serialize to a JSON text write nothing.
+  {
+    JSONStringifyTestStream stream(16);
+    CHECK(!v8::JSON::StringifyTo(context.local(), CompileRun("undefined"),
+                                 &stream)
+               .FromJust());
+    CHECK(stream.output().empty());
+    CHECK_EQ(0, stream.end_of_stream_count());
+  }
+
+  // Aborting the stream stops the output.
+  {
+    Local<Value> value = CompileRun("'x'.repeat(1000)");
+    JSONStringifyTestStream stream(10, 3);
+    CHECK(!v8::JSON::StringifyTo(context.local(), value, &stream).FromJust());
+    CHECK_EQ(3, stream.chunk_count());
+    CHECK_EQ("\"xxxxxxxxxxxxxxxxxxxxxxxxxxxxx", stream.output());
+    CHECK_EQ(0, stream.end_of_stream_count());
+  }
+
+  // Exceptions are propagated.
+  {
+    v8::TryCatch try_catch(context->GetIsolate());
+    Local<Value> value = CompileRun("var a = {}; a.a = a; a");
+    JSONStringifyTestStream stream(16);
+    CHECK(v8::JSON::StringifyTo(context.local(), value, &stream).IsNothing());
+    CHECK(try_catch.HasCaught());
+    CHECK_EQ(0, stream.end_of_stream_count());
+  }
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -22093,6 +22238,126 @@ THREADED_TEST(ObjectNew) {
   }
 }
 
+THREADED_TEST(ObjectNewWithFastProperties) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<v8::Name> names[3] = {v8_str("a"), v8_str("b"), v8_str("0")};
+  Local<v8::Value> values1[3] = {v8_num(1), v8_num(2), v8_num(3)};
+  Local<v8::Value> values2[3] = {v8_str("x"), v8_num(4.5), v8_num(6)};
+  Local<v8::Object> obj1 =
+      v8::Object::New(isolate, names, values1, arraysize(values1));
+  Local<v8::Object> obj2 =
+      v8::Object::New(isolate, names, values2, arraysize(values2));
+  Verify(isolate, obj1);
+  Verify(isolate, obj2);
+  CHECK(obj1->GetPrototype()->SameValue(
+      env->Global()
+          ->Get(env.local(), v8_str("Object"))
+          .ToLocalChecked()
+          .As<v8::Object>()
+          ->Get(env.local(), v8_str("prototype"))
+          .ToLocalChecked()));
+  for (uint32_t i = 0; i < arraysize(names); ++i) {
+    CHECK(values1[i]->SameValue(
+        obj1->Get(env.local(), names[i]).ToLocalChecked()));
+    CHECK(values2[i]->SameValue(
+        obj2->Get(env.local(), names[i]).ToLocalChecked()));
+  }
+  i::Handle<i::JSObject> i_obj1 =
+      i::Handle<i::JSObject>::cast(v8::Utils::OpenHandle(*obj1));
+  i::Handle<i::JSObject> i_obj2 =
+      i::Handle<i::JSObject>::cast(v8::Utils::OpenHandle(*obj2));
+  CHECK(i_obj1->HasFastProperties());
+  CHECK_EQ(i_obj1->map(), i_obj2->map());
+}
+
+THREADED_TEST(ArrayNewFromDoubles) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  const double elements[] = {1, 2.5, -0.0, 1e300};
+  Local<v8::Array> array =
+      v8::Array::New(isolate, elements, arraysize(elements));
+  CHECK_EQ(arraysize(elements), array->Length());
+  for (uint32_t i = 0; i < arraysize(elements); ++i) {
+    CHECK(v8_num(elements[i])
+              ->SameValue(array->Get(env.local(), i).ToLocalChecked()));
+  }
+  i::Handle<i::JSArray> i_array = v8::Utils::OpenHandle(*array);
+  CHECK_EQ(i::PACKED_DOUBLE_ELEMENTS, i_array->GetElementsKind());
+  CHECK_EQ(0, v8::Array::New(isolate, elements, 0)->Length());
+}
+
+namespace {
+
+struct IterationData {
+  v8::Isolate* isolate;
+  std::vector<v8::Global<v8::Value>> elements;
+  uint32_t break_at;
+};
+
+v8::Array::CallbackResult CollectElement(uint32_t index,
+                                         Local<v8::Value> element,
+                                         void* data) {
+  IterationData* iteration_data = static_cast<IterationData*>(data);
+  if (index == iteration_data->break_at) {
+    return v8::Array::CallbackResult::kBreak;
+  }
+  CHECK_EQ(iteration_data->elements.size(), index);
+  // Creating a Global is fine, but {element} itself must not escape.
+  iteration_data->elements.emplace_back(iteration_data->isolate, element);
+  return v8::Array::CallbackResult::kContinue;
+}
+
+v8::Array::CallbackResult ThrowOnSecondElement(uint32_t index,
+                                               Local<v8::Value> element,
+                                               void* data) {
+  if (index == 1) {
+    v8::Isolate* isolate = static_cast<v8::Isolate*>(data);
+    isolate->ThrowError("second element");
+    return v8::Array::CallbackResult::kException;
+  }
+  return v8::Array::CallbackResult::kContinue;
+}
+
+}  // namespace
+
+THREADED_TEST(ArrayIterate) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  const char* sources[] = {
+      "[1, 2, 3]",                         // PACKED_SMI_ELEMENTS
+      "[1, 'two', {}]",                    // PACKED_ELEMENTS
+      "[1.5, 2.5, 3.5]",                   // PACKED_DOUBLE_ELEMENTS
+      "Object.freeze([1, 2, 3])",          // PACKED_FROZEN_ELEMENTS
+      "var a = [1, , 3]; a",               // HOLEY_SMI_ELEMENTS
+      "var b = []; b[2000] = 1; b",        // DICTIONARY_ELEMENTS
+  };
+  for (const char* source : sources) {
+    Local<v8::Array> array = CompileRun(source).As<v8::Array>();
+    uint32_t length = array->Length();
+    IterationData data{isolate, {}, length};
+    CHECK(array->Iterate(env.local(), CollectElement, &data).IsJust());
+    CHECK_EQ(length, data.elements.size());
+    for (uint32_t i = 0; i < length; ++i) {
+      Local<v8::Value> expected = array->Get(env.local(), i).ToLocalChecked();
+      CHECK(expected->StrictEquals(data.elements[i].Get(isolate)));
+    }
+
+    // Breaking out of the iteration is not an error.
+    IterationData break_data{isolate, {}, 1};
+    CHECK(array->Iterate(env.local(), CollectElement, &break_data).IsJust());
+    CHECK_EQ(1, break_data.elements.size());
+
+    v8::TryCatch try_catch(isolate);
+    CHECK(array->Iterate(env.local(), ThrowOnSecondElement, isolate)
+              .IsNothing());
+    CHECK(try_catch.HasCaught());
+  }
+}
+
 TEST(EscapableHandleScope) {
   HandleScope outer_scope(CcTest::isolate());
   LocalContext context;
@@ -29169,6 +29434,98 @@ TEST(FastApiOverloadResolution) {
 #endif  // V8_LITE_MODE
 }
 
+#ifndef V8_LITE_MODE
+namespace {
+int fast_one_byte_string_calls = 0;
+std::string fast_one_byte_string_value;
+
+void FastCallbackOneByteString(v8::Local<v8::Object> receiver,
+                               const v8::FastOneByteString& string) {
+  Trivial* self = UnwrapTrivialObject(receiver);
+  CHECK_NOT_NULL(self);
+  self->set_x(static_cast<int>(string.length));
+  fast_one_byte_string_calls++;
+  fast_one_byte_string_value.assign(string.data, string.length);
+}
+
+void OneByteStringSlowCallback(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Trivial* self = UnwrapTrivialObject(args.This());
+  CHECK_NOT_NULL(self);
+  self->set_x(1337);
+}
+}  // namespace
+#endif  // V8_LITE_MODE
+
+TEST(FastApiOneByteString) {
+#ifndef V8_LITE_MODE
+  if (i::FLAG_jitless) return;
+
+  v8::internal::FLAG_opt = true;
+  v8::internal::FLAG_turbo_fast_api_calls = true;
+  v8::internal::FLAG_allow_natives_syntax = true;
+  // Disable --always_opt, otherwise we haven't generated the necessary
+  // feedback to go down the "best optimization" path for the fast call.
+  v8::internal::FLAG_always_opt = false;
+  v8::internal::FlagList::EnforceFlagImplications();
+
+  v8::Isolate* isolate = CcTest::isolate();
+  HandleScope handle_scope(isolate);
+  LocalContext env;
+
+  v8::CFunction c_func =
+      v8::CFunctionBuilder().Fn(FastCallbackOneByteString).Build();
+  CHECK_EQ(v8::CTypeInfo::Type::kSeqOneByteString,
+           c_func.ArgumentInfo(1).GetType());
+  Local<v8::FunctionTemplate> callback_templ = v8::FunctionTemplate::New(
+      isolate, OneByteStringSlowCallback, v8::Local<v8::Value>(),
+      v8::Local<v8::Signature>(), 1, v8::ConstructorBehavior::kThrow,
+      v8::SideEffectType::kHasSideEffect, &c_func);
+
+  v8::Local<v8::ObjectTemplate> object_template =
+      v8::ObjectTemplate::New(isolate);
+  object_template->SetInternalFieldCount(kV8WrapperObjectIndex + 1);
+  object_template->Set(isolate, "api_func", callback_templ);
+
+  std::unique_ptr<Trivial> rcv(new Trivial(42));
+  v8::Local<v8::Object> object =
+      object_template->NewInstance(env.local()).ToLocalChecked();
+  object->SetAlignedPointerInInternalField(kV8WrapperObjectIndex, rcv.get());
+  CHECK(
+      (env)->Global()->Set(env.local(), v8_str("receiver"), object).FromJust());
+
+  USE(CompileRun(
+      "function func(arg) { return receiver.api_func(arg); }"
+      "%PrepareFunctionForOptimization(func);"
+      "func('warm up');"
+      "%OptimizeFunctionOnNextCall(func);"));
+
+  // Sequential one-byte strings are passed to the fast callback in place.
+  fast_one_byte_string_calls = 0;
+  USE(CompileRun("func('hello world');"));
+  CHECK_EQ(1, fast_one_byte_string_calls);
+  CHECK_EQ(11, rcv->x());
+  CHECK_EQ(std::string("hello world"), fast_one_byte_string_value);
+
+  USE(CompileRun("func('');"));
+  CHECK_EQ(2, fast_one_byte_string_calls);
+  CHECK_EQ(0, rcv->x());
+
+  // Everything else takes the slow callback.
+  USE(CompileRun("func('two-byte \\u20ac');"));
+  CHECK_EQ(1337, rcv->x());
+  rcv->set_x(0);
+  USE(CompileRun(
+      "const cons = 'a cons string made of' + ' two rather long halves';"
+      "func(cons);"));
+  CHECK_EQ(1337, rcv->x());
+  rcv->set_x(0);
+  USE(CompileRun("func(42);"));
+  CHECK_EQ(1337, rcv->x());
+  CHECK_EQ(2, fast_one_byte_string_calls);
+#endif  // V8_LITE_MODE
+}
+
 THREADED_TEST(Recorder_GetContext) {
   using v8::Context;
   using v8::Local;
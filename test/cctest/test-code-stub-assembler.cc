@@ -148,6 +148,7 @@ TEST(NumberToString) {
      2147483646.9,  2147483647.0,  2147483647.5,  2147483647.9,  // SmiMax.
     -4294967295.9, -4294967296.0, -4294967296.5, -4294967297.0,  // - 2^32.
      4294967295.9,  4294967296.0,  4294967296.5,  4294967297.0,  //   2^32.
+     1.5, 2.5, 3.5, 12.25, 12.75, 0.125,  // Short mantissas.
   };
   // clang-format on
 
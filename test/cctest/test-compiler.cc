@@ -43,6 +43,7 @@
 #include "src/heap/spaces.h"
 #include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
+#include "src/maglev/maglev-concurrent-dispatcher.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -1000,5 +1001,123 @@ TEST(ProfilerEnabledDuringBackgroundCompile) {
   cpu_profiler->StopProfiling(profile);
 }
 
+#ifdef V8_ENABLE_MAGLEV
+namespace {
+
+const char* kMaglevClosuresSource =
+    "function factory() { return function(x) { return x; }; }"
+    "var f1 = factory();"
+    "var f2 = factory();"
+    "%PrepareFunctionForOptimization(f1);"
+    "f1(1); f2(2);";
+
+Handle<JSFunction> GetJSFunction(const char* name) {
+  return Handle<JSFunction>::cast(GetGlobalProperty(name));
+}
+
+}  // namespace
+
+// Requesting Maglev code for a function whose feedback vector already caches
+// TurboFan code returns the cached higher-tier code.
+TEST(MaglevAfterTurbofanReusesCachedCode) {
+  if (!FLAG_opt || FLAG_lite_mode) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_always_opt = false;
+  FLAG_maglev = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(kMaglevClosuresSource);
+  CompileRun("%OptimizeFunctionOnNextCall(f1); f1(3);");
+  Handle<JSFunction> f1 = GetJSFunction("f1");
+  CHECK(f1->ActiveTierIsTurbofan());
+  CHECK_EQ(CodeKind::TURBOFAN, f1->feedback_vector().optimized_code().kind());
+
+  Compiler::CompileOptimized(isolate, f1, ConcurrencyMode::kSynchronous,
+                             CodeKind::MAGLEV);
+  CHECK(f1->ActiveTierIsTurbofan());
+  CHECK_EQ(CodeKind::TURBOFAN, f1->feedback_vector().optimized_code().kind());
+}
+
+// Synchronously compiled Maglev code is cached on the feedback vector, picked
+// up by sibling closures and later replaced by TurboFan code.
+TEST(MaglevSynchronousFinalizationCachesCode) {
+  if (!FLAG_opt || FLAG_lite_mode) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_always_opt = false;
+  FLAG_maglev = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(kMaglevClosuresSource);
+  CompileRun("%OptimizeMaglevOnNextCall(f1); f1(3);");
+  Handle<JSFunction> f1 = GetJSFunction("f1");
+  Handle<JSFunction> f2 = GetJSFunction("f2");
+  CHECK(f1->ActiveTierIsMaglev());
+  CHECK_EQ(CodeKind::MAGLEV, f1->feedback_vector().optimized_code().kind());
+  CHECK_EQ(TieringState::kNone, f1->feedback_vector().tiering_state());
+
+  CompileRun("f2(4);");
+  CHECK(f2->ActiveTierIsMaglev());
+
+  CompileRun("%OptimizeFunctionOnNextCall(f2); f2(5);");
+  CHECK(f2->ActiveTierIsTurbofan());
+  CHECK_EQ(CodeKind::TURBOFAN, f2->feedback_vector().optimized_code().kind());
+}
+
+// Finalizing a concurrent Maglev job caches the code and only clears the
+// kInProgress tiering state; a tiering request made while the job was running
+// is preserved.
+TEST(MaglevConcurrentFinalizationKeepsTieringRequest) {
+  if (!FLAG_opt || FLAG_lite_mode) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_always_opt = false;
+  FLAG_maglev = true;
+  FLAG_concurrent_recompilation = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  maglev::MaglevConcurrentDispatcher* dispatcher =
+      isolate->maglev_concurrent_dispatcher();
+  if (!dispatcher->is_enabled()) return;
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(kMaglevClosuresSource);
+  Handle<JSFunction> f1 = GetJSFunction("f1");
+
+  // Without an intervening request, finalization clears kInProgress.
+  Compiler::CompileOptimized(isolate, f1, ConcurrencyMode::kConcurrent,
+                             CodeKind::MAGLEV);
+  CHECK_EQ(TieringState::kInProgress, f1->feedback_vector().tiering_state());
+  dispatcher->AwaitCompileJobs();
+  dispatcher->FinalizeFinishedJobs();
+  CHECK(f1->ActiveTierIsMaglev());
+  CHECK_EQ(CodeKind::MAGLEV, f1->feedback_vector().optimized_code().kind());
+  CHECK_EQ(TieringState::kNone, f1->feedback_vector().tiering_state());
+
+  // Closures of another factory get a fresh feedback vector. Make a TurboFan
+  // request while their job is running.
+  CompileRun(
+      "function factory2() { return function(x) { return x; }; }"
+      "var g1 = factory2();"
+      "var g2 = factory2();"
+      "%PrepareFunctionForOptimization(g1);"
+      "g1(1); g2(2);");
+  Handle<JSFunction> g1 = GetJSFunction("g1");
+  Handle<JSFunction> g2 = GetJSFunction("g2");
+  CHECK(!g1->feedback_vector().has_optimized_code());
+  Compiler::CompileOptimized(isolate, g1, ConcurrencyMode::kConcurrent,
+                             CodeKind::MAGLEV);
+  g1->feedback_vector().set_tiering_state(
+      TieringState::kRequestTurbofan_Concurrent);
+  dispatcher->AwaitCompileJobs();
+  dispatcher->FinalizeFinishedJobs();
+  CHECK(g1->ActiveTierIsMaglev());
+  CHECK_EQ(CodeKind::MAGLEV, g2->feedback_vector().optimized_code().kind());
+  CHECK_EQ(TieringState::kRequestTurbofan_Concurrent,
+           g1->feedback_vector().tiering_state());
+}
+#endif  // V8_ENABLE_MAGLEV
+
 }  // namespace internal
 }  // namespace v8
@@ -42,6 +42,7 @@
 #include "src/codegen/source-position-table.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/embedder-state.h"
+#include "src/flags/flags.h"
 #include "src/heap/spaces.h"
 #include "src/init/v8.h"
 #include "src/libplatform/default-platform.h"
@@ -126,6 +127,16 @@ static void EnqueueTickSampleEvent(ProfilerEventsProcessor* proc,
 
 namespace {
 
+// Tests that need a precise trace become flaky when Sparkplug code is compiled
+// in the background, so they compile it on the main thread.
+void DisableConcurrentSparkplug() {
+  // The flag is read-only, and false, where concurrent Sparkplug is not
+  // supported.
+  if (!i::FLAG_concurrent_sparkplug) return;
+  const char kFlag[] = "--no-concurrent-sparkplug";
+  CHECK_EQ(0, i::FlagList::SetFlagsFromString(kFlag, strlen(kFlag)));
+}
+
 class TestSetup {
  public:
   TestSetup() : old_flag_prof_browser_mode_(i::FLAG_prof_browser_mode) {
@@ -751,9 +762,7 @@ static const char* cpu_profiler_test_source =
 //     2     2    (program) [-1]
 //     6     6    (garbage collector) [-1]
 TEST(CollectCpuProfile) {
-  // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
-  // since it requires a precise trace.
-  if (i::FLAG_concurrent_sparkplug) return;
+  DisableConcurrentSparkplug();
 
   i::FLAG_allow_natives_syntax = true;
   LocalContext env;
@@ -784,9 +793,7 @@ TEST(CollectCpuProfile) {
 }
 
 TEST(CollectCpuProfileCallerLineNumbers) {
-  // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
-  // since it requires a precise trace.
-  if (i::FLAG_concurrent_sparkplug) return;
+  DisableConcurrentSparkplug();
 
   i::FLAG_allow_natives_syntax = true;
   LocalContext env;
@@ -1382,9 +1389,7 @@ static const char* call_function_test_source =
 //     1     1      bar [-1] #7
 //    19    19    (program) [-1] #2
 TEST(FunctionCallSample) {
-  // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
-  // since it requires a precise trace.
-  if (i::FLAG_concurrent_sparkplug) return;
+  DisableConcurrentSparkplug();
 
   i::FLAG_allow_natives_syntax = true;
   LocalContext env;
@@ -1443,9 +1448,7 @@ static const char* function_apply_test_source =
 //     2     2        bar [-1] #16 6
 //    10    10    (program) [-1] #0 2
 TEST(FunctionApplySample) {
-  // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
-  // since it requires a precise trace.
-  if (i::FLAG_concurrent_sparkplug) return;
+  DisableConcurrentSparkplug();
 
   i::FLAG_allow_natives_syntax = true;
   LocalContext env;
@@ -1926,9 +1929,7 @@ static const char* inlining_test_source2 = R"(
 //                        bailed out due to 'Optimization is always disabled'
 //     2    (program):0 0 #2
 TEST(Inlining2) {
-  // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
-  // since it requires a precise trace.
-  if (FLAG_concurrent_sparkplug) return;
+  DisableConcurrentSparkplug();
 
   FLAG_allow_natives_syntax = true;
   v8::Isolate* isolate = CcTest::isolate();
@@ -2018,9 +2019,7 @@ static const char* cross_script_source_b = R"(
   )";
 
 TEST(CrossScriptInliningCallerLineNumbers) {
-  // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
-  // since it requires a precise trace.
-  if (i::FLAG_concurrent_sparkplug) return;
+  DisableConcurrentSparkplug();
 
   i::FLAG_allow_natives_syntax = true;
   v8::Isolate* isolate = CcTest::isolate();
@@ -2113,9 +2112,7 @@ static const char* cross_script_source_f = R"(
   )";
 
 TEST(CrossScriptInliningCallerLineNumbers2) {
-  // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
-  // since it requires a precise trace.
-  if (i::FLAG_concurrent_sparkplug) return;
+  DisableConcurrentSparkplug();
 
   i::FLAG_allow_natives_syntax = true;
   LocalContext env;
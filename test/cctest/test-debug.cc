@@ -1620,6 +1620,82 @@ TEST(BreakPointInlining) {
   CheckDebuggerUnloaded();
 }
 
+// Preparing a whole script for debugging deoptimizes all the optimized
+// functions in it, including the ones that inline other functions of the
+// script, and break points set afterwards are hit.
+TEST(BreakPointsInManyOptimizedFunctions) {
+  i::FLAG_allow_natives_syntax = true;
+  break_point_hit_count = 0;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  i::Isolate* i_isolate = CcTest::i_isolate();
+  v8::HandleScope scope(isolate);
+
+  DebugEventCounter delegate;
+  v8::debug::SetDebugDelegate(isolate, &delegate);
+
+  constexpr int kFunctionCount = 16;
+  std::string source;
+  std::string optimize;
+  std::string call;
+  for (int i = 0; i < kFunctionCount; ++i) {
+    std::string f = "f" + std::to_string(i);
+    std::string g = "g" + std::to_string(i);
+    source += "function " + f + "(x) { return x + " + std::to_string(i) +
+              "; }\n" + "function " + g + "(x) { return " + f +
+              "(x) * 2; }\n";
+    optimize += "%PrepareFunctionForOptimization(" + g + ");" + g + "(0.5);" +
+                g + "(0.6);" + "%OptimizeFunctionOnNextCall(" + g + ");" + g +
+                "(0.7);";
+    call += g + "(0.1);";
+  }
+  CompileRun(source.c_str());
+  CompileRun(optimize.c_str());
+
+  std::vector<v8::Local<v8::Function>> inlinees;
+  std::vector<i::Handle<i::JSFunction>> callers;
+  for (int i = 0; i < kFunctionCount; ++i) {
+    std::string f = "f" + std::to_string(i);
+    std::string g = "g" + std::to_string(i);
+    inlinees.push_back(CompileRun(f.c_str()).As<v8::Function>());
+    callers.push_back(i::Handle<i::JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun(g.c_str()))));
+  }
+  CHECK_EQ(0, break_point_hit_count);
+
+  // Prepare all functions of the script in one go.
+  i::Handle<i::Script> script(i::Script::cast(callers[0]->shared().script()),
+                              i_isolate);
+  std::vector<i::BreakLocation> locations;
+  CHECK(i_isolate->debug()->GetPossibleBreakpoints(
+      script, 0, i::String::cast(script->source()).length(), false,
+      &locations));
+  CHECK(!locations.empty());
+  for (i::Handle<i::JSFunction> caller : callers) {
+    CHECK(!caller->HasAttachedOptimizedCode());
+    i::SharedFunctionInfo shared = caller->shared();
+    CHECK(shared.HasBreakInfo());
+    CHECK(shared.GetDebugInfo().flags(v8::kRelaxedLoad) &
+          i::DebugInfo::kPreparedForDebugExecution);
+  }
+
+  std::vector<i::Handle<i::BreakPoint>> break_points;
+  for (v8::Local<v8::Function> inlinee : inlinees) {
+    break_points.push_back(SetBreakPoint(inlinee, 0));
+  }
+  CompileRun(call.c_str());
+  CHECK_EQ(kFunctionCount, break_point_hit_count);
+
+  for (i::Handle<i::BreakPoint> break_point : break_points) {
+    ClearBreakPoint(break_point);
+  }
+  CompileRun(call.c_str());
+  CHECK_EQ(kFunctionCount, break_point_hit_count);
+
+  v8::debug::SetDebugDelegate(isolate, nullptr);
+  CheckDebuggerUnloaded();
+}
+
 static void CallWithBreakPoints(v8::Local<v8::Context> context,
                                 v8::Local<v8::Object> recv,
                                 v8::Local<v8::Function> f,
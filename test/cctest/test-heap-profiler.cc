@@ -3919,6 +3919,36 @@ TEST(SamplingHeapProfilerApiSamples) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerSurvivedGCCount) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  // Small sample interval to force each object to be sampled.
+  heap_profiler->StartSamplingHeapProfiler(i::kTaggedSize);
+
+  const int kNumObjects = 16;
+  v8::Local<v8::Object> objects[kNumObjects];
+  for (int i = 0; i < kNumObjects; ++i) {
+    objects[i] = v8::Object::New(env->GetIsolate());
+  }
+  CcTest::CollectAllGarbage();
+  CcTest::CollectAllGarbage();
+
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+  int num_survivors = 0;
+  for (auto& sample : profile->GetSamples()) {
+    if (sample.survived_gc_count >= 2) ++num_survivors;
+  }
+  CHECK_GE(num_survivors, kNumObjects);
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(CcTest::isolate());
   LocalContext env;
@@ -167,6 +167,33 @@ UNINITIALIZED_TEST(SharedPtrComprCageImpliesSharedReadOnlyHeap) {
   isolate2->Dispose();
 }
 #endif  // V8_SHARED_RO_HEAP
+
+UNINITIALIZED_TEST(SharedPtrComprCageRetainProcessWideHeapState) {
+  FLAG_retain_process_wide_heap_state = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  bool requires_code_range = i_isolate1->RequiresCodeRange();
+  base::AddressRegion code_region = i_isolate1->heap()->code_region();
+  ReadOnlyHeap* read_only_heap = i_isolate1->read_only_heap();
+  isolate1->Dispose();
+
+  // The second Isolate is created after the first one is gone, and picks up
+  // the retained state instead of setting it up again.
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  if (requires_code_range) {
+    CHECK_EQ(code_region, i_isolate2->heap()->code_region());
+  }
+#ifdef V8_SHARED_RO_HEAP
+  CHECK_EQ(read_only_heap, i_isolate2->read_only_heap());
+#else
+  USE(read_only_heap);
+#endif  // V8_SHARED_RO_HEAP
+  isolate2->Dispose();
+}
 #endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
 
 }  // namespace internal
@@ -55,6 +55,7 @@
 #include "src/snapshot/code-serializer.h"
 #include "src/snapshot/context-deserializer.h"
 #include "src/snapshot/context-serializer.h"
+#include "src/snapshot/embedded/embedded-data-inl.h"
 #include "src/snapshot/read-only-deserializer.h"
 #include "src/snapshot/read-only-serializer.h"
 #include "src/snapshot/shared-heap-deserializer.h"
@@ -465,6 +466,28 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   context_blob.Dispose();
 }
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+// Creating an isolate from the compressed default snapshot works with the
+// read-only snapshot decompressed on the main thread and as a background job.
+UNINITIALIZED_TEST(ConcurrentSnapshotDecompression) {
+  DisableAlwaysOpt();
+  for (bool concurrent : {false, true}) {
+    FLAG_concurrent_snapshot_decompression = concurrent;
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      ExpectInt32("[1, 2, 3].map(x => x * 2).reduce((a, b) => a + b)", 12);
+    }
+    isolate->Dispose();
+  }
+}
+#endif  // V8_SNAPSHOT_COMPRESSION
+
 UNINITIALIZED_TEST(ContextSerializerContext) {
   DisableAlwaysOpt();
   base::Vector<const byte> startup_blob;
@@ -1503,6 +1526,74 @@ UNINITIALIZED_TEST(SnapshotDataBlobWithWarmup) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(SnapshotDataBlobWithContexts) {
+  DisableAlwaysOpt();
+  const char* tenant_a =
+      "function f() { return 'a'; }\n"
+      "var tenant = f();";
+  const char* tenant_b = "var tenant = 'b';";
+
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData base = CreateSnapshotDataBlob(nullptr);
+  // Contexts that were populated at runtime are added to a new blob that is
+  // based on an existing one. The default context stays unpolluted.
+  v8::StartupData blob;
+  {
+    v8::SnapshotCreator creator(nullptr, &base);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope scope(isolate);
+      creator.SetDefaultContext(v8::Context::New(isolate));
+    }
+    for (const char* source : {tenant_a, tenant_b}) {
+      v8::HandleScope scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      {
+        v8::Context::Scope c_scope(context);
+        CompileRun(source);
+      }
+      creator.AddContext(context);
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+  }
+  delete[] base.data;
+  CHECK_NOT_NULL(blob.data);
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &blob;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    {
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope c_scope(context);
+      ExpectTrue("typeof tenant === 'undefined'");
+    }
+    {
+      v8::Local<v8::Context> context =
+          v8::Context::FromSnapshot(isolate, 0).ToLocalChecked();
+      v8::Context::Scope c_scope(context);
+      ExpectString("tenant", "a");
+      // Code compiled while populating the context is kept.
+      CHECK(IsCompiled("f"));
+    }
+    {
+      v8::Local<v8::Context> context =
+          v8::Context::FromSnapshot(isolate, 1).ToLocalChecked();
+      v8::Context::Scope c_scope(context);
+      ExpectString("tenant", "b");
+    }
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(CustomSnapshotDataBlobWithWarmup) {
   DisableAlwaysOpt();
   const char* source =
@@ -2690,6 +2781,129 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerCodeCacheNeedsUpdate) {
+  FLAG_always_opt = false;
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  const char* js_source = "function f() { return 'abc'; }; 'def'";
+  v8::ScriptOrigin origin(isolate, v8_str("test"));
+  v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+          .ToLocalChecked();
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache(
+      ScriptCompiler::CreateCodeCache(script));
+  CHECK(!ScriptCompiler::CodeCacheNeedsUpdate(script, cache.get()));
+
+  // Running the script does not compile f.
+  script->BindToCurrentContext()->Run(context.local()).ToLocalChecked();
+  CHECK(!ScriptCompiler::CodeCacheNeedsUpdate(script, cache.get()));
+
+  // Lazily compiling f makes the cache stale.
+  CompileRun("f()");
+  CHECK(ScriptCompiler::CodeCacheNeedsUpdate(script, cache.get()));
+  cache.reset(ScriptCompiler::CreateCodeCache(script));
+  CHECK(!ScriptCompiler::CodeCacheNeedsUpdate(script, cache.get()));
+
+  // A cache for a different source always needs an update.
+  v8::ScriptCompiler::Source other_source(v8_str("'other'"), origin);
+  v8::Local<v8::UnboundScript> other_script =
+      v8::ScriptCompiler::CompileUnboundScript(isolate, &other_source)
+          .ToLocalChecked();
+  CHECK(ScriptCompiler::CodeCacheNeedsUpdate(other_script, cache.get()));
+}
+
+TEST(CodeSerializerCodeCacheNeedsUpdateAfterFlush) {
+  FLAG_always_opt = false;
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  v8::HandleScope scope(isolate);
+
+  const char* js_source =
+      "function f() { return 'abc'; };"
+      "function g() { return 'ghi'; };"
+      "'def'";
+  v8::ScriptOrigin origin(isolate, v8_str("test"));
+  v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+          .ToLocalChecked();
+  script->BindToCurrentContext()->Run(context.local()).ToLocalChecked();
+  CompileRun("f()");
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache(
+      ScriptCompiler::CreateCodeCache(script));
+  CHECK(!ScriptCompiler::CodeCacheNeedsUpdate(script, cache.get()));
+
+  // Flushing f alone only makes a new cache smaller.
+  Handle<JSFunction> f = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("f").As<v8::Function>()));
+  SharedFunctionInfo::DiscardCompiled(i_isolate,
+                                      handle(f->shared(), i_isolate));
+  f->ResetIfCodeFlushed();
+  CHECK(!ScriptCompiler::CodeCacheNeedsUpdate(script, cache.get()));
+
+  // Compiling g brings the number of compiled functions back to what the
+  // cache has, but the cache doesn't contain g.
+  CompileRun("g()");
+  CHECK(ScriptCompiler::CodeCacheNeedsUpdate(script, cache.get()));
+  cache.reset(ScriptCompiler::CreateCodeCache(script));
+  CHECK(!ScriptCompiler::CodeCacheNeedsUpdate(script, cache.get()));
+
+  // Recompiling f makes the cache stale again.
+  CompileRun("f()");
+  CHECK(ScriptCompiler::CodeCacheNeedsUpdate(script, cache.get()));
+}
+
+TEST(CodeSerializerClearsFlushCount) {
+  FLAG_always_opt = false;
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache;
+  {
+    LocalContext context;
+    v8::Isolate* isolate = context->GetIsolate();
+    v8::HandleScope scope(isolate);
+    v8::ScriptOrigin origin(isolate, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context.local()).ToLocalChecked();
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("f").As<v8::Function>()));
+    f->shared().set_flush_count(
+        SharedFunctionInfo::kFlushCountForBytecodeRetention);
+    cache = ScriptCompiler::CreateCodeCache(script);
+    // Serializing doesn't change the live function.
+    CHECK(f->shared().IsBytecodeRetainedAfterFlushes());
+  }
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("f").As<v8::Function>()));
+    CHECK_EQ(0u, f->shared().flush_count());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
@@ -4118,6 +4332,56 @@ UNINITIALIZED_TEST(ReinitializeHashSeedJSCollectionRehashable) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(HashSeedMatchingSnapshotSkipsRehashing) {
+  DisableAlwaysOpt();
+  i::FLAG_rehash_snapshot = true;
+  i::FLAG_hash_seed = 42;
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    v8::SnapshotCreator creator;
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun(
+          "var m = new Map();"
+          "m.set('a', 1);"
+          "m.set('b', 2);"
+          "var o = {};"
+          "for (var i = 0; i < 100; i++) o['p' + i] = i;"
+          "delete o.p0;");
+      creator.SetDefaultContext(context);
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+    CHECK(blob.CanBeRehashed());
+  }
+
+  // Deserialize with the seed the snapshot was created with, so that the
+  // tables are used as they are.
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.snapshot_blob = &blob;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    CHECK_EQ(static_cast<uint64_t>(42),
+             HashSeed(reinterpret_cast<i::Isolate*>(isolate)));
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    CHECK(!context.IsEmpty());
+    v8::Context::Scope context_scope(context);
+    ExpectInt32("m.get('b')", 2);
+    ExpectInt32("o.p99", 99);
+    ExpectTrue("o.p0 === undefined");
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(ReinitializeHashSeedRehashable) {
   DisableAlwaysOpt();
   i::FLAG_rehash_snapshot = true;
@@ -5029,5 +5293,24 @@ UNINITIALIZED_TEST(SharedStrings) {
   FreeCurrentEmbeddedBlob();
 }
 
+TEST(EmbeddedBuiltinsInCodeOrderDoNotOverlap) {
+  // Unwind info on Windows and the embedded file writer rely on walking the
+  // builtins in code order yielding increasing, disjoint instruction ranges,
+  // whatever the order of the builtin IDs is (see --reorder-builtins).
+  CcTest::InitializeVM();
+  EmbeddedData d = EmbeddedData::FromBlob(CcTest::i_isolate());
+  Address prev_end = d.InstructionStartOfBuiltin(d.BuiltinInCodeOrder(0));
+  std::vector<bool> seen(Builtins::kBuiltinCount, false);
+  for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+    Builtin builtin = d.BuiltinInCodeOrder(i);
+    CHECK(!seen[static_cast<int>(builtin)]);
+    seen[static_cast<int>(builtin)] = true;
+    Address start = d.InstructionStartOfBuiltin(builtin);
+    CHECK_LE(prev_end, start);
+    prev_end = start + d.InstructionSizeOfBuiltin(builtin);
+  }
+  CHECK_LE(prev_end, reinterpret_cast<Address>(d.code()) + d.code_size());
+}
+
 }  // namespace internal
 }  // namespace v8
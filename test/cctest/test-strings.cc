@@ -42,6 +42,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/init/v8.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/string-table.h"
 #include "src/strings/unicode-decoder.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
@@ -2185,6 +2186,39 @@ TEST(CheckCachedDataInternalExternalUncachedStringTwoByte) {
   }
 }
 
+TEST(StringTableLookupKeys) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  uint64_t seed = HashSeed(isolate);
+
+  Handle<String> existing = factory->InternalizeUtf8String("lookup-keys-a");
+  std::vector<std::string> chars = {"lookup-keys-a", "lookup-keys-b",
+                                    "lookup-keys-c", "lookup-keys-b"};
+  // Enough new strings to make the batch outgrow the initial table.
+  for (int i = 0; i < 4096; i++) {
+    chars.push_back("lookup-keys-" + std::to_string(i));
+  }
+  std::vector<OneByteStringKey> keys;
+  for (const std::string& c : chars) {
+    keys.emplace_back(base::OneByteVector(c.c_str(), c.size()), seed);
+  }
+  std::vector<Handle<String>> results(keys.size());
+  isolate->string_table()->LookupKeys(isolate, base::VectorOf(keys),
+                                      results.data());
+
+  CHECK_EQ(*existing, *results[0]);
+  // Equal keys in the same batch must produce the same string.
+  CHECK_EQ(*results[1], *results[3]);
+  CHECK_NE(*results[1], *results[2]);
+  for (size_t i = 0; i < chars.size(); i++) {
+    CHECK(results[i]->IsInternalizedString());
+    CHECK(results[i]->IsOneByteEqualTo(base::CStrVector(chars[i].c_str())));
+    CHECK_EQ(*results[i], *factory->InternalizeUtf8String(chars[i].c_str()));
+  }
+}
+
 }  // namespace test_strings
 }  // namespace internal
 }  // namespace v8
@@ -174,6 +174,14 @@ TEST(Strtod) {
   CHECK_EQ(123456789012345e-25, Strtod(vector, -25));
   CHECK_EQ(123456789012345e-39, Strtod(vector, -39));
 
+  // Lengths around the eight-digit blocks that are read in bulk.
+  CHECK_EQ(12345678.0, StrtodChar("12345678", 0));
+  CHECK_EQ(123456789.0, StrtodChar("123456789", 0));
+  CHECK_EQ(9999999999999998.0, StrtodChar("9999999999999998", 0));
+  CHECK_EQ(12345678901234567e-3, StrtodChar("12345678901234567", -3));
+  CHECK_EQ(18446744073709551615.0, StrtodChar("18446744073709551615", 0));
+  CHECK_EQ(90000000.00000001, StrtodChar("9000000000000001", -8));
+
   CHECK_EQ(0.0, StrtodChar("0", 12345));
   CHECK_EQ(0.0, StrtodChar("", 1324));
   CHECK_EQ(0.0, StrtodChar("000000000", 123));
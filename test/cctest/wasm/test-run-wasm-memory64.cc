@@ -52,6 +52,9 @@ WASM_EXEC_TEST(Load) {
   CHECK_TRAP(r.Call(kWasmPageSize - 3));
   CHECK_EQ(0x0, r.Call(kWasmPageSize - 4));
   CHECK_TRAP(r.Call(uint64_t{1} << 32));
+  // The high word is zero here, so this is caught by the guard regions if the
+  // trap handler is used.
+  CHECK_TRAP(r.Call(uint64_t{kMaxUInt32}));
 }
 
 // TODO(clemensb): Test atomic instructions.
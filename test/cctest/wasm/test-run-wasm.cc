@@ -3967,6 +3967,53 @@ TEST(Liftoff_tier_up) {
   CHECK_EQ(4, r.Call(11, 7));
 }
 
+TEST(Liftoff_LoopLocalsInRegisters_WithoutCalls) {
+  FLAG_SCOPE(liftoff_loop_locals_in_registers);
+  WasmRunner<int32_t, int32_t> r(TestExecutionTier::kLiftoff);
+  uint32_t n = r.AllocateLocal(kWasmI32);
+  uint32_t i = r.AllocateLocal(kWasmI32);
+  uint32_t sum = r.AllocateLocal(kWasmI32);
+  // {n} may share the register of the parameter and {i} starts as a constant,
+  // so both are spilled on loop entry, while {sum} can stay in its register.
+  // Odd values are added twice.
+  BUILD(r, WASM_LOCAL_SET(n, WASM_LOCAL_GET(0)), WASM_LOCAL_SET(i, WASM_ZERO),
+        WASM_LOOP(
+            WASM_LOCAL_SET(
+                sum, WASM_I32_ADD(WASM_LOCAL_GET(sum), WASM_LOCAL_GET(i))),
+            WASM_IF(WASM_I32_AND(WASM_LOCAL_GET(i), WASM_ONE),
+                    WASM_LOCAL_SET(sum, WASM_I32_ADD(WASM_LOCAL_GET(sum),
+                                                     WASM_LOCAL_GET(i)))),
+            WASM_LOCAL_SET(i, WASM_I32_ADD(WASM_LOCAL_GET(i), WASM_ONE)),
+            WASM_BR_IF(0, WASM_I32_LTS(WASM_LOCAL_GET(i), WASM_LOCAL_GET(n)))),
+        WASM_LOCAL_GET(sum));
+  CHECK_EQ(0, r.Call(0));
+  CHECK_EQ(0, r.Call(1));
+  CHECK_EQ(70, r.Call(10));
+  CHECK_EQ(7450, r.Call(100));
+}
+
+TEST(Liftoff_LoopLocalsInRegisters_WithCalls) {
+  FLAG_SCOPE(liftoff_loop_locals_in_registers);
+  WasmRunner<int32_t, int32_t> r(TestExecutionTier::kLiftoff);
+  WasmFunctionCompiler& inc = r.NewFunction<int32_t, int32_t>("inc");
+  BUILD(inc, WASM_I32_ADD(WASM_LOCAL_GET(0), WASM_ONE));
+  uint32_t i = r.AllocateLocal(kWasmI32);
+  uint32_t sum = r.AllocateLocal(kWasmI32);
+  // The call makes the loop keep spilling all locals on entry.
+  BUILD(r,
+        WASM_LOOP(
+            WASM_LOCAL_SET(
+                sum, WASM_I32_ADD(WASM_LOCAL_GET(sum), WASM_LOCAL_GET(i))),
+            WASM_LOCAL_SET(i, WASM_CALL_FUNCTION(inc.function_index(),
+                                                 WASM_LOCAL_GET(i))),
+            WASM_BR_IF(0, WASM_I32_LTS(WASM_LOCAL_GET(i), WASM_LOCAL_GET(0)))),
+        WASM_LOCAL_GET(sum));
+  CHECK_EQ(0, r.Call(0));
+  CHECK_EQ(0, r.Call(1));
+  CHECK_EQ(45, r.Call(10));
+  CHECK_EQ(4950, r.Call(100));
+}
+
 TEST(Regression_1085507) {
   WasmRunner<int32_t> r(TestExecutionTier::kInterpreter);
   TestSignatures sigs;
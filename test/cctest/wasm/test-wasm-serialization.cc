@@ -5,6 +5,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <vector>
+
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
 #include "src/objects/objects-inl.h"
@@ -363,6 +365,113 @@ TEST(SerializeLiftoffModuleFails) {
   CHECK(!wasm_serializer.SerializeNativeModule({buffer.get(), buffer_size}));
 }
 
+TEST(DeserializeTierUpFunction) {
+  // Functions that were marked for tier-up when the module was serialized get
+  // compiled with TurboFan right after deserialization, even with dynamic
+  // tiering.
+  if (!FLAG_liftoff) return;
+  FlagScope<bool> dynamic_tiering(&FLAG_wasm_dynamic_tiering, true);
+  FlagScope<bool> no_lazy_compilation(&FLAG_wasm_lazy_compilation, false);
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  CcTest::InitIsolateOnce();
+
+  ZoneBuffer wire_bytes_buffer(&zone);
+  {
+    WasmModuleBuilder* builder = zone.New<WasmModuleBuilder>(&zone);
+    TestSignatures sigs;
+    byte code[] = {WASM_LOCAL_GET(0), kExprI32Const, 1, kExprI32Add, kExprEnd};
+    WasmFunctionBuilder* turbofan_function = builder->AddFunction(sigs.i_i());
+    turbofan_function->EmitCode(code, sizeof(code));
+    WasmFunctionBuilder* tier_up_function = builder->AddFunction(sigs.i_i());
+    tier_up_function->EmitCode(code, sizeof(code));
+    builder->WriteTo(&wire_bytes_buffer);
+  }
+  constexpr int kTurbofanFunction = 0;
+  constexpr int kTierUpFunction = 1;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator =
+      CcTest::i_isolate()->array_buffer_allocator();
+  v8::Isolate* serialization_v8_isolate = v8::Isolate::New(create_params);
+  Isolate* serialization_isolate =
+      reinterpret_cast<Isolate*>(serialization_v8_isolate);
+  std::weak_ptr<NativeModule> weak_native_module;
+  std::vector<uint8_t> serialized_bytes;
+  {
+    HandleScope scope(serialization_isolate);
+    v8::Local<v8::Context> serialization_context =
+        v8::Context::New(serialization_v8_isolate);
+    v8::Context::Scope context_scope(serialization_context);
+
+    ErrorThrower thrower(serialization_isolate, "");
+    Handle<WasmModuleObject> module_object =
+        GetWasmEngine()
+            ->SyncCompile(serialization_isolate,
+                          WasmFeatures::FromIsolate(serialization_isolate),
+                          &thrower,
+                          ModuleWireBytes(wire_bytes_buffer.begin(),
+                                          wire_bytes_buffer.end()))
+            .ToHandleChecked();
+    weak_native_module = module_object->shared_native_module();
+    NativeModule* native_module = module_object->native_module();
+
+    // Serialization needs at least one TurboFan function.
+    GetWasmEngine()->CompileFunction(serialization_isolate, native_module,
+                                     kTurbofanFunction,
+                                     ExecutionTier::kTurbofan);
+    // Pretend that the other function used up part of its budget and was
+    // then marked for tier-up, but its TurboFan code is not ready yet.
+    const WasmModule* module = native_module->module();
+    native_module->tiering_budget_array()[declared_function_index(
+        module, kTierUpFunction)] = FLAG_wasm_tiering_budget - 1;
+    {
+      base::MutexGuard mutex_guard(&module->type_feedback.mutex);
+      module->type_feedback.feedback_for_function[kTierUpFunction]
+          .tierup_priority = 1;
+    }
+    {
+      WasmCodeRefScope code_ref_scope;
+      CHECK_EQ(ExecutionTier::kLiftoff,
+               native_module->GetCode(kTierUpFunction)->tier());
+    }
+
+    WasmSerializer serializer(native_module);
+    serialized_bytes.resize(serializer.GetSerializedNativeModuleSize());
+    CHECK(serializer.SerializeNativeModule(base::VectorOf(serialized_bytes)));
+  }
+  // Dispose of the serialization isolate, so that deserialization does not
+  // find the module in the native module cache.
+  serialization_v8_isolate->Dispose();
+  while (weak_native_module.lock()) {
+  }
+
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  v8::Local<v8::Context> context = v8::Context::New(CcTest::isolate());
+  v8::Context::Scope context_scope(context);
+  Handle<WasmModuleObject> module_object;
+  CHECK(DeserializeNativeModule(
+            isolate, base::VectorOf(serialized_bytes),
+            base::VectorOf(wire_bytes_buffer.begin(), wire_bytes_buffer.size()),
+            {})
+            .ToHandle(&module_object));
+  NativeModule* native_module = module_object->native_module();
+  {
+    WasmCodeRefScope code_ref_scope;
+    CHECK_EQ(ExecutionTier::kTurbofan,
+             native_module->GetCode(kTurbofanFunction)->tier());
+  }
+  // Dynamic tiering has no event for finished top tier compilation, so wait
+  // for the TurboFan code of the function that was marked for tier-up. It
+  // would only be compiled with Liftoff if the mark got lost.
+  while (true) {
+    WasmCodeRefScope code_ref_scope;
+    WasmCode* code = native_module->GetCode(kTierUpFunction);
+    if (code != nullptr && code->tier() == ExecutionTier::kTurbofan) break;
+  }
+}
+
 }  // namespace test_wasm_serialization
 }  // namespace wasm
 }  // namespace internal
@@ -206,6 +206,21 @@ TEST(SharedEngineRunImported) {
   }
 }
 
+TEST(SharedEngineReuseExportWrappers) {
+  SharedEngineIsolate isolate;
+  HandleScope scope(isolate.isolate());
+  ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+  Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+  // A second module object for the same NativeModule in the same isolate
+  // uses the export wrappers of the first one instead of compiling new ones.
+  Handle<WasmInstanceObject> imported_instance =
+      isolate.ImportInstance(isolate.ExportInstance(instance));
+  CHECK_NE(instance->module_object(), imported_instance->module_object());
+  CHECK_EQ(instance->module_object().export_wrappers(),
+           imported_instance->module_object().export_wrappers());
+  CHECK_EQ(23, isolate.Run(imported_instance));
+}
+
 TEST(SharedEngineRunThreadedBuildingSync) {
   SharedEngineThread thread1([](SharedEngineIsolate* isolate) {
     HandleScope scope(isolate->isolate());
@@ -0,0 +1,34 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Collators whose options resolve to the defaults may compare ASCII strings
+// through the collation weight tables. The results must match ICU, which is
+// used for the -u-kf-false variant since it does not name a fast locale.
+const strings = [
+  "", "a", "A", "ab", "aB", "Ab", "b", "B", "a b", "a-b", "a_b", "a1", "a10",
+  "a2", "Z", "z", "zz", "!", "~", " ", "\x01", "a\x01", "ä", "ä",
+  "Müller", "Mueller", "Muller", "déjà", "deja",
+];
+
+for (const locale of ["en", "en-US", "de", "sv", "fr"]) {
+  const fast = new Intl.Collator(locale, {sensitivity: "variant"});
+  const slow = new Intl.Collator(locale + "-u-kf-false");
+  for (const a of strings) {
+    for (const b of strings) {
+      assertEquals(slow.compare(a, b), fast.compare(a, b), `${a} vs. ${b}`);
+      assertEquals(slow.compare(a, b),
+                   a.localeCompare(b, locale, {usage: "sort"}),
+                   `${a} vs. ${b}`);
+    }
+  }
+}
+
+// Non-default options must not take the fast path.
+function compare(options, a, b) {
+  return new Intl.Collator("en", options).compare(a, b);
+}
+assertEquals(0, compare({sensitivity: "base"}, "a", "A"));
+assertEquals(-1, compare({numeric: true}, "a2", "a10"));
+assertEquals(-1, compare({caseFirst: "upper"}, "A", "a"));
+assertEquals(0, compare({ignorePunctuation: true}, "a-b", "ab"));
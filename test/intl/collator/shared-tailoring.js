@@ -0,0 +1,30 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Collators for the same locale share their ICU template, so options set on
+// one of them must not leak into the others.
+for (let i = 0; i < 3; i++) {
+  let numeric = new Intl.Collator('en', {numeric: true});
+  let plain = new Intl.Collator('en');
+  let base = new Intl.Collator('en', {sensitivity: 'base'});
+  let upper = new Intl.Collator('en', {caseFirst: 'upper'});
+
+  assertEquals(-1, numeric.compare('2', '10'));
+  assertEquals(1, plain.compare('2', '10'));
+  assertEquals(0, base.compare('a', 'A'));
+  assertEquals(-1, plain.compare('a', 'A'));
+  assertEquals(-1, upper.compare('A', 'a'));
+
+  assertTrue(numeric.resolvedOptions().numeric);
+  assertFalse(plain.resolvedOptions().numeric);
+  assertEquals('base', base.resolvedOptions().sensitivity);
+  assertEquals('variant', plain.resolvedOptions().sensitivity);
+  assertEquals('upper', upper.resolvedOptions().caseFirst);
+  assertEquals('false', plain.resolvedOptions().caseFirst);
+}
+
+// Locales with different tailorings get different templates.
+assertEquals(-1, new Intl.Collator('de').compare('ä', 'z'));
+assertEquals(1, new Intl.Collator('sv').compare('ä', 'z'));
+assertEquals(-1, new Intl.Collator('de').compare('ä', 'z'));
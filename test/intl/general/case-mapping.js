@@ -217,3 +217,14 @@ assertEquals("\u00A0¡¢£¤¥¦§¨©ª«¬\u00AD®°±²³´µ¶·¸¹º»¼½
     "àáâãäåæçèéêëi\u0307\u0300i\u0307\u0301îïðñòóôõö×øùúûüýþß" +
     "àáâãäåæçèéêëìíîïðñòóôõö÷øùúûüýþÿ",
     latin1Suppl.toLocaleLowerCase("lt"));
+
+// ASCII strings use the root locale case mapping in these locales, except
+// for the dotted and dotless i of Turkish and Azerbaijani.
+for (const locale of ["tr", "az", "lt", "el"]) {
+  assertEquals("HELLO, WORLD!", "Hello, World!".toLocaleUpperCase(locale));
+  assertEquals("hello, world!", "Hello, World!".toLocaleLowerCase(locale));
+}
+assertEquals("DİK", "dik".toLocaleUpperCase("tr"));
+assertEquals("dık", "DIK".toLocaleLowerCase("az"));
+assertEquals("DIK", "dik".toLocaleUpperCase("lt"));
+assertEquals("dik", "DIK".toLocaleLowerCase("el"));
@@ -0,0 +1,76 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large whole-array copies share their backing store copy-on-write. Writes
+// to either the source or the copy must stay invisible to the other.
+function makeArray(length, f) {
+  const array = [];
+  for (let i = 0; i < length; i++) array.push(f(i));
+  return array;
+}
+
+(function() {
+  for (const f of [i => i, i => 'x' + i, i => ({i})]) {
+    const source = makeArray(1000, f);
+    const sliced = source.slice();
+    const spread = [...source];
+    const concatenated = source.concat();
+    sliced[0] = 'sliced';
+    spread.push('spread');
+    concatenated.length = 10;
+    source[999] = 'source';
+    assertEquals(f(0), source[0]);
+    assertEquals(f(999), sliced[999]);
+    assertEquals(f(999), spread[999]);
+    assertEquals(1000, source.length);
+    assertEquals(1000, sliced.length);
+    assertEquals(1001, spread.length);
+    assertEquals(10, concatenated.length);
+    assertEquals('sliced', sliced[0]);
+    assertEquals('source', source[999]);
+    assertEquals(f(1), spread[1]);
+  }
+})();
+
+// Holey arrays are shared by slice but not by spread, which fills holes.
+(function() {
+  const source = makeArray(1000, i => i);
+  delete source[5];
+  const sliced = source.slice();
+  const spread = [...source];
+  assertFalse(5 in sliced);
+  assertTrue(5 in spread);
+  assertEquals(undefined, spread[5]);
+  sliced[5] = 'hole';
+  assertFalse(5 in source);
+})();
+
+// Shrinking and growing the source after a shared clone.
+(function() {
+  const source = makeArray(500, i => i);
+  const copy = source.slice();
+  source.pop();
+  source.shift();
+  source.unshift('first');
+  assertEquals(500, copy.length);
+  assertEquals(0, copy[0]);
+  assertEquals(499, copy[499]);
+  assertEquals('first', source[0]);
+  assertEquals(499, source.length);
+})();
+
+// Arrays grown by push have slack in their backing store. Pushing into the
+// source and the copy afterwards must not make them alias.
+(function() {
+  for (const f of [i => i, i => 'x' + i]) {
+    const source = makeArray(1000, f);
+    const copy = source.slice();
+    source.push('a');
+    copy.push('b');
+    assertEquals('a', source[1000]);
+    assertEquals('b', copy[1000]);
+    assertEquals(1001, source.length);
+    assertEquals(1001, copy.length);
+  }
+})();
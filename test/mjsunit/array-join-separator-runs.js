@@ -0,0 +1,27 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Runs of separators (produced by holes and empty elements) are written by
+// repeatedly doubling the separator; check all run lengths around powers of
+// two for one-byte, two-byte and non-flat separators.
+(function() {
+  const separators = ['ab', 'xyz', '\u2603-', 'a'.repeat(8) + 'b'.repeat(8)];
+  for (const sep of separators) {
+    for (let holes = 0; holes < 20; holes++) {
+      const a = ['x'];
+      a.length = holes + 2;
+      a[holes + 1] = 'y';
+      assertEquals('x' + sep.repeat(holes + 1) + 'y', a.join(sep));
+      const b = new Array(holes + 1);
+      assertEquals(sep.repeat(holes), b.join(sep));
+    }
+  }
+})();
+
+// Leading and trailing separator runs next to two-byte elements.
+(function() {
+  const a = [, , '\u00e9', , , , '\u03bb', , ];
+  assertEquals('--\u00e9----\u03bb-', a.join('-'));
+  assertEquals('<><>\u00e9<><><><>\u03bb<>', a.join('<>'));
+})();
@@ -0,0 +1,48 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Smi arrays sorted with the default comparator bypass TimSort. Compare
+// against an explicit string comparison for a variety of inputs.
+function referenceSort(array) {
+  return array.slice().sort((a, b) => {
+    const x = String(a), y = String(b);
+    return x < y ? -1 : x > y ? 1 : 0;
+  });
+}
+
+(function() {
+  let seed = 17;
+  function random() {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed;
+  }
+  for (const length of [2, 3, 10, 100, 1000]) {
+    const array = [];
+    for (let i = 0; i < length; i++) {
+      const magnitude = random() % 10;
+      array.push((random() % Math.pow(10, magnitude)) * (random() & 1 ? -1 : 1));
+    }
+    assertEquals(referenceSort(array), array.slice().sort());
+  }
+  assertEquals([-1, -10, -2, 0, 1, 10, 100, 2, 9],
+               [10, 9, 1, 100, 2, 0, -1, -10, -2].sort());
+  assertEquals([1073741823, -1073741824, 0].sort(),
+               [-1073741824, 0, 1073741823]);
+})();
+
+// Holey Smi arrays keep holes at the end.
+(function() {
+  const array = [3, , 1, , 20];
+  array.sort();
+  assertEquals(5, array.length);
+  assertEquals([1, 20, 3], array.slice(0, 3));
+  assertFalse(3 in array);
+  assertFalse(4 in array);
+})();
+
+// Arrays that are not all Smis still take the generic path.
+(function() {
+  assertEquals([1, 1.5, 10, 2], [10, 2, 1.5, 1].sort());
+  assertEquals([1, 10, 2, 'a', undefined], [undefined, 'a', 10, 2, 1].sort());
+})();
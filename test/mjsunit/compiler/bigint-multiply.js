@@ -0,0 +1,38 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+(function OptimizeAndTest() {
+  function fn(a, b) {
+    return a * b;
+  }
+  %PrepareFunctionForOptimization(fn);
+  assertEquals(6n, fn(2n, 3n));
+  assertEquals(-6n, fn(-2n, 3n));
+  %OptimizeFunctionOnNextCall(fn);
+  assertEquals(6n, fn(2n, 3n));
+  assertEquals(0n, fn(0n, 3n));
+  assertEquals(0n, fn(-4n, 0n));
+  assertEquals(2n ** 128n, fn(2n ** 64n, 2n ** 64n));
+  assertEquals(-(3n ** 100n), fn(3n ** 50n, -(3n ** 50n)));
+  assertOptimized(fn);
+
+  assertEquals(6, fn(2, 3));
+  assertUnoptimized(fn);
+})();
+
+(function OptimizeTruncated() {
+  function fn(a, b) {
+    return BigInt.asIntN(64, a * b);
+  }
+  %PrepareFunctionForOptimization(fn);
+  assertEquals(6n, fn(2n, 3n));
+  %OptimizeFunctionOnNextCall(fn);
+  assertEquals(6n, fn(2n, 3n));
+  assertEquals(0n, fn(2n ** 32n, 2n ** 32n));
+  assertEquals(-(2n ** 63n), fn(2n ** 62n, 2n));
+  assertEquals(-1n, fn(2n ** 64n + 1n, -1n));
+  assertOptimized(fn);
+})();
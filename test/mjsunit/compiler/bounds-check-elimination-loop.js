@@ -0,0 +1,41 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// The loop condition implies that the element accesses are in bounds.
+(function() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; ++i) s += a[i];
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(6, sum([1, 2, 3]));
+  assertEquals(6, sum([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(6, sum([1, 2, 3]));
+  assertEquals(0, sum([]));
+  assertOptimized(sum);
+})();
+
+// The array shrinks inside the loop, so the bounds check is still needed.
+(function() {
+  function shrink(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; ++i) {
+      s += a[i];
+      if (i == 1) a.length = 1;
+      s += a[i] === undefined ? 100 : a[i];
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(shrink);
+  assertEquals(104, shrink([1, 2, 3]));
+  assertEquals(104, shrink([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(shrink);
+  assertEquals(104, shrink([1, 2, 3]));
+})();
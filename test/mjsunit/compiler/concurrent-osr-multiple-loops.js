@@ -0,0 +1,32 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --concurrent-osr
+// Flags: --concurrent-recompilation
+
+// OSR code for one loop must not prevent the following loops of the same
+// function from being OSR'd concurrently.
+function f(n) {
+  let a = 0;
+  for (let i = 0; i < n; ++i) {
+    a += i;
+    if (i == 10) %OptimizeOsr();
+  }
+  let b = 0;
+  for (let i = 0; i < n; ++i) {
+    b += 2 * i;
+    if (i == 10) %OptimizeOsr();
+  }
+  let c = 0;
+  for (let i = 0; i < n; ++i) {
+    c += 3 * i;
+    if (i == 10) %OptimizeOsr();
+  }
+  return a + b + c;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(6 * 4950, f(100));
+assertEquals(6 * 4950, f(100));
+assertEquals(6 * 49995000, f(10000));
@@ -0,0 +1,26 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+function f(n, deopt) {
+  var inner = {value: 1};
+  var outer = {inner: inner};
+  var current = outer.inner;
+  var sum = 0;
+  for (var i = 0; i < n; ++i) {
+    sum += current.value;
+    current = outer.inner;
+    if (deopt) %DeoptimizeNow();
+  }
+  return sum + current.value;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(4, f(3, false));
+assertEquals(4, f(3, false));
+%OptimizeFunctionOnNextCall(f);
+assertEquals(4, f(3, false));
+assertEquals(11, f(10, false));
+assertEquals(4, f(3, true));
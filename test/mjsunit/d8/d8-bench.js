@@ -0,0 +1,14 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --bench --bench-threads=2 --bench-warmup=1 --bench-iterations=3
+
+// Just test that d8 can run a script repeatedly on multiple isolates in
+// benchmark mode without crashing.
+
+let sum = 0;
+for (let i = 0; i < 1000; i++) {
+  sum += [i, i + 1].map(x => x * 2).reduce((a, b) => a + b);
+}
+assertEquals(2000000, sum);
@@ -0,0 +1,28 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Test that a worker can transfer ArrayBuffers back to its parent.
+
+if (this.Worker) {
+  (function TestTransferOut() {
+    function workerCode() {
+      onmessage = function(byteLength) {
+        const ab = new ArrayBuffer(byteLength);
+        const ta = new Uint8Array(ab);
+        for (let i = 0; i < byteLength; ++i) ta[i] = i & 0xff;
+        postMessage(ab, [ab]);
+        // The buffer must have been detached by the transfer.
+        postMessage(ab.byteLength);
+      };
+    }
+    const w = new Worker(workerCode, {type: 'function'});
+    w.postMessage(64);
+    const ab = w.getMessage();
+    assertEquals(64, ab.byteLength);
+    const ta = new Uint8Array(ab);
+    for (let i = 0; i < 64; ++i) assertEquals(i, ta[i]);
+    assertEquals(0, w.getMessage());
+    w.terminate();
+  })();
+}
@@ -368,3 +368,17 @@ assertEquals(-8640000000000000, Date.parse("-271821-04-20T00:00:00.000Z"));
 assertEquals(8640000000000000, Date.parse("+275760-09-13T00:00:00.000Z"));
 assertTrue(isNaN(Date.parse("-271821-04-19T00:00:00.000Z")));
 assertTrue(isNaN(Date.parse("+275760-09-14T00:00:00.000Z")));
+
+(function TestToISOStringFormat() {
+  assertEquals("1970-01-01T00:00:00.000Z", new Date(0).toISOString());
+  assertEquals("2022-12-31T23:59:59.999Z",
+               new Date(Date.UTC(2022, 11, 31, 23, 59, 59, 999)).toISOString());
+  assertEquals("0000-01-01T00:00:00.000Z",
+               new Date("0000-01-01T00:00:00.000Z").toISOString());
+  assertEquals("9999-12-31T23:59:59.999Z",
+               new Date("9999-12-31T23:59:59.999Z").toISOString());
+  assertEquals("+010000-01-01T00:00:00.000Z",
+               new Date("+010000-01-01T00:00:00.000Z").toISOString());
+  assertEquals("-000001-01-01T00:00:00.000Z",
+               new Date("-000001-01-01T00:00:00.000Z").toISOString());
+})();
@@ -0,0 +1,32 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Lookups with string keys compare cached hashes before contents; make
+// sure equal strings with different representations still match.
+(function() {
+  const map = new Map();
+  const set = new Set();
+  const base = 'abcdefghijklmnopqrstuvwxyz';
+  for (let i = 0; i < 100; i++) {
+    const key = base + i;
+    map.set(key, i);
+    set.add(key);
+  }
+  for (let i = 0; i < 100; i++) {
+    // Cons, sliced and flat copies of the inserted key.
+    const cons = base + String(i);
+    const sliced = ('!' + base + i).substring(1);
+    const flat = JSON.parse(JSON.stringify(cons));
+    for (const key of [cons, sliced, flat]) {
+      assertEquals(i, map.get(key));
+      assertTrue(map.has(key));
+      assertTrue(set.has(key));
+    }
+    assertFalse(map.has(base + (i + 100)));
+    assertFalse(set.has(base.toUpperCase() + i));
+  }
+  assertTrue(map.delete(base + '7'));
+  assertFalse(map.has(base + 7));
+  assertEquals(99, map.size);
+})();
@@ -0,0 +1,179 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc
+
+// Object.assign into an empty object literal copies the fields of the first
+// source wholesale when the assignment can't be observed.
+
+(function TestSmallLiteralSource() {
+  for (let i = 0; i < 3; ++i) {
+    const source = {a: i, b: 'b', c: 1.5};
+    const result = Object.assign({}, source);
+    assertEquals({a: i, b: 'b', c: 1.5}, result);
+    assertEquals(['a', 'b', 'c'], Object.keys(result));
+    result.d = 4;
+    assertEquals(undefined, source.d);
+  }
+})();
+
+(function TestOutOfObjectProperties() {
+  const source = {};
+  for (let i = 0; i < 20; ++i) source['p' + i] = i;
+  for (let i = 0; i < 3; ++i) {
+    const result = Object.assign({}, source);
+    assertEquals(source, result);
+    result.p19 = -1;
+    assertEquals(19, source.p19);
+  }
+})();
+
+(function TestDoubleFieldsAreNotShared() {
+  for (let i = 0; i < 3; ++i) {
+    const source = {x: 1.5, y: 2.5};
+    const result = Object.assign({}, source);
+    result.x += 1;
+    source.y += 1;
+    assertEquals(2.5, result.x);
+    assertEquals(2.5, result.y);
+    assertEquals(1.5, source.x);
+    assertEquals(3.5, source.y);
+  }
+})();
+
+(function TestCopyOfCopy() {
+  let state = {count: 0, name: 'n'};
+  for (let i = 0; i < 5; ++i) {
+    state = Object.assign({}, state, {count: state.count + 1});
+  }
+  assertEquals({count: 5, name: 'n'}, state);
+})();
+
+(function TestSymbolsAndNonEnumerable() {
+  const sym = Symbol('s');
+  const source = {a: 1, [sym]: 2};
+  Object.defineProperty(source, 'hidden', {value: 3, enumerable: false});
+  for (let i = 0; i < 3; ++i) {
+    const result = Object.assign({}, source);
+    assertEquals(1, result.a);
+    assertEquals(2, result[sym]);
+    assertFalse(result.hasOwnProperty('hidden'));
+    assertEquals(['a', sym], Reflect.ownKeys(result));
+  }
+})();
+
+(function TestReadOnlySourceProperty() {
+  const source = {a: 1};
+  Object.defineProperty(source, 'b', {value: 2, enumerable: true});
+  for (let i = 0; i < 3; ++i) {
+    const result = Object.assign({}, source);
+    result.b = 3;
+    assertEquals(3, result.b);
+    assertTrue(Object.getOwnPropertyDescriptor(result, 'b').configurable);
+  }
+})();
+
+(function TestProtoKey() {
+  const source = JSON.parse('{"a": 1, "__proto__": {"b": 2}}');
+  for (let i = 0; i < 3; ++i) {
+    const result = Object.assign({}, source);
+    assertFalse(result.hasOwnProperty('__proto__'));
+    assertEquals(2, result.b);
+  }
+})();
+
+(function TestSetterOnPrototypeAddedLater() {
+  const source = {setterTestKey: 1};
+  for (let i = 0; i < 3; ++i) {
+    assertEquals(1, Object.assign({}, source).setterTestKey);
+  }
+  let set_value;
+  Object.defineProperty(Object.prototype, 'setterTestKey', {
+    set(v) { set_value = v; },
+    configurable: true
+  });
+  const result = Object.assign({}, source);
+  assertEquals(1, set_value);
+  assertFalse(result.hasOwnProperty('setterTestKey'));
+  delete Object.prototype.setterTestKey;
+  assertEquals(1, Object.assign({}, source).setterTestKey);
+})();
+
+(function TestReadOnlyOnPrototype() {
+  const source = {readOnlyTestKey: 1};
+  assertEquals(1, Object.assign({}, source).readOnlyTestKey);
+  Object.defineProperty(Object.prototype, 'readOnlyTestKey',
+                        {value: 0, writable: false, configurable: true});
+  assertThrows(() => Object.assign({}, source), TypeError);
+  delete Object.prototype.readOnlyTestKey;
+})();
+
+(function TestNonEmptyTargets() {
+  const source = {a: 1, b: 2};
+  assertEquals({x: 0, a: 1, b: 2}, Object.assign({x: 0}, source));
+  const with_elements = [];
+  assertEquals(1, Object.assign(with_elements, source).a);
+  const hashed = {};
+  const map = new Map([[hashed, 'v']]);
+  Object.assign(hashed, source);
+  assertEquals('v', map.get(hashed));
+  assertEquals(2, hashed.b);
+})();
+
+(function TestSourceIdentityHash() {
+  const source = {a: 1};
+  const set = new Set([source]);
+  const result = Object.assign({}, source);
+  assertTrue(set.has(source));
+  assertFalse(set.has(result));
+})();
+
+(function TestOldSpaceTarget() {
+  const target = {};
+  gc();
+  gc();
+  const source = {a: {nested: true}, b: 0.5};
+  Object.assign(target, source);
+  gc();
+  assertEquals({a: {nested: true}, b: 0.5}, target);
+  assertSame(source.a, target.a);
+})();
+
+(function TestMultipleSources() {
+  const result = Object.assign({}, {a: 1, b: 2}, {b: 3, c: 4}, null, 'xy');
+  assertEquals({a: 1, b: 3, c: 4, 0: 'x', 1: 'y'}, result);
+})();
+
+(function TestCacheSurvivesGC() {
+  function assign(source) {
+    return Object.assign({}, source);
+  }
+  const source = {a: 1, b: 'b', c: {nested: 1}};
+  const before = assign(source);
+  gc();
+  const after = assign(source);
+  assertEquals(before, after);
+  assertSame(source.c, after.c);
+  assertEquals(['a', 'b', 'c'], Object.keys(after));
+  after.d = 1;
+  assertEquals(undefined, source.d);
+})();
+
+(function TestCacheEntryDiesWithSourceMap() {
+  function assign(source) {
+    return Object.assign({}, source);
+  }
+  (function() {
+    const source = {};
+    source.unique_gc_test_x = 1;
+    source.unique_gc_test_y = 2;
+    assertEquals({unique_gc_test_x: 1, unique_gc_test_y: 2}, assign(source));
+  })();
+  gc();
+  gc();
+  const source = {};
+  source.unique_gc_test_x = 'x';
+  source.unique_gc_test_y = 'y';
+  assertEquals({unique_gc_test_x: 'x', unique_gc_test_y: 'y'}, assign(source));
+})();
@@ -0,0 +1,43 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Every await of an activation shares the same resolve/reject closures, so
+// fulfilled and rejected awaits must keep resuming the right activation.
+
+async function loop(n, fail_every) {
+  let sum = 0;
+  let caught = 0;
+  for (let i = 0; i < n; ++i) {
+    try {
+      if (i % fail_every == 0) await Promise.reject(i);
+      sum += await i;
+    } catch (e) {
+      assertEquals(i, e);
+      ++caught;
+    }
+  }
+  return [sum, caught];
+}
+
+async function interleaved() {
+  const results = await Promise.all([loop(10, 3), loop(7, 2), loop(5, 10)]);
+  assertEquals([[27, 4], [9, 4], [10, 1]], results);
+}
+
+let done = false;
+interleaved().then(() => done = true, e => %AbortJS(String(e)));
+%PerformMicrotaskCheckpoint();
+assertTrue(done);
+
+async function rethrows() {
+  await 1;
+  await Promise.reject(new Error('boom'));
+}
+
+let message;
+rethrows().catch(e => message = e.message);
+%PerformMicrotaskCheckpoint();
+assertEquals('boom', message);
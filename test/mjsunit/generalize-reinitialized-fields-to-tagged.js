@@ -0,0 +1,50 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --generalize-reinitialized-fields-to-tagged
+
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+(function TestFirstChangeOfConstFieldDeprecates() {
+  function C(x) { this.x = x; }
+  let a = new C(1);
+  let b = new C(2);
+  // The field has never been overwritten, so Smi -> Double takes the regular
+  // path and deprecates the map of {a}.
+  b.x = 1.5;
+  assertFalse(%HaveSameMap(a, b));
+  assertEquals(1, a.x);
+  assertEquals(1.5, b.x);
+})();
+
+(function TestSmiFieldGoesToTaggedInPlace() {
+  let a = new Point(1, 2);
+  let b = new Point(3, 4);
+  // Overwriting the field with another Smi makes it mutable in-place.
+  b.x = 5;
+  assertTrue(%HaveSameMap(a, b));
+  // Smi -> Double would now deprecate the map of {a} a second time; instead
+  // the field is generalized to Tagged in-place and both objects keep
+  // sharing a map.
+  b.x = 1.5;
+  assertTrue(%HaveSameMap(a, b));
+  assertEquals(1, a.x);
+  assertEquals(1.5, b.x);
+  b.x = "string";
+  assertTrue(%HaveSameMap(a, b));
+  assertEquals("string", b.x);
+})();
+
+(function TestUninitializedFieldStillBecomesDouble() {
+  function D() { this.d = 0.5; }
+  let a = new D();
+  let b = new D();
+  b.d = 1;
+  assertTrue(%HaveSameMap(a, b));
+  assertEquals(0.5, a.d);
+  assertEquals(1, b.d);
+})();
@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-sharedarraybuffer
+
+// Ping-pong between the main thread and a worker, where each side publishes
+// with a plain store and then notifies. A notification that finds no waiters
+// without taking the futex lock must never miss a waiter that is about to
+// block, or one side waits for the full timeout.
+
+(function TestNoLostWakeups() {
+  const kRounds = 2000;
+  const kTimeoutMs = 10000;
+  const sab = new SharedArrayBuffer(8);
+  const i32a = new Int32Array(sab);
+
+  function workerCode() {
+    onmessage = function({data: msg}) {
+      const i32a = new Int32Array(msg.sab);
+      for (let i = 1; i <= msg.rounds; i++) {
+        while (Atomics.load(i32a, 0) !== i) {
+          if (Atomics.wait(i32a, 0, i - 1, msg.timeout) === 'timed-out') {
+            postMessage('timed-out in round ' + i);
+            return;
+          }
+        }
+        i32a[1] = i;
+        Atomics.notify(i32a, 1);
+      }
+      postMessage('done');
+    };
+  }
+
+  const worker = new Worker(workerCode, {type: 'function'});
+  worker.postMessage({sab: sab, rounds: kRounds, timeout: kTimeoutMs});
+
+  for (let i = 1; i <= kRounds; i++) {
+    i32a[0] = i;
+    Atomics.notify(i32a, 0);
+    while (Atomics.load(i32a, 1) !== i) {
+      assertNotEquals('timed-out', Atomics.wait(i32a, 1, i - 1, kTimeoutMs));
+    }
+  }
+  assertEquals('done', worker.getMessage());
+  worker.terminate();
+})();
@@ -0,0 +1,126 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition-reo-across-jumps --allow-natives-syntax
+
+// The register optimizer keeps register equivalences on the fall-through
+// path of conditional jumps and switches. Values that are written on one
+// path must still be visible at the join point.
+
+(function TestReloadAfterTest() {
+  function f(g) {
+    let x = g();
+    if (x) return x + 1;
+    return x;
+  }
+  assertEquals(2, f(() => 1));
+  assertEquals(0, f(() => 0));
+  assertEquals('a1', f(() => 'a'));
+})();
+
+(function TestWriteOnOnePath() {
+  function f(a, b) {
+    let x = a;
+    if (b) x = b;
+    return x;
+  }
+  assertEquals(1, f(1, 0));
+  assertEquals(2, f(1, 2));
+  assertEquals(undefined, f(undefined, null));
+})();
+
+(function TestLogicalOperators() {
+  function f(a, b, c) {
+    let x = a;
+    let y = x && b;
+    let z = y || c;
+    return [x, y, z];
+  }
+  assertEquals([1, 2, 2], f(1, 2, 3));
+  assertEquals([0, 0, 3], f(0, 2, 3));
+  assertEquals([1, 0, 3], f(1, 0, 3));
+})();
+
+(function TestNullishAndConditional() {
+  function f(a, b) {
+    let x = a ?? b;
+    let y = x ? a : b;
+    return [x, y];
+  }
+  assertEquals([1, 1], f(1, 2));
+  assertEquals([2, null], f(null, 2));
+  assertEquals([0, 2], f(0, 2));
+})();
+
+(function TestSwitch() {
+  function f(v) {
+    let x = v;
+    let result;
+    switch (x) {
+      case 1:
+        x = 10;
+      case 2:
+        result = x;
+        break;
+      case 3:
+        result = x + 30;
+        break;
+      default:
+        result = -x;
+    }
+    return [x, result];
+  }
+  assertEquals([10, 10], f(1));
+  assertEquals([2, 2], f(2));
+  assertEquals([3, 33], f(3));
+  assertEquals([4, -4], f(4));
+})();
+
+(function TestLoop() {
+  function f(n) {
+    let a = 0;
+    let b = 1;
+    for (let i = 0; i < n; i++) {
+      let t = a;
+      if (i % 2) continue;
+      a = b;
+      b = t + b;
+    }
+    return [a, b];
+  }
+  assertEquals([0, 1], f(0));
+  assertEquals([1, 1], f(1));
+  assertEquals([1, 2], f(3));
+  assertEquals([2, 3], f(5));
+})();
+
+(function TestTryCatch() {
+  function f(g) {
+    let x = 1;
+    try {
+      x = g();
+      if (x) throw x;
+    } catch (e) {
+      return [x, e];
+    }
+    return [x];
+  }
+  assertEquals([0], f(() => 0));
+  assertEquals([5, 5], f(() => 5));
+  assertEquals([1, 'e'], f(() => { throw 'e'; }));
+})();
+
+(function TestAcrossTiers() {
+  function f(a, b) {
+    let x = a;
+    if (x > b) x = b;
+    return x + a;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(2, f(1, 2));
+  assertEquals(5, f(3, 2));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2, f(1, 2));
+  assertEquals(5, f(3, 2));
+})();
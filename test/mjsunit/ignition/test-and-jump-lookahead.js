@@ -0,0 +1,44 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-opt --no-sparkplug --no-maglev
+
+// Exercise the JumpIfTrue/JumpIfFalse lookahead in the Test* handlers, on
+// both the taken and the fall-through path.
+
+function compare(a, b) {
+  let r = 0;
+  if (a == b) r |= 1;
+  if (a === b) r |= 2;
+  if (a < b) r |= 4;
+  if (a > b) r |= 8;
+  if (a <= b) r |= 16;
+  if (a >= b) r |= 32;
+  if (!(a === b)) r |= 64;
+  return r;
+}
+
+function test(o) {
+  let r = 0;
+  if (o == null) r |= 1;
+  if (o === undefined) r |= 2;
+  if (o === null) r |= 4;
+  if (typeof o === 'number') r |= 8;
+  if (typeof o !== 'object') r |= 16;
+  return r;
+}
+
+for (let i = 0; i < 3; i++) {
+  assertEquals(1 | 2 | 16 | 32, compare(1, 1));
+  assertEquals(4 | 16 | 64, compare(1, 2));
+  assertEquals(8 | 32 | 64, compare(2, 1));
+  assertEquals(1 | 16 | 32 | 64, compare(1, '1'));
+  assertEquals(64, compare(NaN, NaN));
+
+  assertEquals(1 | 2 | 16, test(undefined));
+  assertEquals(1 | 4, test(null));
+  assertEquals(8 | 16, test(1));
+  assertEquals(0, test({}));
+  assertEquals(16, test('x'));
+}
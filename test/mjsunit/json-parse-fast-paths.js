@@ -0,0 +1,33 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Numbers take a fast path unless they have too many significant digits or
+// a large exponent; both paths must agree with the number parser.
+const numbers = [
+  '0', '-0', '0.5', '-0.5', '1e3', '1E-3', '1.25e+2', '0.000123',
+  '123456789012345', '1234567890123456', '12345678901234567890',
+  '0.1', '0.2', '0.3', '1.7976931348623157e308', '5e-324', '1e22',
+  '1e23', '9007199254740993', '3.14159265358979', '1e-22', '1e-23',
+  '0e1000', '-0.0e-5', '100000000000000000000e-20'
+];
+for (const n of numbers) {
+  assertEquals(Number(n), JSON.parse(n), n);
+  assertEquals(Number(n), JSON.parse(`[${n}]`)[0], n);
+}
+assertEquals(-Infinity, 1 / JSON.parse('-0'));
+assertEquals(-Infinity, 1 / JSON.parse('-0.0e-5'));
+
+// Strings are scanned in word-sized chunks; terminators and escapes must be
+// found at every offset within a chunk.
+for (let i = 0; i < 20; i++) {
+  const prefix = 'a'.repeat(i);
+  assertEquals(prefix, JSON.parse(`"${prefix}"`));
+  assertEquals(prefix + '"b', JSON.parse(`"${prefix}\\"b"`));
+  assertEquals(prefix + '\\b', JSON.parse(`"${prefix}\\\\b"`));
+  assertEquals(prefix + 'éx', JSON.parse(`"${prefix}\\u00e9x"`));
+  assertThrows(() => JSON.parse(`"${prefix}\nb"`), SyntaxError);
+  assertThrows(() => JSON.parse(`"${prefix}\x1fb"`), SyntaxError);
+  assertThrows(() => JSON.parse(`"${prefix}`), SyntaxError);
+}
+assertEquals('\x7f\x80\xff', JSON.parse('"\x7f\x80\xff"'));
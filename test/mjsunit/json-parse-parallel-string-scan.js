@@ -0,0 +1,43 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --json-parse-parallel-string-scan
+// Flags: --json-parse-parallel-string-scan-threshold-kb=1
+
+function makeRecords(count, suffix) {
+  const records = [];
+  for (let i = 0; i < count; i++) {
+    records.push({
+      id: i,
+      name: 'name' + i + suffix,
+      quoted: 'say "hi" ' + i,
+      path: 'C:\\dir\\' + i,
+      lines: 'a\nb\tc' + i,
+      empty: '',
+      nested: {['key' + (i % 7) + suffix]: [String(i), 'x'.repeat(i % 50)]},
+    });
+  }
+  return records;
+}
+
+for (const suffix of ['', '\xe9', '\u2603', '\ud83d\ude00']) {
+  const records = makeRecords(2000, suffix);
+  const json = JSON.stringify(records);
+  assertEquals(records, JSON.parse(json));
+  // Same input with whitespace and as a slice of a larger string.
+  assertEquals(records, JSON.parse(JSON.stringify(records, null, 2)));
+  const sliced = ('[' + json + ']').slice(1, -1);
+  assertEquals(records, JSON.parse(sliced));
+}
+
+// Errors are still reported, also after strings the pre-pass indexed.
+const big = JSON.stringify(makeRecords(500, ''));
+assertThrows(() => JSON.parse(big + 'x'), SyntaxError);
+assertThrows(() => JSON.parse(big.slice(0, -100)), SyntaxError);
+assertThrows(() => JSON.parse(big.replace('name77', 'name\x0177')),
+             SyntaxError);
+assertThrows(() => JSON.parse(big.replace('"name77"', '"name77')),
+             SyntaxError);
+assertThrows(() => JSON.parse('"' + 'a'.repeat(5000)), SyntaxError);
+assertEquals('a'.repeat(5000), JSON.parse('"' + 'a'.repeat(5000) + '"'));
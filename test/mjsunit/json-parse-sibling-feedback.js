@@ -0,0 +1,26 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Objects that are property values of the same object share their map with
+// the previous sibling, just like array elements do.
+const records = JSON.parse(
+    '{"a": {"x": 1, "y": "s"}, "b": {"x": 2, "y": "t"},' +
+    ' "0": {"x": 3, "y": "u"}}');
+assertTrue(%HaveSameMap(records.a, records.b));
+assertTrue(%HaveSameMap(records.a, records[0]));
+assertEquals({x: 3, y: 'u'}, records[0]);
+
+// Siblings with different or generalized shapes still parse correctly.
+const mixed = JSON.parse(
+    '{"a": {"x": 1}, "b": {"x": 1.5}, "c": {"y": 1}, "d": {"x": "s", "y": 2}}');
+assertEquals({x: 1}, mixed.a);
+assertEquals({x: 1.5}, mixed.b);
+assertEquals({y: 1}, mixed.c);
+assertEquals({x: 's', y: 2}, mixed.d);
+assertFalse(%HaveSameMap(mixed.b, mixed.c));
+
+// A non-object sibling provides no feedback.
+assertEquals({a: 1, b: {x: 1}}, JSON.parse('{"a": 1, "b": {"x": 1}}'));
@@ -0,0 +1,74 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Objects of the same map reuse the escaped keys of the first one.
+const records = [];
+for (let i = 0; i < 10; i++) {
+  records.push({'plain': i, 'q"uote': 'a', 'back\\slash': null,
+                'ctrl\n\x01': true, 'caf\xe9': [i], '☃': {}});
+}
+const expected = '{"plain":0,"q\\"uote":"a","back\\\\slash":null,' +
+    '"ctrl\\n\\u0001":true,"caf\xe9":[0],"☃":{}}';
+assertEquals(expected, JSON.stringify(records[0]));
+assertEquals('[' + records.map(r => JSON.stringify(r)).join(',') + ']',
+             JSON.stringify(records));
+assertEquals('{\n  "plain": 1,\n  "q\\"uote": "a",\n  "back\\\\slash": null,' +
+                 '\n  "ctrl\\n\\u0001": true,\n  "caf\xe9": [\n    1\n  ],' +
+                 '\n  "☃": {}\n}',
+             JSON.stringify(records[1], null, 2));
+
+// Keys of properties that serialize to undefined are dropped, also for the
+// objects that hit the cached plan.
+const sparse = [{a: 1, b: undefined, c: 2}, {a: 3, b: () => 0, c: 4},
+                {a: 5, b: Symbol(), c: 6}];
+assertEquals('[{"a":1,"c":2},{"a":3,"c":4},{"a":5,"c":6}]',
+             JSON.stringify(sparse));
+
+// Non-enumerable properties and accessors.
+const proto = {};
+const withAccessor = [];
+for (let i = 0; i < 3; i++) {
+  const o = {x: i};
+  Object.defineProperty(o, 'hidden', {value: 1, enumerable: false});
+  Object.defineProperty(o, 'y', {get() { return i * 2; }, enumerable: true});
+  withAccessor.push(o);
+}
+assertEquals('[{"x":0,"y":0},{"x":1,"y":2},{"x":2,"y":4}]',
+             JSON.stringify(withAccessor));
+
+// More shapes than the plan cache holds, interleaved and nested.
+const shapes = [];
+for (let i = 0; i < 20; i++) {
+  const o = {};
+  o['k' + i] = {inner: i};
+  shapes.push(o);
+}
+const all = shapes.concat(shapes);
+assertEquals('[' + all.map(o => {
+  const k = Object.keys(o)[0];
+  return `{"${k}":{"inner":${o[k].inner}}}`;
+}).join(',') + ']', JSON.stringify(all));
+
+// toJSON and replacer functions see the original keys.
+const seen = [];
+const withToJSON = [{a: {toJSON(k) { seen.push(k); return 1; }}},
+                    {a: {toJSON(k) { seen.push(k); return 2; }}}];
+assertEquals('[{"a":1},{"a":2}]', JSON.stringify(withToJSON));
+assertEquals(['a', 'a'], seen);
+assertEquals('[{"a":"a"},{"a":"a"}]',
+             JSON.stringify([{a: 1}, {a: 2}],
+                            (k, v) => typeof v === 'number' ? k : v));
+
+// Caching the plan of a map must not disturb any other value, in particular
+// the undefined used to initialize the cache.
+for (let i = 0; i < 10; i++) {
+  const o = {};
+  o['p' + i] = i;
+  JSON.stringify([o, o]);
+}
+assertEquals('undefined', typeof undefined);
+assertSame(void 0, undefined);
+assertEquals(undefined, JSON.stringify(undefined));
+assertEquals('{"a":1}', JSON.stringify({a: 1, b: undefined}));
+assertEquals('[null]', JSON.stringify([undefined]));
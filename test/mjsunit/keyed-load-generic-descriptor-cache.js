@@ -0,0 +1,41 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Generic keyed loads of own fast properties on maps with many descriptors
+// go through the descriptor lookup cache. Check hits, misses (absent keys)
+// and maps that share a descriptor array but own fewer descriptors.
+
+function makeObject(n, salt) {
+  const o = {};
+  for (let i = 0; i < n; i++) o['p' + i] = i + salt;
+  return o;
+}
+
+function get(o, key) {
+  return o[key];
+}
+
+(function() {
+  const objects = [];
+  for (let n = 1; n < 40; n++) objects.push(makeObject(n, n * 100));
+  for (let round = 0; round < 3; round++) {
+    for (const o of objects) {
+      const n = Object.keys(o).length;
+      for (let i = 0; i <= n + 1; i++) {
+        const expected = i < n ? i + n * 100 : undefined;
+        assertEquals(expected, get(o, 'p' + i));
+      }
+      assertEquals(undefined, get(o, 'missing'));
+    }
+  }
+})();
+
+// A property added after the lookup was cached must be found on the new map.
+(function() {
+  const o = makeObject(20, 0);
+  assertEquals(undefined, get(o, 'late'));
+  o.late = 42;
+  assertEquals(42, get(o, 'late'));
+  assertEquals(19, get(o, 'p19'));
+})();
@@ -0,0 +1,43 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev
+
+function f(o, c) {
+  let x = o.a;
+  if (c) {
+    x = x + o.b;
+  } else {
+    x = x + o.a;
+  }
+  // The map of {o} is known on both paths into the merge.
+  return x + o.b;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(4, f({a: 1, b: 2}, true));
+assertEquals(4, f({a: 1, b: 2}, false));
+
+%OptimizeMaglevOnNextCall(f);
+assertEquals(4, f({a: 1, b: 2}, true));
+assertEquals(4, f({a: 1, b: 2}, false));
+
+// A call in between may change the map, so the second access still needs
+// its own check.
+function g(o, h) {
+  let x = o.a;
+  h(o);
+  return x + o.a;
+}
+
+function noop(o) {}
+function change(o) { delete o.a; o.a = 10; }
+
+%PrepareFunctionForOptimization(g);
+assertEquals(2, g({a: 1}, noop));
+assertEquals(2, g({a: 1}, noop));
+
+%OptimizeMaglevOnNextCall(g);
+assertEquals(2, g({a: 1}, noop));
+assertEquals(11, g({a: 1}, change));
@@ -0,0 +1,30 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Runs of microtasks from the same native context keep that context entered;
+// check that every microtask still observes its own context.
+
+const log = [];
+const realm = Realm.create();
+const remote = Realm.eval(realm,
+    '(log) => (tag) => () => log.push(tag + Realm.current())')(log);
+const local = (tag) => () => log.push(tag + Realm.current());
+
+const resolved = Promise.resolve();
+resolved.then(local('a'));
+resolved.then(local('a'));
+resolved.then(remote('b'));
+resolved.then(remote('b'));
+%EnqueueMicrotask(local('c'));
+resolved.then(remote('b'));
+resolved.then(local('a')).then(remote('b')).then(local('a'));
+%EnqueueMicrotask(remote('d'));
+resolved.then(() => { throw new Error('ignored'); }).catch(local('e'));
+
+%PerformMicrotaskCheckpoint();
+assertEquals(['a0', 'a0', 'b1', 'b1', 'c0', 'b1', 'a0', 'd1', 'b1', 'e0',
+              'a0'], log);
+assertEquals(0, Realm.current());
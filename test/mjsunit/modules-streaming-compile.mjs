@@ -0,0 +1,22 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --streaming-compile
+
+// Sibling dependencies are compiled in parallel in the background; shared and
+// cyclic dependencies must still be linked to a single module instance.
+import * as m1 from "modules-skip-1.mjs";
+import * as m2 from "modules-skip-2.mjs";
+import {foo} from "modules-cycle.mjs";
+
+assertEquals(42, m1.default);
+assertEquals(42, m2.default);
+assertEquals(1, m2.b);
+assertEquals(1, m2.c);
+assertEquals(999, m2.zzz);
+assertEquals(1, foo);
+
+m1.set_a(2);
+assertEquals(2, m2.b);
+assertEquals(2, foo);
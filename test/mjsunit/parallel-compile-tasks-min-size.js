@@ -0,0 +1,31 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks-for-lazy --parallel-compile-tasks-for-lazy-min-size=64 --use-external-strings
+
+// Small lazy functions are compiled on demand, larger ones in parallel tasks;
+// both must behave the same.
+function small(a) { return a + 1; }
+
+function large(a, b) {
+  let sum = 0;
+  for (let i = 0; i < a; i++) {
+    sum += b * i;
+  }
+  return sum;
+}
+
+function outer() {
+  function inner_small() { return 1; }
+  function inner_large(x) {
+    let result = [];
+    for (let i = 0; i < x; i++) result.push(i * inner_small());
+    return result.length;
+  }
+  return inner_large(3);
+}
+
+assertEquals(2, small(1));
+assertEquals(6, large(3, 2));
+assertEquals(3, outer());
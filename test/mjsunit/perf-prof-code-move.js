@@ -0,0 +1,22 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --perf-prof --perf-prof-delete-file --compact-code-space
+// Flags: --stress-compaction --allow-natives-syntax --expose-gc
+
+// Code that was logged to the jitdump file may be moved by compaction, which
+// writes move records instead of requiring compaction to be disabled.
+
+function add(a, b) {
+  return a + b;
+}
+
+%PrepareFunctionForOptimization(add);
+assertEquals(3, add(1, 2));
+%OptimizeFunctionOnNextCall(add);
+assertEquals(7, add(3, 4));
+
+for (let i = 0; i < 3; i++) gc();
+
+assertEquals(11, add(5, 6));
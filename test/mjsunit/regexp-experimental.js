@@ -96,3 +96,15 @@ Test(/x$/m, "x\na", ["x"], 0);
 
 // The dotall flag.
 Test(/asdf.xyz/s,  "asdf\nxyz", ["asdf\nxyz"], 0);
+
+// Skipping input that cannot begin a match.
+Test(/[xy]z/, "aaaaaaaaaaxaaaaaaaaaayz", ["yz"], 0);
+Test(/(?:ab)+c/, "ababababxababc", ["ababc"], 0);
+Test(/a+b/, "xxaaaxaabxx", ["aab"], 0);
+Test(/ሴb/, "ሳስሴሴb", ["ሴb"], 0);
+Test(/ab/, "xxxxxxxxxxxxxxxxxxa", null, 0);
+Test(/x\bab/, "xab", null, 0);
+var r = /ab/g;
+Test(r, "xxabxxxxab", ["ab"], 4);
+Test(r, "xxabxxxxab", ["ab"], 10);
+Test(r, "xxabxxxxab", null, 0);
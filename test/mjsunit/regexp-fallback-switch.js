@@ -0,0 +1,27 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+// Flags: --no-enable-experimental-regexp-engine
+// Flags: --enable-experimental-regexp-engine-on-excessive-backtracks
+// Flags: --experimental-regexp-engine-after-fallback
+
+// Once a regexp falls back to the experimental engine, it stays there.
+function makeRegExp() {
+  return new RegExp("a+".repeat(100) + "x");
+}
+let regexp = makeRegExp();
+let match = "a".repeat(100) + "x";
+let subject = match.repeat(3);
+assertEquals("IRREGEXP", %RegexpTypeTag(regexp));
+assertArrayEquals([match], regexp.exec(subject));
+assertEquals("EXPERIMENTAL", %RegexpTypeTag(regexp));
+assertArrayEquals([match], regexp.exec(subject));
+assertNull(regexp.exec("a".repeat(200)));
+
+// Regexps created from the same source afterwards start on the experimental
+// engine.
+let other = makeRegExp();
+assertEquals("EXPERIMENTAL", %RegexpTypeTag(other));
+assertArrayEquals([match], other.exec(subject));
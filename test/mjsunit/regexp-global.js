@@ -252,3 +252,19 @@ var replacement = "\x80";
 var result = subject.replace(/~/g, replacement);
 for (var i = 0; i < 5; i++) result += result;
 new RegExp(result);
+
+// Global atom and capture matches spanning several batches of results.
+var subject = "ab-".repeat(200);
+var matches = subject.match(/ab/g);
+assertEquals(200, matches.length);
+assertEquals("ab", matches[199]);
+assertEquals("ab".repeat(200), subject.replace(/-/g, ""));
+var count = 0;
+assertEquals("x-".repeat(200), subject.replace(/ab/g, function(m, index) {
+  assertEquals(count++ * 3, index);
+  return "x";
+}));
+assertEquals("ab=ab-".repeat(200), subject.replace(/(ab)/g, function(m, c) {
+  assertEquals(m, c);
+  return m + "=" + c;
+}));
@@ -0,0 +1,21 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-shared-bytecode-cache --regexp-interpret-all
+// Flags: --no-compilation-cache
+
+// Without the per-isolate compilation cache, every regexp below is compiled
+// separately, and all but the first one reuse the shared bytecode.
+function test() {
+  assertEquals(["abc", "b"], /a(b)c/.exec("xxabcxx"));
+  assertEquals(["ABC", "B"], /a(b)c/i.exec("xxABCxx"));
+  assertEquals("a-b-c", "a b c".replace(/ /g, "-"));
+  assertNull(/^b/.exec("abc"));
+  assertEquals("b", /(?<x>b)/.exec("abc").groups.x);
+}
+for (let i = 0; i < 3; i++) test();
+// Two-byte subjects use different bytecode.
+for (let i = 0; i < 3; i++) {
+  assertEquals(["aሴc", "ሴ"], /a(.)c/.exec("xaሴcx"));
+}
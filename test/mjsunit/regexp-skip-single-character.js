@@ -0,0 +1,23 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up-ticks=0
+
+// Boyer-Moore lookahead skipping for a single character, at positions on
+// either side of the 16-character boundaries of the vectorized scan.
+for (let prefix = 0; prefix < 40; prefix++) {
+  const filler = '.'.repeat(prefix);
+  assertEquals(prefix, (filler + 'xyzab').search(/[xy]yzab/));
+  assertEquals(-1, (filler + 'xyza').search(/[xy]yzab/));
+  assertEquals(prefix, (filler + 'foo|bar').search(/(foo|baz)\|bar/));
+  // Characters that only differ from the one searched for in the top bit.
+  const high = '\xe1'.repeat(prefix);
+  assertEquals(prefix, (high + 'abcd').search(/[ab]bcd/));
+  assertEquals(-1, (high + '\xe2\xe3\xe4').search(/[ab]bcd/));
+  assertEquals(prefix, (high + '\xe1bcd').search(/[\xe1b]bcd/));
+}
+
+// Matches close to the end of the subject.
+assertEquals(['zzzzab'], 'z'.repeat(100).concat('ab').match(/[yz]zzzab/));
+assertNull('z'.repeat(100).concat('a').match(/[yz]zzzab/));
@@ -0,0 +1,15 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-stack-size-limit=64
+
+// Every iteration of the loop leaves a backtrack entry on the stack, which
+// would need far more than the 64 KB we allow.
+const subject = 'x'.repeat(100000);
+assertThrows(() => /(?:x|xy)*z/.exec(subject), RangeError);
+
+// Regexps with shallow backtracking are unaffected, also after the stack
+// overflow above.
+assertEquals(['xxxz'], /(?:x|xy)*z/.exec('xxxz'));
+assertEquals(['aaab', 'a'], /(a)*b/.exec('aaab'));
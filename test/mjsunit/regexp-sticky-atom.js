@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Sticky, non-global atoms only compare the pattern at lastIndex.
+function Test(re) {
+  assertEquals("ATOM", %RegexpTypeTag(re));
+  const subject = "if(x)if";
+  re.lastIndex = 0;
+  assertEquals(["if"], re.exec(subject));
+  assertEquals(2, re.lastIndex);
+  assertNull(re.exec(subject));
+  assertEquals(0, re.lastIndex);
+  re.lastIndex = 5;
+  assertTrue(re.test(subject));
+  assertEquals(7, re.lastIndex);
+  assertFalse(re.test(subject));
+  re.lastIndex = 6;
+  assertFalse(re.test(subject));
+  re.lastIndex = 1;
+  assertEquals(-1, "(x)if".search(re));
+  assertEquals(1, re.lastIndex);
+  assertEquals(0, "ifif".search(re));
+  re.lastIndex = 0;
+  assertEquals("xif", "ifif".replace(re, "x"));
+  re.lastIndex = 2;
+  assertEquals("ifx", "ifif".replace(re, () => "x"));
+  re.lastIndex = 0;
+  assertEquals("iif", "iif".replace(re, "x"));
+  assertEquals(["", "(x)", ""], "if(x)if".split(re));
+}
+Test(/if/y);
+Test(new RegExp("if", "y"));
+// Few different characters would otherwise choose irregexp.
+const re = /aaaaaaaa/y;
+assertEquals("ATOM", %RegexpTypeTag(re));
+re.lastIndex = 1;
+assertNull(re.exec("aaaaaaaa"));
+assertEquals(["aaaaaaaa"], re.exec("aaaaaaaaa".substring(1)));
+// Two-byte subjects and patterns.
+const two_byte = /ሴb/y;
+two_byte.lastIndex = 1;
+assertEquals(["ሴb"], two_byte.exec("aሴb"));
+assertNull(two_byte.exec("aሴb"));
+// Sticky and global regexps are not atoms.
+assertNotEquals("ATOM", %RegexpTypeTag(/if/gy));
+assertEquals(["if", "if"], "ifif(x)if".match(/if/gy));
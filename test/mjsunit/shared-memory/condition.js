@@ -0,0 +1,27 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --harmony-struct
+
+"use strict";
+
+let mutex = new Atomics.Mutex;
+let cv = new Atomics.Condition;
+
+// Nobody is waiting.
+assertEquals(0, Atomics.Condition.notify(cv));
+assertEquals(0, Atomics.Condition.notify(cv, 1));
+
+// Waiting requires the mutex to be locked.
+assertThrows(() => { Atomics.Condition.wait(cv, mutex); }, TypeError);
+
+// A timed out wait returns false and reacquires the mutex.
+Atomics.Mutex.lock(mutex, () => {
+  assertFalse(Atomics.Condition.wait(cv, mutex, 1));
+  assertFalse(Atomics.Mutex.tryLock(mutex, () => {}));
+});
+assertTrue(Atomics.Mutex.tryLock(mutex, () => {}));
+
+assertThrows(() => { Atomics.Condition.wait(mutex, mutex); }, TypeError);
+assertThrows(() => { Atomics.Condition.notify(mutex); }, TypeError);
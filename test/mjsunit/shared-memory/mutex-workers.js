@@ -0,0 +1,54 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --harmony-struct
+
+"use strict";
+
+if (this.Worker) {
+
+(function TestMutexWorkers() {
+  let workerScript =
+      `onmessage = function(msg) {
+         for (let i = 0; i < 100; i++) {
+           Atomics.Mutex.lock(msg.mutex, () => {
+             msg.box.counter = msg.box.counter + 1;
+           });
+         }
+         Atomics.Mutex.lock(msg.mutex, () => {
+           msg.box.done = msg.box.done + 1;
+           Atomics.Condition.notify(msg.cv);
+         });
+       };
+       postMessage("started");`;
+
+  let Box = new SharedStructType(['counter', 'done']);
+  let Message = new SharedStructType(['mutex', 'cv', 'box']);
+  let msg = new Message();
+  msg.mutex = new Atomics.Mutex;
+  msg.cv = new Atomics.Condition;
+  msg.box = new Box();
+  msg.box.counter = 0;
+  msg.box.done = 0;
+
+  const kNumWorkers = 4;
+  let workers = [];
+  for (let i = 0; i < kNumWorkers; i++) {
+    let worker = new Worker(workerScript, { type: 'string' });
+    assertEquals("started", worker.getMessage());
+    workers.push(worker);
+  }
+  for (let worker of workers) worker.postMessage(msg);
+
+  Atomics.Mutex.lock(msg.mutex, () => {
+    while (msg.box.done < kNumWorkers) {
+      Atomics.Condition.wait(msg.cv, msg.mutex);
+    }
+    assertEquals(kNumWorkers * 100, msg.box.counter);
+  });
+
+  for (let worker of workers) worker.terminate();
+})();
+
+}
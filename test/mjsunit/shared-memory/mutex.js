@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --harmony-struct
+
+"use strict";
+
+let mutex = new Atomics.Mutex;
+let locked_count = 0;
+
+assertEquals(42, Atomics.Mutex.lock(mutex, () => {
+  locked_count++;
+  return 42;
+}));
+assertEquals(locked_count, 1);
+
+// tryLock returns whether the callback ran.
+assertTrue(Atomics.Mutex.tryLock(mutex, () => {
+  locked_count++;
+}));
+assertEquals(locked_count, 2);
+
+// The mutex is not recursive, so tryLock fails while it is held.
+Atomics.Mutex.lock(mutex, () => {
+  assertFalse(Atomics.Mutex.tryLock(mutex, () => {
+    locked_count++;
+  }));
+});
+assertEquals(locked_count, 2);
+
+// The mutex is released when the callback throws.
+assertThrows(() => {
+  Atomics.Mutex.lock(mutex, () => { throw new Error(); });
+});
+assertTrue(Atomics.Mutex.tryLock(mutex, () => {}));
+
+// Mutexes are shared objects.
+let S = new SharedStructType(['field']);
+let s = new S();
+s.field = mutex;
+assertEquals(s.field, mutex);
+
+assertThrows(() => { Atomics.Mutex.lock({}, () => {}); }, TypeError);
+assertThrows(() => { Atomics.Mutex.lock(mutex, 42); }, TypeError);
+assertThrows(() => { Atomics.Mutex.tryLock(new Atomics.Condition, () => {}); },
+             TypeError);
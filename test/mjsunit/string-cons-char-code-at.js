@@ -0,0 +1,55 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --lazy-cons-string-flattening
+
+// Reading characters of large cons strings that are still being built must
+// give the same results whether or not the string gets flattened.
+
+(function TestAppendLoop() {
+  const chunk = 'abcdefghijklmnopqrstuvwxyz'.repeat(100);
+  let s = '';
+  for (let i = 0; i < 100; i++) {
+    s += chunk + String.fromCharCode(0x41 + (i % 26));
+    const last = s.length - 1;
+    assertEquals(0x41 + (i % 26), s.charCodeAt(last));
+    assertEquals('a'.charCodeAt(0), s.charCodeAt(0));
+    assertEquals(0x61, s.charCodeAt(last - chunk.length));
+    assertEquals(0x7a, s.charCodeAt(last - 1));
+    assertEquals(String.fromCharCode(0x41 + (i % 26)), s[last]);
+    assertEquals(NaN, s.charCodeAt(s.length));
+  }
+})();
+
+(function TestPrependLoop() {
+  const chunk = 'αβγ'.repeat(1000);
+  let s = '';
+  for (let i = 0; i < 80; i++) {
+    s = String.fromCharCode(0x30 + (i % 10)) + chunk + s;
+    assertEquals(0x30 + (i % 10), s.charCodeAt(0));
+    assertEquals(0x03b1, s.charCodeAt(1));
+    assertEquals(0x03b3, s.charCodeAt(s.length - 1));
+    assertEquals(s.codePointAt(2), 0x03b2);
+  }
+})();
+
+(function TestBalanced() {
+  let parts = [];
+  for (let i = 0; i < 256; i++) {
+    parts.push(String.fromCharCode(0x61 + i % 26).repeat(1000));
+  }
+  while (parts.length > 1) {
+    const next = [];
+    for (let i = 0; i < parts.length; i += 2) {
+      next.push(parts[i] + parts[i + 1]);
+    }
+    parts = next;
+  }
+  const s = parts[0];
+  for (let i = 0; i < 256; i++) {
+    assertEquals(0x61 + i % 26, s.charCodeAt(i * 1000 + 500));
+  }
+  assertEquals('a', s.charAt(0));
+  assertEquals('v', s.at(-1));
+})();
@@ -0,0 +1,45 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns are searched by matching their first and last character a
+// word at a time. Check that matches are found at every offset and that
+// near-misses are rejected, for one- and two-byte subjects.
+
+function naiveIndexOf(subject, pattern, start) {
+  for (let i = start; i + pattern.length <= subject.length; i++) {
+    if (subject.substring(i, i + pattern.length) === pattern) return i;
+  }
+  return -1;
+}
+
+function check(subject, pattern) {
+  for (let start = 0; start <= subject.length; start++) {
+    assertEquals(naiveIndexOf(subject, pattern, start),
+                 subject.indexOf(pattern, start));
+  }
+  assertEquals(naiveIndexOf(subject, pattern, 0) !== -1,
+               subject.includes(pattern));
+}
+
+const fillers = ['x', '\u1234'];
+const patterns = ['ab', 'aab', 'abab', 'a\u1234b', 'ab\u0100ba', 'abcdefghij'];
+for (const filler of fillers) {
+  for (const pattern of patterns) {
+    for (let offset = 0; offset < 20; offset++) {
+      // Near-misses with the right first and last character.
+      const near = pattern[0] + 'x'.repeat(pattern.length - 2) +
+          pattern[pattern.length - 1];
+      let subject = filler.repeat(offset) + near + filler.repeat(3) + pattern +
+          filler.repeat(offset % 5);
+      check(subject, pattern);
+      check(subject.substring(0, subject.length - 1), pattern);
+    }
+  }
+}
+
+// Used by split and replaceAll as well.
+const text = 'one, two, three, four, five, six, seven, eight, nine, ten';
+assertEquals(text.split(', ').length, 10);
+assertEquals(text.replaceAll(', ', '|').split('|').length, 10);
+assertEquals('\u1234ab\u1234ab'.split('ab'), ['\u1234', '\u1234', '']);
@@ -0,0 +1,51 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+// Flags: --harmony-temporal
+
+// Temporal.PlainDate.compare with Temporal.PlainDate arguments, which are
+// compared by their internal ISO fields without conversion.
+
+let d1 = new Temporal.PlainDate(2021, 3, 14);
+let d2 = new Temporal.PlainDate(2021, 3, 15);
+let d3 = new Temporal.PlainDate(2021, 4, 1);
+let d4 = new Temporal.PlainDate(2022, 1, 1);
+let d5 = new Temporal.PlainDate(-1000, 12, 31);
+let d6 = new Temporal.PlainDate(10000, 1, 1);
+
+assertEquals(0, Temporal.PlainDate.compare(d1, d1));
+assertEquals(0, Temporal.PlainDate.compare(
+    d1, new Temporal.PlainDate(2021, 3, 14)));
+
+// Day, month and year each decide the result when the more significant fields
+// are equal.
+assertEquals(-1, Temporal.PlainDate.compare(d1, d2));
+assertEquals(1, Temporal.PlainDate.compare(d2, d1));
+assertEquals(-1, Temporal.PlainDate.compare(d2, d3));
+assertEquals(1, Temporal.PlainDate.compare(d3, d2));
+assertEquals(-1, Temporal.PlainDate.compare(d3, d4));
+assertEquals(1, Temporal.PlainDate.compare(d4, d3));
+
+// Years outside of the four digit range.
+assertEquals(-1, Temporal.PlainDate.compare(d5, d1));
+assertEquals(1, Temporal.PlainDate.compare(d6, d1));
+assertEquals(-1, Temporal.PlainDate.compare(d5, d6));
+
+// Sorting uses the result as is.
+assertEquals([d5, d1, d2, d3, d4, d6],
+    [d4, d6, d2, d5, d3, d1].sort(Temporal.PlainDate.compare));
+
+// The internal slots are read directly, not the observable getters.
+let getters = ['year', 'month', 'monthCode', 'day', 'calendar'];
+let saved = {};
+for (let name of getters) {
+  saved[name] = Object.getOwnPropertyDescriptor(
+      Temporal.PlainDate.prototype, name);
+  Object.defineProperty(Temporal.PlainDate.prototype, name, {
+    get() { throw new Error('unexpected call to ' + name); }
+  });
+}
+assertEquals(-1, Temporal.PlainDate.compare(d1, d2));
+for (let name of getters) {
+  Object.defineProperty(Temporal.PlainDate.prototype, name, saved[name]);
+}
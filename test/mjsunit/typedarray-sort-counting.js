@@ -0,0 +1,38 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long 8- and 16-bit integer typed arrays are sorted with a counting sort.
+// Compare against sorting through a comparator, which takes the generic path.
+(function() {
+  let seed = 42;
+  function random() {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed;
+  }
+  const types = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array,
+                 Uint16Array];
+  for (const type of types) {
+    for (const length of [2, 255, 256, 1000, 65535, 65536, 100000]) {
+      const array = new type(length);
+      for (let i = 0; i < length; i++) array[i] = random();
+      const expected = array.slice().sort((a, b) => a - b);
+      array.sort();
+      for (let i = 0; i < length; i++) {
+        if (array[i] !== expected[i]) {
+          assertEquals(expected[i], array[i], type.name + '[' + i + ']');
+        }
+      }
+    }
+  }
+})();
+
+(function() {
+  const shared = new Int16Array(new SharedArrayBuffer(2 * 70000));
+  for (let i = 0; i < shared.length; i++) shared[i] = 499 - (i % 1000);
+  shared.sort();
+  assertEquals(-500, shared[0]);
+  assertEquals(-500, shared[69]);
+  assertEquals(-499, shared[70]);
+  assertEquals(499, shared[shared.length - 1]);
+})();
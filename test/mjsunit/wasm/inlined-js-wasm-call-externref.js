@@ -0,0 +1,52 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-inline-js-wasm-calls
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+let deopt = false;
+function maybeDeopt() {
+  if (deopt) %DeoptimizeFunction(callIdentity);
+}
+
+const builder = new WasmModuleBuilder();
+const deopt_index = builder.addImport('m', 'deopt', kSig_v_v);
+builder.addFunction('identity', kSig_r_r)
+    .addBody([kExprCallFunction, deopt_index, kExprLocalGet, 0])
+    .exportFunc();
+builder.addFunction('select', makeSig([kWasmI32, kWasmExternRef,
+                                       kWasmExternRef], [kWasmExternRef]))
+    .addBody([
+      kExprLocalGet, 1, kExprLocalGet, 2, kExprLocalGet, 0,
+      kExprSelectWithType, 1, kExternRefCode
+    ])
+    .exportFunc();
+const instance = builder.instantiate({m: {deopt: maybeDeopt}});
+
+function callIdentity(x) {
+  return instance.exports.identity(x);
+}
+
+function callSelect(c, a, b) {
+  return instance.exports.select(c, a, b);
+}
+
+const obj = {};
+%PrepareFunctionForOptimization(callIdentity);
+%PrepareFunctionForOptimization(callSelect);
+assertSame(obj, callIdentity(obj));
+assertEquals('a', callSelect(1, 'a', 'b'));
+%OptimizeFunctionOnNextCall(callIdentity);
+%OptimizeFunctionOnNextCall(callSelect);
+assertSame(obj, callIdentity(obj));
+assertSame(null, callIdentity(null));
+assertSame(undefined, callIdentity(undefined));
+assertEquals('a', callSelect(1, 'a', 'b'));
+assertEquals('b', callSelect(0, 'a', 'b'));
+assertSame(obj, callSelect(0, 1.5, obj));
+
+// The result of the Wasm call is materialized on lazy deoptimization.
+deopt = true;
+assertSame(obj, callIdentity(obj));
@@ -0,0 +1,33 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-d8-web-snapshot-api --allow-natives-syntax
+// Flags: --concurrent-web-snapshot-strings
+
+'use strict';
+
+d8.file.execute('test/mjsunit/web-snapshot/web-snapshot-helpers.js');
+
+(function TestLargeStringTable() {
+  function createObjects() {
+    // Strings referenced more than once go into the string table; make it
+    // large enough to be decoded concurrently, and mix in non-ASCII strings.
+    const strings = [];
+    for (let i = 0; i < 2000; ++i) {
+      const suffix = i % 3 == 0 ? 'é中' : 'abc';
+      strings.push(`string${i}`.padEnd(64, '-') + suffix);
+    }
+    globalThis.foo = strings;
+    globalThis.bar = strings.slice();
+  }
+  const { foo, bar } = takeAndUseWebSnapshot(createObjects, ['foo', 'bar']);
+  assertEquals(2000, foo.length);
+  assertEquals(2000, bar.length);
+  for (let i = 0; i < 2000; ++i) {
+    const suffix = i % 3 == 0 ? 'é中' : 'abc';
+    const expected = `string${i}`.padEnd(64, '-') + suffix;
+    assertEquals(expected, foo[i]);
+    assertEquals(expected, bar[i]);
+  }
+})();
@@ -0,0 +1,53 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-d8-web-snapshot-api --allow-natives-syntax
+
+'use strict';
+
+d8.file.execute('test/mjsunit/web-snapshot/web-snapshot-helpers.js');
+
+(function TestArrayOfRecords() {
+  function createObjects() {
+    const shared = 'shared';
+    const records = [];
+    for (let i = 0; i < 10; ++i) {
+      records.push({
+        smi: i,
+        double: i + 0.5,
+        string: shared,
+        mixed: i % 2 ? 'odd' : i,
+        object: {inner: i},
+      });
+    }
+    records[3].self = records[4];
+    globalThis.foo = records;
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertEquals(10, foo.length);
+  for (let i = 0; i < 10; ++i) {
+    const record = foo[i];
+    assertEquals(i, record.smi);
+    assertEquals(i + 0.5, record.double);
+    assertEquals('shared', record.string);
+    assertEquals(i % 2 ? 'odd' : i, record.mixed);
+    assertEquals(i, record.object.inner);
+  }
+  assertSame(foo[4], foo[3].self);
+  assertTrue(%HaveSameMap(foo[0], foo[9]));
+})();
+
+(function TestRunReferencingItself() {
+  function createObjects() {
+    const a = {next: null};
+    const b = {next: a};
+    const c = {next: b};
+    a.next = c;
+    globalThis.foo = [a, b, c];
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertSame(foo[2], foo[0].next);
+  assertSame(foo[0], foo[1].next);
+  assertSame(foo[1], foo[2].next);
+})();
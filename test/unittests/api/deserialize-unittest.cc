@@ -10,6 +10,8 @@
 #include "include/v8-platform.h"
 #include "include/v8-primitive.h"
 #include "include/v8-script.h"
+#include "src/execution/isolate.h"
+#include "src/logging/counters.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -19,9 +21,10 @@ class DeserializeTest : public TestWithPlatform {
  public:
   class IsolateAndContextScope {
    public:
-    explicit IsolateAndContextScope(DeserializeTest* test)
+    explicit IsolateAndContextScope(DeserializeTest* test,
+                                    CountersMode counters_mode = kNoCounters)
         : test_(test),
-          isolate_wrapper_(kNoCounters),
+          isolate_wrapper_(counters_mode),
           isolate_scope_(isolate_wrapper_.isolate()),
           handle_scope_(isolate_wrapper_.isolate()),
           context_(Context::New(isolate_wrapper_.isolate())),
@@ -58,6 +61,15 @@ class DeserializeTest : public TestWithPlatform {
         .ToLocalChecked();
   }
 
+  int DeserializeSkippedCount() {
+    internal::StatsCounter* counter =
+        reinterpret_cast<internal::Isolate*>(isolate())
+            ->counters()
+            ->deserialize_skipped();
+    CHECK(counter->Enabled());
+    return *counter->GetInternalPointer();
+  }
+
   Isolate* isolate() { return isolate_; }
   v8::Local<v8::Context> context() { return context_.ToLocalChecked(); }
 
@@ -171,7 +183,7 @@ TEST_F(DeserializeTest, OffThreadDeserialize) {
   }
 
   {
-    IsolateAndContextScope scope(this);
+    IsolateAndContextScope scope(this, kEnableCounters);
 
     DeserializeThread deserialize_thread(
         ScriptCompiler::StartConsumingCodeCache(
@@ -180,6 +192,7 @@ TEST_F(DeserializeTest, OffThreadDeserialize) {
                            ScriptCompiler::CachedData::BufferNotOwned)));
     CHECK(deserialize_thread.Start());
     deserialize_thread.Join();
+    CHECK_EQ(0, DeserializeSkippedCount());
 
     Local<String> source_code = NewString("function foo() { return 42; }");
     ScriptCompiler::Source source(source_code, cached_data.release(),
@@ -238,4 +251,57 @@ TEST_F(DeserializeTest, OffThreadDeserializeRejectsDifferentSource) {
   }
 }
 
+// Check that off-thread deserialization is skipped for a script that is
+// already in the compilation cache.
+TEST_F(DeserializeTest, OffThreadDeserializeSourceTextAvailable) {
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data;
+
+  {
+    IsolateAndContextScope scope(this);
+
+    Local<String> source_code = NewString("function foo() { return 42; }");
+    Local<Script> script =
+        Script::Compile(context(), source_code).ToLocalChecked();
+
+    CHECK(!script->Run(context()).IsEmpty());
+    CHECK_EQ(RunGlobalFunc("foo"), Integer::New(isolate(), 42));
+
+    cached_data.reset(
+        ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+  }
+
+  {
+    IsolateAndContextScope scope(this, kEnableCounters);
+
+    ScriptOrigin origin(isolate(), NewString("test"));
+    Local<String> source_code = NewString("function foo() { return 42; }");
+    {
+      ScriptCompiler::Source source(source_code, origin);
+      CHECK(!ScriptCompiler::Compile(context(), &source).IsEmpty());
+    }
+
+    std::unique_ptr<ScriptCompiler::ConsumeCodeCacheTask> task(
+        ScriptCompiler::StartConsumingCodeCache(
+            isolate(), std::make_unique<ScriptCompiler::CachedData>(
+                           cached_data->data, cached_data->length,
+                           ScriptCompiler::CachedData::BufferNotOwned)));
+    CHECK_EQ(0, DeserializeSkippedCount());
+    task->SourceTextAvailable(isolate(), source_code, origin);
+    DeserializeThread deserialize_thread(task.release());
+    CHECK(deserialize_thread.Start());
+    deserialize_thread.Join();
+    CHECK_EQ(1, DeserializeSkippedCount());
+
+    ScriptCompiler::Source source(source_code, origin, cached_data.release(),
+                                  deserialize_thread.TakeTask().release());
+    Local<Script> script =
+        ScriptCompiler::Compile(context(), &source,
+                                ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+
+    CHECK(!script->Run(context()).IsEmpty());
+    CHECK_EQ(RunGlobalFunc("foo"), v8::Integer::New(isolate(), 42));
+  }
+}
+
 }  // namespace v8
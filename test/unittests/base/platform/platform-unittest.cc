@@ -4,6 +4,7 @@
 
 #include "src/base/platform/platform.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "testing/gtest/include/gtest/gtest.h"
@@ -50,6 +51,47 @@ TEST(OS, RemapPages) {
   }
 }
 
+TEST(OS, AdviseTransparentHugePages) {
+  constexpr size_t kHugePageSize = size_t{2} << 20;
+  const size_t alignment = std::max(kHugePageSize, OS::AllocatePageSize());
+  const size_t size = 2 * alignment;
+  void* data = OS::Allocate(nullptr, size, alignment,
+                            OS::MemoryPermission::kReadWrite);
+  ASSERT_TRUE(data);
+  // The advice is optional, but when given it covers the whole aligned range.
+  size_t advised = OS::AdviseTransparentHugePages(data, size);
+  EXPECT_TRUE(advised == 0 || advised == size);
+  // Ranges without a huge page aligned part are never advised.
+  EXPECT_EQ(0u, OS::AdviseTransparentHugePages(data, kHugePageSize / 2));
+  OS::Free(data, size);
+}
+
+TEST(OS, AdvisePagesMergeable) {
+  const size_t size = OS::AllocatePageSize();
+  void* data =
+      OS::Allocate(nullptr, size, size, OS::MemoryPermission::kReadWrite);
+  ASSERT_TRUE(data);
+  memset(data, 0xab, size);
+  // Merging is only a hint, the contents must be unaffected either way.
+  USE(OS::AdvisePagesMergeable(data, size));
+  EXPECT_EQ(0xab, static_cast<uint8_t*>(data)[size - 1]);
+  OS::Free(data, size);
+}
+
+TEST(OS, SetPreferredNumaNode) {
+  const int node = OS::GetCurrentNumaNode();
+  EXPECT_LE(-1, node);
+  const size_t size = OS::AllocatePageSize();
+  void* data =
+      OS::Allocate(nullptr, size, size, OS::MemoryPermission::kReadWrite);
+  ASSERT_TRUE(data);
+  EXPECT_FALSE(OS::SetPreferredNumaNode(data, size, -1));
+  // The preference is only a hint, so the memory must stay usable either way.
+  if (node >= 0) USE(OS::SetPreferredNumaNode(data, size, node));
+  memset(data, 0xab, size);
+  OS::Free(data, size);
+}
+
 namespace {
 
 class ThreadLocalStorageTest : public Thread, public ::testing::Test {
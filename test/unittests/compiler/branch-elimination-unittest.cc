@@ -7,6 +7,7 @@
 #include "src/compiler/js-graph.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
 #include "test/unittests/compiler/compiler-test-utils.h"
 #include "test/unittests/compiler/graph-unittest.h"
 #include "test/unittests/compiler/node-test-utils.h"
@@ -205,6 +206,71 @@ TEST_F(BranchEliminationTest, BranchInsideLoopSame) {
   EXPECT_THAT(ret1, IsReturn(IsInt32Constant(2), effect, loop));
 }
 
+TEST_F(BranchEliminationTest, CheckBoundsImpliedByBranch) {
+  // if (index < length) a[index];
+  // should not need a bounds check for the element access.
+  SimplifiedOperatorBuilder simplified(zone());
+  Node* index = Parameter(Type::Range(0.0, 100.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, 1000.0, zone()), 1);
+  Node* condition =
+      graph()->NewNode(simplified.NumberLessThan(), index, length);
+  NodeProperties::SetType(condition, Type::Boolean());
+  Node* branch =
+      graph()->NewNode(common()->Branch(), condition, graph()->start());
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check = graph()->NewNode(simplified.CheckBounds(FeedbackSource()),
+                                 index, length, graph()->start(), if_true);
+  NodeProperties::SetType(check, Type::Range(0.0, 100.0, zone()));
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret1 = graph()->NewNode(common()->Return(), zero, check, check,
+                                if_true);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* check2 = graph()->NewNode(simplified.CheckBounds(FeedbackSource()),
+                                  index, length, graph()->start(), if_false);
+  NodeProperties::SetType(check2, Type::Range(0.0, 100.0, zone()));
+  Node* ret2 = graph()->NewNode(common()->Return(), zero, check2, check2,
+                                if_false);
+  graph()->SetEnd(graph()->NewNode(common()->End(2), ret1, ret2));
+
+  Reduce();
+
+  // The check on the true path is implied by the branch, the one on the
+  // false path is not.
+  EXPECT_THAT(check, IsTypeGuard(index, if_true));
+  EXPECT_EQ(IrOpcode::kCheckBounds, check2->opcode());
+}
+
+TEST_F(BranchEliminationTest, BoundsCheckImpliedByDominatingBoundsCheck) {
+  // trap_unless(index < mem_size - 7);
+  // trap_unless(index < mem_size - 3);
+  // trap_unless(index < mem_size - 11);
+  // should not need the second check, but does need the third.
+  Node* index = Parameter(0);
+  Node* mem_size = Parameter(1);
+  auto bounds_check = [&](int32_t offset, Node* control) {
+    Node* limit = graph()->NewNode(machine()->Int32Sub(), mem_size,
+                                   Int32Constant(offset));
+    Node* condition =
+        graph()->NewNode(machine()->Uint32LessThan(), index, limit);
+    return graph()->NewNode(common()->TrapUnless(TrapId::kTrapMemOutOfBounds),
+                            condition, graph()->start(), control);
+  };
+  Node* trap1 = bounds_check(7, graph()->start());
+  Node* trap2 = bounds_check(3, trap1);
+  Node* trap3 = bounds_check(11, trap2);
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret = graph()->NewNode(common()->Return(), zero, zero,
+                               graph()->start(), trap3);
+  graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+
+  Reduce();
+
+  EXPECT_EQ(trap1, NodeProperties::GetControlInput(trap3));
+  EXPECT_EQ(trap3, NodeProperties::GetControlInput(ret));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/compiler/scheduler.h"
+#include "src/builtins/profile-data-reader.h"
 #include "src/codegen/tick-counter.h"
 #include "src/compiler/access-builder.h"
 #include "src/compiler/common-operator.h"
@@ -36,7 +37,8 @@ class SchedulerTest : public TestWithIsolateAndZone {
         simplified_(zone()),
         js_(zone()) {}
 
-  Schedule* ComputeAndVerifySchedule(size_t expected) {
+  Schedule* ComputeAndVerifySchedule(
+      size_t expected, const ProfileDataFromFile* profile_data = nullptr) {
     if (FLAG_trace_turbo) {
       SourcePositionTable table(graph());
       NodeOriginTable table2(graph());
@@ -44,7 +46,7 @@ class SchedulerTest : public TestWithIsolateAndZone {
     }
 
     Schedule* schedule = Scheduler::ComputeSchedule(
-        zone(), graph(), Scheduler::kSplitNodes, tick_counter(), nullptr);
+        zone(), graph(), Scheduler::kSplitNodes, tick_counter(), profile_data);
 
     if (FLAG_trace_turbo_scheduler) {
       StdoutStream{} << *schedule << std::endl;
@@ -89,6 +91,20 @@ const Operator kMockCall(IrOpcode::kCall, Operator::kNoProperties, "MockCall",
 const Operator kMockTailCall(IrOpcode::kTailCall, Operator::kNoProperties,
                              "MockTailCall", 1, 1, 1, 0, 0, 1);
 
+// Block counters as they would be read from a --turbo-profiling-log-file.
+// Block ids are stable across schedules of the same graph, so tests take them
+// from a schedule computed without profile data.
+class TestProfileData : public ProfileDataFromFile {
+ public:
+  void SetCounter(BasicBlock* block, double count) {
+    size_t block_id = block->id().ToSize();
+    if (block_id >= block_counts_by_id_.size()) {
+      block_counts_by_id_.resize(block_id + 1);
+    }
+    block_counts_by_id_[block_id] = count;
+  }
+};
+
 }  // namespace
 
 
@@ -569,6 +585,116 @@ TARGET_TEST_F(SchedulerTest, BranchHintFalse) {
 }
 
 
+TARGET_TEST_F(SchedulerTest, ProfileDefersUnreachedBranchSuccessor) {
+  Node* start = graph()->NewNode(common()->Start(1));
+  graph()->SetStart(start);
+
+  Node* p0 = graph()->NewNode(common()->Parameter(0), start);
+  Node* tv = graph()->NewNode(common()->Int32Constant(6));
+  Node* fv = graph()->NewNode(common()->Int32Constant(7));
+  Node* br = graph()->NewNode(common()->Branch(), p0, start);
+  Node* t = graph()->NewNode(common()->IfTrue(), br);
+  Node* f = graph()->NewNode(common()->IfFalse(), br);
+  Node* m = graph()->NewNode(common()->Merge(2), t, f);
+  Node* phi = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                               tv, fv, m);
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret = graph()->NewNode(common()->Return(), zero, phi, start, start);
+  Node* end = graph()->NewNode(common()->End(1), ret);
+
+  graph()->SetEnd(end);
+
+  Schedule* schedule = ComputeAndVerifySchedule(14);
+  TestProfileData profile;
+  profile.SetCounter(schedule->block(t), 1001);
+  schedule = ComputeAndVerifySchedule(14, &profile);
+  // The false block never ran, so it is deferred even though the true block
+  // is far from the threshold for ordinary profile-based hints.
+  EXPECT_FALSE(schedule->block(t)->deferred());
+  EXPECT_TRUE(schedule->block(f)->deferred());
+}
+
+
+TARGET_TEST_F(SchedulerTest, ProfileKeepsUnreachedBranchSuccessorIfCold) {
+  Node* start = graph()->NewNode(common()->Start(1));
+  graph()->SetStart(start);
+
+  Node* p0 = graph()->NewNode(common()->Parameter(0), start);
+  Node* tv = graph()->NewNode(common()->Int32Constant(6));
+  Node* fv = graph()->NewNode(common()->Int32Constant(7));
+  Node* br = graph()->NewNode(common()->Branch(), p0, start);
+  Node* t = graph()->NewNode(common()->IfTrue(), br);
+  Node* f = graph()->NewNode(common()->IfFalse(), br);
+  Node* m = graph()->NewNode(common()->Merge(2), t, f);
+  Node* phi = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                               tv, fv, m);
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret = graph()->NewNode(common()->Return(), zero, phi, start, start);
+  Node* end = graph()->NewNode(common()->End(1), ret);
+
+  graph()->SetEnd(end);
+
+  Schedule* schedule = ComputeAndVerifySchedule(14);
+  TestProfileData profile;
+  profile.SetCounter(schedule->block(t), 1000);
+  schedule = ComputeAndVerifySchedule(14, &profile);
+  // The branch did not run often enough for the profile to be trusted.
+  EXPECT_FALSE(schedule->block(t)->deferred());
+  EXPECT_FALSE(schedule->block(f)->deferred());
+}
+
+
+TARGET_TEST_F(SchedulerTest, ProfileOverridesBranchHintForUnreachedSuccessor) {
+  Node* start = graph()->NewNode(common()->Start(1));
+  graph()->SetStart(start);
+
+  Node* p0 = graph()->NewNode(common()->Parameter(0), start);
+  Node* tv = graph()->NewNode(common()->Int32Constant(6));
+  Node* fv = graph()->NewNode(common()->Int32Constant(7));
+  Node* br = graph()->NewNode(common()->Branch(BranchHint::kTrue), p0, start);
+  Node* t = graph()->NewNode(common()->IfTrue(), br);
+  Node* f = graph()->NewNode(common()->IfFalse(), br);
+  Node* m = graph()->NewNode(common()->Merge(2), t, f);
+  Node* phi = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                               tv, fv, m);
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret = graph()->NewNode(common()->Return(), zero, phi, start, start);
+  Node* end = graph()->NewNode(common()->End(1), ret);
+
+  graph()->SetEnd(end);
+
+  Schedule* schedule = ComputeAndVerifySchedule(14);
+  TestProfileData profile;
+  profile.SetCounter(schedule->block(f), 5000);
+  schedule = ComputeAndVerifySchedule(14, &profile);
+  // The profile shows that the hinted block never ran.
+  EXPECT_TRUE(schedule->block(t)->deferred());
+  EXPECT_FALSE(schedule->block(f)->deferred());
+}
+
+
+TARGET_TEST_F(SchedulerTest, ThrowSuccessorIsDeferred) {
+  Node* start = graph()->NewNode(common()->Start(1));
+  graph()->SetStart(start);
+
+  Node* p0 = graph()->NewNode(common()->Parameter(0), start);
+  Node* br = graph()->NewNode(common()->Branch(), p0, start);
+  Node* t = graph()->NewNode(common()->IfTrue(), br);
+  Node* f = graph()->NewNode(common()->IfFalse(), br);
+  Node* thr = graph()->NewNode(common()->Throw(), start, t);
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret = graph()->NewNode(common()->Return(), zero, p0, start, f);
+  Node* end = graph()->NewNode(common()->End(2), ret, thr);
+
+  graph()->SetEnd(end);
+
+  Schedule* schedule = ComputeAndVerifySchedule(9);
+  // Make sure the throwing block is marked as deferred.
+  EXPECT_TRUE(schedule->block(t)->deferred());
+  EXPECT_FALSE(schedule->block(f)->deferred());
+}
+
+
 TARGET_TEST_F(SchedulerTest, CallException) {
   Node* start = graph()->NewNode(common()->Start(1));
   graph()->SetStart(start);
@@ -663,6 +789,40 @@ TARGET_TEST_F(SchedulerTest, FloatingSwitch) {
 }
 
 
+TARGET_TEST_F(SchedulerTest, ProfileDefersUnreachedSwitchCase) {
+  Node* start = graph()->NewNode(common()->Start(1));
+  graph()->SetStart(start);
+
+  Node* p0 = graph()->NewNode(common()->Parameter(0), start);
+  Node* sw = graph()->NewNode(common()->Switch(3), p0, start);
+  Node* c0 = graph()->NewNode(common()->IfValue(0), sw);
+  Node* v0 = graph()->NewNode(common()->Int32Constant(11));
+  Node* c1 = graph()->NewNode(common()->IfValue(1), sw);
+  Node* v1 = graph()->NewNode(common()->Int32Constant(22));
+  Node* d = graph()->NewNode(common()->IfDefault(), sw);
+  Node* vd = graph()->NewNode(common()->Int32Constant(33));
+  Node* m = graph()->NewNode(common()->Merge(3), c0, c1, d);
+  Node* phi = graph()->NewNode(common()->Phi(MachineRepresentation::kWord32, 3),
+                               v0, v1, vd, m);
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret = graph()->NewNode(common()->Return(), zero, phi, start, m);
+  Node* end = graph()->NewNode(common()->End(1), ret);
+
+  graph()->SetEnd(end);
+
+  Schedule* schedule = ComputeAndVerifySchedule(17);
+  TestProfileData profile;
+  profile.SetCounter(schedule->block(c0), 600);
+  profile.SetCounter(schedule->block(d), 600);
+  schedule = ComputeAndVerifySchedule(17, &profile);
+  // Only the case that never ran is deferred, although no single case ran
+  // often enough on its own.
+  EXPECT_FALSE(schedule->block(c0)->deferred());
+  EXPECT_TRUE(schedule->block(c1)->deferred());
+  EXPECT_FALSE(schedule->block(d)->deferred());
+}
+
+
 TARGET_TEST_F(SchedulerTest, Terminate) {
   Node* start = graph()->NewNode(common()->Start(1));
   graph()->SetStart(start);
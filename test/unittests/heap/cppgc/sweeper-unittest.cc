@@ -346,6 +346,31 @@ TEST_F(SweeperTest, LazySweepingNormalPages) {
   EXPECT_EQ(2u, g_destructor_callcount);
 }
 
+TEST_F(SweeperTest, LazySweepingDoesNotFinishOtherSpaces) {
+  using SmallObject = GCed<sizeof(size_t)>;
+  using LargerObject = GCed<256>;
+  PreciseGC();
+  MakeGarbageCollected<LargerObject>(GetAllocationHandle());
+  testing::TestPlatform::DisableBackgroundTasksScope no_concurrent_sweep_scope(
+      GetPlatformHandle().get());
+  g_destructor_callcount = 0;
+  static constexpr Heap::Config config = {
+      Heap::Config::CollectionType::kMajor,
+      Heap::Config::StackState::kNoHeapPointers,
+      Heap::Config::MarkingType::kAtomic,
+      Heap::Config::SweepingType::kIncrementalAndConcurrent};
+  Heap::From(GetHeap())->CollectGarbage(config);
+  EXPECT_EQ(0u, g_destructor_callcount);
+  // The space of SmallObject has no pages left to sweep. Allocating should
+  // expand that space rather than sweeping the space holding LargerObject.
+  MakeGarbageCollected<SmallObject>(GetAllocationHandle());
+  EXPECT_EQ(0u, g_destructor_callcount);
+  Sweeper& sweeper = Heap::From(GetHeap())->sweeper();
+  EXPECT_TRUE(sweeper.IsSweepingInProgress());
+  sweeper.FinishIfRunning();
+  EXPECT_EQ(1u, g_destructor_callcount);
+}
+
 namespace {
 class AllocatingFinalizer : public GarbageCollected<AllocatingFinalizer> {
  public:
@@ -108,5 +108,36 @@ TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
           new_space_capacity, factor, Heap::HeapGrowingMode::kMinimal));
 }
 
+TEST(YoungGenerationSizeControllerTest, DesiredCapacity) {
+  const size_t min_capacity = 1 * MB;
+  const size_t max_capacity = 16 * MB;
+  const size_t current_capacity = 8 * MB;
+
+  // Without measurements the capacity is kept.
+  EXPECT_EQ(current_capacity, YoungGenerationSizeController::DesiredCapacity(
+                                  current_capacity, min_capacity, max_capacity,
+                                  0, 0, 0.1, 1.0));
+
+  // High allocation throughput: grow until the pause target is reached.
+  EXPECT_EQ(10 * MB, YoungGenerationSizeController::DesiredCapacity(
+                         current_capacity, min_capacity, max_capacity, MB, MB,
+                         0.1, 1.0));
+
+  // Low allocation throughput: shrink, but at most by kMaxShrinkingFactor.
+  EXPECT_EQ(4 * MB, YoungGenerationSizeController::DesiredCapacity(
+                        current_capacity, min_capacity, max_capacity, KB, MB,
+                        0.1, 1.0));
+
+  // The result is bounded by the maximum capacity.
+  EXPECT_EQ(max_capacity, YoungGenerationSizeController::DesiredCapacity(
+                              max_capacity, min_capacity, max_capacity, MB,
+                              100 * MB, 0.1, 1.0));
+
+  // The result is bounded by the minimum capacity.
+  EXPECT_EQ(min_capacity, YoungGenerationSizeController::DesiredCapacity(
+                              min_capacity, min_capacity, max_capacity, KB, MB,
+                              0.1, 1.0));
+}
+
 }  // namespace internal
 }  // namespace v8
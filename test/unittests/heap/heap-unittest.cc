@@ -9,6 +9,7 @@
 #include <limits>
 
 #include "src/handles/handles-inl.h"
+#include "src/heap/incremental-marking.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/safepoint.h"
 #include "src/heap/spaces-inl.h"
@@ -130,6 +131,15 @@ TEST_F(HeapTest, ExternalLimitStaysAboveDefaultForExplicitHandling) {
   EXPECT_GE(heap->external_memory_limit(), kExternalAllocationSoftLimit);
 }
 
+TEST_F(HeapTest, GCPauseBudget) {
+  IncrementalMarking* marking = i_isolate()->heap()->incremental_marking();
+  EXPECT_EQ(0.0, marking->step_duration_budget_ms());
+  v8_isolate()->SetGCPauseBudget(2.0);
+  EXPECT_EQ(2.0, marking->step_duration_budget_ms());
+  v8_isolate()->SetGCPauseBudget(0.0);
+  EXPECT_EQ(0.0, marking->step_duration_budget_ms());
+}
+
 #ifdef V8_COMPRESS_POINTERS
 TEST_F(HeapTest, HeapLayout) {
   // Produce some garbage.
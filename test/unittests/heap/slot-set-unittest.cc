@@ -4,6 +4,7 @@
 
 #include <limits>
 #include <map>
+#include <vector>
 
 #include "src/common/globals.h"
 #include "src/heap/slot-set.h"
@@ -106,6 +107,36 @@ TEST(SlotSet, Iterate) {
   SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
 }
 
+TEST(SlotSet, IterateSparseCells) {
+  SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
+  const int kBytesPerCell = SlotSet::kBitsPerCell * kTaggedSize;
+  const int kBytesPerBucket = SlotSet::kBitsPerBucket * kTaggedSize;
+  std::vector<Address> expected;
+  // Populate only the first and the last cell of every other bucket.
+  for (int bucket = 0; bucket < SlotSet::kBucketsRegularPage; bucket += 2) {
+    const int first = bucket * kBytesPerBucket;
+    const int last = first + (SlotSet::kCellsPerBucket - 1) * kBytesPerCell +
+                     (SlotSet::kBitsPerCell - 1) * kTaggedSize;
+    set->Insert<AccessMode::ATOMIC>(first);
+    set->Insert<AccessMode::ATOMIC>(last);
+    expected.push_back(first);
+    expected.push_back(last);
+  }
+
+  std::vector<Address> visited;
+  size_t kept = set->Iterate(
+      kNullAddress, 0, SlotSet::kBucketsRegularPage,
+      [&visited](MaybeObjectSlot slot) {
+        visited.push_back(slot.address());
+        return KEEP_SLOT;
+      },
+      SlotSet::KEEP_EMPTY_BUCKETS);
+
+  EXPECT_EQ(expected, visited);
+  EXPECT_EQ(expected.size(), kept);
+  SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
+}
+
 TEST(SlotSet, IterateFromHalfway) {
   SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
 
@@ -140,6 +171,40 @@ TEST(SlotSet, IterateFromHalfway) {
   SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
 }
 
+TEST(SlotSet, IterateAndReportEmptyBuckets) {
+  SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
+
+  for (int i = 0; i < Page::kPageSize; i += kTaggedSize) {
+    if (i % 7 == 0) {
+      set->Insert<AccessMode::ATOMIC>(i);
+    }
+  }
+
+  const size_t start_bucket = SlotSet::kBucketsRegularPage / 2;
+  std::vector<size_t> empty_buckets;
+  set->IterateAndReportEmptyBuckets(
+      kNullAddress, start_bucket, SlotSet::kBucketsRegularPage,
+      [](MaybeObjectSlot slot) { return REMOVE_SLOT; },
+      [&empty_buckets](size_t bucket_index) {
+        empty_buckets.push_back(bucket_index);
+      });
+
+  EXPECT_EQ(SlotSet::kBucketsRegularPage - start_bucket, empty_buckets.size());
+  for (size_t i = 0; i < empty_buckets.size(); i++) {
+    EXPECT_EQ(start_bucket + i, empty_buckets[i]);
+  }
+
+  for (int i = 0; i < Page::kPageSize; i += kTaggedSize) {
+    if (i < Page::kPageSize / 2 && i % 7 == 0) {
+      EXPECT_TRUE(set->Lookup(i));
+    } else {
+      EXPECT_FALSE(set->Lookup(i));
+    }
+  }
+
+  SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
+}
+
 TEST(SlotSet, Remove) {
   SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
 
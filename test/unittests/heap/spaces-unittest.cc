@@ -153,6 +153,24 @@ TEST_F(SpacesTest, CodeRangeAddressReuse) {
   EXPECT_EQ(code_range6, code_range3);
 }
 
+TEST_F(SpacesTest, FreeBlockHistogram) {
+  Heap* heap = i_isolate()->heap();
+  Page* page = heap->old_space()->first_page();
+  page->ResetFreeBlockHistogram();
+  for (int i = 0; i < MemoryChunk::kNumFreeBlockSizeClasses; i++) {
+    EXPECT_EQ(0u, page->free_block_bytes(i));
+  }
+  page->RecordFreeBlock(kTaggedSize);
+  page->RecordFreeBlock(255);
+  page->RecordFreeBlock(256);
+  page->RecordFreeBlock(16 * KB);
+  EXPECT_EQ(kTaggedSize + 255u, page->free_block_bytes(0));
+  EXPECT_EQ(256u, page->free_block_bytes(1));
+  EXPECT_EQ(0u, page->free_block_bytes(2));
+  EXPECT_EQ(static_cast<size_t>(16 * KB), page->free_block_bytes(3));
+  page->ResetFreeBlockHistogram();
+}
+
 // Tests that FreeListMany::SelectFreeListCategoryType returns what it should.
 TEST_F(SpacesTest, FreeListManySelectFreeListCategoryType) {
   FreeListMany free_list;
@@ -6,6 +6,7 @@
 
 #include "src/interpreter/bytecode-label.h"
 #include "src/interpreter/bytecode-register-optimizer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/interpreter/bytecode-utils.h"
 #include "test/unittests/test-utils.h"
 
@@ -88,6 +89,44 @@ TEST_F(BytecodeRegisterOptimizerTest, TemporaryMaterializedForJump) {
   CHECK_EQ(output()->at(0).output.index(), temp.index());
 }
 
+TEST_F(BytecodeRegisterOptimizerTest, EquivalenceKeptAcrossConditionalJump) {
+  FLAG_SCOPE(ignition_reo_across_jumps);
+  Initialize(1, 1);
+  Register temp = NewTemporary();
+  optimizer()->DoStar(temp);
+  CHECK_EQ(write_count(), 0u);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJumpIfTrue,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 1u);
+  CHECK_EQ(output()->at(0).bytecode, Bytecode::kStar);
+  CHECK_EQ(output()->at(0).output.index(), temp.index());
+  // The accumulator still holds the value of |temp| on the fall-through path.
+  optimizer()->DoLdar(temp);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kReturn,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 1u);
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, EquivalenceFlushedAcrossConditionalJump) {
+  FLAG_VALUE_SCOPE(ignition_reo_across_jumps, false);
+  Initialize(1, 1);
+  Register temp = NewTemporary();
+  optimizer()->DoStar(temp);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJumpIfTrue,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 1u);
+  optimizer()->DoLdar(temp);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kReturn,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 2u);
+  CHECK_EQ(output()->at(1).bytecode, Bytecode::kLdar);
+  CHECK_EQ(output()->at(1).input.index(), temp.index());
+}
+
 // Basic Register Optimizations
 
 TEST_F(BytecodeRegisterOptimizerTest, TemporaryNotEmitted) {
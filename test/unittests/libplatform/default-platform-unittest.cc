@@ -252,6 +252,57 @@ TEST(CustomDefaultPlatformTest, RunBackgroundTask) {
   EXPECT_TRUE(task_executed);
 }
 
+TEST(CustomDefaultPlatformTest, RunBackgroundTasksWithAppliedPriority) {
+  DefaultPlatform platform(1, IdleTaskSupport::kDisabled, nullptr,
+                           PriorityMode::kApply);
+
+  base::Semaphore sem(0);
+  bool task_executed[3] = {false, false, false};
+  StrictMock<TestBackgroundTask>* tasks[3];
+  for (int i = 0; i < 3; ++i) {
+    tasks[i] = new StrictMock<TestBackgroundTask>(&sem, &task_executed[i]);
+    EXPECT_CALL(*tasks[i], Die());
+  }
+  EXPECT_EQ(base::Thread::Priority::kBestEffort,
+            platform.GetWorkerThreadPriorityForTesting(
+                TaskPriority::kBestEffort));
+  EXPECT_EQ(base::Thread::Priority::kUserVisible,
+            platform.GetWorkerThreadPriorityForTesting(
+                TaskPriority::kUserVisible));
+  EXPECT_EQ(base::Thread::Priority::kUserBlocking,
+            platform.GetWorkerThreadPriorityForTesting(
+                TaskPriority::kUserBlocking));
+  platform.CallLowPriorityTaskOnWorkerThread(std::unique_ptr<Task>(tasks[0]));
+  platform.CallOnWorkerThread(std::unique_ptr<Task>(tasks[1]));
+  platform.CallBlockingTaskOnWorkerThread(std::unique_ptr<Task>(tasks[2]));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(sem.WaitFor(base::TimeDelta::FromSeconds(1)));
+  }
+  for (int i = 0; i < 3; ++i) EXPECT_TRUE(task_executed[i]);
+}
+
+TEST(CustomDefaultPlatformTest, SharedWorkerThreadsWithoutAppliedPriority) {
+  // All priorities share one pool of default priority threads, which is
+  // terminated once when the platform goes away.
+  DefaultPlatform platform(1, IdleTaskSupport::kDisabled, nullptr,
+                           PriorityMode::kDontApply);
+  EXPECT_EQ(base::Thread::Priority::kDefault,
+            platform.GetWorkerThreadPriorityForTesting(
+                TaskPriority::kBestEffort));
+  EXPECT_EQ(base::Thread::Priority::kDefault,
+            platform.GetWorkerThreadPriorityForTesting(
+                TaskPriority::kUserBlocking));
+
+  base::Semaphore sem(0);
+  bool task_executed = false;
+  StrictMock<TestBackgroundTask>* task =
+      new StrictMock<TestBackgroundTask>(&sem, &task_executed);
+  EXPECT_CALL(*task, Die());
+  platform.CallBlockingTaskOnWorkerThread(std::unique_ptr<Task>(task));
+  EXPECT_TRUE(sem.WaitFor(base::TimeDelta::FromSeconds(1)));
+  EXPECT_TRUE(task_executed);
+}
+
 TEST(CustomDefaultPlatformTest, PostForegroundTaskAfterPlatformTermination) {
   std::shared_ptr<TaskRunner> foreground_taskrunner;
   {
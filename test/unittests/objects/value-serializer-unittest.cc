@@ -965,6 +965,21 @@ TEST_F(ValueSerializerTest, RoundTripDictionaryObjectForTransitions) {
       ",{\"\xF0\x9F\x91\x8A\":5,\"\xF0\x9F\x91\x9B\":6}]");
 }
 
+TEST_F(ValueSerializerTest, RoundTripObjectKeysAreInternalized) {
+  // One-byte keys are internalized directly from the wire; objects with
+  // diverging shapes must still end up with the same property names.
+  Local<Value> value =
+      RoundTripTest("[{a: 1, b: 2}, {a: 3, c: 4}, {a: 5, b: 6}, {'0': 7}]");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result[0].a === 1 && result[0].b === 2");
+  ExpectScriptTrue("result[1].a === 3 && result[1].c === 4");
+  ExpectScriptTrue("result[2].a === 5 && result[2].b === 6");
+  ExpectScriptTrue("result[3][0] === 7");
+  ExpectScriptTrue(
+      "Object.keys(result[1]).join() === 'a,c' && "
+      "Object.keys(result[2]).join() === 'a,b'");
+}
+
 TEST_F(ValueSerializerTest, DecodeDictionaryObjectVersion0) {
   // Empty object.
   Local<Value> value = DecodeTestForVersion0({0x7B, 0x00});
@@ -56,18 +56,26 @@ TEST_F(BackingStoreTest, GrowSharedWasmMemoryInPlace) {
   EXPECT_EQ(3 * wasm::kWasmPageSize, backing_store->byte_length());
 }
 
-TEST_F(BackingStoreTest, CopyWasmMemory) {
+TEST_F(BackingStoreTest, MoveWasmMemory) {
   auto bs1 =
       BackingStore::AllocateWasmMemory(isolate(), 1, 2, SharedFlag::kNotShared);
   CHECK(bs1);
   EXPECT_TRUE(bs1->is_wasm_memory());
   EXPECT_EQ(1 * wasm::kWasmPageSize, bs1->byte_length());
   EXPECT_EQ(2 * wasm::kWasmPageSize, bs1->byte_capacity());
+  uint8_t* data1 = reinterpret_cast<uint8_t*>(bs1->buffer_start());
+  data1[0] = 17;
+  data1[wasm::kWasmPageSize - 1] = 42;
 
-  auto bs2 = bs1->CopyWasmMemory(isolate(), 3, 3);
+  auto bs2 = bs1->MoveWasmMemory(isolate(), 3, 3);
   EXPECT_TRUE(bs2->is_wasm_memory());
   EXPECT_EQ(3 * wasm::kWasmPageSize, bs2->byte_length());
   EXPECT_EQ(3 * wasm::kWasmPageSize, bs2->byte_capacity());
+  // The contents are preserved, whether they were copied or moved.
+  uint8_t* data2 = reinterpret_cast<uint8_t*>(bs2->buffer_start());
+  EXPECT_EQ(17, data2[0]);
+  EXPECT_EQ(42, data2[wasm::kWasmPageSize - 1]);
+  EXPECT_EQ(0, data2[wasm::kWasmPageSize]);
 }
 
 class GrowerThread : public base::Thread {
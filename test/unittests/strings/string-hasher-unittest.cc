@@ -0,0 +1,67 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-hasher.h"
+
+#include <vector>
+
+#include "src/strings/string-hasher-inl.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const uint64_t kSeed = 0x1234567890ABCDEF;
+
+uint32_t HashOneByte(const std::vector<uint8_t>& chars) {
+  return StringHasher::HashSequentialString(
+      chars.data(), static_cast<int>(chars.size()), kSeed);
+}
+
+uint32_t HashTwoByte(const std::vector<uint8_t>& chars) {
+  std::vector<uint16_t> wide(chars.begin(), chars.end());
+  return StringHasher::HashSequentialString(
+      wide.data(), static_cast<int>(wide.size()), kSeed);
+}
+
+}  // namespace
+
+TEST(StringHasherTest, OneByteAndTwoByteAgree) {
+  std::vector<uint8_t> chars;
+  // Cover every tail length of the block-wise hash, and characters with the
+  // high bit set, which must not be sign-extended.
+  for (int length = 0; length <= 40; length++) {
+    EXPECT_EQ(HashOneByte(chars), HashTwoByte(chars)) << length;
+    chars.push_back(static_cast<uint8_t>('a' + length * 37));
+  }
+}
+
+TEST(StringHasherTest, IndexHashesAgree) {
+  std::vector<uint8_t> index = {'4', '2', '0', '0'};
+  EXPECT_EQ(HashOneByte(index), HashTwoByte(index));
+  EXPECT_TRUE(Name::ContainsCachedArrayIndex(HashOneByte(index)));
+  std::vector<uint8_t> integer_index(String::kMaxArrayIndexSize + 1, '9');
+  EXPECT_EQ(HashOneByte(integer_index), HashTwoByte(integer_index));
+}
+
+TEST(StringHasherTest, HashIsNeverZero) {
+  std::vector<uint8_t> chars;
+  for (int length = 0; length <= 40; length++) {
+    uint32_t hash = HashOneByte(chars);
+    EXPECT_NE(0u, Name::HashBits::decode(hash)) << length;
+    chars.push_back(static_cast<uint8_t>(length));
+  }
+}
+
+TEST(StringHasherTest, SeedChangesHash) {
+  const uint8_t chars[] = "the quick brown fox";
+  int length = static_cast<int>(sizeof(chars) - 1);
+  EXPECT_NE(StringHasher::HashSequentialString(chars, length, 1),
+            StringHasher::HashSequentialString(chars, length, 2));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -105,6 +105,29 @@ TEST_F(DisjointAllocationPoolTest, ExtractExact) {
   CheckRange(b, {10, 5});
 }
 
+TEST_F(DisjointAllocationPoolTest, ExtractFromEnd) {
+  DisjointAllocationPool a = Make({{10, 5}, {20, 5}, {30, 5}});
+  CheckRange(a.AllocateFromEndInRegion(2, {0, 100}), {33, 2});
+  CheckPool(a, {{10, 5}, {20, 5}, {30, 3}});
+  // Skip regions which are too small or outside the given region.
+  CheckRange(a.AllocateFromEndInRegion(4, {0, 100}), {21, 4});
+  CheckRange(a.AllocateFromEndInRegion(2, {0, 20}), {13, 2});
+  CheckPool(a, {{10, 3}, {20, 1}, {30, 3}});
+  CheckRange(a.AllocateFromEndInRegion(2, {0, 12}), {10, 2});
+  CheckRange(a.AllocateFromEndInRegion(4, {0, 100}), {});
+  CheckPool(a, {{12, 1}, {20, 1}, {30, 3}});
+}
+
+TEST_F(DisjointAllocationPoolTest, Contains) {
+  DisjointAllocationPool a = Make({{10, 5}, {20, 5}});
+  EXPECT_TRUE(a.Contains({10, 5}));
+  EXPECT_TRUE(a.Contains({21, 2}));
+  EXPECT_FALSE(a.Contains({9, 2}));
+  EXPECT_FALSE(a.Contains({14, 2}));
+  EXPECT_FALSE(a.Contains({12, 10}));
+  EXPECT_FALSE(a.Contains({30, 1}));
+}
+
 TEST_F(DisjointAllocationPoolTest, Merging) {
   DisjointAllocationPool a = Make({{10, 5}, {20, 5}});
   a.Merge({15, 5});
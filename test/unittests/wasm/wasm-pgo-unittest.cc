@@ -0,0 +1,144 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/pgo.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "src/wasm/wasm-module.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+class WasmPgoTest : public ::testing::Test {
+ protected:
+  static constexpr uint32_t kNumImportedFunctions = 1;
+  static constexpr uint32_t kNumDeclaredFunctions = 3;
+  static constexpr uint32_t kFunctionBodySize = 16;
+
+  WasmPgoTest() { InitModule(&module_); }
+
+  ~WasmPgoTest() override { std::remove(ProfileFileName().c_str()); }
+
+  static void InitModule(WasmModule* module) {
+    module->num_imported_functions = kNumImportedFunctions;
+    module->num_declared_functions = kNumDeclaredFunctions;
+    for (uint32_t i = 0; i < kNumImportedFunctions + kNumDeclaredFunctions;
+         i++) {
+      bool imported = i < kNumImportedFunctions;
+      module->functions.push_back(
+          {nullptr, i, 0, WireBytesRef(i * kFunctionBodySize,
+                                       imported ? 0 : kFunctionBodySize),
+           0, imported, false, !imported});
+    }
+  }
+
+  std::string ProfileFileName() const {
+    return GetProfileFileName(base::ArrayVector(wire_bytes_));
+  }
+
+  void WriteProfile(const char* contents) {
+    std::ofstream file(ProfileFileName());
+    file << contents;
+  }
+
+  std::vector<int> LoadProfile(WasmModule* module) {
+    return LoadProfileFromFile(module, base::ArrayVector(wire_bytes_));
+  }
+
+  WasmModule module_;
+  const uint8_t wire_bytes_[8] = {0x00, 0x61, 0x73, 0x6d, 0x01, 0, 0, 0};
+};
+
+TEST_F(WasmPgoTest, NoProfile) {
+  EXPECT_TRUE(LoadProfile(&module_).empty());
+  EXPECT_TRUE(module_.type_feedback.feedback_for_function.empty());
+}
+
+TEST_F(WasmPgoTest, RoundTrip) {
+  {
+    auto& feedback = module_.type_feedback.feedback_for_function;
+    feedback[1].tierup_priority = 3;
+    feedback[1].feedback_vector = {{3, 7}, {-1, 0}};
+    feedback[1].positions = {{10, 0}, {12, 1}};
+    // Functions that never asked for tier-up are not written.
+    feedback[2].feedback_vector = {{1, 4}};
+    feedback[2].positions = {{20, 0}};
+    feedback[3].tierup_priority = 5;
+  }
+  DumpProfileToFile(&module_, base::ArrayVector(wire_bytes_));
+
+  WasmModule loaded;
+  InitModule(&loaded);
+  std::vector<int> tiered_up = LoadProfile(&loaded);
+  // Hottest first.
+  EXPECT_EQ((std::vector<int>{3, 1}), tiered_up);
+
+  auto& feedback = loaded.type_feedback.feedback_for_function;
+  EXPECT_EQ(0u, feedback.count(2));
+  ASSERT_EQ(1u, feedback.count(1));
+  EXPECT_EQ(3, feedback[1].tierup_priority);
+  ASSERT_EQ(2u, feedback[1].feedback_vector.size());
+  EXPECT_EQ(3, feedback[1].feedback_vector[0].function_index);
+  EXPECT_EQ(7, feedback[1].feedback_vector[0].absolute_call_frequency);
+  // Call sites without a known target are not restored.
+  EXPECT_EQ(-1, feedback[1].feedback_vector[1].function_index);
+  EXPECT_EQ((std::map<WasmCodePosition, int>{{10, 0}}),
+            feedback[1].positions);
+  ASSERT_EQ(1u, feedback.count(3));
+  EXPECT_EQ(5, feedback[3].tierup_priority);
+  EXPECT_TRUE(feedback[3].feedback_vector.empty());
+}
+
+TEST_F(WasmPgoTest, FunctionIndexOutOfBounds) {
+  WriteProfile(
+      "function,0,5,0\n"   // Imported.
+      "function,4,5,0\n"   // Past the declared functions.
+      "function,-1,5,0\n"  // Negative.
+      "function,2,1,0\n");
+  EXPECT_EQ((std::vector<int>{2}), LoadProfile(&module_));
+  EXPECT_EQ(1u, module_.type_feedback.feedback_for_function.size());
+}
+
+TEST_F(WasmPgoTest, TargetIndexOutOfBounds) {
+  WriteProfile(
+      "function,1,1,4\n"
+      "call,10,0,0,5\n"  // Imported target.
+      "call,11,1,4,5\n"  // Past the declared functions.
+      "call,12,2,3,5\n"
+      "call,13,4,3,5\n");  // Slot past the number of call sites.
+  EXPECT_EQ((std::vector<int>{1}), LoadProfile(&module_));
+  FunctionTypeFeedback& feedback =
+      module_.type_feedback.feedback_for_function[1];
+  ASSERT_EQ(4u, feedback.feedback_vector.size());
+  EXPECT_EQ(-1, feedback.feedback_vector[0].function_index);
+  EXPECT_EQ(-1, feedback.feedback_vector[1].function_index);
+  EXPECT_EQ(3, feedback.feedback_vector[2].function_index);
+  EXPECT_EQ((std::map<WasmCodePosition, int>{{12, 2}}), feedback.positions);
+}
+
+TEST_F(WasmPgoTest, TooManyCallSites) {
+  // A function can't have more call sites than bytes in its body.
+  WriteProfile("function,1,1,1000000000\n");
+  EXPECT_TRUE(LoadProfile(&module_).empty());
+  EXPECT_TRUE(module_.type_feedback.feedback_for_function.empty());
+}
+
+TEST_F(WasmPgoTest, MalformedLines) {
+  WriteProfile(
+      "function,1\n"
+      "function,1,x,0\n"
+      "function,1,1,0,7\n"
+      "call,10,0,3,5\n"  // No preceding function.
+      "unknown,1,2,3\n");
+  EXPECT_TRUE(LoadProfile(&module_).empty());
+  EXPECT_TRUE(module_.type_feedback.feedback_for_function.empty());
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -5,6 +5,7 @@
 #include "src/zone/zone.h"
 
 #include "src/zone/accounting-allocator.h"
+#include "src/zone/zone-containers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -25,5 +26,36 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentsAreReusedAcrossZones) {
+  AccountingAllocator allocator;
+  Address first_segment_start;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    first_segment_start =
+        reinterpret_cast<Address>(zone.Allocate<ZoneTestTag>(8));
+    EXPECT_LT(0u, allocator.GetCurrentMemoryUsage());
+  }
+  // Pooled segments do not count as used memory.
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  if (!FLAG_zone_segment_pool_size) return;
+  Zone zone(&allocator, ZONE_NAME);
+  EXPECT_EQ(first_segment_start,
+            reinterpret_cast<Address>(zone.Allocate<ZoneTestTag>(8)));
+}
+
+TEST_F(ZoneTest, SmallVectorSpillsToZone) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  ZoneSmallVector<int, 2> vector(&zone);
+  vector.push_back(1);
+  vector.push_back(2);
+  EXPECT_EQ(size_t{0}, zone.allocation_size());
+  vector.push_back(3);
+  EXPECT_LT(size_t{0}, zone.allocation_size());
+  EXPECT_EQ(size_t{3}, vector.size());
+  EXPECT_EQ(1, vector.front());
+  EXPECT_EQ(3, vector.back());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -451,8 +451,8 @@ KNOWN_MAPS = {
     ("read_only_space", 0x06ab5): (138, "StoreHandler1Map"),
     ("read_only_space", 0x06add): (138, "StoreHandler2Map"),
     ("read_only_space", 0x06b05): (138, "StoreHandler3Map"),
-    ("map_space", 0x02149): (2113, "ExternalMap"),
-    ("map_space", 0x02171): (2117, "JSMessageObjectMap"),
+    ("map_space", 0x02171): (2113, "ExternalMap"),
+    ("map_space", 0x02199): (2117, "JSMessageObjectMap"),
 }
 
 # List of known V8 objects.
@@ -501,64 +501,64 @@ KNOWN_OBJECTS = {
   ("read_only_space", 0x0368d): "EmptyFunctionScopeInfo",
   ("read_only_space", 0x036b1): "NativeScopeInfo",
   ("read_only_space", 0x036c9): "HashSeed",
-  ("old_space", 0x04215): "ArgumentsIteratorAccessor",
-  ("old_space", 0x04259): "ArrayLengthAccessor",
-  ("old_space", 0x0429d): "BoundFunctionLengthAccessor",
-  ("old_space", 0x042e1): "BoundFunctionNameAccessor",
-  ("old_space", 0x04325): "ErrorStackAccessor",
-  ("old_space", 0x04369): "FunctionArgumentsAccessor",
-  ("old_space", 0x043ad): "FunctionCallerAccessor",
-  ("old_space", 0x043f1): "FunctionNameAccessor",
-  ("old_space", 0x04435): "FunctionLengthAccessor",
-  ("old_space", 0x04479): "FunctionPrototypeAccessor",
-  ("old_space", 0x044bd): "StringLengthAccessor",
-  ("old_space", 0x04501): "WrappedFunctionLengthAccessor",
-  ("old_space", 0x04545): "WrappedFunctionNameAccessor",
-  ("old_space", 0x04589): "InvalidPrototypeValidityCell",
-  ("old_space", 0x04591): "EmptyScript",
-  ("old_space", 0x045d1): "ManyClosuresCell",
-  ("old_space", 0x045dd): "ArrayConstructorProtector",
-  ("old_space", 0x045f1): "NoElementsProtector",
-  ("old_space", 0x04605): "MegaDOMProtector",
-  ("old_space", 0x04619): "IsConcatSpreadableProtector",
-  ("old_space", 0x0462d): "ArraySpeciesProtector",
-  ("old_space", 0x04641): "TypedArraySpeciesProtector",
-  ("old_space", 0x04655): "PromiseSpeciesProtector",
-  ("old_space", 0x04669): "RegExpSpeciesProtector",
-  ("old_space", 0x0467d): "StringLengthProtector",
-  ("old_space", 0x04691): "ArrayIteratorProtector",
-  ("old_space", 0x046a5): "ArrayBufferDetachingProtector",
-  ("old_space", 0x046b9): "PromiseHookProtector",
-  ("old_space", 0x046cd): "PromiseResolveProtector",
-  ("old_space", 0x046e1): "MapIteratorProtector",
-  ("old_space", 0x046f5): "PromiseThenProtector",
-  ("old_space", 0x04709): "SetIteratorProtector",
-  ("old_space", 0x0471d): "StringIteratorProtector",
-  ("old_space", 0x04731): "SingleCharacterStringCache",
-  ("old_space", 0x04b39): "StringSplitCache",
-  ("old_space", 0x04f41): "RegExpMultipleCache",
-  ("old_space", 0x05349): "BuiltinsConstantsTable",
-  ("old_space", 0x05775): "AsyncFunctionAwaitRejectSharedFun",
-  ("old_space", 0x05799): "AsyncFunctionAwaitResolveSharedFun",
-  ("old_space", 0x057bd): "AsyncGeneratorAwaitRejectSharedFun",
-  ("old_space", 0x057e1): "AsyncGeneratorAwaitResolveSharedFun",
-  ("old_space", 0x05805): "AsyncGeneratorYieldResolveSharedFun",
-  ("old_space", 0x05829): "AsyncGeneratorReturnResolveSharedFun",
-  ("old_space", 0x0584d): "AsyncGeneratorReturnClosedRejectSharedFun",
-  ("old_space", 0x05871): "AsyncGeneratorReturnClosedResolveSharedFun",
-  ("old_space", 0x05895): "AsyncIteratorValueUnwrapSharedFun",
-  ("old_space", 0x058b9): "PromiseAllResolveElementSharedFun",
-  ("old_space", 0x058dd): "PromiseAllSettledResolveElementSharedFun",
-  ("old_space", 0x05901): "PromiseAllSettledRejectElementSharedFun",
-  ("old_space", 0x05925): "PromiseAnyRejectElementSharedFun",
-  ("old_space", 0x05949): "PromiseCapabilityDefaultRejectSharedFun",
-  ("old_space", 0x0596d): "PromiseCapabilityDefaultResolveSharedFun",
-  ("old_space", 0x05991): "PromiseCatchFinallySharedFun",
-  ("old_space", 0x059b5): "PromiseGetCapabilitiesExecutorSharedFun",
-  ("old_space", 0x059d9): "PromiseThenFinallySharedFun",
-  ("old_space", 0x059fd): "PromiseThrowerFinallySharedFun",
-  ("old_space", 0x05a21): "PromiseValueThunkFinallySharedFun",
-  ("old_space", 0x05a45): "ProxyRevokeSharedFun",
+  ("old_space", 0x0423d): "ArgumentsIteratorAccessor",
+  ("old_space", 0x04281): "ArrayLengthAccessor",
+  ("old_space", 0x042c5): "BoundFunctionLengthAccessor",
+  ("old_space", 0x04309): "BoundFunctionNameAccessor",
+  ("old_space", 0x0434d): "ErrorStackAccessor",
+  ("old_space", 0x04391): "FunctionArgumentsAccessor",
+  ("old_space", 0x043d5): "FunctionCallerAccessor",
+  ("old_space", 0x04419): "FunctionNameAccessor",
+  ("old_space", 0x0445d): "FunctionLengthAccessor",
+  ("old_space", 0x044a1): "FunctionPrototypeAccessor",
+  ("old_space", 0x044e5): "StringLengthAccessor",
+  ("old_space", 0x04529): "WrappedFunctionLengthAccessor",
+  ("old_space", 0x0456d): "WrappedFunctionNameAccessor",
+  ("old_space", 0x045b1): "InvalidPrototypeValidityCell",
+  ("old_space", 0x045b9): "EmptyScript",
+  ("old_space", 0x045f9): "ManyClosuresCell",
+  ("old_space", 0x04605): "ArrayConstructorProtector",
+  ("old_space", 0x04619): "NoElementsProtector",
+  ("old_space", 0x0462d): "MegaDOMProtector",
+  ("old_space", 0x04641): "IsConcatSpreadableProtector",
+  ("old_space", 0x04655): "ArraySpeciesProtector",
+  ("old_space", 0x04669): "TypedArraySpeciesProtector",
+  ("old_space", 0x0467d): "PromiseSpeciesProtector",
+  ("old_space", 0x04691): "RegExpSpeciesProtector",
+  ("old_space", 0x046a5): "StringLengthProtector",
+  ("old_space", 0x046b9): "ArrayIteratorProtector",
+  ("old_space", 0x046cd): "ArrayBufferDetachingProtector",
+  ("old_space", 0x046e1): "PromiseHookProtector",
+  ("old_space", 0x046f5): "PromiseResolveProtector",
+  ("old_space", 0x04709): "MapIteratorProtector",
+  ("old_space", 0x0471d): "PromiseThenProtector",
+  ("old_space", 0x04731): "SetIteratorProtector",
+  ("old_space", 0x04745): "StringIteratorProtector",
+  ("old_space", 0x04759): "SingleCharacterStringCache",
+  ("old_space", 0x04b61): "StringSplitCache",
+  ("old_space", 0x04f69): "RegExpMultipleCache",
+  ("old_space", 0x05371): "BuiltinsConstantsTable",
+  ("old_space", 0x0579d): "AsyncFunctionAwaitRejectSharedFun",
+  ("old_space", 0x057c1): "AsyncFunctionAwaitResolveSharedFun",
+  ("old_space", 0x057e5): "AsyncGeneratorAwaitRejectSharedFun",
+  ("old_space", 0x05809): "AsyncGeneratorAwaitResolveSharedFun",
+  ("old_space", 0x0582d): "AsyncGeneratorYieldResolveSharedFun",
+  ("old_space", 0x05851): "AsyncGeneratorReturnResolveSharedFun",
+  ("old_space", 0x05875): "AsyncGeneratorReturnClosedRejectSharedFun",
+  ("old_space", 0x05899): "AsyncGeneratorReturnClosedResolveSharedFun",
+  ("old_space", 0x058bd): "AsyncIteratorValueUnwrapSharedFun",
+  ("old_space", 0x058e1): "PromiseAllResolveElementSharedFun",
+  ("old_space", 0x05905): "PromiseAllSettledResolveElementSharedFun",
+  ("old_space", 0x05929): "PromiseAllSettledRejectElementSharedFun",
+  ("old_space", 0x0594d): "PromiseAnyRejectElementSharedFun",
+  ("old_space", 0x05971): "PromiseCapabilityDefaultRejectSharedFun",
+  ("old_space", 0x05995): "PromiseCapabilityDefaultResolveSharedFun",
+  ("old_space", 0x059b9): "PromiseCatchFinallySharedFun",
+  ("old_space", 0x059dd): "PromiseGetCapabilitiesExecutorSharedFun",
+  ("old_space", 0x05a01): "PromiseThenFinallySharedFun",
+  ("old_space", 0x05a25): "PromiseThrowerFinallySharedFun",
+  ("old_space", 0x05a49): "PromiseValueThunkFinallySharedFun",
+  ("old_space", 0x05a6d): "ProxyRevokeSharedFun",
 }
 
 # Lower 32 bits of first page addresses for various heap spaces.